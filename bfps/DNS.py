@@ -56,6 +56,7 @@ class DNS(_code):
                           'queue'       : '',
                           'mail_address': '',
                           'mail_events' : None}
+        self.backend = 'FFTW'
         self.generate_default_parameters()
         return None
     def set_precision(
@@ -107,29 +108,47 @@ class DNS(_code):
                     (getenv("BFPS_FPE_OFF") != std::string("TRUE")));
                 return main_code< {0} >(argc, argv, fpe);
             }}
-            """.format(self.dns_type + '<{0}>'.format(self.C_field_dtype))
+            """.format(self.dns_type + '<{0}>'.format(
+                self.C_field_dtype + ('' if self.backend == 'FFTW' else ', ' + self.backend)))
         self.includes = '\n'.join(
                 ['#include ' + hh
                  for hh in self.include_list])
         with open(self.name + '.cpp', 'w') as outfile:
             outfile.write(self.version_message + '\n\n')
             outfile.write(self.includes + '\n\n')
-            outfile.write(
-                    self.cread_pars(
-                       template_class = '{0}<rnumber>::'.format(self.dns_type),
-                        template_prefix = 'template <typename rnumber> ',
-                        simname_variable = 'this->simname.c_str()',
-                        prepend_this = True) +
-                    '\n\n')
-            for rnumber in ['float', 'double']:
+            # NSVE is also templated on the FFT backend, and the library
+            # instantiates it for every backend
+            if self.dns_type == 'NSVE':
+                template_args = ['<{0}, {1}>'.format(rnumber, backend)
+                                 for rnumber in ['float', 'double']
+                                 for backend in ['FFTW', 'PENCIL']]
+                outfile.write(
+                        self.cread_pars(
+                            template_class = 'NSVE<rnumber, be>::',
+                            template_prefix = 'template <typename rnumber, field_backend be> ',
+                            simname_variable = 'this->simname.c_str()',
+                            prepend_this = True) +
+                        '\n\n')
+            else:
+                template_args = ['<float>', '<double>']
+                outfile.write(
+                        self.cread_pars(
+                           template_class = '{0}<rnumber>::'.format(self.dns_type),
+                            template_prefix = 'template <typename rnumber> ',
+                            simname_variable = 'this->simname.c_str()',
+                            prepend_this = True) +
+                        '\n\n')
+            for targs in template_args:
                 outfile.write(self.cread_pars(
-                    template_class = '{0}<{1}>::'.format(self.dns_type, rnumber),
-                    template_prefix = 'template '.format(rnumber),
+                    template_class = '{0}{1}::'.format(self.dns_type, targs),
+                    template_prefix = 'template ',
                     just_declaration = True) + '\n\n')
             if self.dns_type in ['NSVEparticles', 'NSVE_no_output', 'NSVEparticles_no_output']:
-                outfile.write('template <typename rnumber> int NSVE<rnumber>::read_parameters(){return EXIT_SUCCESS;}\n')
-                outfile.write('template int NSVE<float>::read_parameters();\n')
-                outfile.write('template int NSVE<double>::read_parameters();\n\n')
+                outfile.write('template <typename rnumber, field_backend be> int NSVE<rnumber, be>::read_parameters(){return EXIT_SUCCESS;}\n')
+                for rnumber in ['float', 'double']:
+                    for backend in ['FFTW', 'PENCIL']:
+                        outfile.write('template int NSVE<{0}, {1}>::read_parameters();\n'.format(rnumber, backend))
+                outfile.write('\n')
             if self.dns_type in ['NSVEparticles_no_output']:
                 outfile.write('template <typename rnumber> int NSVEparticles<rnumber>::read_parameters(){return EXIT_SUCCESS;}\n')
                 outfile.write('template int NSVEparticles<float>::read_parameters();\n')
@@ -146,6 +165,11 @@ class DNS(_code):
         self.parameters['niter_stat'] = int(1)
         self.parameters['niter_out'] = int(8)
         self.parameters['checkpoints_per_file'] = int(1)
+        self.parameters['async_checkpoints'] = int(0)
+        self.parameters['io_collective'] = int(1)
+        self.parameters['io_chunked'] = int(1)
+        self.parameters['io_compression_level'] = int(0)
+        self.parameters['mpiio_hints'] = 'none'
         self.parameters['dt'] = float(0.01)
         self.parameters['nu'] = float(0.1)
         self.parameters['fmode'] = int(1)
@@ -154,8 +178,18 @@ class DNS(_code):
         self.parameters['fk1'] = float(4.0)
         self.parameters['forcing_type'] = 'linear'
         self.parameters['histogram_bins'] = int(256)
+        # a non-positive estimate makes the histograms span the actual range
+        # of values, with bin edges that change from one iteration to the next
         self.parameters['max_velocity_estimate'] = float(1)
         self.parameters['max_vorticity_estimate'] = float(1)
+        # quantiles cost an extra pass through a sketch for every grid point
+        self.parameters['compute_quantiles'] = int(0)
+        self.parameters['mixed_precision'] = int(0)
+        # pairs of vector fields share one FFT, at the cost of the memory
+        # of one more vector field
+        self.parameters['batched_transforms'] = int(0)
+        # process rows of the PENCIL backend, 0 picks the most square grid
+        self.parameters['pencil_process_rows'] = int(0)
         # parameters specific to particle version
         self.NSVEp_extra_parameters = {}
         self.NSVEp_extra_parameters['niter_part'] = int(1)
@@ -163,6 +197,8 @@ class DNS(_code):
         self.NSVEp_extra_parameters['tracers0_integration_steps'] = int(4)
         self.NSVEp_extra_parameters['tracers0_neighbours'] = int(1)
         self.NSVEp_extra_parameters['tracers0_smoothness'] = int(1)
+        self.NSVEp_extra_parameters['tracers0_cell_order'] = int(0)
+        self.NSVEp_extra_parameters['tracers0_exchange_mode'] = int(0)
         return None
     def get_kspace(self):
         kspace = {}
@@ -418,6 +454,12 @@ class DNS(_code):
                                                  self.parameters['histogram_bins'],
                                                  4),
                                      dtype = np.int64)
+                tools.create_rspace_stats_extra_datasets(
+                        ofile['statistics'],
+                        k,
+                        self.parameters['histogram_bins'],
+                        (4,),
+                        with_quantiles = bool(self.parameters['compute_quantiles']))
             ofile['checkpoint'] = int(0)
         if self.dns_type in ['NSVE', 'NSVE_no_output']:
             return None
@@ -523,6 +565,13 @@ class DNS(_code):
                 choices = ['single', 'double'],
                 type = str,
                 default = 'single')
+        parser.add_argument(
+                '--backend',
+                choices = ['FFTW', 'PENCIL'],
+                type = str,
+                default = 'FFTW',
+                help = ('FFTW slabs use at most nz processes, ' +
+                        'PENCIL decompositions also split the y direction'))
         parser.add_argument(
                 '--src-wd',
                 type = str,
@@ -652,7 +701,13 @@ class DNS(_code):
         opt = _code.prepare_launch(self, args = args)
         self.set_precision(opt.precision)
         self.dns_type = opt.DNS_class
+        self.backend = opt.backend
+        # only NSVE is templated on the backend, particles are distributed
+        # over z slabs only
+        assert(self.backend == 'FFTW' or self.dns_type == 'NSVE')
         self.name = self.dns_type + '-' + self.fluid_precision + '-v' + bfps.__version__
+        if self.backend != 'FFTW':
+            self.name += '-' + self.backend.lower()
         # merge parameters if needed
         if self.dns_type in ['NSVEparticles', 'NSVEparticles_no_output']:
             for k in self.NSVEp_extra_parameters.keys():
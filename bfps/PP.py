@@ -136,6 +136,8 @@ class PP(_code):
             dns_type = 'joint_acc_vel_stats'):
         pars = {}
         if dns_type == 'joint_acc_vel_stats':
+            # a non-positive estimate makes the histograms span the actual range
+            # of values, with bin edges that change from one iteration to the next
             pars['max_acceleration_estimate'] = float(10)
             pars['max_velocity_estimate'] = float(1)
             pars['histogram_bins'] = int(129)
@@ -704,6 +706,8 @@ class PP(_code):
                 else:
                     assert(histogram_bins ==
                            group['histograms/' + quantity].shape[1])
+                tools.create_rspace_stats_extra_datasets(
+                        group, quantity, histogram_bins, ())
                 if quantity not in group['moments'].keys():
                     time_chunk = 2**20 // (8*10)
                     time_chunk = max(time_chunk, 1)
@@ -734,6 +738,9 @@ class PP(_code):
                             chunks = (time_chunk, histogram_bins, histogram_bins),
                             maxshape = (None, histogram_bins, histogram_bins),
                             dtype = np.int64)
+                tools.create_rspace_stats_extra_datasets(
+                        group, 'acceleration_and_velocity', histogram_bins, (2, 4),
+                        with_quantiles = False)
             ncomps = 4
             for quantity in vec4_rspace_stats:
                 if quantity not in group['histograms'].keys():
@@ -745,6 +752,8 @@ class PP(_code):
                             chunks = (time_chunk, histogram_bins, ncomps),
                             maxshape = (None, histogram_bins, ncomps),
                             dtype = np.int64)
+                tools.create_rspace_stats_extra_datasets(
+                        group, quantity, histogram_bins, (ncomps,))
                 if quantity not in group['moments'].keys():
                     time_chunk = 2**20 // (8*10*ncomps)
                     time_chunk = max(time_chunk, 1)
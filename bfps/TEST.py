@@ -123,6 +123,14 @@ class TEST(_code):
         self.parameters['dky'] = float(1.0)
         self.parameters['dkz'] = float(1.0)
         self.parameters['filter_length'] = float(1.0)
+        self.parameters['nparticles'] = int(100000)
+        self.parameters['niterations'] = int(8)
+        self.parameters['max_neighbours'] = int(5)
+        self.parameters['compression_level'] = int(1)
+        self.parameters['histogram_bins'] = int(256)
+        self.parameters['mpiio_hints'] = 'none'
+        # process rows of the PENCIL backend, 0 picks the most square grid
+        self.parameters['pencil_process_rows'] = int(0)
         return None
     def get_kspace(self):
         kspace = {}
@@ -257,6 +265,66 @@ class TEST(_code):
         self.simulation_parser_arguments(parser_filter_test)
         self.job_parser_arguments(parser_filter_test)
         self.parameters_to_parser_arguments(parser_filter_test)
+        parser_particles_interpolation_benchmark = subparsers.add_parser(
+                'particles_interpolation_benchmark',
+                help = 'particle interpolation kernel benchmark')
+        self.simulation_parser_arguments(parser_particles_interpolation_benchmark)
+        self.job_parser_arguments(parser_particles_interpolation_benchmark)
+        self.parameters_to_parser_arguments(parser_particles_interpolation_benchmark)
+        parser_vorticity_equation_step_benchmark = subparsers.add_parser(
+                'vorticity_equation_step_benchmark',
+                help = 'timing of vorticity_equation::step')
+        self.simulation_parser_arguments(parser_vorticity_equation_step_benchmark)
+        self.job_parser_arguments(parser_vorticity_equation_step_benchmark)
+        self.parameters_to_parser_arguments(parser_vorticity_equation_step_benchmark)
+        parser_vorticity_equation_scaling_benchmark = subparsers.add_parser(
+                'vorticity_equation_scaling_benchmark',
+                help = 'strong scaling of vorticity_equation::step for FFTW slabs and PENCIL decompositions')
+        self.simulation_parser_arguments(parser_vorticity_equation_scaling_benchmark)
+        self.job_parser_arguments(parser_vorticity_equation_scaling_benchmark)
+        self.parameters_to_parser_arguments(parser_vorticity_equation_scaling_benchmark)
+        parser_vorticity_equation_mixed_precision_test = subparsers.add_parser(
+                'vorticity_equation_mixed_precision_test',
+                help = 'accuracy of mixed precision vorticity_equation steps')
+        self.simulation_parser_arguments(parser_vorticity_equation_mixed_precision_test)
+        self.job_parser_arguments(parser_vorticity_equation_mixed_precision_test)
+        self.parameters_to_parser_arguments(parser_vorticity_equation_mixed_precision_test)
+        parser_particles_redistribute_test = subparsers.add_parser(
+                'particles_redistribute_test',
+                help = 'particle redistribution stress test')
+        self.simulation_parser_arguments(parser_particles_redistribute_test)
+        self.job_parser_arguments(parser_particles_redistribute_test)
+        self.parameters_to_parser_arguments(parser_particles_redistribute_test)
+        parser_field_io_benchmark = subparsers.add_parser(
+                'field_io_benchmark',
+                help = 'bandwidth of HDF5 field I/O')
+        self.simulation_parser_arguments(parser_field_io_benchmark)
+        self.job_parser_arguments(parser_field_io_benchmark)
+        self.parameters_to_parser_arguments(parser_field_io_benchmark)
+        parser_shared_array_merge_benchmark = subparsers.add_parser(
+                'shared_array_merge_benchmark',
+                help = 'cost of merging per-thread shared_array copies')
+        self.simulation_parser_arguments(parser_shared_array_merge_benchmark)
+        self.job_parser_arguments(parser_shared_array_merge_benchmark)
+        self.parameters_to_parser_arguments(parser_shared_array_merge_benchmark)
+        parser_particles_memory_test = subparsers.add_parser(
+                'particles_memory_test',
+                help = 'memory use of particle communications over a long run')
+        self.simulation_parser_arguments(parser_particles_memory_test)
+        self.job_parser_arguments(parser_particles_memory_test)
+        self.parameters_to_parser_arguments(parser_particles_memory_test)
+        parser_spline_table_test = subparsers.add_parser(
+                'spline_table_test',
+                help = 'accuracy and throughput of the beta polynomial tables')
+        self.simulation_parser_arguments(parser_spline_table_test)
+        self.job_parser_arguments(parser_spline_table_test)
+        self.parameters_to_parser_arguments(parser_spline_table_test)
+        parser_kspace_test = subparsers.add_parser(
+                'kspace_test',
+                help = 'consistency of the per shell tables of kspace')
+        self.simulation_parser_arguments(parser_kspace_test)
+        self.job_parser_arguments(parser_kspace_test)
+        self.parameters_to_parser_arguments(parser_kspace_test)
         return None
     def prepare_launch(
             self,
@@ -169,6 +169,11 @@ class _code(_base):
                     global_timer_manager.show(MPI_COMM_WORLD);
                     global_timer_manager.showHtml(MPI_COMM_WORLD);
                     #endif
+                    #ifdef USE_TRACEOUTPUT
+                    global_event_tracer.write(
+                            MPI_COMM_WORLD,
+                            getenv("TRACEOUTPUT") ? getenv("TRACEOUTPUT") : simname + std::string("_trace"));
+                    #endif
                     MPI_Finalize();
                     return EXIT_SUCCESS;
                 }
@@ -430,6 +435,9 @@ class _code(_base):
                           ':${LD_LIBRARY_PATH}\n')
         script_file.write('echo "Start time is `date`"\n')
         script_file.write('export HTMLOUTPUT={}.html\n'.format(command_atoms[-1]))
+        script_file.write('export TRACEOUTPUT={}_trace\n'.format(command_atoms[-1]))
+        if 'BFPS_FFTW_WISDOM_DIR' in os.environ:
+            script_file.write('export BFPS_FFTW_WISDOM_DIR={}\n'.format(os.environ['BFPS_FFTW_WISDOM_DIR']))
         script_file.write('cd ' + self.work_dir + '\n')
 
         script_file.write('export KMP_AFFINITY=compact,verbose\n')
@@ -523,6 +531,9 @@ class _code(_base):
                           ':${LD_LIBRARY_PATH}\n')
         script_file.write('echo "Start time is `date`"\n')
         script_file.write('export HTMLOUTPUT={}.html\n'.format(command_atoms[-1]))
+        script_file.write('export TRACEOUTPUT={}_trace\n'.format(command_atoms[-1]))
+        if 'BFPS_FFTW_WISDOM_DIR' in os.environ:
+            script_file.write('export BFPS_FFTW_WISDOM_DIR={}\n'.format(os.environ['BFPS_FFTW_WISDOM_DIR']))
         script_file.write('cd ' + self.work_dir + '\n')
 
         script_file.write('export KMP_AFFINITY=compact,verbose\n')
@@ -652,6 +663,9 @@ class _code(_base):
         script_file.write('echo "Start time is `date`"\n')
         script_file.write('cd ' + self.work_dir + '\n')
         script_file.write('export HTMLOUTPUT={}.html\n'.format(command_atoms[-1]))
+        script_file.write('export TRACEOUTPUT={}_trace\n'.format(command_atoms[-1]))
+        if 'BFPS_FFTW_WISDOM_DIR' in os.environ:
+            script_file.write('export BFPS_FFTW_WISDOM_DIR={}\n'.format(os.environ['BFPS_FFTW_WISDOM_DIR']))
         script_file.write('srun {0}\n'.format(' '.join(command_atoms)))
         script_file.write('echo "End time is `date`"\n')
         script_file.write('exit 0\n')
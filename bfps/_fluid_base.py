@@ -252,10 +252,7 @@ class _fluid_particle_base(_code):
             self.main       += '{\n'
 
             self.main       += """
-                                #ifdef USE_TIMINGOUTPUT
-                                const std::string loopLabel = "code::main_start::loop-" + std::to_string(iteration);
-                                TIMEZONE(loopLabel.c_str());
-                                #endif
+                                TIMEZONE("code::main_start::loop");
                                 """
             self.main       += 'if (iteration % niter_stat == 0) do_stats();\n'
             if self.particle_species > 0:
@@ -271,10 +268,7 @@ class _fluid_particle_base(_code):
             self.main       += 'for (int frame_index = iter0; frame_index <= iter1; frame_index += niter_out)\n'
             self.main       += '{\n'
             self.main       += """
-                                #ifdef USE_TIMINGOUTPUT
-                                const std::string loopLabel = "code::main_start::loop-" + std::to_string(frame_index);
-                                TIMEZONE(loopLabel.c_str());
-                                #endif
+                                TIMEZONE("code::main_start::loop");
                                 """
             if self.particle_species > 0:
                 self.main   += self.particle_loop
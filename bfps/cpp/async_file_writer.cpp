@@ -0,0 +1,87 @@
+#include <cstring>
+#include <algorithm>
+#include <cassert>
+#include "async_file_writer.hpp"
+#include "scope_timer.hpp"
+
+async_file_writer::~async_file_writer()
+{
+    this->fence();
+}
+
+int async_file_writer::start_write(
+        const MPI_Comm comm,
+        const std::string fname,
+        const std::vector<block> &blocks)
+{
+    TIMEZONE("async_file_writer::start_write");
+    pending_file pf;
+    int err = MPI_File_open(
+            comm,
+            const_cast<char*>(fname.c_str()),
+            MPI_MODE_WRONLY,
+            MPI_INFO_NULL,
+            &pf.fh);
+    if (err != MPI_SUCCESS)
+    {
+        DEBUG_MSG("async_file_writer could not open %s\n", fname.c_str());
+        return EXIT_FAILURE;
+    }
+    /* individual requests are limited to int counts */
+    const size_t max_request_size = size_t(1) << 30;
+    for (auto bb: blocks)
+    {
+        if (bb.nbytes == 0)
+            continue;
+        std::vector<char> buffer;
+        {
+            TIMEZONE("async_file_writer::stage");
+            /* reuse the smallest spare buffer that is large enough */
+            auto spare = this->spare_buffers.end();
+            for (auto sb = this->spare_buffers.begin(); sb != this->spare_buffers.end(); sb++)
+                if (sb->size() >= bb.nbytes &&
+                    (spare == this->spare_buffers.end() || sb->size() < spare->size()))
+                    spare = sb;
+            if (spare != this->spare_buffers.end())
+            {
+                buffer.swap(*spare);
+                this->spare_buffers.erase(spare);
+            }
+            else
+                buffer.resize(bb.nbytes);
+            std::memcpy(buffer.data(), bb.data, bb.nbytes);
+        }
+        for (size_t start = 0; start < bb.nbytes; start += max_request_size)
+        {
+            pf.requests.emplace_back();
+            MPI_File_iwrite_at(
+                    pf.fh,
+                    bb.offset + MPI_Offset(start),
+                    buffer.data() + start,
+                    int(std::min(max_request_size, bb.nbytes - start)),
+                    MPI_BYTE,
+                    &pf.requests.back());
+        }
+        pf.buffers.push_back(std::move(buffer));
+    }
+    this->pending_files.push_back(std::move(pf));
+    return EXIT_SUCCESS;
+}
+
+int async_file_writer::fence()
+{
+    if (this->pending_files.empty())
+        return EXIT_SUCCESS;
+    TIMEZONE("async_file_writer::fence");
+    for (auto &pf: this->pending_files)
+    {
+        MPI_Waitall(pf.requests.size(), pf.requests.data(), MPI_STATUSES_IGNORE);
+        /* collective */
+        MPI_File_close(&pf.fh);
+        for (auto &buffer: pf.buffers)
+            this->spare_buffers.push_back(std::move(buffer));
+    }
+    this->pending_files.clear();
+    return EXIT_SUCCESS;
+}
+
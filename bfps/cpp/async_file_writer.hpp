@@ -0,0 +1,94 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#ifndef ASYNC_FILE_WRITER_HPP
+#define ASYNC_FILE_WRITER_HPP
+
+#include <mpi.h>
+#include <string>
+#include <vector>
+#include "base.hpp"
+
+/** \class async_file_writer
+ *  \brief Writes raw data into existing files in the background.
+ *
+ *  The data is first copied into staging buffers owned by the writer, and
+ *  then written with nonblocking MPI-IO, so the caller may modify its arrays
+ *  as soon as `start_write` returns. `fence` waits for all pending writes and
+ *  closes the files.
+ *  The typical use is to create (HDF5) datasets with contiguous storage that
+ *  is allocated early, get their offsets in the file, close the file, and
+ *  then give the raw data to the writer.
+ *  While writes are pending, other MPI-IO handles may be opened on the same
+ *  file (e.g. by HDF5), provided they never touch the same bytes.
+ */
+
+class async_file_writer
+{
+    public:
+        /* one contiguous piece of data, to be written at `offset` (in bytes) */
+        struct block
+        {
+            MPI_Offset offset;
+            const void *data;
+            size_t nbytes;
+        };
+
+    private:
+        struct pending_file
+        {
+            MPI_File fh;
+            std::vector<MPI_Request> requests;
+            std::vector<std::vector<char>> buffers;
+        };
+        std::vector<pending_file> pending_files;
+        /* buffers of completed writes, kept to avoid reallocating them */
+        std::vector<std::vector<char>> spare_buffers;
+
+    public:
+        async_file_writer(){}
+        ~async_file_writer();
+
+        /* copy the blocks into staging buffers and start writing them.
+         * collective on `comm`, since the file is opened on `comm`.
+         * */
+        int start_write(
+                const MPI_Comm comm,
+                const std::string fname,
+                const std::vector<block> &blocks);
+
+        /* wait until all pending writes are done, close the files. */
+        int fence();
+
+        inline bool has_pending_writes() const
+        {
+            return !this->pending_files.empty();
+        }
+};
+
+#endif//ASYNC_FILE_WRITER_HPP
+
@@ -25,6 +25,7 @@
 #ifndef FFTW_INTERFACE_HPP
 #define FFTW_INTERFACE_HPP
 
+#include <cstdio>
 #include <fftw3-mpi.h>
 
 #ifdef USE_FFTWESTIMATE
@@ -86,6 +87,20 @@ public:
         return fftwf_plan_guru_dft(params...);
     }
 
+    template <class ... Params>
+    static plan plan_guru_dft_r2c(Params ... params){
+        return fftwf_plan_guru_dft_r2c(params...);
+    }
+
+    template <class ... Params>
+    static plan plan_guru_dft_c2r(Params ... params){
+        return fftwf_plan_guru_dft_c2r(params...);
+    }
+
+    static void execute_dft(plan in_plan, complex* in, complex* out){
+        fftwf_execute_dft(in_plan, in, out);
+    }
+
     template <class ... Params>
     static plan mpi_plan_many_dft_c2r(Params ... params){
         return fftwf_mpi_plan_many_dft_c2r(params...);
@@ -100,6 +115,26 @@ public:
     static plan mpi_plan_dft_c2r_3d(Params ... params){
         return fftwf_mpi_plan_dft_c2r_3d(params...);
     }
+
+    static int import_wisdom_from_filename(const char* filename){
+        return fftwf_import_wisdom_from_filename(filename);
+    }
+
+    static char* export_wisdom_to_string(){
+        return fftwf_export_wisdom_to_string();
+    }
+
+    static void export_wisdom_to_file(FILE* output_file){
+        fftwf_export_wisdom_to_file(output_file);
+    }
+
+    static void mpi_broadcast_wisdom(MPI_Comm comm){
+        fftwf_mpi_broadcast_wisdom(comm);
+    }
+
+    static void mpi_gather_wisdom(MPI_Comm comm){
+        fftwf_mpi_gather_wisdom(comm);
+    }
 };
 
 template <>
@@ -151,6 +186,20 @@ public:
         return fftw_plan_guru_dft(params...);
     }
 
+    template <class ... Params>
+    static plan plan_guru_dft_r2c(Params ... params){
+        return fftw_plan_guru_dft_r2c(params...);
+    }
+
+    template <class ... Params>
+    static plan plan_guru_dft_c2r(Params ... params){
+        return fftw_plan_guru_dft_c2r(params...);
+    }
+
+    static void execute_dft(plan in_plan, complex* in, complex* out){
+        fftw_execute_dft(in_plan, in, out);
+    }
+
     template <class ... Params>
     static plan mpi_plan_many_dft_c2r(Params ... params){
         return fftw_mpi_plan_many_dft_c2r(params...);
@@ -165,6 +214,26 @@ public:
     static plan mpi_plan_dft_c2r_3d(Params ... params){
         return fftw_mpi_plan_dft_c2r_3d(params...);
     }
+
+    static int import_wisdom_from_filename(const char* filename){
+        return fftw_import_wisdom_from_filename(filename);
+    }
+
+    static char* export_wisdom_to_string(){
+        return fftw_export_wisdom_to_string();
+    }
+
+    static void export_wisdom_to_file(FILE* output_file){
+        fftw_export_wisdom_to_file(output_file);
+    }
+
+    static void mpi_broadcast_wisdom(MPI_Comm comm){
+        fftw_mpi_broadcast_wisdom(comm);
+    }
+
+    static void mpi_gather_wisdom(MPI_Comm comm){
+        fftw_mpi_gather_wisdom(comm);
+    }
 };
 
 
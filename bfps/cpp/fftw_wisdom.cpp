@@ -0,0 +1,218 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <omp.h>
+#include <hdf5.h>
+#include "fftw_wisdom.hpp"
+#include "scope_timer.hpp"
+
+int fftw_planning_statistics::plans_created = 0;
+double fftw_planning_statistics::planning_time = 0;
+double fftw_planning_statistics::allocation_time = 0;
+double fftw_planning_statistics::wisdom_import_time = 0;
+
+/* cache file names and wisdom as imported, for float and double; only
+ * meaningful on rank 0 */
+static std::string wisdom_file_name[2];
+static std::string imported_wisdom[2];
+
+static std::string get_rigor_name(const unsigned rigor)
+{
+    if (rigor & FFTW_ESTIMATE)
+        return "estimate";
+    if (rigor & FFTW_EXHAUSTIVE)
+        return "exhaustive";
+    if (rigor & FFTW_PATIENT)
+        return "patient";
+    return "measure";
+}
+
+static std::string get_grid_name(const std::string simname)
+{
+    const std::string fname = simname + std::string(".h5");
+    struct stat file_buffer;
+    if (stat(fname.c_str(), &file_buffer) != 0)
+        return "anygrid";
+    hid_t parameter_file = H5Fopen(fname.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (parameter_file < 0)
+        return "anygrid";
+    std::string grid_name = "anygrid";
+    if (H5Lexists(parameter_file, "parameters", H5P_DEFAULT) &&
+        H5Lexists(parameter_file, "/parameters/nx", H5P_DEFAULT) &&
+        H5Lexists(parameter_file, "/parameters/ny", H5P_DEFAULT) &&
+        H5Lexists(parameter_file, "/parameters/nz", H5P_DEFAULT))
+    {
+        int n[3];
+        const char *dset_name[3] = {"/parameters/nx", "/parameters/ny", "/parameters/nz"};
+        for (int i=0; i<3; i++)
+        {
+            hid_t dset = H5Dopen(parameter_file, dset_name[i], H5P_DEFAULT);
+            H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, n + i);
+            H5Dclose(dset);
+        }
+        grid_name = (std::to_string(n[0]) + "x" +
+                     std::to_string(n[1]) + "x" +
+                     std::to_string(n[2]));
+    }
+    H5Fclose(parameter_file);
+    return grid_name;
+}
+
+template <typename rnumber>
+static void import_wisdom(
+        const int precision_index,
+        const MPI_Comm comm)
+{
+    int myrank;
+    MPI_Comm_rank(comm, &myrank);
+    if (myrank == 0)
+    {
+        /* a missing file is not an error, the cache is then created at the
+         * end of the run */
+        fftw_interface<rnumber>::import_wisdom_from_filename(
+                wisdom_file_name[precision_index].c_str());
+        char *wisdom = fftw_interface<rnumber>::export_wisdom_to_string();
+        if (wisdom != nullptr)
+        {
+            imported_wisdom[precision_index] = wisdom;
+            free(wisdom);
+        }
+    }
+    fftw_interface<rnumber>::mpi_broadcast_wisdom(comm);
+}
+
+template <typename rnumber>
+static int export_wisdom(
+        const int precision_index,
+        const MPI_Comm comm)
+{
+    int myrank;
+    MPI_Comm_rank(comm, &myrank);
+    fftw_interface<rnumber>::mpi_gather_wisdom(comm);
+    if (myrank != 0)
+        return EXIT_SUCCESS;
+    char *wisdom = fftw_interface<rnumber>::export_wisdom_to_string();
+    if (wisdom == nullptr)
+        return EXIT_FAILURE;
+    const bool new_plans = (imported_wisdom[precision_index] != wisdom);
+    free(wisdom);
+    if (!new_plans)
+        return EXIT_SUCCESS;
+    /* write to a temporary file first, so that runs sharing the cache never
+     * read a partially written file */
+    const std::string tmp_name = (
+            wisdom_file_name[precision_index] +
+            std::string(".") +
+            std::to_string(getpid()));
+    FILE *output_file = fopen(tmp_name.c_str(), "w");
+    if (output_file == nullptr)
+    {
+        std::cerr << "could not write FFTW wisdom to " << tmp_name << std::endl;
+        return EXIT_FAILURE;
+    }
+    fftw_interface<rnumber>::export_wisdom_to_file(output_file);
+    fclose(output_file);
+    if (rename(tmp_name.c_str(), wisdom_file_name[precision_index].c_str()) != 0)
+    {
+        std::cerr << "could not write FFTW wisdom to " <<
+                     wisdom_file_name[precision_index] << std::endl;
+        remove(tmp_name.c_str());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+int import_fftw_wisdom(
+        const std::string simname,
+        const MPI_Comm comm)
+{
+    TIMEZONE("import_fftw_wisdom");
+    const double time_start = MPI_Wtime();
+    int myrank, nprocs;
+    MPI_Comm_rank(comm, &myrank);
+    MPI_Comm_size(comm, &nprocs);
+    if (myrank == 0)
+    {
+#ifdef NO_FFTWOMP
+        const int nthreads = 1;
+#else
+        const int nthreads = omp_get_max_threads();
+#endif
+        std::string directory = ".";
+        if (getenv("BFPS_FFTW_WISDOM_DIR") != nullptr)
+        {
+            directory = getenv("BFPS_FFTW_WISDOM_DIR");
+            // the parent directory must exist, errors show up on export
+            mkdir(directory.c_str(), 0755);
+        }
+        const std::string key = (
+                get_grid_name(simname) +
+                std::string("_np") + std::to_string(nprocs) +
+                std::string("_nt") + std::to_string(nthreads) +
+                std::string("_") + get_rigor_name(DEFAULT_FFTW_FLAG));
+        wisdom_file_name[0] = directory + std::string("/fftw_wisdom_float_") + key + std::string(".txt");
+        wisdom_file_name[1] = directory + std::string("/fftw_wisdom_double_") + key + std::string(".txt");
+    }
+    import_wisdom<float>(0, comm);
+    import_wisdom<double>(1, comm);
+    fftw_planning_statistics::wisdom_import_time += MPI_Wtime() - time_start;
+    return EXIT_SUCCESS;
+}
+
+int export_fftw_wisdom(const MPI_Comm comm)
+{
+    TIMEZONE("export_fftw_wisdom");
+    const int float_result = export_wisdom<float>(0, comm);
+    const int double_result = export_wisdom<double>(1, comm);
+    if (float_result != EXIT_SUCCESS || double_result != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
+
+void report_fftw_planning_statistics(const MPI_Comm comm)
+{
+    int myrank;
+    MPI_Comm_rank(comm, &myrank);
+    double local_times[3] = {
+            fftw_planning_statistics::wisdom_import_time,
+            fftw_planning_statistics::allocation_time,
+            fftw_planning_statistics::planning_time};
+    double times[3];
+    MPI_Reduce(local_times, times, 3, MPI_DOUBLE, MPI_MAX, 0, comm);
+    if (myrank == 0)
+        std::cout << "FFTW startup: wisdom import " << times[0] <<
+                     " s, field allocation " << times[1] <<
+                     " s, creation of " << fftw_planning_statistics::plans_created <<
+                     " plans " << times[2] << " s" << std::endl;
+}
+
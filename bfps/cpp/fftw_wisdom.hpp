@@ -0,0 +1,72 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#include <string>
+#include <mpi.h>
+#include "fftw_interface.hpp"
+
+#ifndef FFTW_WISDOM_HPP
+
+#define FFTW_WISDOM_HPP
+
+/** \brief Cache of FFTW wisdom, shared between runs.
+ *
+ *  Wisdom depends on the grid, the number of processes, the number of threads
+ *  and the planning rigor, so it is kept in one file per precision and per
+ *  combination of these, named e.g.
+ *  `fftw_wisdom_double_1024x1024x1024_np64_nt8_patient.txt`, in the directory
+ *  given by the `BFPS_FFTW_WISDOM_DIR` environment variable (the current
+ *  directory if it is not set).
+ *  The wisdom is read by rank 0 and broadcast, and it is only written back
+ *  if plans that were not in the cache have been created.
+ */
+
+class fftw_planning_statistics
+{
+    public:
+        static int plans_created;         /**< FFTW plans created by field constructors. */
+        static double planning_time;      /**< seconds spent creating these plans. */
+        static double allocation_time;    /**< seconds spent allocating field data. */
+        static double wisdom_import_time; /**< seconds spent reading and broadcasting wisdom. */
+};
+
+/* import the cached wisdom of both precisions; the grid size is read from
+ * the parameters in `<simname>.h5`. */
+int import_fftw_wisdom(
+        const std::string simname,
+        const MPI_Comm comm);
+
+/* gather the wisdom of all processes, and update the cache files if it
+ * contains new plans. */
+int export_fftw_wisdom(const MPI_Comm comm);
+
+/* print on rank 0 of `comm` the time spent importing wisdom, allocating field
+ * data and creating plans (maximum over processes). */
+void report_fftw_planning_statistics(const MPI_Comm comm);
+
+#endif//FFTW_WISDOM_HPP
+
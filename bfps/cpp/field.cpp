@@ -28,9 +28,162 @@
 #include <cstdlib>
 #include <algorithm>
 #include <cassert>
+#include <limits>
+#include <vector>
 #include "field.hpp"
+#include "fftw_wisdom.hpp"
 #include "scope_timer.hpp"
 #include "shared_array.hpp"
+#include "hdf5_tools.hpp"
+#include "quantile_sketch.hpp"
+
+
+field_io_parameters field_io_settings = {true, true, 0, MPI_INFO_NULL};
+
+static int read_optional_int_parameter(
+        const hid_t parameter_file,
+        const std::string dset_name,
+        int &value)
+{
+    if (!H5Lexists(parameter_file, dset_name.c_str(), H5P_DEFAULT))
+        return EXIT_FAILURE;
+    hid_t dset = H5Dopen(parameter_file, dset_name.c_str(), H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &value);
+    H5Dclose(dset);
+    return EXIT_SUCCESS;
+}
+
+int read_field_io_parameters(
+        const std::string fname,
+        const MPI_Comm comm)
+{
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    struct stat file_buffer;
+    if (stat(fname.c_str(), &file_buffer) != 0)
+        return EXIT_SUCCESS;
+    hid_t parameter_file = H5Fopen(fname.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (parameter_file < 0)
+        return EXIT_FAILURE;
+    std::string hints = "none";
+    if (H5Lexists(parameter_file, "parameters", H5P_DEFAULT))
+    {
+        int value;
+        if (read_optional_int_parameter(parameter_file, "/parameters/io_collective", value) == EXIT_SUCCESS)
+            field_io_settings.collective = (value != 0);
+        if (read_optional_int_parameter(parameter_file, "/parameters/io_chunked", value) == EXIT_SUCCESS)
+            field_io_settings.chunked = (value != 0);
+        if (read_optional_int_parameter(parameter_file, "/parameters/io_compression_level", value) == EXIT_SUCCESS)
+            field_io_settings.compression_level = std::max(0, std::min(9, value));
+        if (H5Lexists(parameter_file, "/parameters/mpiio_hints", H5P_DEFAULT))
+            hints = hdf5_tools::read_string(parameter_file, "/parameters/mpiio_hints");
+    }
+    H5Fclose(parameter_file);
+
+    if (field_io_settings.compression_level > 0)
+    {
+        /* parallel writes through filters are only possible since HDF5 1.10.2,
+         * and only with collective transfers into chunked datasets */
+#if H5_VERSION_GE(1, 10, 2)
+        if (!H5Zfilter_avail(H5Z_FILTER_DEFLATE))
+        {
+            if (rank == 0)
+                std::cerr << "HDF5 was built without deflate, "
+                             "field compression is turned off." << std::endl;
+            field_io_settings.compression_level = 0;
+        }
+        else if (!(field_io_settings.collective && field_io_settings.chunked))
+        {
+            if (rank == 0)
+                std::cerr << "field compression requires collective I/O "
+                             "into chunked datasets, turning both on." << std::endl;
+            field_io_settings.collective = true;
+            field_io_settings.chunked = true;
+        }
+#else
+        if (rank == 0)
+            std::cerr << "parallel HDF5 compression requires HDF5 1.10.2, "
+                         "field compression is turned off." << std::endl;
+        field_io_settings.compression_level = 0;
+#endif
+    }
+    return set_field_io_hints(hints, comm);
+}
+
+int set_field_io_hints(
+        const std::string hints,
+        const MPI_Comm comm)
+{
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    if (field_io_settings.hints != MPI_INFO_NULL)
+        MPI_Info_free(&field_io_settings.hints);
+    if (hints.size() == 0 || hints == "none")
+        return EXIT_SUCCESS;
+    MPI_Info_create(&field_io_settings.hints);
+    size_t token_start = 0;
+    while (token_start < hints.size())
+    {
+        size_t token_end = hints.find(',', token_start);
+        if (token_end == std::string::npos)
+            token_end = hints.size();
+        const std::string token = hints.substr(token_start, token_end - token_start);
+        const size_t separator = token.find('=');
+        if (separator == std::string::npos || separator == 0)
+        {
+            if (rank == 0 && token.size() > 0)
+                std::cerr << "ignoring malformed MPI-IO hint \"" << token << "\"" << std::endl;
+        }
+        else
+            MPI_Info_set(
+                    field_io_settings.hints,
+                    token.substr(0, separator).c_str(),
+                    token.substr(separator + 1).c_str());
+        token_start = token_end + 1;
+    }
+    return EXIT_SUCCESS;
+}
+
+void clear_field_io_parameters()
+{
+    if (field_io_settings.hints != MPI_INFO_NULL)
+        MPI_Info_free(&field_io_settings.hints);
+}
+
+/* transfer properties for field data, according to `field_io_settings` */
+static hid_t field_io_transfer_properties()
+{
+    hid_t dxpl_id = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_dxpl_mpio(
+            dxpl_id,
+            field_io_settings.collective ? H5FD_MPIO_COLLECTIVE : H5FD_MPIO_INDEPENDENT);
+    return dxpl_id;
+}
+
+/* creation properties for a field dataset of shape `dims`, where
+ * `dims[slab_dim]` is the direction of the slab decomposition. */
+static hid_t field_io_creation_properties(
+        const int ndims,
+        const hsize_t *dims,
+        const int slab_dim,
+        const bool compress)
+{
+    hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+    if (!field_io_settings.chunked)
+        return dcpl_id;
+    std::vector<hsize_t> chunk(dims, dims + ndims);
+    for (int i=0; i<=slab_dim; i++)
+        chunk[i] = 1;
+    H5Pset_chunk(dcpl_id, ndims, &chunk.front());
+    /* every chunk is written as a whole by the process owning that plane */
+    H5Pset_fill_time(dcpl_id, H5D_FILL_TIME_NEVER);
+    if (compress && field_io_settings.compression_level > 0)
+    {
+        H5Pset_shuffle(dcpl_id);
+        H5Pset_deflate(dcpl_id, field_io_settings.compression_level);
+    }
+    return dcpl_id;
+}
 
 
 
@@ -51,6 +204,7 @@ field<rnumber, be, fc>::field(
 
     this->fftw_plan_rigor = FFTW_PLAN_RIGOR;
     this->real_space_representation = true;
+    this->symmetrize_buffer = nullptr;
 
     /* generate HDF5 data types */
     if (typeid(rnumber) == typeid(float))
@@ -68,7 +222,48 @@ field<rnumber, be, fc>::field(
     /* switch on backend */
     switch(be)
     {
+        case PENCIL:
+        {
+            this->decomposition = new pencil_decomposition(
+                    nx, ny, nz, this->comm);
+            const pencil_decomposition *dd = this->decomposition;
+            hsize_t sizes[3], subsizes[3], starts[3];
+            sizes[0] = nz; sizes[1] = ny; sizes[2] = nx;
+            subsizes[0] = dd->z_size[dd->row]; subsizes[1] = dd->y_size[dd->col]; subsizes[2] = nx;
+            starts[0] = dd->z_start[dd->row]; starts[1] = dd->y_start[dd->col]; starts[2] = 0;
+            this->rlayout = new field_layout<fc>(
+                    sizes, subsizes, starts, this->comm);
+            this->npoints = this->rlayout->full_size / ncomp(fc);
+            sizes[2] = dd->padded_nx;
+            subsizes[2] = dd->padded_nx;
+            this->rmemlayout = new field_layout<fc>(
+                    sizes, subsizes, starts, this->comm);
+            sizes[0] = ny; sizes[1] = nz; sizes[2] = nx/2+1;
+            subsizes[0] = dd->ky_size[dd->row]; subsizes[1] = nz; subsizes[2] = dd->kx_size[dd->col];
+            starts[0] = dd->ky_start[dd->row]; starts[1] = 0; starts[2] = dd->kx_start[dd->col];
+            this->clayout = new field_layout<fc>(
+                    sizes, subsizes, starts, this->comm);
+            /* the padding of the x lines makes room for the Fourier space
+             * representation */
+            assert(this->rmemlayout->local_size >= 2*this->clayout->local_size);
+            double time_start = MPI_Wtime();
+            this->data = fftw_interface<rnumber>::alloc_real(
+                    this->rmemlayout->local_size);
+            memset(this->data, 0, sizeof(rnumber)*this->rmemlayout->local_size);
+            fftw_planning_statistics::allocation_time += MPI_Wtime() - time_start;
+            time_start = MPI_Wtime();
+            this->pencil_transforms = new pencil_fft<rnumber>(
+                    this->decomposition,
+                    ncomp(fc),
+                    this->data,
+                    this->fftw_plan_rigor);
+            fftw_planning_statistics::planning_time += MPI_Wtime() - time_start;
+            fftw_planning_statistics::plans_created += 6;
+            break;
+        }
         case FFTW:
+            this->decomposition = nullptr;
+            this->pencil_transforms = nullptr;
             ptrdiff_t nfftw[3];
             nfftw[0] = nz;
             nfftw[1] = ny;
@@ -99,9 +294,12 @@ field<rnumber, be, fc>::field(
             starts[0] = local_1_start; starts[1] = 0; starts[2] = 0;
             this->clayout = new field_layout<fc>(
                     sizes, subsizes, starts, this->comm);
+            double time_start = MPI_Wtime();
             this->data = fftw_interface<rnumber>::alloc_real(
                     this->rmemlayout->local_size);
             memset(this->data, 0, sizeof(rnumber)*this->rmemlayout->local_size);
+            fftw_planning_statistics::allocation_time += MPI_Wtime() - time_start;
+            time_start = MPI_Wtime();
             this->c2r_plan = fftw_interface<rnumber>::mpi_plan_many_dft_c2r(
                     3, nfftw, ncomp(fc),
                     FFTW_MPI_DEFAULT_BLOCK, FFTW_MPI_DEFAULT_BLOCK,
@@ -116,6 +314,8 @@ field<rnumber, be, fc>::field(
                     (typename fftw_interface<rnumber>::complex*)this->data,
                     this->comm,
                     this->fftw_plan_rigor | FFTW_MPI_TRANSPOSED_OUT);
+            fftw_planning_statistics::planning_time += MPI_Wtime() - time_start;
+            fftw_planning_statistics::plans_created += 2;
             break;
     }
 }
@@ -135,9 +335,21 @@ field<rnumber, be, fc>::~field()
             delete this->rmemlayout;
             delete this->clayout;
             fftw_interface<rnumber>::free(this->data);
+            if (this->symmetrize_buffer != nullptr)
+                fftw_interface<rnumber>::free(this->symmetrize_buffer);
             fftw_interface<rnumber>::destroy_plan(this->c2r_plan);
             fftw_interface<rnumber>::destroy_plan(this->r2c_plan);
             break;
+        case PENCIL:
+            delete this->rlayout;
+            delete this->rmemlayout;
+            delete this->clayout;
+            delete this->pencil_transforms;
+            delete this->decomposition;
+            fftw_interface<rnumber>::free(this->data);
+            if (this->symmetrize_buffer != nullptr)
+                fftw_interface<rnumber>::free(this->symmetrize_buffer);
+            break;
     }
 }
 
@@ -147,7 +359,15 @@ template <typename rnumber,
 void field<rnumber, be, fc>::ift()
 {
     TIMEZONE("field::ift");
-    fftw_interface<rnumber>::execute(this->c2r_plan);
+    switch(be)
+    {
+        case FFTW:
+            fftw_interface<rnumber>::execute(this->c2r_plan);
+            break;
+        case PENCIL:
+            this->pencil_transforms->c2r();
+            break;
+    }
     this->real_space_representation = true;
 }
 
@@ -157,7 +377,15 @@ template <typename rnumber,
 void field<rnumber, be, fc>::dft()
 {
     TIMEZONE("field::dft");
-    fftw_interface<rnumber>::execute(this->r2c_plan);
+    switch(be)
+    {
+        case FFTW:
+            fftw_interface<rnumber>::execute(this->r2c_plan);
+            break;
+        case PENCIL:
+            this->pencil_transforms->r2c();
+            break;
+    }
     this->real_space_representation = false;
 }
 
@@ -184,7 +412,7 @@ int field<rnumber, be, fc>::io(
 
     /* open/create file */
     plist_id = H5Pcreate(H5P_FILE_ACCESS);
-    H5Pset_fapl_mpio(plist_id, this->comm, MPI_INFO_NULL);
+    H5Pset_fapl_mpio(plist_id, this->comm, field_io_settings.hints);
     bool file_exists = false;
     {
         struct stat file_buffer;
@@ -289,18 +517,24 @@ int field<rnumber, be, fc>::io(
                     ndim(fc),
                     dims,
                     NULL);
-            /* chunking needs to go in here */
+            hid_t dcpl_id = field_io_creation_properties(
+                    ndim(fc),
+                    dims,
+                    0,
+                    this->real_space_representation);
             dset_id = H5Dcreate(
                     file_id,
                     dset_name.c_str(),
                     (this->real_space_representation ? this->rnumber_H5T : this->cnumber_H5T),
                     fspace,
                     H5P_DEFAULT,
-                    H5P_DEFAULT,
+                    dcpl_id,
                     H5P_DEFAULT);
+            H5Pclose(dcpl_id);
         }
     }
     /* both dset_id and fspace should now have sane values */
+    hid_t dxpl_id = field_io_transfer_properties();
 
     /* check file space */
     int ndims_fspace = H5Sget_simple_extent_dims(fspace, dims, NULL);
@@ -316,12 +550,12 @@ int field<rnumber, be, fc>::io(
         if (read)
         {
             std::fill_n(this->data, this->rmemlayout->local_size, 0);
-            H5Dread(dset_id, this->rnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dread(dset_id, this->rnumber_H5T, mspace, fspace, dxpl_id, this->data);
         }
         else
         {
             assert(this->real_space_representation);
-            H5Dwrite(dset_id, this->rnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dwrite(dset_id, this->rnumber_H5T, mspace, fspace, dxpl_id, this->data);
         }
         H5Sclose(mspace);
     }
@@ -336,17 +570,18 @@ int field<rnumber, be, fc>::io(
         if (read)
         {
             std::fill_n(this->data, this->clayout->local_size*2, 0);
-            H5Dread(dset_id, this->cnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dread(dset_id, this->cnumber_H5T, mspace, fspace, dxpl_id, this->data);
             this->symmetrize();
         }
         else
         {
             assert(!this->real_space_representation);
-            H5Dwrite(dset_id, this->cnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dwrite(dset_id, this->cnumber_H5T, mspace, fspace, dxpl_id, this->data);
         }
         H5Sclose(mspace);
     }
 
+    H5Pclose(dxpl_id);
     H5Sclose(fspace);
     /* close data set */
     H5Dclose(dset_id);
@@ -355,6 +590,101 @@ int field<rnumber, be, fc>::io(
     return EXIT_SUCCESS;
 }
 
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+int field<rnumber, be, fc>::io_async(
+        const std::string fname,
+        const std::string field_name,
+        const int iteration,
+        async_file_writer &writer)
+{
+    TIMEZONE("field::io_async");
+    /* the local part of the real space representation is not contiguous in
+     * the file, because of the FFTW padding, and neither are the pencils of
+     * the PENCIL backend */
+    if (this->real_space_representation || be != FFTW)
+        return this->io(fname, field_name, iteration, false);
+    std::string dset_name = (
+            "/" + field_name +
+            "/complex" +
+            "/" + std::to_string(iteration));
+
+    /* create the dataset, so that its storage is allocated */
+    hid_t file_id, dset_id, plist_id;
+    plist_id = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(plist_id, this->comm, field_io_settings.hints);
+    bool file_exists = false;
+    {
+        struct stat file_buffer;
+        file_exists = (stat(fname.c_str(), &file_buffer) == 0);
+    }
+    if (file_exists)
+        file_id = H5Fopen(fname.c_str(), H5F_ACC_RDWR, plist_id);
+    else
+        file_id = H5Fcreate(fname.c_str(), H5F_ACC_EXCL, H5P_DEFAULT, plist_id);
+    assert(file_id >= 0);
+    H5Pclose(plist_id);
+    if (!H5Lexists(file_id, field_name.c_str(), H5P_DEFAULT))
+    {
+        hid_t gid_tmp = H5Gcreate(
+                file_id, field_name.c_str(),
+                H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        H5Gclose(gid_tmp);
+    }
+    if (!H5Lexists(file_id, (field_name + "/complex").c_str(), H5P_DEFAULT))
+    {
+        hid_t gid_tmp = H5Gcreate(
+                file_id, ("/" + field_name + "/complex").c_str(),
+                H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        H5Gclose(gid_tmp);
+    }
+    if (H5Lexists(file_id, dset_name.c_str(), H5P_DEFAULT))
+        dset_id = H5Dopen(file_id, dset_name.c_str(), H5P_DEFAULT);
+    else
+    {
+        hsize_t dims[ndim(fc)];
+        for (unsigned int i=0; i<ndim(fc); i++)
+            dims[i] = this->clayout->sizes[i];
+        hid_t fspace = H5Screate_simple(ndim(fc), dims, NULL);
+        hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+        H5Pset_layout(dcpl_id, H5D_CONTIGUOUS);
+        H5Pset_alloc_time(dcpl_id, H5D_ALLOC_TIME_EARLY);
+        H5Pset_fill_time(dcpl_id, H5D_FILL_TIME_NEVER);
+        dset_id = H5Dcreate(
+                file_id,
+                dset_name.c_str(),
+                this->cnumber_H5T,
+                fspace,
+                H5P_DEFAULT,
+                dcpl_id,
+                H5P_DEFAULT);
+        H5Pclose(dcpl_id);
+        H5Sclose(fspace);
+    }
+    assert(dset_id >= 0);
+    hid_t dset_type = H5Dget_type(dset_id);
+    const bool same_type = (H5Tequal(dset_type, this->cnumber_H5T) > 0);
+    H5Tclose(dset_type);
+    const haddr_t dset_offset = H5Dget_offset(dset_id);
+    H5Dclose(dset_id);
+    H5Fclose(file_id);
+
+    /* e.g. chunked datasets written by other codes */
+    if (!same_type || dset_offset == HADDR_UNDEF)
+        return this->io(fname, field_name, iteration, false);
+
+    /* the slab of the current process is contiguous in the file */
+    const size_t cnumber_size = 2*sizeof(rnumber);
+    std::vector<async_file_writer::block> blocks(1);
+    blocks[0].offset = MPI_Offset(
+            dset_offset +
+            this->clayout->starts[0]*(this->clayout->full_size/this->clayout->sizes[0])*cnumber_size);
+    blocks[0].data = this->data;
+    blocks[0].nbytes = this->clayout->local_size*cnumber_size;
+    return writer.start_write(this->comm, fname, blocks);
+}
+
 template <typename rnumber,
           field_backend be,
           field_components fc>
@@ -377,7 +707,7 @@ int field<rnumber, be, fc>::io_database(
 
     /* open/create file */
     plist_id = H5Pcreate(H5P_FILE_ACCESS);
-    H5Pset_fapl_mpio(plist_id, this->comm, MPI_INFO_NULL);
+    H5Pset_fapl_mpio(plist_id, this->comm, field_io_settings.hints);
     bool file_exists = false;
     {
         struct stat file_buffer;
@@ -487,6 +817,7 @@ int field<rnumber, be, fc>::io_database(
         }
     }
     /* both dset_id and fspace should now have sane values */
+    hid_t dxpl_id = field_io_transfer_properties();
 
     /* check file space */
     int ndims_fspace = H5Sget_simple_extent_dims(fspace, dims, NULL);
@@ -503,13 +834,13 @@ int field<rnumber, be, fc>::io_database(
         if (read)
         {
             std::fill_n(this->data, this->rmemlayout->local_size, 0);
-            H5Dread(dset_id, this->rnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dread(dset_id, this->rnumber_H5T, mspace, fspace, dxpl_id, this->data);
             this->real_space_representation = true;
         }
         else
         {
             assert(this->real_space_representation);
-            H5Dwrite(dset_id, this->rnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dwrite(dset_id, this->rnumber_H5T, mspace, fspace, dxpl_id, this->data);
         }
         H5Sclose(mspace);
     }
@@ -523,18 +854,19 @@ int field<rnumber, be, fc>::io_database(
         H5Sselect_hyperslab(fspace, H5S_SELECT_SET, offset, NULL, count, NULL);
         if (read)
         {
-            H5Dread(dset_id, this->cnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dread(dset_id, this->cnumber_H5T, mspace, fspace, dxpl_id, this->data);
             this->real_space_representation = false;
             this->symmetrize();
         }
         else
         {
             assert(!this->real_space_representation);
-            H5Dwrite(dset_id, this->cnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dwrite(dset_id, this->cnumber_H5T, mspace, fspace, dxpl_id, this->data);
         }
         H5Sclose(mspace);
     }
 
+    H5Pclose(dxpl_id);
     H5Sclose(fspace);
     /* close data set */
     H5Dclose(dset_id);
@@ -655,6 +987,99 @@ void field<rnumber, be, fc>::compute_rspace_xincrement_stats(
 
 
 
+/* Histogram range of a single value.
+ * A positive `max_estimate` gives the fixed range [-max_estimate, max_estimate]
+ * ([0, max_estimate] for magnitudes), and values outside of it are not
+ * counted. Otherwise the range is the actual [minimum, maximum] of the value,
+ * so that nothing is lost and the histogram resolution is not wasted.
+ */
+static void get_histogram_range(
+        const double max_estimate,
+        const bool magnitude,
+        const double minimum,
+        const double maximum,
+        double &lower,
+        double &upper)
+{
+    if (max_estimate > 0)
+    {
+        lower = magnitude ? 0.0 : -max_estimate;
+        upper = max_estimate;
+        return;
+    }
+    lower = minimum;
+    upper = maximum;
+    if (!(upper > lower))
+    {
+        // constant value
+        const double half_width = 0.5*std::max(std::abs(lower), 1.0);
+        lower -= half_width;
+        upper += half_width;
+    }
+}
+
+static inline int get_histogram_bin(
+        const double value,
+        const double lower,
+        const double upper,
+        const double binsize,
+        const int nbins)
+{
+    int bin = int(floor((value - lower) / binsize));
+    // the maximum itself belongs to the last bin
+    if (bin == nbins && value <= upper)
+        bin = nbins - 1;
+    return bin;
+}
+
+/* Optional statistics datasets (bin edges, quantiles) are only written if the
+ * python code created them.
+ */
+static bool stats_dataset_exists(
+        const hid_t group,
+        const std::string subgroup_name,
+        const std::string dset_name)
+{
+    return (H5Lexists(group, subgroup_name.c_str(), H5P_DEFAULT) &&
+            H5Lexists(group, (subgroup_name + "/" + dset_name).c_str(), H5P_DEFAULT));
+}
+
+/* write the time slice `toffset` of a statistics dataset, whatever its shape */
+static void write_stats_time_slice(
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset,
+        const hid_t mem_type,
+        const void *values)
+{
+    hid_t dset, wspace, mspace;
+    dset = H5Dopen(group, dset_name.c_str(), H5P_DEFAULT);
+    assert(dset > 0);
+    wspace = H5Dget_space(dset);
+    const int ndims = H5Sget_simple_extent_ndims(wspace);
+    std::vector<hsize_t> count(ndims), offset(ndims, 0);
+    H5Sget_simple_extent_dims(wspace, &count.front(), NULL);
+    offset[0] = toffset;
+    count[0] = 1;
+    mspace = H5Screate_simple(ndims, &count.front(), NULL);
+    H5Sselect_hyperslab(wspace, H5S_SELECT_SET, &offset.front(), NULL, &count.front(), NULL);
+    H5Dwrite(dset, mem_type, mspace, wspace, H5P_DEFAULT, values);
+    H5Sclose(wspace);
+    H5Sclose(mspace);
+    H5Dclose(dset);
+}
+
+/** \brief Moments, histograms and quantiles of a real space field.
+ *
+ *  Entries of `max_estimate` that are not positive ask for histograms over
+ *  the actual range of the value. In that case the moments and extrema are
+ *  computed in a first pass over the field, and the histograms are filled in
+ *  a second pass, once the extrema are known on all processes.
+ *  The bin edges are written to "bin_edges/<dset_name>", and quantiles
+ *  estimated with a `quantile_sketch` to "quantiles/<dset_name>", when these
+ *  datasets exist; the quantile levels are read from the "levels" attribute
+ *  of the latter.
+ */
 template <typename rnumber,
           field_backend be,
           field_components fc>
@@ -667,7 +1092,7 @@ void field<rnumber, be, fc>::compute_rspace_stats(
     TIMEZONE("field::compute_rspace_stats");
     assert(this->real_space_representation);
     const unsigned int nmoments = 10;
-    int nvals, nbins;
+    int nvals, nbins, compute_quantiles;
     if (this->myrank == 0)
     {
         hid_t dset, wspace;
@@ -703,32 +1128,75 @@ void field<rnumber, be, fc>::compute_rspace_stats(
             assert(nvals == int(dims[2]*dims[3]));
         H5Sclose(wspace);
         H5Dclose(dset);
+        compute_quantiles = stats_dataset_exists(group, "quantiles", dset_name);
     }
     {
         TIMEZONE("MPI_Bcast");
-        MPI_Bcast(&nvals, 1, MPI_INT, 0, this->comm);
-        MPI_Bcast(&nbins, 1, MPI_INT, 0, this->comm);
+        int tmp[3] = {nvals, nbins, compute_quantiles};
+        MPI_Bcast(tmp, 3, MPI_INT, 0, this->comm);
+        nvals = tmp[0];
+        nbins = tmp[1];
+        compute_quantiles = tmp[2];
     }
     assert(nvals == int(max_estimate.size()));
 
+    bool adaptive_bins = false;
+    for (int i=0; i<nvals; i++)
+        adaptive_bins = adaptive_bins || !(max_estimate[i] > 0);
+
+    /// histograms are followed by the quantile sketch counts
+    const quantile_sketch sketch;
+    const int nsketch = compute_quantiles ? sketch.get_nbuckets() : 0;
+    const int ncounts = (nbins + nsketch)*nvals;
+
     shared_array<double> local_moments_threaded(nmoments*nvals, [&](double* local_moments){
         std::fill_n(local_moments, nmoments*nvals, 0);
-        if (nvals == 4) local_moments[3] = max_estimate[3];
+        std::fill_n(local_moments, nvals, std::numeric_limits<double>::max());
+        std::fill_n(local_moments + (nmoments-1)*nvals, nvals, -std::numeric_limits<double>::max());
     });
 
     shared_array<double> val_tmp_threaded(nvals,[&](double *val_tmp){
         std::fill_n(val_tmp, nvals, 0);
     });
 
-    shared_array<ptrdiff_t> local_hist_threaded(nbins*nvals,[&](ptrdiff_t* local_hist){
-        std::fill_n(local_hist, nbins*nvals, 0);
+    shared_array<ptrdiff_t> local_counts_threaded(ncounts,[&](ptrdiff_t* local_counts){
+        std::fill_n(local_counts, ncounts, 0);
     });
 
     shared_array<double> local_pow_tmp(nvals);
 
-    double *binsize = new double[nvals];
-    for (int i=0; i<nvals; i++)
-        binsize[i] = 2*max_estimate[i] / nbins;
+    std::vector<double> lower(nvals), upper(nvals), binsize(nvals);
+    auto set_bins = [&](const double *minima, const double *maxima){
+        for (int i=0; i<nvals; i++)
+        {
+            get_histogram_range(
+                    max_estimate[i],
+                    nvals == 4 && i == 3,
+                    minima[i], maxima[i],
+                    lower[i], upper[i]);
+            binsize[i] = (upper[i] - lower[i]) / nbins;
+        }
+    };
+    auto fill_histograms = [&](const double *val_tmp, ptrdiff_t *local_hist){
+        for (int i=0; i<nvals; i++)
+        {
+            int bin = get_histogram_bin(val_tmp[i], lower[i], upper[i], binsize[i], nbins);
+            if (bin >= 0 && bin < nbins)
+                local_hist[bin*nvals+i]++;
+        }
+    };
+    auto get_values = [&](const ptrdiff_t rindex, double *val_tmp){
+        if (nvals == int(4)) val_tmp[3] = 0.0;
+        for (unsigned int i=0; i<ncomp(fc); i++)
+        {
+            val_tmp[i] = this->data[rindex*ncomp(fc)+i];
+            if (nvals == int(4)) val_tmp[3] += val_tmp[i]*val_tmp[i];
+        }
+        if (nvals == int(4))
+            val_tmp[3] = sqrt(val_tmp[3]);
+    };
+    if (!adaptive_bins)
+        set_bins(&max_estimate.front(), &max_estimate.front());
 
     {
         TIMEZONE("field::RLOOP");
@@ -742,35 +1210,23 @@ void field<rnumber, be, fc>::compute_rspace_stats(
 
             double *local_moments = local_moments_threaded.getMine();
             double *val_tmp = val_tmp_threaded.getMine();
-            ptrdiff_t *local_hist = local_hist_threaded.getMine();
+            ptrdiff_t *local_counts = local_counts_threaded.getMine();
 
-            if (nvals == int(4)) val_tmp[3] = 0.0;
-            for (unsigned int i=0; i<ncomp(fc); i++)
-            {
-                val_tmp[i] = this->data[rindex*ncomp(fc)+i];
-                if (nvals == int(4)) val_tmp[3] += val_tmp[i]*val_tmp[i];
-            }
-            if (nvals == int(4))
-            {
-                val_tmp[3] = sqrt(val_tmp[3]);
-                if (val_tmp[3] < local_moments[0*nvals+3])
-                    local_moments[0*nvals+3] = val_tmp[3];
-                if (val_tmp[3] > local_moments[9*nvals+3])
-                    local_moments[9*nvals+3] = val_tmp[3];
-                int bin = int(floor(val_tmp[3]*2/binsize[3]));
-                if (bin >= 0 && bin < nbins){
-                    local_hist[bin*nvals+3]++;
-                }
-            }
-            for (unsigned int i=0; i<ncomp(fc); i++)
+            get_values(rindex, val_tmp);
+            for (int i=0; i<nvals; i++)
             {
                 if (val_tmp[i] < local_moments[0*nvals+i])
                     local_moments[0*nvals+i] = val_tmp[i];
                 if (val_tmp[i] > local_moments[(nmoments-1)*nvals+i])
                     local_moments[(nmoments-1)*nvals+i] = val_tmp[i];
-                int bin = int(floor((val_tmp[i] + max_estimate[i]) / binsize[i]));
-                if (bin >= 0 && bin < nbins)
-                    local_hist[bin*nvals+i]++;
+            }
+            if (!adaptive_bins)
+                fill_histograms(val_tmp, local_counts);
+            if (compute_quantiles)
+            {
+                ptrdiff_t *local_sketch = local_counts + nbins*nvals;
+                for (int i=0; i<nvals; i++)
+                    local_sketch[sketch.get_bucket(val_tmp[i])*nvals+i]++;
             }
             for (int n=1; n < int(nmoments)-1; n++){
                 for (int i=0; i<nvals; i++){
@@ -781,55 +1237,75 @@ void field<rnumber, be, fc>::compute_rspace_stats(
 
           TIMEZONE("FIELD_RLOOP::Merge");
           local_moments_threaded.mergeParallel([&](const int idx, const double& v1, const double& v2) -> double {
-              if(nvals == int(4) && idx == 0*nvals+3){
+              if(idx < nvals){
                   return std::min(v1, v2);
               }
-              if(nvals == int(4) && idx == 9*nvals+3){
-                  return std::max(v1, v2);
-              }
-              if(idx < int(ncomp(fc))){
-                  return std::min(v1, v2);
-              }
-              if(int(nmoments-1)*nvals <= idx && idx < int(int(nmoments-1)*nvals+ncomp(fc))){
+              if(int(nmoments-1)*nvals <= idx){
                   return std::max(v1, v2);
               }
               return v1 + v2;
           });
-
-        local_hist_threaded.mergeParallel();
     }
-    ptrdiff_t *hist = new ptrdiff_t[nbins*nvals];
+    /// extrema are needed everywhere for adaptive bins, -minima are reduced
+    /// together with the maxima
     double *moments = new double[nmoments*nvals];
     {
         TIMEZONE("MPI_Allreduce");
+        const double *local_moments = local_moments_threaded.getMasterData();
+        std::vector<double> extrema(2*nvals);
+        for (int i=0; i<nvals; i++)
+        {
+            extrema[i] = -local_moments[i];
+            extrema[nvals+i] = local_moments[(nmoments-1)*nvals+i];
+        }
         MPI_Allreduce(
-                (void*)local_moments_threaded.getMasterData(),
-                (void*)moments,
-                nvals,
-                MPI_DOUBLE, MPI_MIN, this->comm);
-        MPI_Allreduce(
-                (void*)(local_moments_threaded.getMasterData() + nvals),
+                MPI_IN_PLACE,
+                (void*)&extrema.front(),
+                2*nvals,
+                MPI_DOUBLE, MPI_MAX, this->comm);
+        for (int i=0; i<nvals; i++)
+        {
+            moments[i] = -extrema[i];
+            moments[(nmoments-1)*nvals+i] = extrema[nvals+i];
+        }
+        MPI_Reduce(
+                (void*)(local_moments + nvals),
                 (void*)(moments+nvals),
                 (nmoments-2)*nvals,
-                MPI_DOUBLE, MPI_SUM, this->comm);
-        MPI_Allreduce(
-                (void*)(local_moments_threaded.getMasterData() + (nmoments-1)*nvals),
-                (void*)(moments+(nmoments-1)*nvals),
-                nvals,
-                MPI_DOUBLE, MPI_MAX, this->comm);
-        MPI_Allreduce(
-                (void*)local_hist_threaded.getMasterData(),
-                (void*)hist,
-                nbins*nvals,
-                MPI_INT64_T, MPI_SUM, this->comm);
+                MPI_DOUBLE, MPI_SUM, 0, this->comm);
     }
-    for (int n=1; n < int(nmoments)-1; n++)
-        for (int i=0; i<nvals; i++)
-            moments[n*nvals + i] /= this->npoints;
+    if (adaptive_bins)
+    {
+        TIMEZONE("field::RLOOP::histograms");
+        set_bins(moments, moments + (nmoments-1)*nvals);
+        this->RLOOP(
+                [&](ptrdiff_t rindex,
+                    ptrdiff_t xindex,
+                    ptrdiff_t yindex,
+                    ptrdiff_t zindex){
+            double *val_tmp = val_tmp_threaded.getMine();
+            get_values(rindex, val_tmp);
+            fill_histograms(val_tmp, local_counts_threaded.getMine());
+                });
+    }
+    local_counts_threaded.mergeParallel();
+    ptrdiff_t *counts = new ptrdiff_t[ncounts];
+    {
+        TIMEZONE("MPI_Reduce");
+        MPI_Reduce(
+                (void*)local_counts_threaded.getMasterData(),
+                (void*)counts,
+                ncounts,
+                MPI_INT64_T, MPI_SUM, 0, this->comm);
+    }
+    const ptrdiff_t *hist = counts;
 
-    delete[] binsize;
     if (this->myrank == 0)
     {
+        for (int n=1; n < int(nmoments)-1; n++)
+            for (int i=0; i<nvals; i++)
+                moments[n*nvals + i] /= this->npoints;
+
         TIMEZONE("root-work");
         hid_t dset, wspace, mspace;
         hsize_t count[ndim(fc)-1], offset[ndim(fc)-1], dims[ndim(fc)-1];
@@ -869,7 +1345,50 @@ void field<rnumber, be, fc>::compute_rspace_stats(
         H5Sclose(wspace);
         H5Sclose(mspace);
         H5Dclose(dset);
-        if (H5Lexists(
+        if (stats_dataset_exists(group, "bin_edges", dset_name))
+        {
+            std::vector<double> edges((nbins+1)*nvals);
+            for (int bin=0; bin<=nbins; bin++)
+                for (int i=0; i<nvals; i++)
+                    edges[bin*nvals+i] = lower[i] + bin*binsize[i];
+            write_stats_time_slice(
+                    group,
+                    "bin_edges/" + dset_name,
+                    toffset,
+                    H5T_NATIVE_DOUBLE,
+                    &edges.front());
+        }
+        if (compute_quantiles)
+        {
+            const std::string quantile_dset_name = "quantiles/" + dset_name;
+            hid_t attr = H5Aopen_by_name(
+                    group,
+                    quantile_dset_name.c_str(),
+                    "levels",
+                    H5P_DEFAULT,
+                    H5P_DEFAULT);
+            assert(attr > 0);
+            hid_t aspace = H5Aget_space(attr);
+            std::vector<double> levels(H5Sget_simple_extent_npoints(aspace));
+            H5Aread(attr, H5T_NATIVE_DOUBLE, &levels.front());
+            H5Sclose(aspace);
+            H5Aclose(attr);
+            std::vector<double> quantiles(levels.size()*nvals);
+            for (unsigned int q=0; q<levels.size(); q++)
+                for (int i=0; i<nvals; i++)
+                    quantiles[q*nvals+i] = sketch.get_quantile(
+                            counts + nbins*nvals,
+                            nvals, i,
+                            levels[q]);
+            write_stats_time_slice(
+                    group,
+                    quantile_dset_name,
+                    toffset,
+                    H5T_NATIVE_DOUBLE,
+                    &quantiles.front());
+        }
+        /* only the slab decomposition has the whole z = 0 slice on rank 0 */
+        if (be == FFTW && H5Lexists(
                     group,
                     "0slices",
                     H5P_DEFAULT))
@@ -885,7 +1404,7 @@ void field<rnumber, be, fc>::compute_rspace_stats(
         }
     }
     delete[] moments;
-    delete[] hist;
+    delete[] counts;
 }
 
 template <typename rnumber,
@@ -898,71 +1417,119 @@ void field<rnumber, be, fc>::normalize()
 }
 
 template <typename rnumber,
-          field_backend be,
           field_components fc>
-void field<rnumber, be, fc>::symmetrize()
+void symmetrize_kx0_plane(
+        const field_layout<fc> *clayout,
+        typename fftw_interface<rnumber>::complex *data,
+        const ptrdiff_t ncomponents,
+        const ptrdiff_t stride,
+        typename fftw_interface<rnumber>::complex *&work_buffer)
 {
-    TIMEZONE("field::symmetrize");
-    assert(!this->real_space_representation);
     ptrdiff_t ii, cc;
-    typename fftw_interface<rnumber>::complex *data = this->get_cdata();
-    MPI_Status *mpistatus = new MPI_Status;
-    if (this->myrank == this->clayout->rank[0][0])
+    if (clayout->myrank == clayout->rank[0][0])
     {
-        for (cc = 0; cc < ncomp(fc); cc++)
+        for (cc = 0; cc < ncomponents; cc++)
             data[cc][1] = 0.0;
-        for (ii = 1; ii < ptrdiff_t(this->clayout->sizes[1]/2); ii++)
-            for (cc = 0; cc < ncomp(fc); cc++) {
-                ( *(data + cc + ncomp(fc)*(this->clayout->sizes[1] - ii)*this->clayout->sizes[2]))[0] =
-                 (*(data + cc + ncomp(fc)*(                          ii)*this->clayout->sizes[2]))[0];
-                ( *(data + cc + ncomp(fc)*(this->clayout->sizes[1] - ii)*this->clayout->sizes[2]))[1] =
-                -(*(data + cc + ncomp(fc)*(                          ii)*this->clayout->sizes[2]))[1];
+        for (ii = 1; ii < ptrdiff_t(clayout->sizes[1]/2); ii++)
+            for (cc = 0; cc < ncomponents; cc++) {
+                ( *(data + cc + stride*(clayout->sizes[1] - ii)*clayout->subsizes[2]))[0] =
+                 (*(data + cc + stride*(                          ii)*clayout->subsizes[2]))[0];
+                ( *(data + cc + stride*(clayout->sizes[1] - ii)*clayout->subsizes[2]))[1] =
+                -(*(data + cc + stride*(                          ii)*clayout->subsizes[2]))[1];
             }
     }
-    typename fftw_interface<rnumber>::complex *buffer;
-    buffer = fftw_interface<rnumber>::alloc_complex(ncomp(fc)*this->clayout->sizes[1]);
-    ptrdiff_t yy;
-    /*ptrdiff_t tindex;*/
-    int ranksrc, rankdst;
-    for (yy = 1; yy < ptrdiff_t(this->clayout->sizes[0]/2); yy++) {
-        ranksrc = this->clayout->rank[0][yy];
-        rankdst = this->clayout->rank[0][this->clayout->sizes[0] - yy];
-        if (this->clayout->myrank == ranksrc)
-            for (ii = 0; ii < ptrdiff_t(this->clayout->sizes[1]); ii++)
-                for (cc = 0; cc < ncomp(fc); cc++)
-                    for (int imag_comp=0; imag_comp<2; imag_comp++)
-                        (*(buffer + ncomp(fc)*ii+cc))[imag_comp] =
-                            (*(data + ncomp(fc)*((yy - this->clayout->starts[0])*this->clayout->sizes[1] + ii)*this->clayout->sizes[2] + cc))[imag_comp];
-        if (ranksrc != rankdst)
+    /* the kx = 0 line of plane ky = yy is copied to plane ky = -yy.
+     * Source planes (0 < yy < ny/2) and destination planes are disjoint, so
+     * all the exchanges can be done at once, with a single message for
+     * each pair of ranks. Planes are always stored in increasing yy order,
+     * so they are contiguous in the buffers for a given pair of ranks. */
+    const ptrdiff_t plane_size = ncomponents*clayout->sizes[1];
+    std::vector<ptrdiff_t> send_yy, recv_yy;
+    for (ptrdiff_t yy = 1; yy < ptrdiff_t(clayout->sizes[0]/2); yy++)
+    {
+        if (clayout->rank[0][yy] == clayout->myrank)
+            send_yy.push_back(yy);
+        if (clayout->rank[0][clayout->sizes[0] - yy] == clayout->myrank)
+            recv_yy.push_back(yy);
+    }
+    if (work_buffer == nullptr)
+        work_buffer = fftw_interface<rnumber>::alloc_complex(
+                2*std::max(clayout->subsizes[0], hsize_t(1))*plane_size);
+    typename fftw_interface<rnumber>::complex *send_buffer = work_buffer;
+    typename fftw_interface<rnumber>::complex *recv_buffer = (
+            work_buffer +
+            std::max(clayout->subsizes[0], hsize_t(1))*plane_size);
+
+    #pragma omp parallel for schedule(static)
+    for (ptrdiff_t idx = 0; idx < ptrdiff_t(send_yy.size()); idx++)
+    {
+        const ptrdiff_t yy = send_yy[idx];
+        for (ptrdiff_t ii = 0; ii < ptrdiff_t(clayout->sizes[1]); ii++)
+            for (ptrdiff_t cc = 0; cc < ncomponents; cc++)
+                for (int imag_comp=0; imag_comp<2; imag_comp++)
+                    (*(send_buffer + idx*plane_size + ncomponents*ii+cc))[imag_comp] =
+                        (*(data + stride*((yy - clayout->starts[0])*clayout->sizes[1] + ii)*clayout->subsizes[2] + cc))[imag_comp];
+    }
+
+    std::vector<MPI_Request> requests;
+    requests.reserve(send_yy.size() + recv_yy.size());
+    for (ptrdiff_t idx = 0; idx < ptrdiff_t(send_yy.size());)
+    {
+        const int rankdst = clayout->rank[0][clayout->sizes[0] - send_yy[idx]];
+        ptrdiff_t idx_end = idx + 1;
+        while (idx_end < ptrdiff_t(send_yy.size()) &&
+               clayout->rank[0][clayout->sizes[0] - send_yy[idx_end]] == rankdst)
+            idx_end++;
+        if (rankdst != clayout->myrank)
         {
-            if (this->clayout->myrank == ranksrc)
-                MPI_Send((void*)buffer,
-                         ncomp(fc)*this->clayout->sizes[1], mpi_real_type<rnumber>::complex(), rankdst, yy,
-                        this->clayout->comm);
-            if (this->clayout->myrank == rankdst)
-                MPI_Recv((void*)buffer,
-                         ncomp(fc)*this->clayout->sizes[1], mpi_real_type<rnumber>::complex(), ranksrc, yy,
-                        this->clayout->comm, mpistatus);
+            requests.emplace_back();
+            MPI_Isend((void*)(send_buffer + idx*plane_size),
+                      (idx_end - idx)*plane_size, mpi_real_type<rnumber>::complex(), rankdst, 0,
+                      clayout->comm, &requests.back());
         }
-        if (this->clayout->myrank == rankdst)
+        idx = idx_end;
+    }
+    for (ptrdiff_t idx = 0; idx < ptrdiff_t(recv_yy.size());)
+    {
+        const int ranksrc = clayout->rank[0][recv_yy[idx]];
+        ptrdiff_t idx_end = idx + 1;
+        while (idx_end < ptrdiff_t(recv_yy.size()) &&
+               clayout->rank[0][recv_yy[idx_end]] == ranksrc)
+            idx_end++;
+        if (ranksrc != clayout->myrank)
         {
-            for (ii = 1; ii < ptrdiff_t(this->clayout->sizes[1]); ii++)
-                for (cc = 0; cc < ncomp(fc); cc++)
-                {
-                    (*(data + ncomp(fc)*((this->clayout->sizes[0] - yy - this->clayout->starts[0])*this->clayout->sizes[1] + ii)*this->clayout->sizes[2] + cc))[0] =
-                            (*(buffer + ncomp(fc)*(this->clayout->sizes[1]-ii)+cc))[0];
-                    (*(data + ncomp(fc)*((this->clayout->sizes[0] - yy - this->clayout->starts[0])*this->clayout->sizes[1] + ii)*this->clayout->sizes[2] + cc))[1] =
-                            -(*(buffer + ncomp(fc)*(this->clayout->sizes[1]-ii)+cc))[1];
-                }
-            for (cc = 0; cc < ncomp(fc); cc++)
+            requests.emplace_back();
+            MPI_Irecv((void*)(recv_buffer + idx*plane_size),
+                      (idx_end - idx)*plane_size, mpi_real_type<rnumber>::complex(), ranksrc, 0,
+                      clayout->comm, &requests.back());
+        }
+        idx = idx_end;
+    }
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+    #pragma omp parallel for schedule(static)
+    for (ptrdiff_t idx = 0; idx < ptrdiff_t(recv_yy.size()); idx++)
+    {
+        const ptrdiff_t yy = recv_yy[idx];
+        /* local planes are read directly from the send buffer */
+        const typename fftw_interface<rnumber>::complex *buffer = (
+                (clayout->rank[0][yy] == clayout->myrank) ?
+                send_buffer + (yy - send_yy[0])*plane_size :
+                recv_buffer + idx*plane_size);
+        for (ptrdiff_t ii = 1; ii < ptrdiff_t(clayout->sizes[1]); ii++)
+            for (ptrdiff_t cc = 0; cc < ncomponents; cc++)
             {
-                (*((data + cc + ncomp(fc)*(this->clayout->sizes[0] - yy - this->clayout->starts[0])*this->clayout->sizes[1]*this->clayout->sizes[2])))[0] =  (*(buffer + cc))[0];
-                (*((data + cc + ncomp(fc)*(this->clayout->sizes[0] - yy - this->clayout->starts[0])*this->clayout->sizes[1]*this->clayout->sizes[2])))[1] = -(*(buffer + cc))[1];
+                (*(data + stride*((clayout->sizes[0] - yy - clayout->starts[0])*clayout->sizes[1] + ii)*clayout->subsizes[2] + cc))[0] =
+                        (*(buffer + ncomponents*(clayout->sizes[1]-ii)+cc))[0];
+                (*(data + stride*((clayout->sizes[0] - yy - clayout->starts[0])*clayout->sizes[1] + ii)*clayout->subsizes[2] + cc))[1] =
+                        -(*(buffer + ncomponents*(clayout->sizes[1]-ii)+cc))[1];
             }
+        for (ptrdiff_t cc = 0; cc < ncomponents; cc++)
+        {
+            (*((data + cc + stride*(clayout->sizes[0] - yy - clayout->starts[0])*clayout->sizes[1]*clayout->subsizes[2])))[0] =  (*(buffer + cc))[0];
+            (*((data + cc + stride*(clayout->sizes[0] - yy - clayout->starts[0])*clayout->sizes[1]*clayout->subsizes[2])))[1] = -(*(buffer + cc))[1];
         }
     }
-    fftw_interface<rnumber>::free(buffer);
-    delete mpistatus;
     /* put asymmetric data to 0 */
     /*if (this->clayout->myrank == this->clayout->rank[0][this->clayout->sizes[0]/2])
     {
@@ -977,6 +1544,21 @@ void field<rnumber, be, fc>::symmetrize()
     std::fill_n((rnumber*)(data + tindex), ncomp(fc)*2, 0.0);*/
 }
 
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+void field<rnumber, be, fc>::symmetrize()
+{
+    TIMEZONE("field::symmetrize");
+    assert(!this->real_space_representation);
+    symmetrize_kx0_plane<rnumber, fc>(
+            this->clayout,
+            this->get_cdata(),
+            ncomp(fc),
+            ncomp(fc),
+            this->symmetrize_buffer);
+}
+
 template <typename rnumber,
           field_backend be,
           field_components fc>
@@ -1217,27 +1799,73 @@ int joint_rspace_PDF(
                 std::fill_n(local_hist, nbins*nbins, 0);
                 });
 
-    /// set up bin sizes
-    std::vector<double> bin1size, bin2size;
-    bin1size.resize(4);
-    bin2size.resize(4);
-    if (fc == THREE)
+    /// set up bins, values are the 3 components and the magnitude for
+    /// vector fields, or the value itself (binned as a magnitude) for scalars
+    const int nvals = (fc == THREE) ? 4 : 1;
+    bool adaptive_bins = false;
+    for (int i=0; i<nvals; i++)
+        adaptive_bins = (adaptive_bins ||
+                         !(max_f1_estimate[i] > 0) ||
+                         !(max_f2_estimate[i] > 0));
+    /// extrema of f1 then f2 values, -minima reduced together with maxima
+    std::vector<double> extrema(4*nvals, -std::numeric_limits<double>::max());
+    if (adaptive_bins)
     {
-        for (unsigned int i=0; i<3; i++)
-        {
-            bin1size[i] = 2*max_f1_estimate[i] / nbins;
-            bin2size[i] = 2*max_f2_estimate[i] / nbins;
-        }
-        bin1size[3] = max_f1_estimate[3] / nbins;
-        bin2size[3] = max_f2_estimate[3] / nbins;
+        TIMEZONE("field::RLOOP::extrema");
+        shared_array<double> local_extrema_threaded(
+                4*nvals,
+                [&](double* local_extrema){
+                    std::fill_n(local_extrema, 4*nvals, -std::numeric_limits<double>::max());
+                    });
+        f1->RLOOP(
+                [&](ptrdiff_t rindex,
+                    ptrdiff_t xindex,
+                    ptrdiff_t yindex,
+                    ptrdiff_t zindex){
+            double *local_extrema = local_extrema_threaded.getMine();
+            field<rnumber, be, fc> *ff[2] = {f1, f2};
+            for (int f=0; f<2; f++)
+            {
+                double mag = 0.0;
+                for (unsigned int i=0; i<ncomp(fc); i++)
+                {
+                    const double val = ff[f]->rval(rindex, i);
+                    mag += val*val;
+                    local_extrema[(2*f)*nvals+i] = std::max(local_extrema[(2*f)*nvals+i], -val);
+                    local_extrema[(2*f+1)*nvals+i] = std::max(local_extrema[(2*f+1)*nvals+i], val);
+                }
+                if (fc == THREE)
+                {
+                    mag = sqrt(mag);
+                    local_extrema[(2*f)*nvals+3] = std::max(local_extrema[(2*f)*nvals+3], -mag);
+                    local_extrema[(2*f+1)*nvals+3] = std::max(local_extrema[(2*f+1)*nvals+3], mag);
+                }
+            }
+            });
+        local_extrema_threaded.mergeParallel([&](const int idx, const double& v1, const double& v2) -> double {
+            return std::max(v1, v2);
+        });
+        MPI_Allreduce(
+                (void*)local_extrema_threaded.getMasterData(),
+                (void*)&extrema.front(),
+                4*nvals,
+                MPI_DOUBLE, MPI_MAX, f1->comm);
     }
-    else if (fc == ONE)
+    std::vector<double> lower1(nvals), upper1(nvals), bin1size(nvals);
+    std::vector<double> lower2(nvals), upper2(nvals), bin2size(nvals);
+    for (int i=0; i<nvals; i++)
     {
-        for (unsigned int i=0; i<4; i++)
-        {
-            bin1size[i] = max_f1_estimate[0] / nbins;
-            bin2size[i] = max_f2_estimate[0] / nbins;
-        }
+        const bool magnitude = (fc == ONE || i == 3);
+        get_histogram_range(
+                max_f1_estimate[i], magnitude,
+                -extrema[0*nvals+i], extrema[1*nvals+i],
+                lower1[i], upper1[i]);
+        get_histogram_range(
+                max_f2_estimate[i], magnitude,
+                -extrema[2*nvals+i], extrema[3*nvals+i],
+                lower2[i], upper2[i]);
+        bin1size[i] = (upper1[i] - lower1[i]) / nbins;
+        bin2size[i] = (upper2[i] - lower2[i]) / nbins;
     }
 
 
@@ -1262,25 +1890,25 @@ int joint_rspace_PDF(
                 {
                     double val1 = f1->rval(rindex, i);
                     mag1 += val1*val1;
-                    int bin1 = int(floor((val1 + max_f1_estimate[i])/bin1size[i]));
+                    int bin1 = get_histogram_bin(val1, lower1[i], upper1[i], bin1size[i], nbins);
                     mag2 = 0.0;
                     for (unsigned int j=0; j<3; j++)
                     {
                         double val2 = f2->rval(rindex, j);
                         mag2 += val2*val2;
-                        int bin2 = int(floor((val2 + max_f2_estimate[j])/bin2size[j]));
+                        int bin2 = get_histogram_bin(val2, lower2[j], upper2[j], bin2size[j], nbins);
                         if ((bin1 >= 0 && bin1 < nbins) &&
                             (bin2 >= 0 && bin2 < nbins))
                             local_histc[(bin1*nbins + bin2)*9 + i*3 + j]++;
                     }
                 }
-                bin1 = int(floor(sqrt(mag1)/bin1size[3]));
-                bin2 = int(floor(sqrt(mag2)/bin2size[3]));
+                bin1 = get_histogram_bin(sqrt(mag1), lower1[3], upper1[3], bin1size[3], nbins);
+                bin2 = get_histogram_bin(sqrt(mag2), lower2[3], upper2[3], bin2size[3], nbins);
             }
             else if (fc == ONE)
             {
-                bin1 = int(floor(f1->rval(rindex)/bin1size[3]));
-                bin2 = int(floor(f2->rval(rindex)/bin2size[3]));
+                bin1 = get_histogram_bin(f1->rval(rindex), lower1[0], upper1[0], bin1size[0], nbins);
+                bin2 = get_histogram_bin(f2->rval(rindex), lower2[0], upper2[0], bin2size[0], nbins);
             }
             if ((bin1 >= 0 && bin1 < nbins) &&
                 (bin2 >= 0 && bin2 < nbins))
@@ -1351,6 +1979,23 @@ int joint_rspace_PDF(
         H5Sclose(wspace);
         H5Sclose(mspace);
         H5Dclose(dset);
+        if (stats_dataset_exists(group, "bin_edges", dset_name))
+        {
+            /// shape is (nbins+1, 2, nvals), f1 edges then f2 edges
+            std::vector<double> edges((nbins+1)*2*nvals);
+            for (int bin=0; bin<=nbins; bin++)
+                for (int i=0; i<nvals; i++)
+                {
+                    edges[(bin*2+0)*nvals+i] = lower1[i] + bin*bin1size[i];
+                    edges[(bin*2+1)*nvals+i] = lower2[i] + bin*bin2size[i];
+                }
+            write_stats_time_slice(
+                    group,
+                    "bin_edges/" + dset_name,
+                    toffset,
+                    H5T_NATIVE_DOUBLE,
+                    &edges.front());
+        }
     }
 
     delete[] histm;
@@ -1367,6 +2012,43 @@ template class field<double, FFTW, ONE>;
 template class field<double, FFTW, THREE>;
 template class field<double, FFTW, THREExTHREE>;
 
+template void symmetrize_kx0_plane<float, ONE>(
+        const field_layout<ONE> *clayout,
+        fftwf_complex *data,
+        const ptrdiff_t ncomponents,
+        const ptrdiff_t stride,
+        fftwf_complex *&work_buffer);
+template void symmetrize_kx0_plane<float, THREE>(
+        const field_layout<THREE> *clayout,
+        fftwf_complex *data,
+        const ptrdiff_t ncomponents,
+        const ptrdiff_t stride,
+        fftwf_complex *&work_buffer);
+template void symmetrize_kx0_plane<float, THREExTHREE>(
+        const field_layout<THREExTHREE> *clayout,
+        fftwf_complex *data,
+        const ptrdiff_t ncomponents,
+        const ptrdiff_t stride,
+        fftwf_complex *&work_buffer);
+template void symmetrize_kx0_plane<double, ONE>(
+        const field_layout<ONE> *clayout,
+        fftw_complex *data,
+        const ptrdiff_t ncomponents,
+        const ptrdiff_t stride,
+        fftw_complex *&work_buffer);
+template void symmetrize_kx0_plane<double, THREE>(
+        const field_layout<THREE> *clayout,
+        fftw_complex *data,
+        const ptrdiff_t ncomponents,
+        const ptrdiff_t stride,
+        fftw_complex *&work_buffer);
+template void symmetrize_kx0_plane<double, THREExTHREE>(
+        const field_layout<THREExTHREE> *clayout,
+        fftw_complex *data,
+        const ptrdiff_t ncomponents,
+        const ptrdiff_t stride,
+        fftw_complex *&work_buffer);
+
 template void field<float, FFTW, ONE>::compute_stats<TWO_THIRDS>(
         kspace<FFTW, TWO_THIRDS> *,
         const hid_t, const std::string, const hsize_t, const double);
@@ -1468,3 +2150,111 @@ template int joint_rspace_PDF<double, FFTW, ONE>(
         const std::vector<double>,
         const std::vector<double>);
 
+template class field<float, PENCIL, ONE>;
+template class field<float, PENCIL, THREE>;
+template class field<float, PENCIL, THREExTHREE>;
+template class field<double, PENCIL, ONE>;
+template class field<double, PENCIL, THREE>;
+template class field<double, PENCIL, THREExTHREE>;
+
+template void field<float, PENCIL, ONE>::compute_stats<TWO_THIRDS>(
+        kspace<PENCIL, TWO_THIRDS> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<float, PENCIL, THREE>::compute_stats<TWO_THIRDS>(
+        kspace<PENCIL, TWO_THIRDS> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<float, PENCIL, THREExTHREE>::compute_stats<TWO_THIRDS>(
+        kspace<PENCIL, TWO_THIRDS> *,
+        const hid_t, const std::string, const hsize_t, const double);
+
+template void field<double, PENCIL, ONE>::compute_stats<TWO_THIRDS>(
+        kspace<PENCIL, TWO_THIRDS> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<double, PENCIL, THREE>::compute_stats<TWO_THIRDS>(
+        kspace<PENCIL, TWO_THIRDS> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<double, PENCIL, THREExTHREE>::compute_stats<TWO_THIRDS>(
+        kspace<PENCIL, TWO_THIRDS> *,
+        const hid_t, const std::string, const hsize_t, const double);
+
+template void field<float, PENCIL, ONE>::compute_stats<SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<float, PENCIL, THREE>::compute_stats<SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<float, PENCIL, THREExTHREE>::compute_stats<SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        const hid_t, const std::string, const hsize_t, const double);
+
+template void field<double, PENCIL, ONE>::compute_stats<SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<double, PENCIL, THREE>::compute_stats<SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<double, PENCIL, THREExTHREE>::compute_stats<SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        const hid_t, const std::string, const hsize_t, const double);
+
+template int compute_gradient<float, PENCIL, THREE, THREExTHREE, SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        field<float, PENCIL, THREE> *,
+        field<float, PENCIL, THREExTHREE> *);
+template int compute_gradient<double, PENCIL, THREE, THREExTHREE, SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        field<double, PENCIL, THREE> *,
+        field<double, PENCIL, THREExTHREE> *);
+
+template int compute_gradient<float, PENCIL, ONE, THREE, SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        field<float, PENCIL, ONE> *,
+        field<float, PENCIL, THREE> *);
+template int compute_gradient<double, PENCIL, ONE, THREE, SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        field<double, PENCIL, ONE> *,
+        field<double, PENCIL, THREE> *);
+
+template int invert_curl<float, PENCIL, SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        field<float, PENCIL, THREE> *,
+        field<float, PENCIL, THREE> *);
+template int invert_curl<double, PENCIL, SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        field<double, PENCIL, THREE> *,
+        field<double, PENCIL, THREE> *);
+
+template int joint_rspace_PDF<float, PENCIL, THREE>(
+        field<float, PENCIL, THREE> *,
+        field<float, PENCIL, THREE> *,
+        const hid_t,
+        const std::string,
+        const hsize_t,
+        const std::vector<double>,
+        const std::vector<double>);
+template int joint_rspace_PDF<double, PENCIL, THREE>(
+        field<double, PENCIL, THREE> *,
+        field<double, PENCIL, THREE> *,
+        const hid_t,
+        const std::string,
+        const hsize_t,
+        const std::vector<double>,
+        const std::vector<double>);
+
+template int joint_rspace_PDF<float, PENCIL, ONE>(
+        field<float, PENCIL, ONE> *,
+        field<float, PENCIL, ONE> *,
+        const hid_t,
+        const std::string,
+        const hsize_t,
+        const std::vector<double>,
+        const std::vector<double>);
+template int joint_rspace_PDF<double, PENCIL, ONE>(
+        field<double, PENCIL, ONE> *,
+        field<double, PENCIL, ONE> *,
+        const hid_t,
+        const std::string,
+        const hsize_t,
+        const std::vector<double>,
+        const std::vector<double>);
+
@@ -30,11 +30,46 @@
 #include <string>
 #include "kspace.hpp"
 #include "omputils.hpp"
+#include "pencil_fft.hpp"
+#include "async_file_writer.hpp"
 
 #ifndef FIELD_HPP
 
 #define FIELD_HPP
 
+/** \brief Settings shared by the HDF5 I/O methods of all fields.
+ *
+ *  `collective` selects collective MPI-IO transfers, `chunked` makes new
+ *  datasets chunked by single planes along the slab direction, so that each
+ *  chunk is owned by exactly one process.
+ *  `compression_level` is the deflate level used for chunked real space
+ *  datasets, 0 means no compression; parallel writes of filtered datasets
+ *  need collective transfers, so `read_field_io_parameters` enforces them.
+ *  `hints` are handed to MPI-IO when files are opened.
+ */
+struct field_io_parameters
+{
+    bool collective;
+    bool chunked;
+    int compression_level;
+    MPI_Info hints;
+};
+
+extern field_io_parameters field_io_settings;
+
+/* read the optional `io_collective`, `io_chunked`, `io_compression_level`
+ * and `mpiio_hints` parameters from `fname`; missing entries keep their
+ * defaults. `mpiio_hints` is a list of "key=value" pairs separated by
+ * commas, or "none".
+ * */
+int read_field_io_parameters(
+        const std::string fname,
+        const MPI_Comm comm);
+int set_field_io_hints(
+        const std::string hints,
+        const MPI_Comm comm);
+void clear_field_io_parameters();
+
 /** \class field
  *  \brief Holds field data, performs FFTs and HDF5 I/O operations.
  *
@@ -57,6 +92,7 @@ class field
 {
     private:
         rnumber *__restrict__ data; /**< data array */
+        typename fftw_interface<rnumber>::complex *symmetrize_buffer; /**< persistent buffer for `symmetrize`. */
     public:
         hsize_t npoints; /**< total number of grid points. Useful for normalization. */
         bool real_space_representation; /**< `true` if field is in real space representation. */
@@ -76,6 +112,10 @@ class field
         typename fftw_interface<rnumber>::plan r2c_plan;
         unsigned fftw_plan_rigor;
 
+        /* distribution and transforms of the PENCIL backend */
+        pencil_decomposition *decomposition;
+        pencil_fft<rnumber> *pencil_transforms;
+
         /* HDF5 data types for arrays */
         hid_t rnumber_H5T, cnumber_H5T;
 
@@ -93,6 +133,17 @@ class field
                 const std::string field_name,
                 const int iteration,
                 const bool read = true);
+        /* write the complex representation through `writer`: the data is
+         * staged and written in the background, call `writer.fence()` before
+         * reading the file.
+         * Falls back to a synchronous `io` when the dataset can not be
+         * written as a single contiguous block.
+         * */
+        int io_async(
+                const std::string fname,
+                const std::string field_name,
+                const int iteration,
+                async_file_writer &writer);
         int io_database(
                 const std::string fname,
                 const std::string field_name,
@@ -216,6 +267,23 @@ class field
             return *this;
         }
 
+        /* copy the Fourier space representation of a field with the same
+         * layout but a different precision, converting the values.
+         * */
+        template <typename rnumber2>
+        void copy_converted_cdata(const field<rnumber2, be, fc> &source)
+        {
+            assert(!source.real_space_representation);
+            assert(source.clayout->local_size == this->clayout->local_size);
+            const rnumber2 *__restrict__ src = source.get_rdata();
+            rnumber *__restrict__ dst = this->data;
+            const ptrdiff_t nvalues = 2*ptrdiff_t(this->clayout->local_size);
+            #pragma omp parallel for schedule(static)
+            for (ptrdiff_t ii = 0; ii < nvalues; ii++)
+                dst[ii] = rnumber(src[ii]);
+            this->real_space_representation = false;
+        }
+
         template <kspace_dealias_type dt>
         void compute_stats(
                 kspace<be, dt> *kk,
@@ -237,6 +305,7 @@ class field
             switch(be)
             {
                 case FFTW:
+                case PENCIL:
                     #pragma omp parallel
                     {
                         const hsize_t start = OmpUtils::ForIntervalStart(this->rlayout->subsizes[1]);
@@ -318,5 +387,18 @@ int joint_rspace_PDF(
         const std::vector<double> max_f1_estimate,
         const std::vector<double> max_f2_estimate);
 
+/* impose Hermitian symmetry on the kx = 0 plane of Fourier space data
+ * distributed as `clayout`, for `ncomponents` complex values per mode
+ * stored `stride` complex values apart. `work_buffer` is allocated on the
+ * first call, and must be freed by the caller. */
+template <typename rnumber,
+          field_components fc>
+void symmetrize_kx0_plane(
+        const field_layout<fc> *clayout,
+        typename fftw_interface<rnumber>::complex *data,
+        const ptrdiff_t ncomponents,
+        const ptrdiff_t stride,
+        typename fftw_interface<rnumber>::complex *&work_buffer);
+
 #endif//FIELD_HPP
 
@@ -0,0 +1,219 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+
+#include <cstring>
+#include "field_batch.hpp"
+#include "fftw_wisdom.hpp"
+#include "scope_timer.hpp"
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+field_batch<rnumber, be, fc>::field_batch(
+        const field<rnumber, be, fc> *model,
+        const int NFIELDS):
+    nfields(NFIELDS)
+{
+    TIMEZONE("field_batch::field_batch");
+    assert(this->nfields > 0);
+    this->real_space_representation = true;
+    this->clayout = new field_layout<fc>(
+            model->clayout->sizes,
+            model->clayout->subsizes,
+            model->clayout->starts,
+            model->clayout->comm);
+    this->symmetrize_buffer = nullptr;
+    switch(be)
+    {
+        case PENCIL:
+        {
+            /* same grid, hence the same decomposition as the model */
+            this->decomposition = new pencil_decomposition(
+                    model->rlayout->sizes[2],
+                    model->rlayout->sizes[1],
+                    model->rlayout->sizes[0],
+                    model->comm);
+            this->rpoints = model->rmemlayout->local_size / ncomp(fc);
+            this->cpoints = model->clayout->local_size / ncomp(fc);
+            const ptrdiff_t nreals = this->rpoints*this->nfields*ncomp(fc);
+            double time_start = MPI_Wtime();
+            this->data = fftw_interface<rnumber>::alloc_real(nreals);
+            memset(this->data, 0, sizeof(rnumber)*nreals);
+            fftw_planning_statistics::allocation_time += MPI_Wtime() - time_start;
+            time_start = MPI_Wtime();
+            this->pencil_transforms = new pencil_fft<rnumber>(
+                    this->decomposition,
+                    this->nfields*ncomp(fc),
+                    this->data,
+                    model->fftw_plan_rigor);
+            fftw_planning_statistics::planning_time += MPI_Wtime() - time_start;
+            fftw_planning_statistics::plans_created += 6;
+            break;
+        }
+        case FFTW:
+            this->decomposition = nullptr;
+            this->pencil_transforms = nullptr;
+            ptrdiff_t nfftw[3];
+            nfftw[0] = model->rlayout->sizes[0];
+            nfftw[1] = model->rlayout->sizes[1];
+            nfftw[2] = model->rlayout->sizes[2];
+            const ptrdiff_t howmany = this->nfields*ncomp(fc);
+            ptrdiff_t local_n0, local_0_start;
+            ptrdiff_t local_n1, local_1_start;
+            /* the distribution does not depend on howmany, but the buffer
+             * FFTW needs for the transposes may exceed the data size; for
+             * r2c transforms the size is computed in complex numbers */
+            ptrdiff_t nfftw_complex[3] = {nfftw[0], nfftw[1], nfftw[2]/2+1};
+            const ptrdiff_t alloc_size = fftw_mpi_local_size_many_transposed(
+                    3, nfftw_complex, howmany,
+                    FFTW_MPI_DEFAULT_BLOCK, FFTW_MPI_DEFAULT_BLOCK, model->comm,
+                    &local_n0, &local_0_start,
+                    &local_n1, &local_1_start);
+            assert(hsize_t(local_n0) == model->rlayout->subsizes[0]);
+            assert(hsize_t(local_n1) == model->clayout->subsizes[0]);
+            this->rpoints = model->rmemlayout->local_size / ncomp(fc);
+            this->cpoints = model->clayout->local_size / ncomp(fc);
+            const ptrdiff_t nreals = std::max(
+                    2*alloc_size,
+                    std::max(this->rpoints, 2*this->cpoints)*howmany);
+            double time_start = MPI_Wtime();
+            this->data = fftw_interface<rnumber>::alloc_real(nreals);
+            memset(this->data, 0, sizeof(rnumber)*nreals);
+            fftw_planning_statistics::allocation_time += MPI_Wtime() - time_start;
+            time_start = MPI_Wtime();
+            this->c2r_plan = fftw_interface<rnumber>::mpi_plan_many_dft_c2r(
+                    3, nfftw, howmany,
+                    FFTW_MPI_DEFAULT_BLOCK, FFTW_MPI_DEFAULT_BLOCK,
+                    (typename fftw_interface<rnumber>::complex*)this->data,
+                    this->data,
+                    model->comm,
+                    model->fftw_plan_rigor | FFTW_MPI_TRANSPOSED_IN);
+            this->r2c_plan = fftw_interface<rnumber>::mpi_plan_many_dft_r2c(
+                    3, nfftw, howmany,
+                    FFTW_MPI_DEFAULT_BLOCK, FFTW_MPI_DEFAULT_BLOCK,
+                    this->data,
+                    (typename fftw_interface<rnumber>::complex*)this->data,
+                    model->comm,
+                    model->fftw_plan_rigor | FFTW_MPI_TRANSPOSED_OUT);
+            fftw_planning_statistics::planning_time += MPI_Wtime() - time_start;
+            fftw_planning_statistics::plans_created += 2;
+            break;
+    }
+}
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+field_batch<rnumber, be, fc>::~field_batch()
+{
+    switch(be)
+    {
+        case FFTW:
+            fftw_interface<rnumber>::free(this->data);
+            fftw_interface<rnumber>::destroy_plan(this->c2r_plan);
+            fftw_interface<rnumber>::destroy_plan(this->r2c_plan);
+            if (this->symmetrize_buffer != nullptr)
+                fftw_interface<rnumber>::free(this->symmetrize_buffer);
+            break;
+        case PENCIL:
+            delete this->pencil_transforms;
+            delete this->decomposition;
+            fftw_interface<rnumber>::free(this->data);
+            if (this->symmetrize_buffer != nullptr)
+                fftw_interface<rnumber>::free(this->symmetrize_buffer);
+            break;
+    }
+    delete this->clayout;
+}
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+void field_batch<rnumber, be, fc>::ift()
+{
+    TIMEZONE("field_batch::ift");
+    switch(be)
+    {
+        case FFTW:
+            fftw_interface<rnumber>::execute(this->c2r_plan);
+            break;
+        case PENCIL:
+            this->pencil_transforms->c2r();
+            break;
+    }
+    this->real_space_representation = true;
+}
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+void field_batch<rnumber, be, fc>::dft()
+{
+    TIMEZONE("field_batch::dft");
+    switch(be)
+    {
+        case FFTW:
+            fftw_interface<rnumber>::execute(this->r2c_plan);
+            break;
+        case PENCIL:
+            this->pencil_transforms->r2c();
+            break;
+    }
+    this->real_space_representation = false;
+}
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+void field_batch<rnumber, be, fc>::symmetrize(
+        const int slot)
+{
+    TIMEZONE("field_batch::symmetrize");
+    assert(slot >= 0 && slot < this->nfields);
+    assert(!this->real_space_representation);
+    symmetrize_kx0_plane<rnumber, fc>(
+            this->clayout,
+            (typename fftw_interface<rnumber>::complex*)(this->data) + slot*ncomp(fc),
+            ncomp(fc),
+            this->nfields*ncomp(fc),
+            this->symmetrize_buffer);
+}
+
+template class field_batch<float, FFTW, ONE>;
+template class field_batch<float, FFTW, THREE>;
+template class field_batch<float, FFTW, THREExTHREE>;
+template class field_batch<double, FFTW, ONE>;
+template class field_batch<double, FFTW, THREE>;
+template class field_batch<double, FFTW, THREExTHREE>;
+template class field_batch<float, PENCIL, ONE>;
+template class field_batch<float, PENCIL, THREE>;
+template class field_batch<float, PENCIL, THREExTHREE>;
+template class field_batch<double, PENCIL, ONE>;
+template class field_batch<double, PENCIL, THREE>;
+template class field_batch<double, PENCIL, THREExTHREE>;
+
@@ -0,0 +1,113 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#include "field.hpp"
+
+#ifndef FIELD_BATCH_HPP
+
+#define FIELD_BATCH_HPP
+
+/** \class field_batch
+ *  \brief Several fields with the same layout, transformed together.
+ *
+ *  The fields are stacked component-wise, and the FFTs are planned with
+ *  `howmany = nfields*ncomp(fc)`, so that transforming the batch costs a
+ *  single set of MPI transposes instead of one per field.
+ *  FFTW interleaves the transforms, so a slot can not be used as a plain
+ *  `field`: slots are filled and read in place with `rval` and `cval`,
+ *  with the indices of the fields the batch was created from.
+ */
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+class field_batch
+{
+    private:
+        rnumber *__restrict__ data; /**< data array */
+        ptrdiff_t rpoints;          /**< local number of real space points, padding included. */
+        ptrdiff_t cpoints;          /**< local number of Fourier space points. */
+        typename fftw_interface<rnumber>::complex *symmetrize_buffer; /**< persistent buffer for `symmetrize`. */
+    public:
+        const int nfields;
+        bool real_space_representation;
+        field_layout<fc> *clayout;
+
+        /* FFT plans */
+        typename fftw_interface<rnumber>::plan c2r_plan;
+        typename fftw_interface<rnumber>::plan r2c_plan;
+
+        /* distribution and transforms of the PENCIL backend */
+        pencil_decomposition *decomposition;
+        pencil_fft<rnumber> *pencil_transforms;
+
+        /* `model` provides the grid, the communicator and the plan rigor */
+        field_batch(
+                const field<rnumber, be, fc> *model,
+                const int NFIELDS);
+        ~field_batch();
+
+        void dft();
+        void ift();
+
+        /* impose Hermitian symmetry on the kx = 0 plane of slot `slot`,
+         * as `field::symmetrize` does */
+        void symmetrize(const int slot);
+
+        inline rnumber &rval(ptrdiff_t rindex, int slot, int component = 0)
+        {
+            assert(slot >= 0 && slot < this->nfields);
+            assert(component >= 0 && component < int(ncomp(fc)));
+            return *(this->data + (rindex*this->nfields + slot)*ncomp(fc) + component);
+        }
+
+        inline const rnumber &rval(ptrdiff_t rindex, int slot, int component = 0) const
+        {
+            assert(slot >= 0 && slot < this->nfields);
+            assert(component >= 0 && component < int(ncomp(fc)));
+            return *(this->data + (rindex*this->nfields + slot)*ncomp(fc) + component);
+        }
+
+        inline rnumber &cval(ptrdiff_t cindex, int slot, int component, int imag)
+        {
+            assert(slot >= 0 && slot < this->nfields);
+            assert(component >= 0 && component < int(ncomp(fc)));
+            assert(imag == 0 || imag == 1);
+            return *(this->data + ((cindex*this->nfields + slot)*ncomp(fc) + component)*2 + imag);
+        }
+
+        inline const rnumber &cval(ptrdiff_t cindex, int slot, int component, int imag) const
+        {
+            assert(slot >= 0 && slot < this->nfields);
+            assert(component >= 0 && component < int(ncomp(fc)));
+            assert(imag == 0 || imag == 1);
+            return *(this->data + ((cindex*this->nfields + slot)*ncomp(fc) + component)*2 + imag);
+        }
+};
+
+#endif//FIELD_BATCH_HPP
+
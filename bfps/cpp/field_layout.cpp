@@ -63,6 +63,17 @@ field_layout<fc>::field_layout(
     }
 
     /*field will at most be distributed in 2D*/
+    /* rank[i][ii] is the process that holds index ii of dimension i, and
+     * the start of the other dimensions; for a pencil decomposition in
+     * Fourier space, rank[0][ky] holds the kx = 0 modes of plane ky. */
+    bool holds_other_starts[3];
+    for (int i=0; i<3; i++)
+    {
+        holds_other_starts[i] = true;
+        for (int j=0; j<3; j++)
+            if (j != i && this->starts[j] != 0)
+                holds_other_starts[i] = false;
+    }
     this->rank.resize(2);
     this->all_start.resize(2);
     this->all_size.resize(2);
@@ -71,8 +82,9 @@ field_layout<fc>::field_layout(
         this->rank[i].resize(this->sizes[i]);
         std::vector<int> local_rank;
         local_rank.resize(this->sizes[i], 0);
-        for (unsigned int ii=this->starts[i]; ii<this->starts[i]+this->subsizes[i]; ii++)
-            local_rank[ii] = this->myrank;
+        if (holds_other_starts[i])
+            for (unsigned int ii=this->starts[i]; ii<this->starts[i]+this->subsizes[i]; ii++)
+                local_rank[ii] = this->myrank;
         MPI_Allreduce(
                 &local_rank.front(),
                 &this->rank[i].front(),
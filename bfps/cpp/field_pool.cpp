@@ -0,0 +1,134 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#include <iostream>
+#include "field_pool.hpp"
+#include "scope_timer.hpp"
+
+int field_pool_statistics::fields_created = 0;
+int field_pool_statistics::fields_reused = 0;
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+std::vector<field<rnumber, be, fc> *> field_pool<rnumber, be, fc>::available_fields;
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+field<rnumber, be, fc> *field_pool<rnumber, be, fc>::acquire(
+                const int nx,
+                const int ny,
+                const int nz,
+                const MPI_Comm COMM_TO_USE,
+                const unsigned FFTW_PLAN_RIGOR)
+{
+    TIMEZONE("field_pool::acquire");
+    for (auto ff = available_fields.begin(); ff != available_fields.end(); ff++)
+    {
+        if (int((*ff)->rlayout->sizes[2]) == nx &&
+            int((*ff)->rlayout->sizes[1]) == ny &&
+            int((*ff)->rlayout->sizes[0]) == nz &&
+            (*ff)->comm == COMM_TO_USE &&
+            (*ff)->fftw_plan_rigor == FFTW_PLAN_RIGOR)
+        {
+            field<rnumber, be, fc> *result = *ff;
+            available_fields.erase(ff);
+            field_pool_statistics::fields_reused++;
+            return result;
+        }
+    }
+    field_pool_statistics::fields_created++;
+    return new field<rnumber, be, fc>(
+            nx, ny, nz,
+            COMM_TO_USE,
+            FFTW_PLAN_RIGOR);
+}
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+void field_pool<rnumber, be, fc>::release(
+        field<rnumber, be, fc> *f)
+{
+    if (f == NULL)
+        return;
+    available_fields.push_back(f);
+}
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+void field_pool<rnumber, be, fc>::clear()
+{
+    for (auto ff: available_fields)
+        delete ff;
+    available_fields.clear();
+}
+
+void clear_field_pools()
+{
+    field_pool<float, FFTW, ONE>::clear();
+    field_pool<float, FFTW, THREE>::clear();
+    field_pool<float, FFTW, THREExTHREE>::clear();
+    field_pool<double, FFTW, ONE>::clear();
+    field_pool<double, FFTW, THREE>::clear();
+    field_pool<double, FFTW, THREExTHREE>::clear();
+    field_pool<float, PENCIL, ONE>::clear();
+    field_pool<float, PENCIL, THREE>::clear();
+    field_pool<float, PENCIL, THREExTHREE>::clear();
+    field_pool<double, PENCIL, ONE>::clear();
+    field_pool<double, PENCIL, THREE>::clear();
+    field_pool<double, PENCIL, THREExTHREE>::clear();
+}
+
+void report_field_pool_statistics(const MPI_Comm comm)
+{
+    int myrank;
+    MPI_Comm_rank(comm, &myrank);
+    if (myrank == 0)
+        std::cout << "field pool: " <<
+                     field_pool_statistics::fields_created << " fields (" <<
+                     2*field_pool_statistics::fields_created << " FFTW plans) created, " <<
+                     field_pool_statistics::fields_reused << " fields (" <<
+                     2*field_pool_statistics::fields_reused << " FFTW plans) reused" <<
+                     std::endl;
+}
+
+template class field_pool<float, FFTW, ONE>;
+template class field_pool<float, FFTW, THREE>;
+template class field_pool<float, FFTW, THREExTHREE>;
+template class field_pool<double, FFTW, ONE>;
+template class field_pool<double, FFTW, THREE>;
+template class field_pool<double, FFTW, THREExTHREE>;
+template class field_pool<float, PENCIL, ONE>;
+template class field_pool<float, PENCIL, THREE>;
+template class field_pool<float, PENCIL, THREExTHREE>;
+template class field_pool<double, PENCIL, ONE>;
+template class field_pool<double, PENCIL, THREE>;
+template class field_pool<double, PENCIL, THREExTHREE>;
+
@@ -0,0 +1,82 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#include <vector>
+#include "field.hpp"
+
+#ifndef FIELD_POOL_HPP
+
+#define FIELD_POOL_HPP
+
+/** \class field_pool
+ *  \brief Keeps allocated and planned fields around for later reuse.
+ *
+ *  Creating a `field` allocates memory and creates two FFTW plans, which can
+ *  cost more than the FFTs themselves. Codes that need temporary fields
+ *  (postprocessing codes in particular, that work on many iterations) should
+ *  `acquire` them from the pool and `release` them when done, instead of
+ *  calling `new` and `delete`.
+ *  Fields are matched on type, number of components, grid size, communicator
+ *  and FFTW plan rigor.
+ *  The contents of a reused field are not reset.
+ */
+
+class field_pool_statistics
+{
+    public:
+        static int fields_created; /**< fields created, i.e. 2 FFTW plans each. */
+        static int fields_reused;  /**< fields handed out from the pool. */
+};
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+class field_pool
+{
+    private:
+        static std::vector<field<rnumber, be, fc> *> available_fields;
+    public:
+        static field<rnumber, be, fc> *acquire(
+                const int nx,
+                const int ny,
+                const int nz,
+                const MPI_Comm COMM_TO_USE,
+                const unsigned FFTW_PLAN_RIGOR = DEFAULT_FFTW_FLAG);
+        static void release(field<rnumber, be, fc> *f);
+        static void clear();
+};
+
+/* delete all fields held by the pools.
+ * must be called before the FFTW and MPI cleanup.
+ * */
+void clear_field_pools();
+
+/* print on rank 0 of `comm` how many fields (and plans) were created and reused. */
+void report_field_pool_statistics(const MPI_Comm comm);
+
+#endif//FIELD_POOL_HPP
+
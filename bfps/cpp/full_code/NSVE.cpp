@@ -2,10 +2,12 @@
 #include <cmath>
 #include "NSVE.hpp"
 #include "scope_timer.hpp"
+#include "field_pool.hpp"
 
 
-template <typename rnumber>
-int NSVE<rnumber>::initialize(void)
+template <typename rnumber,
+          field_backend be>
+int NSVE<rnumber, be>::initialize(void)
 {
     this->read_iteration();
     this->read_parameters();
@@ -32,12 +34,14 @@ int NSVE<rnumber>::initialize(void)
             std::endl;
         return EXIT_FAILURE;
     }
-    this->fs = new vorticity_equation<rnumber, FFTW>(
+    /* the process grid of the fields created below */
+    ::pencil_process_rows = this->pencil_process_rows;
+    this->fs = new vorticity_equation<rnumber, be>(
             simname.c_str(),
             nx, ny, nz,
             dkx, dky, dkz,
             DEFAULT_FFTW_FLAG);
-    this->tmp_vec_field = new field<rnumber, FFTW, THREE>(
+    this->tmp_vec_field = field_pool<rnumber, be, THREE>::acquire(
             nx, ny, nz,
             this->comm,
             DEFAULT_FFTW_FLAG);
@@ -50,6 +54,8 @@ int NSVE<rnumber>::initialize(void)
     this->fs->fk0 = fk0;
     this->fs->fk1 = fk1;
     strncpy(this->fs->forcing_type, forcing_type, 128);
+    this->fs->set_mixed_precision(this->mixed_precision != 0);
+    this->fs->set_batched_transforms(this->batched_transforms != 0);
     this->fs->iteration = this->iteration;
     this->fs->checkpoint = this->checkpoint;
 
@@ -61,30 +67,39 @@ int NSVE<rnumber>::initialize(void)
     return EXIT_SUCCESS;
 }
 
-template <typename rnumber>
-int NSVE<rnumber>::step(void)
+template <typename rnumber,
+          field_backend be>
+int NSVE<rnumber, be>::step(void)
 {
     this->fs->step(this->dt);
     this->iteration = this->fs->iteration;
     return EXIT_SUCCESS;
 }
 
-template <typename rnumber>
-int NSVE<rnumber>::write_checkpoint(void)
+template <typename rnumber,
+          field_backend be>
+int NSVE<rnumber, be>::write_checkpoint(void)
 {
-    this->fs->io_checkpoint(false);
+    /* the previous checkpoint must be complete before the next one starts */
+    this->checkpoint_writer.fence();
+    if (this->async_checkpoints)
+        this->fs->write_checkpoint_async(this->checkpoint_writer);
+    else
+        this->fs->io_checkpoint(false);
     this->checkpoint = this->fs->checkpoint;
     this->write_iteration();
     return EXIT_SUCCESS;
 }
 
-template <typename rnumber>
-int NSVE<rnumber>::finalize(void)
+template <typename rnumber,
+          field_backend be>
+int NSVE<rnumber, be>::finalize(void)
 {
+    this->checkpoint_writer.fence();
     if (this->myrank == 0)
         H5Fclose(this->stat_file);
     delete this->fs;
-    delete this->tmp_vec_field;
+    field_pool<rnumber, be, THREE>::release(this->tmp_vec_field);
     return EXIT_SUCCESS;
 }
 
@@ -98,8 +113,9 @@ int NSVE<rnumber>::finalize(void)
  *  don't break it.
  */
 
-template <typename rnumber>
-int NSVE<rnumber>::do_stats()
+template <typename rnumber,
+          field_backend be>
+int NSVE<rnumber, be>::do_stats()
 {
     if (!(this->iteration % this->niter_stat == 0))
         return EXIT_SUCCESS;
@@ -134,6 +150,8 @@ int NSVE<rnumber>::do_stats()
     return EXIT_SUCCESS;
 }
 
-template class NSVE<float>;
-template class NSVE<double>;
+template class NSVE<float, FFTW>;
+template class NSVE<double, FFTW>;
+template class NSVE<float, PENCIL>;
+template class NSVE<double, PENCIL>;
 
@@ -34,12 +34,22 @@
 #include "vorticity_equation.hpp"
 #include "full_code/direct_numerical_simulation.hpp"
 
-template <typename rnumber>
+/** \brief Navier-Stokes solver in vorticity form.
+ *
+ *  The backend selects the parallel FFT: `FFTW` slabs can use at most `nz`
+ *  processes, `PENCIL` decompositions go beyond that (the process grid is
+ *  set by the `pencil_process_rows` parameter, 0 meaning automatic).
+ */
+
+template <typename rnumber,
+          field_backend be = FFTW>
 class NSVE: public direct_numerical_simulation
 {
     public:
 
         /* parameters that are read in read_parameters */
+        int batched_transforms;
+        int compute_quantiles;
         double dt;
         double famplitude;
         double fk0;
@@ -49,12 +59,16 @@ class NSVE: public direct_numerical_simulation
         int histogram_bins;
         double max_velocity_estimate;
         double max_vorticity_estimate;
+        int mixed_precision;
         double nu;
+        int pencil_process_rows;
 
         /* other stuff */
-        vorticity_equation<rnumber, FFTW> *fs;
-        field<rnumber, FFTW, THREE> *tmp_vec_field;
-        field<rnumber, FFTW, ONE> *tmp_scal_field;
+        vorticity_equation<rnumber, be> *fs;
+        field<rnumber, be, THREE> *tmp_vec_field;
+        field<rnumber, be, ONE> *tmp_scal_field;
+        /* used when async_checkpoints is nonzero */
+        async_file_writer checkpoint_writer;
 
 
         NSVE(
@@ -2,13 +2,14 @@
 #include <cmath>
 #include "NSVE_field_stats.hpp"
 #include "scope_timer.hpp"
+#include "field_pool.hpp"
 
 
 template <typename rnumber>
 int NSVE_field_stats<rnumber>::initialize(void)
 {
     this->postprocess::read_parameters();
-    this->vorticity = new field<rnumber, FFTW, THREE>(
+    this->vorticity = field_pool<rnumber, FFTW, THREE>::acquire(
             nx, ny, nz,
             this->comm,
             DEFAULT_FFTW_FLAG);
@@ -78,7 +79,7 @@ int NSVE_field_stats<rnumber>::finalize(void)
 {
     if (this->bin_IO != NULL)
         delete this->bin_IO;
-    delete this->vorticity;
+    field_pool<rnumber, FFTW, THREE>::release(this->vorticity);
     return EXIT_SUCCESS;
 }
 
@@ -3,6 +3,7 @@
 #include "NSVEparticles.hpp"
 #include "scope_timer.hpp"
 #include "particles/particles_sampling.hpp"
+#include "field_pool.hpp"
 
 template <typename rnumber>
 int NSVEparticles<rnumber>::initialize(void)
@@ -20,13 +21,23 @@ int NSVEparticles<rnumber>::initialize(void)
                 tracers0_neighbours,        // parameter (interpolation no neighbours)
                 tracers0_smoothness,        // parameter
                 this->comm,
-                this->fs->iteration+1);
+                this->fs->iteration+1,
+                tracers0_cell_order != 0,   // keep particles sorted by cell
+                particles_exchange_mode(tracers0_exchange_mode)); // 0 auto, 1 send particles, 2 field halo
     this->particles_output_writer_mpi = new particles_output_hdf5<
         long long int, double, 3, 3>(
                 MPI_COMM_WORLD,
                 "tracers0",
                 nparticles,
                 tracers0_integration_steps);
+    if (this->async_checkpoints)
+        this->particles_output_writer_mpi->set_async_writer(&this->checkpoint_writer);
+    this->particles_sample_writer_mpi = new particles_output_sampling_hdf5<
+        long long int, double, 3, 6>(
+                MPI_COMM_WORLD,
+                this->ps->getGlobalNbParticles(),
+                (this->simname + "_particles.h5"),
+                "tracers0");
     return EXIT_SUCCESS;
 }
 
@@ -61,6 +72,7 @@ int NSVEparticles<rnumber>::finalize(void)
     this->NSVE<rnumber>::finalize();
     this->ps.release();
     delete this->particles_output_writer_mpi;
+    delete this->particles_sample_writer_mpi;
     return EXIT_SUCCESS;
 }
 
@@ -77,23 +89,26 @@ int NSVEparticles<rnumber>::do_stats()
     if (!(this->iteration % this->niter_part == 0))
         return EXIT_SUCCESS;
 
-    /// sample velocity
-    sample_from_particles_system(*this->tmp_vec_field,              // field to save
-                                 this->ps,
-                                 (this->simname + "_particles.h5"), // filename
-                                 "tracers0",                        // hdf5 parent group
-                                 "velocity"                         // dataset basename TODO
-                                 );
+    /// compute acceleration, `tmp_vec_field` keeps the velocity
+    field<rnumber, FFTW, THREE> *acceleration = field_pool<rnumber, FFTW, THREE>::acquire(
+            this->nx, this->ny, this->nz,
+            this->comm,
+            DEFAULT_FFTW_FLAG);
+    this->fs->compute_Lagrangian_acceleration(acceleration);
+    acceleration->ift();
 
-    /// compute acceleration and sample it
-    this->fs->compute_Lagrangian_acceleration(this->tmp_vec_field);
-    this->tmp_vec_field->ift();
-    sample_from_particles_system(*this->tmp_vec_field,
+    /// sample velocity and acceleration with a single exchange
+    particles_field_set<rnumber> sampled_fields;
+    sampled_fields.add(*this->tmp_vec_field);
+    sampled_fields.add(*acceleration);
+    sample_from_particles_system(sampled_fields,
+                                 {"velocity", "acceleration"},      // dataset basenames
                                  this->ps,
-                                 (this->simname + "_particles.h5"),
-                                 "tracers0",
-                                 "acceleration");
+                                 *this->particles_sample_writer_mpi,
+                                 (this->simname + "_particles.h5"), // filename
+                                 "tracers0");                       // hdf5 parent group
 
+    field_pool<rnumber, FFTW, THREE>::release(acceleration);
     return EXIT_SUCCESS;
 }
 
@@ -35,6 +35,7 @@
 #include "full_code/NSVE.hpp"
 #include "particles/particles_system_builder.hpp"
 #include "particles/particles_output_hdf5.hpp"
+#include "particles/particles_output_sampling_hdf5.hpp"
 
 /** \brief Navier-Stokes solver that includes simple Lagrangian tracers.
  *
@@ -54,10 +55,14 @@ class NSVEparticles: public NSVE<rnumber>
         int tracers0_integration_steps;
         int tracers0_neighbours;
         int tracers0_smoothness;
+        int tracers0_cell_order;
+        int tracers0_exchange_mode;
 
         /* other stuff */
         std::unique_ptr<abstract_particles_system<long long int, double>> ps;
         particles_output_hdf5<long long int, double,3,3> *particles_output_writer_mpi;
+        /* velocity and acceleration, sampled together */
+        particles_output_sampling_hdf5<long long int, double, 3, 6> *particles_sample_writer_mpi;
 
 
         NSVEparticles(
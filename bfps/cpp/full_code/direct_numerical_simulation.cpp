@@ -93,11 +93,7 @@ int direct_numerical_simulation::main_loop(void)
                     (this->iteration % this->niter_todo));
     for (; this->iteration < max_iter;)
     {
-    #ifdef USE_TIMINGOUTPUT
-        const std::string loopLabel = ("code::main_start::loop-" +
-                                       std::to_string(this->iteration));
-        TIMEZONE(loopLabel.c_str());
-    #endif
+        TIMEZONE("code::main_start::loop");
         this->do_stats();
 
         this->step();
@@ -38,6 +38,12 @@ class direct_numerical_simulation: public code_base
     public:
         int checkpoint;
         int checkpoints_per_file;
+        int async_checkpoints;
+        /* read here as well, but applied through `read_field_io_parameters` */
+        int io_collective;
+        int io_chunked;
+        int io_compression_level;
+        char mpiio_hints[512];
         int niter_out;
         int niter_stat;
         int niter_todo;
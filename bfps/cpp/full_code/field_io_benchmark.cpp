@@ -0,0 +1,193 @@
+#include <string>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <cstdio>
+#include "field_io_benchmark.hpp"
+#include "scope_timer.hpp"
+
+
+template <typename rnumber>
+int field_io_benchmark<rnumber>::initialize(void)
+{
+    this->read_parameters();
+    this->vec_field = new field<rnumber, FFTW, THREE>(
+            nx, ny, nz,
+            this->comm,
+            DEFAULT_FFTW_FLAG);
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int field_io_benchmark<rnumber>::finalize(void)
+{
+    delete this->vec_field;
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int field_io_benchmark<rnumber>::read_parameters()
+{
+    this->test::read_parameters();
+    hid_t parameter_file;
+    hid_t dset;
+    parameter_file = H5Fopen(
+            (this->simname + std::string(".h5")).c_str(),
+            H5F_ACC_RDONLY,
+            H5P_DEFAULT);
+    dset = H5Dopen(parameter_file, "/parameters/niterations", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->niterations);
+    H5Dclose(dset);
+    dset = H5Dopen(parameter_file, "/parameters/compression_level", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->compression_level);
+    H5Dclose(dset);
+    H5Fclose(parameter_file);
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+void field_io_benchmark<rnumber>::time_io(
+        const bool real_space,
+        double *bandwidth)
+{
+    const std::string fname = this->simname + std::string("_io_benchmark.h5");
+    if (this->myrank == 0)
+        std::remove(fname.c_str());
+    MPI_Barrier(this->comm);
+
+    /* smooth data in real space, so that compression has something to do;
+     * random modes in Fourier space */
+    if (real_space)
+    {
+        const double dx = 2*M_PI / this->nx;
+        const double dy = 2*M_PI / this->ny;
+        const double dz = 2*M_PI / this->nz;
+        const hsize_t zstart = this->vec_field->rlayout->starts[0];
+        this->vec_field->RLOOP(
+                [&](ptrdiff_t rindex,
+                    ptrdiff_t xindex,
+                    ptrdiff_t yindex,
+                    ptrdiff_t zindex){
+            const double x = xindex*dx;
+            const double y = yindex*dy;
+            const double z = (zindex + zstart)*dz;
+            this->vec_field->rval(rindex, 0) = rnumber(sin(x)*cos(y)*cos(2*z));
+            this->vec_field->rval(rindex, 1) = rnumber(cos(x)*sin(y)*cos(2*z));
+            this->vec_field->rval(rindex, 2) = rnumber(-sin(x)*sin(3*y)*cos(z));
+        });
+        this->vec_field->real_space_representation = true;
+    }
+    else
+    {
+        std::mt19937_64 rgen(this->myrank + 1);
+        std::uniform_real_distribution<double> rdist(-1, 1);
+        for (hsize_t tindex = 0; tindex < this->vec_field->clayout->local_size; tindex++)
+            for (int i=0; i<2; i++)
+                this->vec_field->get_cdata()[tindex][i] = rnumber(rdist(rgen));
+        this->vec_field->real_space_representation = false;
+    }
+
+    const double nbytes = (real_space ?
+            double(this->vec_field->rlayout->full_size) :
+            2*double(this->vec_field->clayout->full_size))*sizeof(rnumber);
+
+    double local_time[2];
+    MPI_Barrier(this->comm);
+    double time_start = MPI_Wtime();
+    for (int iteration = 0; iteration < this->niterations; iteration++)
+        this->vec_field->io(fname, "field", iteration, false);
+    local_time[0] = MPI_Wtime() - time_start;
+
+    MPI_Barrier(this->comm);
+    time_start = MPI_Wtime();
+    for (int iteration = 0; iteration < this->niterations; iteration++)
+        this->vec_field->io(fname, "field", iteration, true);
+    local_time[1] = MPI_Wtime() - time_start;
+
+    double max_time[2];
+    MPI_Allreduce(local_time, max_time, 2, MPI_DOUBLE, MPI_MAX, this->comm);
+    for (int i=0; i<2; i++)
+        bandwidth[i] = nbytes*this->niterations / max_time[i] / 1e9;
+    if (this->myrank == 0)
+        std::remove(fname.c_str());
+}
+
+template <typename rnumber>
+int field_io_benchmark<rnumber>::do_work(void)
+{
+    const field_io_parameters original_settings = field_io_settings;
+    std::vector<int> configuration;
+    std::vector<double> bandwidth;
+    for (int real_space = 0; real_space < 2; real_space++)
+    for (int collective = 0; collective < 2; collective++)
+    for (int chunked = 0; chunked < 2; chunked++)
+    for (int compressed = 0; compressed < 2; compressed++)
+    {
+        // compression is only applied to real space fields, and it requires
+        // collective transfers into chunked datasets
+        if (compressed && !(real_space && collective && chunked && this->compression_level > 0))
+            continue;
+        field_io_settings.collective = (collective == 1);
+        field_io_settings.chunked = (chunked == 1);
+        field_io_settings.compression_level = (compressed ? this->compression_level : 0);
+        double current_bandwidth[2];
+        this->time_io(real_space == 1, current_bandwidth);
+        configuration.push_back(real_space);
+        configuration.push_back(collective);
+        configuration.push_back(chunked);
+        configuration.push_back(field_io_settings.compression_level);
+        bandwidth.push_back(current_bandwidth[0]);
+        bandwidth.push_back(current_bandwidth[1]);
+        if (this->myrank == 0)
+            std::cout << (real_space ? "real" : "complex") <<
+                         (collective ? ", collective" : ", independent") <<
+                         (chunked ? ", chunked" : ", contiguous") <<
+                         ", compression " << field_io_settings.compression_level <<
+                         ": write " << current_bandwidth[0] <<
+                         " GB/s, read " << current_bandwidth[1] <<
+                         " GB/s" << std::endl;
+    }
+    field_io_settings.collective = original_settings.collective;
+    field_io_settings.chunked = original_settings.chunked;
+    field_io_settings.compression_level = original_settings.compression_level;
+
+    if (this->myrank == 0)
+    {
+        hid_t stat_file = H5Fopen(
+                (this->simname + std::string(".h5")).c_str(),
+                H5F_ACC_RDWR,
+                H5P_DEFAULT);
+        hsize_t dims[2] = {bandwidth.size() / 2, 4};
+        hid_t space = H5Screate_simple(2, dims, NULL);
+        hid_t dset = H5Dcreate(
+                stat_file,
+                "io_configuration",
+                H5T_NATIVE_INT,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &configuration.front());
+        H5Dclose(dset);
+        H5Sclose(space);
+        dims[1] = 2;
+        space = H5Screate_simple(2, dims, NULL);
+        dset = H5Dcreate(
+                stat_file,
+                "io_bandwidth",
+                H5T_NATIVE_DOUBLE,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &bandwidth.front());
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(stat_file);
+    }
+    return EXIT_SUCCESS;
+}
+
+template class field_io_benchmark<float>;
+template class field_io_benchmark<double>;
+
@@ -0,0 +1,79 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+#ifndef FIELD_IO_BENCHMARK_HPP
+#define FIELD_IO_BENCHMARK_HPP
+
+
+
+#include <cstdlib>
+#include "base.hpp"
+#include "field.hpp"
+#include "full_code/test.hpp"
+
+/** \brief Bandwidth of `field::io` for the possible I/O settings.
+ *
+ *  A vector field is written and read back `niterations` times, in real
+ *  space and in Fourier space, for independent and collective transfers into
+ *  contiguous and chunked datasets; real space fields are also written
+ *  compressed at level `compression_level`.
+ *  The `mpiio_hints` parameter applies to all configurations.
+ *  The configurations are stored as `/io_configuration` (real space,
+ *  collective, chunked, compression level), and the corresponding write and
+ *  read bandwidths in GB/s as `/io_bandwidth`.
+ */
+
+template <typename rnumber>
+class field_io_benchmark: public test
+{
+    public:
+
+        /* parameters that are read in read_parameters */
+        int niterations;
+        int compression_level;
+
+        /* other stuff */
+        field<rnumber, FFTW, THREE> *vec_field;
+
+        field_io_benchmark(
+                const MPI_Comm COMMUNICATOR,
+                const std::string &simulation_name):
+            test(
+                    COMMUNICATOR,
+                    simulation_name){}
+        ~field_io_benchmark(){}
+
+        int initialize(void);
+        int do_work(void);
+        int finalize(void);
+        int read_parameters(void);
+
+        /* returns write and read bandwidth in GB/s */
+        void time_io(
+                const bool real_space,
+                double *bandwidth);
+};
+
+#endif//FIELD_IO_BENCHMARK_HPP
+
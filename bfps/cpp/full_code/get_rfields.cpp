@@ -2,6 +2,7 @@
 #include <cmath>
 #include "get_rfields.hpp"
 #include "scope_timer.hpp"
+#include "field_pool.hpp"
 
 
 template <typename rnumber>
@@ -37,7 +38,7 @@ int get_rfields<rnumber>::work_on_current_iteration(void)
 {
     DEBUG_MSG("entered get_rfields::work_on_current_iteration\n");
     this->read_current_cvorticity();
-    field<rnumber, FFTW, THREE> *vel = new field<rnumber, FFTW, THREE>(
+    field<rnumber, FFTW, THREE> *vel = field_pool<rnumber, FFTW, THREE>::acquire(
             this->nx, this->ny, this->nz,
             this->comm,
             this->vorticity->fftw_plan_rigor);
@@ -76,7 +77,7 @@ int get_rfields<rnumber>::work_on_current_iteration(void)
             this->iteration,
             false);
 
-    delete vel;
+    field_pool<rnumber, FFTW, THREE>::release(vel);
     return EXIT_SUCCESS;
 }
 
@@ -2,6 +2,7 @@
 #include <cmath>
 #include "joint_acc_vel_stats.hpp"
 #include "scope_timer.hpp"
+#include "field_pool.hpp"
 
 
 template <typename rnumber>
@@ -106,7 +107,7 @@ int joint_acc_vel_stats<rnumber>::work_on_current_iteration(void)
     field<rnumber, FFTW, THREE> *acc;
 
     /// compute velocity
-    vel = new field<rnumber, FFTW, THREE>(
+    vel = field_pool<rnumber, FFTW, THREE>::acquire(
             this->nx, this->ny, this->nz,
             this->comm,
             DEFAULT_FFTW_FLAG);
@@ -148,7 +149,7 @@ int joint_acc_vel_stats<rnumber>::work_on_current_iteration(void)
             max_acc_estimate,
             max_vel_estimate);
 
-    delete vel;
+    field_pool<rnumber, FFTW, THREE>::release(vel);
 
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,114 @@
+#include <string>
+#include <cmath>
+#include <vector>
+#include <iostream>
+#include <omp.h>
+#include "kspace_test.hpp"
+#include "scope_timer.hpp"
+
+
+template <typename rnumber>
+int kspace_test<rnumber>::initialize(void)
+{
+    this->read_parameters();
+    this->scal_field = new field<rnumber, FFTW, ONE>(
+            nx, ny, nz,
+            this->comm,
+            DEFAULT_FFTW_FLAG);
+    this->kk = new kspace<FFTW, SMOOTH>(
+            this->scal_field->clayout, this->dkx, this->dky, this->dkz);
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int kspace_test<rnumber>::finalize(void)
+{
+    delete this->scal_field;
+    delete this->kk;
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int kspace_test<rnumber>::do_work(void)
+{
+    // per thread counts of the modes outside the tables, with a wrong
+    // dealiasing factor and with a wrong spectrum shell
+    std::vector<long long int> errors_per_thread(3*omp_get_max_threads(), 0);
+    if (this->kk->nk2shells > 0)
+        this->kk->CLOOP_K2(
+                [&](ptrdiff_t cindex,
+                    ptrdiff_t xindex,
+                    ptrdiff_t yindex,
+                    ptrdiff_t zindex,
+                    double k2){
+            long long int *errors = &errors_per_thread[3*omp_get_thread_num()];
+            const int k2shell = this->kk->get_k2shell(k2);
+            if (k2shell < 0 || k2shell >= this->kk->nk2shells)
+            {
+                errors[0]++;
+                return;
+            }
+            const double dealias_factor = exp(-36.0 * pow(k2/this->kk->kM2, 18.));
+            if (std::abs(this->kk->get_dealias_factor(k2) - dealias_factor) > 1e-12)
+                errors[1]++;
+            if (this->kk->spectrum_shell[k2shell] != int(sqrt(k2) / this->kk->dk))
+                errors[2]++;
+                });
+    long long int errors[3] = {0, 0, 0};
+    for (int thread = 0; thread < omp_get_max_threads(); thread++)
+        for (int check = 0; check < 3; check++)
+            errors[check] += errors_per_thread[3*thread + check];
+    MPI_Allreduce(MPI_IN_PLACE, errors, 3, MPI_LONG_LONG_INT, MPI_SUM, this->comm);
+    if (this->myrank == 0)
+        std::cout << "nk2shells = " << this->kk->nk2shells <<
+                     ", modes outside the tables " << errors[0] <<
+                     ", wrong dealiasing factors " << errors[1] <<
+                     ", wrong spectrum shells " << errors[2] << std::endl;
+
+    if (this->myrank == 0)
+    {
+        hid_t stat_file = H5Fopen(
+                (this->simname + std::string(".h5")).c_str(),
+                H5F_ACC_RDWR,
+                H5P_DEFAULT);
+        hid_t group = H5Gcreate(
+                stat_file,
+                "kspace_test",
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        hsize_t dims[1] = {1};
+        hid_t space = H5Screate_simple(1, dims, NULL);
+        hid_t dset = H5Dcreate(
+                group,
+                "nk2shells",
+                H5T_NATIVE_INT,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->kk->nk2shells);
+        H5Dclose(dset);
+        H5Sclose(space);
+        dims[0] = 3;
+        space = H5Screate_simple(1, dims, NULL);
+        dset = H5Dcreate(
+                group,
+                "errors",
+                H5T_NATIVE_LLONG,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, errors);
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Gclose(group);
+        H5Fclose(stat_file);
+    }
+    return EXIT_SUCCESS;
+}
+
+template class kspace_test<float>;
+template class kspace_test<double>;
+
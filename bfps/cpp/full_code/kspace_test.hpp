@@ -0,0 +1,73 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#ifndef KSPACE_TEST_HPP
+#define KSPACE_TEST_HPP
+
+
+
+#include <cstdlib>
+#include "base.hpp"
+#include "kspace.hpp"
+#include "field.hpp"
+#include "full_code/test.hpp"
+
+/** \brief Consistency of the per shell tables of `kspace`.
+ *
+ *  Every mode of the grid, which does not need to be cubic, is checked
+ *  against the dense tables indexed by the k2 shell: the shell must be
+ *  inside the tables, and the tabulated dealiasing factor and spectrum
+ *  shell must match the values computed from k2 directly.
+ *  The number of shells is stored as `/kspace_test/nk2shells`, and the
+ *  number of modes that fail each of the three checks as
+ *  `/kspace_test/errors`.
+ */
+
+template <typename rnumber>
+class kspace_test: public test
+{
+    public:
+
+        /* other stuff */
+        kspace<FFTW, SMOOTH> *kk;
+        field<rnumber, FFTW, ONE> *scal_field;
+
+        kspace_test(
+                const MPI_Comm COMMUNICATOR,
+                const std::string &simulation_name):
+            test(
+                    COMMUNICATOR,
+                    simulation_name){}
+        ~kspace_test(){}
+
+        int initialize(void);
+        int do_work(void);
+        int finalize(void);
+};
+
+#endif//KSPACE_TEST_HPP
+
@@ -34,6 +34,8 @@
 #include <iostream>
 #include "base.hpp"
 #include "field.hpp"
+#include "field_pool.hpp"
+#include "fftw_wisdom.hpp"
 #include "scope_timer.hpp"
 
 int myrank, nprocs;
@@ -97,11 +99,15 @@ int main_code(
 
 
 
-    /* import fftw wisdom */
-    if (myrank == 0)
-        fftwf_import_wisdom_from_filename(
-                (simname + std::string("_fftw_wisdom.txt")).c_str());
-    fftwf_mpi_broadcast_wisdom(MPI_COMM_WORLD);
+    /* import fftw wisdom of both precisions, see fftw_wisdom.hpp */
+    import_fftw_wisdom(simname, MPI_COMM_WORLD);
+
+
+
+    /* HDF5 field I/O settings */
+    read_field_io_parameters(
+            simname + std::string(".h5"),
+            MPI_COMM_WORLD);
 
 
 
@@ -123,6 +129,7 @@ int main_code(
             simname);
     int return_value;
     return_value = dns->initialize();
+    report_fftw_planning_statistics(MPI_COMM_WORLD);
     if (return_value == EXIT_SUCCESS)
         return_value = dns->main_loop();
     else
@@ -138,15 +145,13 @@ int main_code(
                   return_value);
 
     delete dns;
+    report_field_pool_statistics(MPI_COMM_WORLD);
+    clear_field_pools();
 
 
 
-    /* export fftw wisdom */
-    fftwf_mpi_gather_wisdom(MPI_COMM_WORLD);
-    MPI_Barrier(MPI_COMM_WORLD);
-    if (myrank == 0)
-        fftwf_export_wisdom_to_filename(
-                (simname + std::string("_fftw_wisdom.txt")).c_str());
+    /* export fftw wisdom, only written if new plans were created */
+    export_fftw_wisdom(MPI_COMM_WORLD);
 
 
 
@@ -163,6 +168,12 @@ int main_code(
     global_timer_manager.show(MPI_COMM_WORLD);
     global_timer_manager.showHtml(MPI_COMM_WORLD);
 #endif
+#ifdef USE_TRACEOUTPUT
+    global_event_tracer.write(
+            MPI_COMM_WORLD,
+            getenv("TRACEOUTPUT") ? getenv("TRACEOUTPUT") : simname + std::string("_trace"));
+#endif
+    clear_field_io_parameters();
 
     MPI_Finalize();
     return EXIT_SUCCESS;
@@ -2,13 +2,14 @@
 #include <cmath>
 #include "native_binary_to_hdf5.hpp"
 #include "scope_timer.hpp"
+#include "field_pool.hpp"
 
 
 template <typename rnumber>
 int native_binary_to_hdf5<rnumber>::initialize(void)
 {
     this->read_parameters();
-    this->vec_field = new field<rnumber, FFTW, THREE>(
+    this->vec_field = field_pool<rnumber, FFTW, THREE>::acquire(
             nx, ny, nz,
             this->comm,
             DEFAULT_FFTW_FLAG);
@@ -46,7 +47,7 @@ template <typename rnumber>
 int native_binary_to_hdf5<rnumber>::finalize(void)
 {
     delete this->bin_IO;
-    delete this->vec_field;
+    field_pool<rnumber, FFTW, THREE>::release(this->vec_field);
     return EXIT_SUCCESS;
 }
 
@@ -0,0 +1,243 @@
+#include <string>
+#include <cmath>
+#include <random>
+#include <memory>
+#include <algorithm>
+#include "particles_interpolation_benchmark.hpp"
+#include "scope_timer.hpp"
+#include "omputils.hpp"
+#include "particles/particles_field_computer.hpp"
+#include "particles/particles_generic_interp.hpp"
+#include "particles/particles_system_builder.hpp"
+
+
+template <typename rnumber>
+struct particles_interpolation_benchmark_container {
+    template <const int interpolation_size, const int spline_mode>
+    static double instanciate(
+            const field<rnumber, FFTW, THREE>* fs_field,
+            const std::array<double,3> spatial_box_width,
+            const double* particles_positions,
+            const long long int nb_particles,
+            const int niterations,
+            MPI_Comm mpi_comm){
+        std::array<size_t,3> field_grid_dim;
+        field_grid_dim[IDX_X] = fs_field->rlayout->sizes[FIELD_IDX_X];
+        field_grid_dim[IDX_Y] = fs_field->rlayout->sizes[FIELD_IDX_Y];
+        field_grid_dim[IDX_Z] = fs_field->rlayout->sizes[FIELD_IDX_Z];
+
+        std::array<double,3> spatial_box_offset;
+        spatial_box_offset.fill(0);
+
+        std::array<double,3> box_step_width;
+        box_step_width[IDX_X] = spatial_box_width[IDX_X]/double(field_grid_dim[IDX_X]);
+        box_step_width[IDX_Y] = spatial_box_width[IDX_Y]/double(field_grid_dim[IDX_Y]);
+        box_step_width[IDX_Z] = spatial_box_width[IDX_Z]/double(field_grid_dim[IDX_Z]);
+
+        const std::pair<int,int> current_partition_interval(
+                int(fs_field->rlayout->starts[FIELD_IDX_Z]),
+                int(fs_field->rlayout->starts[FIELD_IDX_Z] + fs_field->rlayout->subsizes[FIELD_IDX_Z]));
+
+        using interpolator_class = particles_generic_interp<double, interpolation_size, spline_mode>;
+        interpolator_class interpolator;
+        particles_field_computer<long long int, double, interpolator_class, interpolation_size> computer(
+                field_grid_dim,
+                current_partition_interval,
+                interpolator,
+                spatial_box_width,
+                spatial_box_offset,
+                box_step_width);
+
+        std::unique_ptr<double[]> particles_rhs(new double[nb_particles*3]);
+
+        MPI_Barrier(mpi_comm);
+        const double time_start = MPI_Wtime();
+        for (int iteration = 0; iteration < niterations; iteration++)
+        {
+            #pragma omp parallel
+            {
+                const long long int start = OmpUtils::ForIntervalStart(nb_particles);
+                const long long int end = OmpUtils::ForIntervalEnd(nb_particles);
+                computer.template init_result_array<3>(
+                        particles_rhs.get() + start*3,
+                        end - start);
+                computer.template apply_computation<field<rnumber, FFTW, THREE>, 3>(
+                        *fs_field,
+                        particles_positions + start*3,
+                        particles_rhs.get() + start*3,
+                        end - start);
+            }
+        }
+        const double local_time = MPI_Wtime() - time_start;
+
+        double max_time;
+        long long int total_nb_particles;
+        MPI_Allreduce(&local_time, &max_time, 1, MPI_DOUBLE, MPI_MAX, mpi_comm);
+        MPI_Allreduce(&nb_particles, &total_nb_particles, 1, MPI_LONG_LONG_INT, MPI_SUM, mpi_comm);
+        return double(total_nb_particles)*niterations / max_time;
+    }
+};
+
+
+template <typename rnumber>
+int particles_interpolation_benchmark<rnumber>::initialize(void)
+{
+    this->read_parameters();
+    this->vec_field = new field<rnumber, FFTW, THREE>(
+            nx, ny, nz,
+            this->comm,
+            DEFAULT_FFTW_FLAG);
+
+    // random field values, the actual values do not matter here
+    std::mt19937_64 rgen(this->myrank + 1);
+    std::uniform_real_distribution<double> rdist(-1, 1);
+    this->vec_field->real_space_representation = true;
+    const ptrdiff_t local_size = ptrdiff_t(this->vec_field->rmemlayout->local_size);
+    for (ptrdiff_t rindex = 0; rindex < local_size; rindex++)
+        this->vec_field->get_rdata()[rindex] = rnumber(rdist(rgen));
+
+    // particles are uniformly distributed inside the local slab
+    const long long int local_nparticles = (
+            this->nparticles / this->nprocs +
+            ((this->myrank < this->nparticles % this->nprocs) ? 1 : 0));
+    const double zmin = this->vec_field->rlayout->starts[0] * (4*acos(0) / (this->nz*this->dkz));
+    const double zmax = (this->vec_field->rlayout->starts[0] + this->vec_field->rlayout->subsizes[0]) * (
+            4*acos(0) / (this->nz*this->dkz));
+    std::uniform_real_distribution<double> xdist(0, 4*acos(0) / this->dkx);
+    std::uniform_real_distribution<double> ydist(0, 4*acos(0) / this->dky);
+    std::uniform_real_distribution<double> zdist(zmin, zmax);
+    if (this->vec_field->rlayout->subsizes[0] > 0)
+        this->particles_positions.resize(local_nparticles*3);
+    for (long long int idx_part = 0; idx_part < (long long int)(this->particles_positions.size()/3); idx_part++)
+    {
+        this->particles_positions[idx_part*3 + IDX_X] = xdist(rgen);
+        this->particles_positions[idx_part*3 + IDX_Y] = ydist(rgen);
+        this->particles_positions[idx_part*3 + IDX_Z] = zdist(rgen);
+    }
+
+    // same particles, in the Morton order of their cells
+    const double cell_width[3] = {4*acos(0) / (this->nx*this->dkx),
+                                  4*acos(0) / (this->ny*this->dky),
+                                  4*acos(0) / (this->nz*this->dkz)};
+    const long long int nb_particles = (long long int)(this->particles_positions.size()/3);
+    std::vector<std::pair<unsigned long long, long long int>> cell_keys(nb_particles);
+    for (long long int idx_part = 0; idx_part < nb_particles; idx_part++)
+    {
+        cell_keys[idx_part].first = particles_utils::morton_code_3d(
+                int(this->particles_positions[idx_part*3 + IDX_X] / cell_width[IDX_X]),
+                int(this->particles_positions[idx_part*3 + IDX_Y] / cell_width[IDX_Y]),
+                int(this->particles_positions[idx_part*3 + IDX_Z] / cell_width[IDX_Z]));
+        cell_keys[idx_part].second = idx_part;
+    }
+    std::sort(cell_keys.begin(), cell_keys.end());
+    this->particles_positions_cell_order.resize(this->particles_positions.size());
+    for (long long int idx_part = 0; idx_part < nb_particles; idx_part++)
+        std::copy(this->particles_positions.begin() + cell_keys[idx_part].second*3,
+                  this->particles_positions.begin() + cell_keys[idx_part].second*3 + 3,
+                  this->particles_positions_cell_order.begin() + idx_part*3);
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int particles_interpolation_benchmark<rnumber>::finalize(void)
+{
+    delete this->vec_field;
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int particles_interpolation_benchmark<rnumber>::read_parameters()
+{
+    this->test::read_parameters();
+    hid_t parameter_file;
+    hid_t dset;
+    parameter_file = H5Fopen(
+            (this->simname + std::string(".h5")).c_str(),
+            H5F_ACC_RDONLY,
+            H5P_DEFAULT);
+    dset = H5Dopen(parameter_file, "/parameters/nparticles", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->nparticles);
+    H5Dclose(dset);
+    dset = H5Dopen(parameter_file, "/parameters/niterations", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->niterations);
+    H5Dclose(dset);
+    dset = H5Dopen(parameter_file, "/parameters/max_neighbours", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->max_neighbours);
+    H5Dclose(dset);
+    H5Fclose(parameter_file);
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int particles_interpolation_benchmark<rnumber>::do_work(void)
+{
+    std::array<double,3> spatial_box_width;
+    spatial_box_width[IDX_X] = 4 * acos(0) / this->dkx;
+    spatial_box_width[IDX_Y] = 4 * acos(0) / this->dky;
+    spatial_box_width[IDX_Z] = 4 * acos(0) / this->dkz;
+
+    std::vector<double> interpolation_rate(this->max_neighbours*3, 0.0);
+    std::vector<double> interpolation_rate_cell_order(this->max_neighbours*3, 0.0);
+    for (int neighbours = 1; neighbours <= this->max_neighbours; neighbours++)
+    for (int smoothness = 0; smoothness < 3; smoothness++)
+    for (int sorted = 0; sorted < 2; sorted++)
+    {
+        const std::vector<double> &positions = (
+                sorted ? this->particles_positions_cell_order : this->particles_positions);
+        const double rate = Template_double_for_if::evaluate<double,
+                int, 1, 11, 1, // interpolation_size
+                int, 0, 3, 1, // spline_mode
+                particles_interpolation_benchmark_container<rnumber>>(
+                        neighbours,
+                        smoothness,
+                        this->vec_field,
+                        spatial_box_width,
+                        positions.data(),
+                        (long long int)(positions.size()/3),
+                        this->niterations,
+                        this->comm);
+        (sorted ? interpolation_rate_cell_order : interpolation_rate)[(neighbours-1)*3 + smoothness] = rate;
+        if (this->myrank == 0)
+            std::cout << "interpolation with neighbours = " << neighbours <<
+                         ", smoothness = " << smoothness <<
+                         (sorted ? ", cell order" : ", random order") <<
+                         ": " << rate << " interpolations per second" << std::endl;
+    }
+
+    if (this->myrank == 0)
+    {
+        hid_t stat_file = H5Fopen(
+                (this->simname + std::string(".h5")).c_str(),
+                H5F_ACC_RDWR,
+                H5P_DEFAULT);
+        hsize_t dims[2] = {hsize_t(this->max_neighbours), 3};
+        hid_t space = H5Screate_simple(2, dims, NULL);
+        hid_t dset = H5Dcreate(
+                stat_file,
+                "interpolation_rate",
+                H5T_NATIVE_DOUBLE,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, interpolation_rate.data());
+        H5Dclose(dset);
+        dset = H5Dcreate(
+                stat_file,
+                "interpolation_rate_cell_order",
+                H5T_NATIVE_DOUBLE,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, interpolation_rate_cell_order.data());
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(stat_file);
+    }
+    return EXIT_SUCCESS;
+}
+
+template class particles_interpolation_benchmark<float>;
+template class particles_interpolation_benchmark<double>;
+
@@ -0,0 +1,83 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#ifndef PARTICLES_INTERPOLATION_BENCHMARK_HPP
+#define PARTICLES_INTERPOLATION_BENCHMARK_HPP
+
+
+
+#include <cstdlib>
+#include <vector>
+#include "base.hpp"
+#include "field.hpp"
+#include "full_code/test.hpp"
+
+/** \brief Microbenchmark of the particle interpolation kernel.
+ *
+ *  A random real space vector field is interpolated at `nparticles`
+ *  randomly placed particles, `niterations` times, for every interpolation
+ *  size up to `max_neighbours` and every smoothness available.
+ *  The number of interpolations per second is printed, and stored in the
+ *  simulation file as `/interpolation_rate` (indexed by neighbours-1 and
+ *  smoothness).
+ *  The same particles are also interpolated after sorting them in the
+ *  Morton order of their cells, as done by `particles_system` when
+ *  `cell_order` is on; those rates are stored as
+ *  `/interpolation_rate_cell_order`.
+ */
+
+template <typename rnumber>
+class particles_interpolation_benchmark: public test
+{
+    public:
+
+        /* parameters that are read in read_parameters */
+        long long int nparticles;
+        int niterations;
+        int max_neighbours;
+
+        /* other stuff */
+        field<rnumber, FFTW, THREE> *vec_field;
+        std::vector<double> particles_positions;
+        std::vector<double> particles_positions_cell_order;
+
+        particles_interpolation_benchmark(
+                const MPI_Comm COMMUNICATOR,
+                const std::string &simulation_name):
+            test(
+                    COMMUNICATOR,
+                    simulation_name){}
+        ~particles_interpolation_benchmark(){}
+
+        int initialize(void);
+        int do_work(void);
+        int finalize(void);
+        int read_parameters(void);
+};
+
+#endif//PARTICLES_INTERPOLATION_BENCHMARK_HPP
+
@@ -0,0 +1,228 @@
+#include <string>
+#include <cmath>
+#include <random>
+#include <memory>
+#include <array>
+#include <fstream>
+#include <unistd.h>
+#include "particles_memory_test.hpp"
+#include "scope_timer.hpp"
+#include "particles/particles_distr_mpi.hpp"
+
+
+/* minimal computer class: every process adds one to the right hand side of
+ * the particles it sees */
+struct particles_memory_test_computer {
+    int nz;
+    double dz;
+
+    int pbc_field_layer(const double& a_z_pos, const int /*idx_dim*/) const {
+        const int nb_level_to_pos = int(floor(a_z_pos/dz));
+        return ((nb_level_to_pos%nz)+nz)%nz;
+    }
+
+    template <int size_particle_rhs>
+    void init_result_array(double particles_current_rhs[],
+                           const long long int nb_particles) const {
+        std::fill_n(particles_current_rhs, nb_particles*size_particle_rhs, 0);
+    }
+
+    template <class field_class, int size_particle_rhs>
+    void apply_computation(const field_class& /*in_field*/,
+                           const double /*particles_positions*/[],
+                           double particles_current_rhs[],
+                           const long long int nb_particles) const {
+        for(long long int idx = 0 ; idx < nb_particles*size_particle_rhs ; ++idx)
+            particles_current_rhs[idx] += 1;
+    }
+
+    template <int size_particle_rhs>
+    void reduce_particles_rhs(double particles_current_rhs[],
+                              const double extra_particles_current_rhs[],
+                              const long long int nb_particles) const {
+        for(long long int idx = 0 ; idx < nb_particles*size_particle_rhs ; ++idx)
+            particles_current_rhs[idx] += extra_particles_current_rhs[idx];
+    }
+};
+
+/* current resident set size in kB, 0 if it can not be read */
+static long long int particles_memory_test_rss_kB()
+{
+    std::ifstream statm("/proc/self/statm");
+    long long int total_pages = 0, resident_pages = 0;
+    if (!(statm >> total_pages >> resident_pages))
+        return 0;
+    return resident_pages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+template <typename rnumber>
+int particles_memory_test<rnumber>::initialize(void)
+{
+    this->read_parameters();
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int particles_memory_test<rnumber>::finalize(void)
+{
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int particles_memory_test<rnumber>::read_parameters()
+{
+    this->test::read_parameters();
+    hid_t parameter_file;
+    hid_t dset;
+    parameter_file = H5Fopen(
+            (this->simname + std::string(".h5")).c_str(),
+            H5F_ACC_RDONLY,
+            H5P_DEFAULT);
+    dset = H5Dopen(parameter_file, "/parameters/nparticles", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->nparticles);
+    H5Dclose(dset);
+    dset = H5Dopen(parameter_file, "/parameters/niterations", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->niterations);
+    H5Dclose(dset);
+    dset = H5Dopen(parameter_file, "/parameters/max_neighbours", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->max_neighbours);
+    H5Dclose(dset);
+    H5Fclose(parameter_file);
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int particles_memory_test<rnumber>::do_work(void)
+{
+    const double lx = 4 * acos(0) / this->dkx;
+    const double ly = 4 * acos(0) / this->dky;
+    const double lz = 4 * acos(0) / this->dkz;
+    particles_memory_test_computer computer;
+    computer.nz = this->nz;
+    computer.dz = lz / this->nz;
+    int dummy_field = 0;
+
+    // same kind of slab decomposition as FFTW: processes at the end may be empty
+    const int block_size = (this->nz + this->nprocs - 1) / this->nprocs;
+    const std::pair<int,int> current_partition_interval(
+            std::min(this->myrank*block_size, this->nz),
+            std::min((this->myrank+1)*block_size, this->nz));
+    const int current_partition_size = current_partition_interval.second - current_partition_interval.first;
+    std::array<size_t,3> field_grid_dim;
+    field_grid_dim[IDX_X] = this->nx;
+    field_grid_dim[IDX_Y] = this->ny;
+    field_grid_dim[IDX_Z] = this->nz;
+
+    particles_distr_mpi<long long int, double> distr(
+            this->comm,
+            current_partition_interval,
+            field_grid_dim);
+
+    std::unique_ptr<long long int[]> nb_particles_per_partition(new long long int[std::max(current_partition_size, 1)]);
+    long long int nb_particles = 0;
+    for (int idx_partition = 0; idx_partition < current_partition_size; idx_partition++)
+    {
+        const int layer = current_partition_interval.first + idx_partition;
+        nb_particles_per_partition[idx_partition] = (
+                this->nparticles / this->nz +
+                ((layer < this->nparticles % this->nz) ? 1 : 0));
+        nb_particles += nb_particles_per_partition[idx_partition];
+    }
+    long long int first_index = 0;
+    MPI_Exscan(&nb_particles, &first_index, 1, MPI_LONG_LONG_INT, MPI_SUM, this->comm);
+    if (this->myrank == 0)
+        first_index = 0;
+
+    std::mt19937_64 rgen(this->myrank + 1);
+    std::uniform_real_distribution<double> udist(0, 1);
+    std::unique_ptr<double[]> positions(new double[nb_particles*3]);
+    std::unique_ptr<double[]> rhs[1];
+    rhs[0].reset(new double[nb_particles*3]);
+    std::unique_ptr<long long int[]> indexes(new long long int[nb_particles]);
+    long long int idx_part = 0;
+    for (int idx_partition = 0; idx_partition < current_partition_size; idx_partition++)
+    for (long long int ii = 0; ii < nb_particles_per_partition[idx_partition]; ii++, idx_part++)
+    {
+        positions[idx_part*3 + IDX_X] = udist(rgen)*lx;
+        positions[idx_part*3 + IDX_Y] = udist(rgen)*ly;
+        positions[idx_part*3 + IDX_Z] = (current_partition_interval.first + idx_partition + udist(rgen))*computer.dz;
+        indexes[idx_part] = first_index + idx_part;
+    }
+
+    std::uniform_real_distribution<double> ddist(-0.5*computer.dz, 0.5*computer.dz);
+    std::vector<long long int> rss_kB(this->niterations, 0);
+    long long int rss_reference = 0, rss_growth = 0;
+    for (int iteration = 0; iteration < this->niterations; iteration++)
+    {
+        std::fill_n(rhs[0].get(), nb_particles*3, 0);
+        distr.template compute_distr<particles_memory_test_computer, int, 3, 3>(
+                computer,
+                dummy_field,
+                nb_particles_per_partition.get(),
+                positions.get(),
+                rhs[0].get(),
+                this->max_neighbours);
+        for (idx_part = 0; idx_part < nb_particles; idx_part++)
+            positions[idx_part*3 + IDX_Z] += ddist(rgen);
+        distr.template redistribute<particles_memory_test_computer, 3, 3, 1>(
+                computer,
+                nb_particles_per_partition.get(),
+                &nb_particles,
+                &positions,
+                rhs,
+                1,
+                &indexes);
+
+        const long long int rss = particles_memory_test_rss_kB();
+        MPI_Allreduce(&rss, &rss_kB[iteration], 1, MPI_LONG_LONG_INT, MPI_MAX, this->comm);
+        // the buffers reach their high-water mark during the first iterations
+        if (iteration == this->niterations / 4)
+            rss_reference = rss;
+        else if (iteration > this->niterations / 4)
+            rss_growth = std::max(rss_growth, rss - rss_reference);
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &rss_growth, 1, MPI_LONG_LONG_INT, MPI_MAX, this->comm);
+    if (this->myrank == 0)
+        std::cout << "resident set size after " << this->niterations <<
+                     " iterations: " << rss_kB.back() <<
+                     " kB, largest growth " << rss_growth << " kB" << std::endl;
+
+    if (this->myrank == 0)
+    {
+        hid_t stat_file = H5Fopen(
+                (this->simname + std::string(".h5")).c_str(),
+                H5F_ACC_RDWR,
+                H5P_DEFAULT);
+        hsize_t dims[1] = {hsize_t(this->niterations)};
+        hid_t space = H5Screate_simple(1, dims, NULL);
+        hid_t dset = H5Dcreate(
+                stat_file,
+                "rss_kB",
+                H5T_NATIVE_LLONG,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, rss_kB.data());
+        H5Dclose(dset);
+        H5Sclose(space);
+        space = H5Screate(H5S_SCALAR);
+        dset = H5Dcreate(
+                stat_file,
+                "rss_growth_kB",
+                H5T_NATIVE_LLONG,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, &rss_growth);
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(stat_file);
+    }
+    return EXIT_SUCCESS;
+}
+
+template class particles_memory_test<float>;
+template class particles_memory_test<double>;
+
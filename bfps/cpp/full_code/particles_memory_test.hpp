@@ -0,0 +1,72 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+#ifndef PARTICLES_MEMORY_TEST_HPP
+#define PARTICLES_MEMORY_TEST_HPP
+
+
+
+#include <cstdlib>
+#include <vector>
+#include "base.hpp"
+#include "full_code/test.hpp"
+
+/** \brief Long run check of the memory used by the particle communications.
+ *
+ *  `nparticles` particles are placed in the z slabs of the processes, and
+ *  `niterations` times the distributed computation (with `max_neighbours`
+ *  layers on each side) is followed by a displacement of less than one
+ *  grid cell and a redistribution.
+ *  The resident set size of every process is measured after every
+ *  iteration; its maximum over the processes is stored in the simulation
+ *  file as `/rss_kB`, and the largest growth of a single process after the
+ *  first quarter of the iterations as `/rss_growth_kB`.
+ */
+
+template <typename rnumber>
+class particles_memory_test: public test
+{
+    public:
+
+        /* parameters that are read in read_parameters */
+        long long int nparticles;
+        int niterations;
+        int max_neighbours;
+
+        particles_memory_test(
+                const MPI_Comm COMMUNICATOR,
+                const std::string &simulation_name):
+            test(
+                    COMMUNICATOR,
+                    simulation_name){}
+        ~particles_memory_test(){}
+
+        int initialize(void);
+        int do_work(void);
+        int finalize(void);
+        int read_parameters(void);
+};
+
+#endif//PARTICLES_MEMORY_TEST_HPP
+
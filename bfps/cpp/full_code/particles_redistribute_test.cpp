@@ -0,0 +1,201 @@
+#include <string>
+#include <cmath>
+#include <random>
+#include <memory>
+#include <array>
+#include "particles_redistribute_test.hpp"
+#include "scope_timer.hpp"
+#include "particles/particles_distr_mpi.hpp"
+
+
+/* minimal computer class, only the layer of a position is needed here */
+struct particles_redistribute_test_layers {
+    int nz;
+    double dz;
+
+    int pbc_field_layer(const double& a_z_pos, const int /*idx_dim*/) const {
+        const int nb_level_to_pos = int(floor(a_z_pos/dz));
+        return ((nb_level_to_pos%nz)+nz)%nz;
+    }
+};
+
+template <typename rnumber>
+int particles_redistribute_test<rnumber>::initialize(void)
+{
+    this->read_parameters();
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int particles_redistribute_test<rnumber>::finalize(void)
+{
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int particles_redistribute_test<rnumber>::read_parameters()
+{
+    this->test::read_parameters();
+    hid_t parameter_file;
+    hid_t dset;
+    parameter_file = H5Fopen(
+            (this->simname + std::string(".h5")).c_str(),
+            H5F_ACC_RDONLY,
+            H5P_DEFAULT);
+    dset = H5Dopen(parameter_file, "/parameters/nparticles", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->nparticles);
+    H5Dclose(dset);
+    dset = H5Dopen(parameter_file, "/parameters/niterations", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->niterations);
+    H5Dclose(dset);
+    H5Fclose(parameter_file);
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int particles_redistribute_test<rnumber>::do_work(void)
+{
+    const double lx = 4 * acos(0) / this->dkx;
+    const double ly = 4 * acos(0) / this->dky;
+    const double lz = 4 * acos(0) / this->dkz;
+    particles_redistribute_test_layers layers;
+    layers.nz = this->nz;
+    layers.dz = lz / this->nz;
+
+    // same kind of slab decomposition as FFTW: processes at the end may be empty
+    const int block_size = (this->nz + this->nprocs - 1) / this->nprocs;
+    const std::pair<int,int> current_partition_interval(
+            std::min(this->myrank*block_size, this->nz),
+            std::min((this->myrank+1)*block_size, this->nz));
+    const int current_partition_size = current_partition_interval.second - current_partition_interval.first;
+    std::array<size_t,3> field_grid_dim;
+    field_grid_dim[IDX_X] = this->nx;
+    field_grid_dim[IDX_Y] = this->ny;
+    field_grid_dim[IDX_Z] = this->nz;
+
+    particles_distr_mpi<long long int, double> distr(
+            this->comm,
+            current_partition_interval,
+            field_grid_dim);
+
+    // particles are uniformly distributed in the layers of the local slab
+    std::unique_ptr<long long int[]> nb_particles_per_partition(new long long int[std::max(current_partition_size, 1)]);
+    long long int nb_particles = 0;
+    for (int idx_partition = 0; idx_partition < current_partition_size; idx_partition++)
+    {
+        const int layer = current_partition_interval.first + idx_partition;
+        nb_particles_per_partition[idx_partition] = (
+                this->nparticles / this->nz +
+                ((layer < this->nparticles % this->nz) ? 1 : 0));
+        nb_particles += nb_particles_per_partition[idx_partition];
+    }
+    long long int first_index = 0;
+    MPI_Exscan(&nb_particles, &first_index, 1, MPI_LONG_LONG_INT, MPI_SUM, this->comm);
+    if (this->myrank == 0)
+        first_index = 0;
+
+    std::mt19937_64 rgen(this->myrank + 1);
+    std::uniform_real_distribution<double> udist(0, 1);
+    std::unique_ptr<double[]> positions(new double[nb_particles*3]);
+    std::unique_ptr<double[]> rhs[1];
+    rhs[0].reset(new double[nb_particles*3]);
+    std::unique_ptr<long long int[]> indexes(new long long int[nb_particles]);
+    long long int idx_part = 0;
+    for (int idx_partition = 0; idx_partition < current_partition_size; idx_partition++)
+    for (long long int ii = 0; ii < nb_particles_per_partition[idx_partition]; ii++, idx_part++)
+    {
+        positions[idx_part*3 + IDX_X] = udist(rgen)*lx;
+        positions[idx_part*3 + IDX_Y] = udist(rgen)*ly;
+        positions[idx_part*3 + IDX_Z] = (current_partition_interval.first + idx_partition + udist(rgen))*layers.dz;
+        indexes[idx_part] = first_index + idx_part;
+        for (int cc = 0; cc < 3; cc++)
+            rhs[0][idx_part*3 + cc] = double(indexes[idx_part]);
+    }
+
+    long long int total_nb_particles, total_index_sum;
+    long long int local_index_sum = 0;
+    for (idx_part = 0; idx_part < nb_particles; idx_part++)
+        local_index_sum += indexes[idx_part];
+    MPI_Allreduce(&nb_particles, &total_nb_particles, 1, MPI_LONG_LONG_INT, MPI_SUM, this->comm);
+    MPI_Allreduce(&local_index_sum, &total_index_sum, 1, MPI_LONG_LONG_INT, MPI_SUM, this->comm);
+
+    std::vector<int> redistribute_errors(this->niterations, 0);
+    for (int iteration = 0; iteration < this->niterations; iteration++)
+    {
+        // particles only ever leave through the first or last layer of the
+        // slab when they move by less than one cell
+        const double max_displacement = ((iteration % 2 == 0) ? 0.5*layers.dz : 0.5*lz);
+        std::uniform_real_distribution<double> ddist(-max_displacement, max_displacement);
+        for (idx_part = 0; idx_part < nb_particles; idx_part++)
+            positions[idx_part*3 + IDX_Z] += ddist(rgen);
+
+        distr.template redistribute<particles_redistribute_test_layers, 3, 3, 1>(
+                layers,
+                nb_particles_per_partition.get(),
+                &nb_particles,
+                &positions,
+                rhs,
+                1,
+                &indexes);
+
+        int errors = 0;
+        long long int offset = 0;
+        for (int idx_partition = 0; idx_partition < current_partition_size; idx_partition++)
+        {
+            for (idx_part = offset; idx_part < offset + nb_particles_per_partition[idx_partition]; idx_part++)
+                if (layers.pbc_field_layer(positions[idx_part*3 + IDX_Z], IDX_Z) !=
+                        current_partition_interval.first + idx_partition)
+                    errors++;
+            offset += nb_particles_per_partition[idx_partition];
+        }
+        if (offset != nb_particles)
+            errors++;
+        local_index_sum = 0;
+        for (idx_part = 0; idx_part < nb_particles; idx_part++)
+        {
+            local_index_sum += indexes[idx_part];
+            for (int cc = 0; cc < 3; cc++)
+                if (rhs[0][idx_part*3 + cc] != double(indexes[idx_part]))
+                    errors++;
+        }
+        long long int new_total_nb_particles, new_total_index_sum;
+        MPI_Allreduce(&nb_particles, &new_total_nb_particles, 1, MPI_LONG_LONG_INT, MPI_SUM, this->comm);
+        MPI_Allreduce(&local_index_sum, &new_total_index_sum, 1, MPI_LONG_LONG_INT, MPI_SUM, this->comm);
+        MPI_Allreduce(MPI_IN_PLACE, &errors, 1, MPI_INT, MPI_SUM, this->comm);
+        if (new_total_nb_particles != total_nb_particles ||
+            new_total_index_sum != total_index_sum)
+            errors++;
+        redistribute_errors[iteration] = errors;
+        if (this->myrank == 0)
+            std::cout << "redistribute iteration " << iteration <<
+                         ", max displacement " << max_displacement <<
+                         ": " << errors << " errors" << std::endl;
+    }
+
+    if (this->myrank == 0)
+    {
+        hid_t stat_file = H5Fopen(
+                (this->simname + std::string(".h5")).c_str(),
+                H5F_ACC_RDWR,
+                H5P_DEFAULT);
+        hsize_t dims[1] = {hsize_t(this->niterations)};
+        hid_t space = H5Screate_simple(1, dims, NULL);
+        hid_t dset = H5Dcreate(
+                stat_file,
+                "redistribute_errors",
+                H5T_NATIVE_INT,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, redistribute_errors.data());
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(stat_file);
+    }
+    return EXIT_SUCCESS;
+}
+
+template class particles_redistribute_test<float>;
+template class particles_redistribute_test<double>;
+
@@ -0,0 +1,76 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#ifndef PARTICLES_REDISTRIBUTE_TEST_HPP
+#define PARTICLES_REDISTRIBUTE_TEST_HPP
+
+
+
+#include <cstdlib>
+#include <vector>
+#include "base.hpp"
+#include "full_code/test.hpp"
+
+/** \brief Stress test of the particle redistribution.
+ *
+ *  `nparticles` particles are placed in the z slabs of the processes, and
+ *  are then displaced `niterations` times before being redistributed.
+ *  Even iterations move the particles by less than one grid cell, which
+ *  exercises the neighbors exchange, while odd iterations move them by up to
+ *  half the box, i.e. through several slabs.
+ *  After every redistribution the test checks that all particles are inside
+ *  the slab of their process, and that no particle (or its right hand side)
+ *  was lost or duplicated.
+ *  The number of errors per iteration is stored in the simulation file as
+ *  `/redistribute_errors`.
+ */
+
+template <typename rnumber>
+class particles_redistribute_test: public test
+{
+    public:
+
+        /* parameters that are read in read_parameters */
+        long long int nparticles;
+        int niterations;
+
+        particles_redistribute_test(
+                const MPI_Comm COMMUNICATOR,
+                const std::string &simulation_name):
+            test(
+                    COMMUNICATOR,
+                    simulation_name){}
+        ~particles_redistribute_test(){}
+
+        int initialize(void);
+        int do_work(void);
+        int finalize(void);
+        int read_parameters(void);
+};
+
+#endif//PARTICLES_REDISTRIBUTE_TEST_HPP
+
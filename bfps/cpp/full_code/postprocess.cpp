@@ -14,11 +14,7 @@ int postprocess::main_loop(void)
          iteration_counter++)
     {
         this->iteration = iteration_list[iteration_counter];
-    #ifdef USE_TIMINGOUTPUT
-        const std::string loopLabel = ("postprocess::main_loop-" +
-                                       std::to_string(this->iteration));
-        TIMEZONE(loopLabel.c_str());
-    #endif
+        TIMEZONE("postprocess::main_loop");
         this->work_on_current_iteration();
         this->print_simple_timer(
                 "iteration " + std::to_string(this->iteration));
@@ -0,0 +1,177 @@
+#include <string>
+#include <vector>
+#include <omp.h>
+#include "shared_array_merge_benchmark.hpp"
+#include "shared_array.hpp"
+#include "scope_timer.hpp"
+
+
+template <typename rnumber>
+int shared_array_merge_benchmark<rnumber>::initialize(void)
+{
+    this->read_parameters();
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int shared_array_merge_benchmark<rnumber>::finalize(void)
+{
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int shared_array_merge_benchmark<rnumber>::read_parameters()
+{
+    this->test::read_parameters();
+    hid_t parameter_file;
+    hid_t dset;
+    parameter_file = H5Fopen(
+            (this->simname + std::string(".h5")).c_str(),
+            H5F_ACC_RDONLY,
+            H5P_DEFAULT);
+    dset = H5Dopen(parameter_file, "/parameters/niterations", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->niterations);
+    H5Dclose(dset);
+    dset = H5Dopen(parameter_file, "/parameters/histogram_bins", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->histogram_bins);
+    H5Dclose(dset);
+    H5Fclose(parameter_file);
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+template <typename value_type>
+void shared_array_merge_benchmark<rnumber>::time_merge(
+        const size_t array_size,
+        double *timing)
+{
+    std::fill_n(timing, 3, 0.0);
+    // points binned per thread, the order of a local slab per thread
+    const size_t npoints = size_t(this->nx)*this->ny*this->nz / this->nprocs / omp_get_max_threads();
+    for (int iteration = 0; iteration < this->niterations; iteration++)
+    {
+        shared_array<value_type> serial_copies(array_size, [&](value_type *local){
+            std::fill_n(local, array_size, 0);
+        });
+        shared_array<value_type> parallel_copies(array_size, [&](value_type *local){
+            std::fill_n(local, array_size, 0);
+        });
+
+        double time_start = MPI_Wtime();
+        #pragma omp parallel
+        {
+            value_type *serial_local = serial_copies.getMine();
+            value_type *parallel_local = parallel_copies.getMine();
+            size_t bin = size_t(omp_get_thread_num())*7919;
+            for (size_t point = 0; point < npoints; point++)
+            {
+                bin = (bin*1103515245 + 12345) % array_size;
+                serial_local[bin] += 1;
+                parallel_local[bin] += 1;
+            }
+        }
+        timing[0] += MPI_Wtime() - time_start;
+
+        time_start = MPI_Wtime();
+        serial_copies.merge();
+        timing[1] += MPI_Wtime() - time_start;
+
+        time_start = MPI_Wtime();
+        parallel_copies.mergeParallel();
+        timing[2] += MPI_Wtime() - time_start;
+
+        for (size_t i = 0; i < array_size; i++)
+            assert(serial_copies.getMasterData()[i] ==
+                   parallel_copies.getMasterData()[i]);
+    }
+    MPI_Allreduce(MPI_IN_PLACE, timing, 3, MPI_DOUBLE, MPI_MAX, this->comm);
+    for (int i=0; i<3; i++)
+        timing[i] /= this->niterations;
+}
+
+template <typename rnumber>
+int shared_array_merge_benchmark<rnumber>::do_work(void)
+{
+    const int max_threads = omp_get_max_threads();
+    const size_t spectrum_size = 9*size_t(this->nx/2 + 1);
+    const size_t histogram_size = 9*size_t(this->histogram_bins);
+    const size_t joint_histogram_size = histogram_size*this->histogram_bins;
+    std::vector<long long int> configuration;
+    std::vector<double> timing;
+    for (int nthreads = 1; ; nthreads = std::min(2*nthreads, max_threads))
+    {
+        omp_set_num_threads(nthreads);
+        for (int array_type = 0; array_type < 3; array_type++)
+        {
+            double current_timing[3];
+            size_t array_size;
+            switch(array_type)
+            {
+                case 0:
+                    array_size = spectrum_size;
+                    this->time_merge<double>(array_size, current_timing);
+                    break;
+                case 1:
+                    array_size = histogram_size;
+                    this->time_merge<ptrdiff_t>(array_size, current_timing);
+                    break;
+                case 2:
+                    array_size = joint_histogram_size;
+                    this->time_merge<ptrdiff_t>(array_size, current_timing);
+                    break;
+            }
+            configuration.push_back(nthreads);
+            configuration.push_back(array_size);
+            timing.insert(timing.end(), current_timing, current_timing + 3);
+            if (this->myrank == 0)
+                std::cout << nthreads << " threads, " <<
+                             array_size << " values: fill " <<
+                             current_timing[0] << " s, merge " <<
+                             current_timing[1] << " s, mergeParallel " <<
+                             current_timing[2] << " s" << std::endl;
+        }
+        if (nthreads == max_threads)
+            break;
+    }
+    omp_set_num_threads(max_threads);
+
+    if (this->myrank == 0)
+    {
+        hid_t stat_file = H5Fopen(
+                (this->simname + std::string(".h5")).c_str(),
+                H5F_ACC_RDWR,
+                H5P_DEFAULT);
+        hsize_t dims[2] = {configuration.size() / 2, 2};
+        hid_t space = H5Screate_simple(2, dims, NULL);
+        hid_t dset = H5Dcreate(
+                stat_file,
+                "merge_configuration",
+                H5T_NATIVE_LLONG,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, &configuration.front());
+        H5Dclose(dset);
+        H5Sclose(space);
+        dims[1] = 3;
+        space = H5Screate_simple(2, dims, NULL);
+        dset = H5Dcreate(
+                stat_file,
+                "merge_time",
+                H5T_NATIVE_DOUBLE,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &timing.front());
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(stat_file);
+    }
+    return EXIT_SUCCESS;
+}
+
+template class shared_array_merge_benchmark<float>;
+template class shared_array_merge_benchmark<double>;
+
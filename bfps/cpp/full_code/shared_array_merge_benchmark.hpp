@@ -0,0 +1,80 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+#ifndef SHARED_ARRAY_MERGE_BENCHMARK_HPP
+#define SHARED_ARRAY_MERGE_BENCHMARK_HPP
+
+
+
+#include <cstdlib>
+#include "base.hpp"
+#include "full_code/test.hpp"
+
+/** \brief Cost of merging the per-thread copies of a `shared_array`.
+ *
+ *  The arrays are sized like the reductions done by the statistics:
+ *  a cospectrum (`9*(nx/2+1)` doubles), the histograms of a tensor field
+ *  (`9*histogram_bins` integers) and the joint component histograms
+ *  (`9*histogram_bins^2` integers).
+ *  For 1, 2, 4, ... up to the maximum number of OpenMP threads, every thread
+ *  fills its copy as `field::RLOOP` would, then the copies are merged
+ *  `niterations` times with the serial `merge` and with `mergeParallel`.
+ *  The thread count and array size are stored as `/merge_configuration`, the
+ *  average fill, serial merge and parallel merge times in seconds as
+ *  `/merge_time`.
+ */
+
+template <typename rnumber>
+class shared_array_merge_benchmark: public test
+{
+    public:
+
+        /* parameters that are read in read_parameters */
+        int niterations;
+        int histogram_bins;
+
+        shared_array_merge_benchmark(
+                const MPI_Comm COMMUNICATOR,
+                const std::string &simulation_name):
+            test(
+                    COMMUNICATOR,
+                    simulation_name){}
+        ~shared_array_merge_benchmark(){}
+
+        int initialize(void);
+        int do_work(void);
+        int finalize(void);
+        int read_parameters(void);
+
+        /* returns fill, serial merge and parallel merge times in seconds */
+        template <typename value_type>
+        void time_merge(
+                const size_t array_size,
+                double *timing);
+};
+
+#endif//SHARED_ARRAY_MERGE_BENCHMARK_HPP
+
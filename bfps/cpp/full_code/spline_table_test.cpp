@@ -0,0 +1,275 @@
+#include <string>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include "spline_table_test.hpp"
+#include "spline.hpp"
+#include "Lagrange_polys.hpp"
+#include "spline_table.hpp"
+
+
+template <class coefficients>
+void spline_table_beta(
+        const int deriv,
+        const double x[],
+        const int nb_x,
+        double beta[],
+        const int beta_stride)
+{
+    spline_table_evaluate<coefficients>(deriv, x, nb_x, beta, beta_stride);
+}
+
+struct spline_table_kernel
+{
+    int neighbours;
+    // -1 for the Lagrange interpolation
+    int smoothness;
+    void (*function)(const int, const double, double *__restrict__);
+    void (*table)(const int, const double[], const int, double[], const int);
+};
+
+const spline_table_kernel spline_table_kernels[] = {
+    {1, -1, beta_Lagrange_n1, spline_table_beta<Lagrange_coefficients<1>>},
+    {1, 0, beta_n1_m0, spline_table_beta<spline_coefficients<1,0>>},
+    {1, 1, beta_n1_m1, spline_table_beta<spline_coefficients<1,1>>},
+    {1, 2, beta_n1_m2, spline_table_beta<spline_coefficients<1,2>>},
+    {2, -1, beta_Lagrange_n2, spline_table_beta<Lagrange_coefficients<2>>},
+    {2, 0, beta_n2_m0, spline_table_beta<spline_coefficients<2,0>>},
+    {2, 1, beta_n2_m1, spline_table_beta<spline_coefficients<2,1>>},
+    {2, 2, beta_n2_m2, spline_table_beta<spline_coefficients<2,2>>},
+    {2, 3, beta_n2_m3, spline_table_beta<spline_coefficients<2,3>>},
+    {2, 4, beta_n2_m4, spline_table_beta<spline_coefficients<2,4>>},
+    {3, -1, beta_Lagrange_n3, spline_table_beta<Lagrange_coefficients<3>>},
+    {3, 0, beta_n3_m0, spline_table_beta<spline_coefficients<3,0>>},
+    {3, 1, beta_n3_m1, spline_table_beta<spline_coefficients<3,1>>},
+    {3, 2, beta_n3_m2, spline_table_beta<spline_coefficients<3,2>>},
+    {3, 3, beta_n3_m3, spline_table_beta<spline_coefficients<3,3>>},
+    {3, 4, beta_n3_m4, spline_table_beta<spline_coefficients<3,4>>},
+    {3, 5, beta_n3_m5, spline_table_beta<spline_coefficients<3,5>>},
+    {3, 6, beta_n3_m6, spline_table_beta<spline_coefficients<3,6>>},
+    {4, -1, beta_Lagrange_n4, spline_table_beta<Lagrange_coefficients<4>>},
+    {4, 0, beta_n4_m0, spline_table_beta<spline_coefficients<4,0>>},
+    {4, 1, beta_n4_m1, spline_table_beta<spline_coefficients<4,1>>},
+    {4, 2, beta_n4_m2, spline_table_beta<spline_coefficients<4,2>>},
+    {4, 3, beta_n4_m3, spline_table_beta<spline_coefficients<4,3>>},
+    {4, 4, beta_n4_m4, spline_table_beta<spline_coefficients<4,4>>},
+    {4, 5, beta_n4_m5, spline_table_beta<spline_coefficients<4,5>>},
+    {4, 6, beta_n4_m6, spline_table_beta<spline_coefficients<4,6>>},
+    {4, 7, beta_n4_m7, spline_table_beta<spline_coefficients<4,7>>},
+    {4, 8, beta_n4_m8, spline_table_beta<spline_coefficients<4,8>>},
+    {5, -1, beta_Lagrange_n5, spline_table_beta<Lagrange_coefficients<5>>},
+    {5, 0, beta_n5_m0, spline_table_beta<spline_coefficients<5,0>>},
+    {5, 1, beta_n5_m1, spline_table_beta<spline_coefficients<5,1>>},
+    {5, 2, beta_n5_m2, spline_table_beta<spline_coefficients<5,2>>},
+    {5, 3, beta_n5_m3, spline_table_beta<spline_coefficients<5,3>>},
+    {5, 4, beta_n5_m4, spline_table_beta<spline_coefficients<5,4>>},
+    {5, 5, beta_n5_m5, spline_table_beta<spline_coefficients<5,5>>},
+    {5, 6, beta_n5_m6, spline_table_beta<spline_coefficients<5,6>>},
+    {5, 7, beta_n5_m7, spline_table_beta<spline_coefficients<5,7>>},
+    {5, 8, beta_n5_m8, spline_table_beta<spline_coefficients<5,8>>},
+    {5, 9, beta_n5_m9, spline_table_beta<spline_coefficients<5,9>>},
+    {5, 10, beta_n5_m10, spline_table_beta<spline_coefficients<5,10>>},
+    {6, -1, beta_Lagrange_n6, spline_table_beta<Lagrange_coefficients<6>>},
+    {6, 0, beta_n6_m0, spline_table_beta<spline_coefficients<6,0>>},
+    {6, 1, beta_n6_m1, spline_table_beta<spline_coefficients<6,1>>},
+    {6, 2, beta_n6_m2, spline_table_beta<spline_coefficients<6,2>>},
+    {6, 3, beta_n6_m3, spline_table_beta<spline_coefficients<6,3>>},
+    {6, 4, beta_n6_m4, spline_table_beta<spline_coefficients<6,4>>},
+    {6, 5, beta_n6_m5, spline_table_beta<spline_coefficients<6,5>>},
+    {6, 6, beta_n6_m6, spline_table_beta<spline_coefficients<6,6>>},
+    {6, 7, beta_n6_m7, spline_table_beta<spline_coefficients<6,7>>},
+    {6, 8, beta_n6_m8, spline_table_beta<spline_coefficients<6,8>>},
+    {6, 9, beta_n6_m9, spline_table_beta<spline_coefficients<6,9>>},
+    {6, 10, beta_n6_m10, spline_table_beta<spline_coefficients<6,10>>},
+    {6, 11, beta_n6_m11, spline_table_beta<spline_coefficients<6,11>>},
+    {6, 12, beta_n6_m12, spline_table_beta<spline_coefficients<6,12>>},
+    {7, -1, beta_Lagrange_n7, spline_table_beta<Lagrange_coefficients<7>>},
+    {7, 0, beta_n7_m0, spline_table_beta<spline_coefficients<7,0>>},
+    {7, 1, beta_n7_m1, spline_table_beta<spline_coefficients<7,1>>},
+    {7, 2, beta_n7_m2, spline_table_beta<spline_coefficients<7,2>>},
+    {7, 3, beta_n7_m3, spline_table_beta<spline_coefficients<7,3>>},
+    {7, 4, beta_n7_m4, spline_table_beta<spline_coefficients<7,4>>},
+    {8, -1, beta_Lagrange_n8, spline_table_beta<Lagrange_coefficients<8>>},
+    {8, 0, beta_n8_m0, spline_table_beta<spline_coefficients<8,0>>},
+    {8, 1, beta_n8_m1, spline_table_beta<spline_coefficients<8,1>>},
+    {8, 2, beta_n8_m2, spline_table_beta<spline_coefficients<8,2>>},
+    {8, 3, beta_n8_m3, spline_table_beta<spline_coefficients<8,3>>},
+    {8, 4, beta_n8_m4, spline_table_beta<spline_coefficients<8,4>>},
+    {9, -1, beta_Lagrange_n9, spline_table_beta<Lagrange_coefficients<9>>},
+    {9, 0, beta_n9_m0, spline_table_beta<spline_coefficients<9,0>>},
+    {9, 1, beta_n9_m1, spline_table_beta<spline_coefficients<9,1>>},
+    {9, 2, beta_n9_m2, spline_table_beta<spline_coefficients<9,2>>},
+    {9, 3, beta_n9_m3, spline_table_beta<spline_coefficients<9,3>>},
+    {9, 4, beta_n9_m4, spline_table_beta<spline_coefficients<9,4>>},
+    {10, -1, beta_Lagrange_n10, spline_table_beta<Lagrange_coefficients<10>>},
+    {10, 0, beta_n10_m0, spline_table_beta<spline_coefficients<10,0>>},
+    {10, 1, beta_n10_m1, spline_table_beta<spline_coefficients<10,1>>},
+    {10, 2, beta_n10_m2, spline_table_beta<spline_coefficients<10,2>>},
+    {10, 3, beta_n10_m3, spline_table_beta<spline_coefficients<10,3>>},
+    {10, 4, beta_n10_m4, spline_table_beta<spline_coefficients<10,4>>}
+};
+
+template <typename rnumber>
+int spline_table_test<rnumber>::initialize(void)
+{
+    this->read_parameters();
+    // uniformly distributed positions in the cell, plus both ends
+    std::mt19937_64 rgen(this->myrank + 1);
+    std::uniform_real_distribution<double> rdist(0, 1);
+    this->positions.resize(std::max(this->nparticles, 2ll));
+    this->positions[0] = 0;
+    this->positions[1] = std::nextafter(1.0, 0.0);
+    for (size_t idx = 2; idx < this->positions.size(); idx++)
+        this->positions[idx] = rdist(rgen);
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int spline_table_test<rnumber>::finalize(void)
+{
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int spline_table_test<rnumber>::read_parameters()
+{
+    this->test::read_parameters();
+    hid_t parameter_file;
+    hid_t dset;
+    parameter_file = H5Fopen(
+            (this->simname + std::string(".h5")).c_str(),
+            H5F_ACC_RDONLY,
+            H5P_DEFAULT);
+    dset = H5Dopen(parameter_file, "/parameters/nparticles", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->nparticles);
+    H5Dclose(dset);
+    dset = H5Dopen(parameter_file, "/parameters/niterations", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->niterations);
+    H5Dclose(dset);
+    H5Fclose(parameter_file);
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int spline_table_test<rnumber>::do_work(void)
+{
+    // same batches as particles_field_computer
+    const int batch_size = 32;
+    const int nb_kernels = int(sizeof(spline_table_kernels) / sizeof(spline_table_kernel));
+    const int nb_positions = int(this->positions.size());
+    const double *positions = this->positions.data();
+
+    std::vector<long long int> kernel_description(nb_kernels*2);
+    std::vector<double> error(nb_kernels*3);
+    std::vector<double> rate(nb_kernels*3*2);
+    for (int idx_kernel = 0; idx_kernel < nb_kernels; idx_kernel++)
+    {
+        const spline_table_kernel &kernel = spline_table_kernels[idx_kernel];
+        const int nb_polys = 2*kernel.neighbours + 2;
+        kernel_description[idx_kernel*2 + 0] = kernel.neighbours;
+        kernel_description[idx_kernel*2 + 1] = kernel.smoothness;
+        std::vector<double> function_beta(size_t(nb_positions)*nb_polys);
+        std::vector<double> table_beta(nb_polys*batch_size);
+        for (int deriv = 0; deriv < 3; deriv++)
+        {
+            double timing[2];
+            double time_start = MPI_Wtime();
+            for (int iteration = 0; iteration < this->niterations; iteration++)
+                for (int idx = 0; idx < nb_positions; idx++)
+                    kernel.function(deriv, positions[idx], &function_beta[size_t(idx)*nb_polys]);
+            timing[0] = MPI_Wtime() - time_start;
+
+            time_start = MPI_Wtime();
+            for (int iteration = 0; iteration < this->niterations; iteration++)
+                for (int idx_batch = 0; idx_batch < nb_positions; idx_batch += batch_size)
+                    kernel.table(deriv, positions + idx_batch,
+                                 std::min(batch_size, nb_positions - idx_batch),
+                                 table_beta.data(), batch_size);
+            timing[1] = MPI_Wtime() - time_start;
+
+            double max_beta = 0;
+            double max_difference = 0;
+            for (int idx_batch = 0; idx_batch < nb_positions; idx_batch += batch_size)
+            {
+                const int nb_in_batch = std::min(batch_size, nb_positions - idx_batch);
+                kernel.table(deriv, positions + idx_batch, nb_in_batch,
+                             table_beta.data(), batch_size);
+                for (int idx = 0; idx < nb_in_batch; idx++)
+                for (int idx_poly = 0; idx_poly < nb_polys; idx_poly++)
+                {
+                    const double function_value = function_beta[size_t(idx_batch + idx)*nb_polys + idx_poly];
+                    const double table_value = table_beta[idx_poly*batch_size + idx];
+                    max_beta = std::max(max_beta, std::abs(function_value));
+                    max_difference = std::max(max_difference, std::abs(table_value - function_value));
+                }
+            }
+            double current_error = max_difference / std::max(max_beta, 1.0);
+            MPI_Allreduce(MPI_IN_PLACE, &current_error, 1, MPI_DOUBLE, MPI_MAX, this->comm);
+            MPI_Allreduce(MPI_IN_PLACE, timing, 2, MPI_DOUBLE, MPI_MAX, this->comm);
+            error[idx_kernel*3 + deriv] = current_error;
+            for (int idx_method = 0; idx_method < 2; idx_method++)
+                rate[(idx_kernel*3 + deriv)*2 + idx_method] = double(nb_positions)*this->niterations / timing[idx_method];
+            if (this->myrank == 0)
+                std::cout << "neighbours = " << kernel.neighbours <<
+                             (kernel.smoothness < 0 ? std::string(", Lagrange") :
+                                                      ", smoothness = " + std::to_string(kernel.smoothness)) <<
+                             ", deriv = " << deriv <<
+                             ": error " << current_error <<
+                             ", functions " << rate[(idx_kernel*3 + deriv)*2 + 0] <<
+                             ", table " << rate[(idx_kernel*3 + deriv)*2 + 1] <<
+                             " positions per second" << std::endl;
+        }
+    }
+
+    if (this->myrank == 0)
+    {
+        hid_t stat_file = H5Fopen(
+                (this->simname + std::string(".h5")).c_str(),
+                H5F_ACC_RDWR,
+                H5P_DEFAULT);
+        hsize_t dims[3] = {hsize_t(nb_kernels), 2, 2};
+        hid_t space = H5Screate_simple(2, dims, NULL);
+        hid_t dset = H5Dcreate(
+                stat_file,
+                "spline_table_kernel",
+                H5T_NATIVE_LLONG,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, kernel_description.data());
+        H5Dclose(dset);
+        H5Sclose(space);
+        dims[1] = 3;
+        space = H5Screate_simple(2, dims, NULL);
+        dset = H5Dcreate(
+                stat_file,
+                "spline_table_error",
+                H5T_NATIVE_DOUBLE,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, error.data());
+        H5Dclose(dset);
+        H5Sclose(space);
+        space = H5Screate_simple(3, dims, NULL);
+        dset = H5Dcreate(
+                stat_file,
+                "spline_table_rate",
+                H5T_NATIVE_DOUBLE,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, rate.data());
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(stat_file);
+    }
+    return EXIT_SUCCESS;
+}
+
+template class spline_table_test<float>;
+template class spline_table_test<double>;
+
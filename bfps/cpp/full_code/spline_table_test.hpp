@@ -0,0 +1,80 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#ifndef SPLINE_TABLE_TEST_HPP
+#define SPLINE_TABLE_TEST_HPP
+
+
+
+#include <cstdlib>
+#include <vector>
+#include "base.hpp"
+#include "full_code/test.hpp"
+
+/** \brief Accuracy and throughput of the table driven beta polynomials.
+ *
+ *  For every interpolation kernel of `spline_n*.cpp` and `Lagrange_polys.cpp`
+ *  and every derivative, the betas computed by `spline_table_evaluate` at
+ *  `nparticles` random positions are compared with the ones of the
+ *  generated `beta_*` functions, and both are timed over `niterations`
+ *  repetitions; the table is evaluated by batches of 32 positions, as in
+ *  `particles_field_computer`.
+ *  The kernels are stored as `/spline_table_kernel` (neighbours and
+ *  smoothness, -1 for Lagrange), the largest difference, relative to the
+ *  largest beta when it is above 1, as `/spline_table_error` (indexed by
+ *  kernel and derivative), and the number of positions per second of the
+ *  functions and of the table as `/spline_table_rate` (indexed by kernel,
+ *  derivative, then 0 for the functions and 1 for the table).
+ */
+
+template <typename rnumber>
+class spline_table_test: public test
+{
+    public:
+        /* parameters that are read in read_parameters */
+        long long int nparticles;
+        int niterations;
+
+        /* other stuff */
+        std::vector<double> positions;
+
+        spline_table_test(
+                const MPI_Comm COMMUNICATOR,
+                const std::string &simulation_name):
+            test(
+                    COMMUNICATOR,
+                    simulation_name){}
+        ~spline_table_test(){}
+
+        int initialize(void);
+        int do_work(void);
+        int finalize(void);
+        int read_parameters(void);
+};
+
+#endif//SPLINE_TABLE_TEST_HPP
+
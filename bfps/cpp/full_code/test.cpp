@@ -8,9 +8,7 @@
 
 int test::main_loop(void)
 {
-    #ifdef USE_TIMINGOUTPUT
-        TIMEZONE("test::main_loop");
-    #endif
+    TIMEZONE("test::main_loop");
     this->start_simple_timer();
     this->do_work();
     this->print_simple_timer(
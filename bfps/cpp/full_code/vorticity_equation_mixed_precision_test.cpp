@@ -0,0 +1,174 @@
+#include <string>
+#include <cmath>
+#include <random>
+#include "vorticity_equation_mixed_precision_test.hpp"
+#include "field_pool.hpp"
+#include "scope_timer.hpp"
+
+
+template <typename rnumber>
+int vorticity_equation_mixed_precision_test<rnumber>::initialize(void)
+{
+    this->read_parameters();
+    this->fs = new vorticity_equation<rnumber, FFTW>(
+            simname.c_str(),
+            nx, ny, nz,
+            dkx, dky, dkz,
+            DEFAULT_FFTW_FLAG);
+    strncpy(this->fs->forcing_type, "none", 128);
+    this->initial_vorticity = field_pool<rnumber, FFTW, THREE>::acquire(
+            nx, ny, nz,
+            this->comm,
+            DEFAULT_FFTW_FLAG);
+    this->finest_vorticity = field_pool<rnumber, FFTW, THREE>::acquire(
+            nx, ny, nz,
+            this->comm,
+            DEFAULT_FFTW_FLAG);
+    this->double_vorticity = field_pool<rnumber, FFTW, THREE>::acquire(
+            nx, ny, nz,
+            this->comm,
+            DEFAULT_FFTW_FLAG);
+    this->mixed_vorticity = field_pool<rnumber, FFTW, THREE>::acquire(
+            nx, ny, nz,
+            this->comm,
+            DEFAULT_FFTW_FLAG);
+
+    // random vorticity, restricted to the resolved modes
+    std::mt19937_64 rgen(this->myrank + 1);
+    std::uniform_real_distribution<double> rdist(-1, 1);
+    this->fs->cvorticity->real_space_representation = false;
+    for (hsize_t tindex = 0; tindex < this->fs->cvorticity->clayout->local_size; tindex++)
+        for (int i=0; i<2; i++)
+            this->fs->cvorticity->get_cdata()[tindex][i] = rnumber(rdist(rgen));
+    this->fs->kk->template low_pass<rnumber, THREE>(this->fs->cvorticity->get_cdata(), this->fs->kk->kM / 4);
+    this->fs->kk->template force_divfree<rnumber>(this->fs->cvorticity->get_cdata());
+    this->fs->cvorticity->symmetrize();
+
+    // rescale to a root mean square vorticity of order one, so that the
+    // nonlinear term is not negligible
+    double local_norm2 = 0, norm2;
+    for (hsize_t tindex = 0; tindex < this->fs->cvorticity->clayout->local_size; tindex++)
+        for (int i=0; i<2; i++)
+            local_norm2 += 2*double(this->fs->cvorticity->get_cdata()[tindex][i])*this->fs->cvorticity->get_cdata()[tindex][i];
+    MPI_Allreduce(&local_norm2, &norm2, 1, MPI_DOUBLE, MPI_SUM, this->comm);
+    const rnumber scale = rnumber(1 / sqrt(norm2));
+    for (hsize_t tindex = 0; tindex < this->fs->cvorticity->clayout->local_size; tindex++)
+        for (int i=0; i<2; i++)
+            this->fs->cvorticity->get_cdata()[tindex][i] *= scale;
+    *this->initial_vorticity = this->fs->cvorticity->get_cdata();
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int vorticity_equation_mixed_precision_test<rnumber>::finalize(void)
+{
+    field_pool<rnumber, FFTW, THREE>::release(this->initial_vorticity);
+    field_pool<rnumber, FFTW, THREE>::release(this->finest_vorticity);
+    field_pool<rnumber, FFTW, THREE>::release(this->double_vorticity);
+    field_pool<rnumber, FFTW, THREE>::release(this->mixed_vorticity);
+    delete this->fs;
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int vorticity_equation_mixed_precision_test<rnumber>::read_parameters()
+{
+    this->test::read_parameters();
+    hid_t parameter_file;
+    hid_t dset;
+    parameter_file = H5Fopen(
+            (this->simname + std::string(".h5")).c_str(),
+            H5F_ACC_RDONLY,
+            H5P_DEFAULT);
+    dset = H5Dopen(parameter_file, "/parameters/niterations", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->niterations);
+    H5Dclose(dset);
+    H5Fclose(parameter_file);
+    return EXIT_SUCCESS;
+}
+
+/* advance the initial vorticity by `nsteps` steps of size `dt`, and copy the
+ * final vorticity to `result` */
+template <typename rnumber>
+void vorticity_equation_mixed_precision_test<rnumber>::advance(
+        const bool mixed_precision,
+        const double dt,
+        const int nsteps,
+        field<rnumber, FFTW, THREE> *result)
+{
+    this->fs->set_mixed_precision(mixed_precision);
+    *this->fs->cvorticity = this->initial_vorticity->get_cdata();
+    this->fs->iteration = 0;
+    for (int iteration = 0; iteration < nsteps; iteration++)
+        this->fs->step(dt);
+    *result = this->fs->cvorticity->get_cdata();
+}
+
+/* relative L2 norm of a - b, with respect to b */
+template <typename rnumber>
+double vorticity_equation_mixed_precision_test<rnumber>::relative_difference(
+        field<rnumber, FFTW, THREE> *a,
+        field<rnumber, FFTW, THREE> *b)
+{
+    double local_sums[2] = {0, 0};
+    for (hsize_t tindex = 0; tindex < a->clayout->local_size; tindex++)
+        for (int i=0; i<2; i++)
+        {
+            const double diff = double(a->get_cdata()[tindex][i]) - double(b->get_cdata()[tindex][i]);
+            local_sums[0] += diff*diff;
+            local_sums[1] += double(b->get_cdata()[tindex][i])*b->get_cdata()[tindex][i];
+        }
+    double sums[2];
+    MPI_Allreduce(local_sums, sums, 2, MPI_DOUBLE, MPI_SUM, this->comm);
+    return sqrt(sums[0] / sums[1]);
+}
+
+template <typename rnumber>
+int vorticity_equation_mixed_precision_test<rnumber>::do_work(void)
+{
+    const double dt0 = 1e-2;
+    const int nlevels = 3;
+    std::vector<double> error_table(nlevels*3);
+    this->advance(false, dt0 / (1 << nlevels), this->niterations << nlevels, this->finest_vorticity);
+    for (int level = 0; level < nlevels; level++)
+    {
+        const double dt = dt0 / (1 << level);
+        this->advance(false, dt, this->niterations << level, this->double_vorticity);
+        this->advance(true, dt, this->niterations << level, this->mixed_vorticity);
+        error_table[level*3 + 0] = dt;
+        error_table[level*3 + 1] = this->relative_difference(this->mixed_vorticity, this->double_vorticity);
+        error_table[level*3 + 2] = this->relative_difference(this->double_vorticity, this->finest_vorticity);
+    }
+    this->fs->set_mixed_precision(false);
+    if (this->myrank == 0)
+    {
+        std::cout << "dt, mixed precision error, time discretization error" << std::endl;
+        for (int level = 0; level < nlevels; level++)
+            std::cout << error_table[level*3 + 0] << " " <<
+                         error_table[level*3 + 1] << " " <<
+                         error_table[level*3 + 2] << std::endl;
+        hid_t stat_file = H5Fopen(
+                (this->simname + std::string(".h5")).c_str(),
+                H5F_ACC_RDWR,
+                H5P_DEFAULT);
+        hsize_t dims[2] = {hsize_t(nlevels), 3};
+        hid_t space = H5Screate_simple(2, dims, NULL);
+        hid_t dset = H5Dcreate(
+                stat_file,
+                "mixed_precision_error",
+                H5T_NATIVE_DOUBLE,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, error_table.data());
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(stat_file);
+    }
+    return EXIT_SUCCESS;
+}
+
+template class vorticity_equation_mixed_precision_test<float>;
+template class vorticity_equation_mixed_precision_test<double>;
+
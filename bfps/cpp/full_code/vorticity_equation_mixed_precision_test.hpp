@@ -0,0 +1,89 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#ifndef VORTICITY_EQUATION_MIXED_PRECISION_TEST_HPP
+#define VORTICITY_EQUATION_MIXED_PRECISION_TEST_HPP
+
+
+
+#include <cstdlib>
+#include "base.hpp"
+#include "vorticity_equation.hpp"
+#include "full_code/test.hpp"
+
+/** \brief Accuracy of the mixed precision mode of `vorticity_equation`.
+ *
+ *  A random divergence free vorticity field is advanced up to the same final
+ *  time with time steps `dt0`, `dt0/2` and `dt0/4`, `dt0` being used for
+ *  `niterations` steps, both in double and in mixed precision.
+ *  For every time step the relative L2 difference between the mixed and the
+ *  double precision solutions is compared to the time discretization error
+ *  of the double precision solution, estimated against a run with `dt0/8`.
+ *  The table (dt, mixed precision error, time discretization error) is
+ *  printed, and stored in the simulation file as `/mixed_precision_error`.
+ */
+
+template <typename rnumber>
+class vorticity_equation_mixed_precision_test: public test
+{
+    public:
+
+        /* parameters that are read in read_parameters */
+        int niterations;
+
+        /* other stuff */
+        vorticity_equation<rnumber, FFTW> *fs;
+        field<rnumber, FFTW, THREE> *initial_vorticity;
+        field<rnumber, FFTW, THREE> *finest_vorticity;
+        field<rnumber, FFTW, THREE> *double_vorticity;
+        field<rnumber, FFTW, THREE> *mixed_vorticity;
+
+        vorticity_equation_mixed_precision_test(
+                const MPI_Comm COMMUNICATOR,
+                const std::string &simulation_name):
+            test(
+                    COMMUNICATOR,
+                    simulation_name){}
+        ~vorticity_equation_mixed_precision_test(){}
+
+        int initialize(void);
+        int do_work(void);
+        int finalize(void);
+        int read_parameters(void);
+
+        void advance(
+                const bool mixed_precision,
+                const double dt,
+                const int nsteps,
+                field<rnumber, FFTW, THREE> *result);
+        double relative_difference(
+                field<rnumber, FFTW, THREE> *a,
+                field<rnumber, FFTW, THREE> *b);
+};
+
+#endif//VORTICITY_EQUATION_MIXED_PRECISION_TEST_HPP
+
@@ -0,0 +1,119 @@
+#include <string>
+#include <cmath>
+#include <random>
+#include "vorticity_equation_scaling_benchmark.hpp"
+#include "scope_timer.hpp"
+
+
+template <typename rnumber>
+int vorticity_equation_scaling_benchmark<rnumber>::initialize(void)
+{
+    this->read_parameters();
+    ::pencil_process_rows = this->pencil_process_rows;
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int vorticity_equation_scaling_benchmark<rnumber>::finalize(void)
+{
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int vorticity_equation_scaling_benchmark<rnumber>::read_parameters()
+{
+    this->test::read_parameters();
+    hid_t parameter_file;
+    hid_t dset;
+    parameter_file = H5Fopen(
+            (this->simname + std::string(".h5")).c_str(),
+            H5F_ACC_RDONLY,
+            H5P_DEFAULT);
+    dset = H5Dopen(parameter_file, "/parameters/niterations", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->niterations);
+    H5Dclose(dset);
+    dset = H5Dopen(parameter_file, "/parameters/pencil_process_rows", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->pencil_process_rows);
+    H5Dclose(dset);
+    H5Fclose(parameter_file);
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+template <field_backend be>
+double vorticity_equation_scaling_benchmark<rnumber>::time_steps(void)
+{
+    const double dt = 1e-3;
+    vorticity_equation<rnumber, be> *fs = new vorticity_equation<rnumber, be>(
+            simname.c_str(),
+            nx, ny, nz,
+            dkx, dky, dkz,
+            DEFAULT_FFTW_FLAG);
+    strncpy(fs->forcing_type, "linear", 128);
+
+    // random vorticity, restricted to the resolved modes
+    std::mt19937_64 rgen(this->myrank + 1);
+    std::uniform_real_distribution<double> rdist(-1, 1);
+    fs->cvorticity->real_space_representation = false;
+    for (hsize_t tindex = 0; tindex < fs->cvorticity->clayout->local_size; tindex++)
+        for (int i=0; i<2; i++)
+            fs->cvorticity->get_cdata()[tindex][i] = rnumber(rdist(rgen) / fs->cvorticity->npoints);
+    fs->kk->template low_pass<rnumber, THREE>(fs->cvorticity->get_cdata(), fs->kk->kM / 4);
+    fs->kk->template force_divfree<rnumber>(fs->cvorticity->get_cdata());
+    fs->cvorticity->symmetrize();
+
+    // first step is not timed, it includes the building of the tables
+    fs->step(dt);
+    MPI_Barrier(this->comm);
+    const double time_start = MPI_Wtime();
+    for (int iteration = 0; iteration < this->niterations; iteration++)
+        fs->step(dt);
+    const double local_time = (MPI_Wtime() - time_start) / this->niterations;
+    double max_time;
+    MPI_Allreduce(&local_time, &max_time, 1, MPI_DOUBLE, MPI_MAX, this->comm);
+    delete fs;
+    return max_time;
+}
+
+template <typename rnumber>
+int vorticity_equation_scaling_benchmark<rnumber>::do_work(void)
+{
+    double step_time[2] = {-1, -1};
+    if (this->nprocs <= this->nz)
+        step_time[0] = this->template time_steps<FFTW>();
+    step_time[1] = this->template time_steps<PENCIL>();
+    if (this->myrank == 0)
+    {
+        if (step_time[0] < 0)
+            std::cout << "vorticity_equation::step, FFTW slabs: not timed, " <<
+                         this->nprocs << " processes for nz = " << this->nz << std::endl;
+        else
+            std::cout << "vorticity_equation::step, FFTW slabs: " <<
+                         step_time[0] << " seconds per step" << std::endl;
+        std::cout << "vorticity_equation::step, PENCIL decomposition: " <<
+                     step_time[1] << " seconds per step" << std::endl;
+        hid_t stat_file = H5Fopen(
+                (this->simname + std::string(".h5")).c_str(),
+                H5F_ACC_RDWR,
+                H5P_DEFAULT);
+        hsize_t dims[1] = {2};
+        hid_t space = H5Screate_simple(1, dims, NULL);
+        hid_t dset = H5Dcreate(
+                stat_file,
+                "step_time",
+                H5T_NATIVE_DOUBLE,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, step_time);
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(stat_file);
+    }
+    return EXIT_SUCCESS;
+}
+
+template class vorticity_equation_scaling_benchmark<float>;
+template class vorticity_equation_scaling_benchmark<double>;
+
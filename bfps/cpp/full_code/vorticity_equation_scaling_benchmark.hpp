@@ -0,0 +1,79 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#ifndef VORTICITY_EQUATION_SCALING_BENCHMARK_HPP
+#define VORTICITY_EQUATION_SCALING_BENCHMARK_HPP
+
+
+
+#include <cstdlib>
+#include "base.hpp"
+#include "vorticity_equation.hpp"
+#include "full_code/test.hpp"
+
+/** \brief Strong scaling of `vorticity_equation::step` for both backends.
+ *
+ *  A random divergence free vorticity field is advanced `niterations` times
+ *  on `FFTW` slabs and on `PENCIL` decompositions, the latter with
+ *  `pencil_process_rows` process rows (0 for the most square grid).
+ *  Slabs cannot use more than `nz` processes, in which case only the pencil
+ *  decomposition is timed.
+ *  The average time per step for both backends is printed, and stored in the
+ *  simulation file as `/step_time`, with a negative value for slabs that
+ *  were not timed.
+ *  Launching the same grid on increasing numbers of processes gives the
+ *  strong scaling of the two backends.
+ */
+
+template <typename rnumber>
+class vorticity_equation_scaling_benchmark: public test
+{
+    public:
+
+        /* parameters that are read in read_parameters */
+        int niterations;
+        int pencil_process_rows;
+
+        vorticity_equation_scaling_benchmark(
+                const MPI_Comm COMMUNICATOR,
+                const std::string &simulation_name):
+            test(
+                    COMMUNICATOR,
+                    simulation_name){}
+        ~vorticity_equation_scaling_benchmark(){}
+
+        int initialize(void);
+        int do_work(void);
+        int finalize(void);
+        int read_parameters(void);
+
+        template <field_backend be>
+        double time_steps(void);
+};
+
+#endif//VORTICITY_EQUATION_SCALING_BENCHMARK_HPP
+
@@ -0,0 +1,110 @@
+#include <string>
+#include <cmath>
+#include <random>
+#include "vorticity_equation_step_benchmark.hpp"
+#include "scope_timer.hpp"
+
+
+template <typename rnumber>
+int vorticity_equation_step_benchmark<rnumber>::initialize(void)
+{
+    this->read_parameters();
+    this->fs = new vorticity_equation<rnumber, FFTW>(
+            simname.c_str(),
+            nx, ny, nz,
+            dkx, dky, dkz,
+            DEFAULT_FFTW_FLAG);
+    strncpy(this->fs->forcing_type, "linear", 128);
+
+    // random vorticity, restricted to the resolved modes
+    std::mt19937_64 rgen(this->myrank + 1);
+    std::uniform_real_distribution<double> rdist(-1, 1);
+    this->fs->cvorticity->real_space_representation = false;
+    for (hsize_t tindex = 0; tindex < this->fs->cvorticity->clayout->local_size; tindex++)
+        for (int i=0; i<2; i++)
+            this->fs->cvorticity->get_cdata()[tindex][i] = rnumber(rdist(rgen) / this->fs->cvorticity->npoints);
+    this->fs->kk->template low_pass<rnumber, THREE>(this->fs->cvorticity->get_cdata(), this->fs->kk->kM / 4);
+    this->fs->kk->template force_divfree<rnumber>(this->fs->cvorticity->get_cdata());
+    this->fs->cvorticity->symmetrize();
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int vorticity_equation_step_benchmark<rnumber>::finalize(void)
+{
+    delete this->fs;
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int vorticity_equation_step_benchmark<rnumber>::read_parameters()
+{
+    this->test::read_parameters();
+    hid_t parameter_file;
+    hid_t dset;
+    parameter_file = H5Fopen(
+            (this->simname + std::string(".h5")).c_str(),
+            H5F_ACC_RDONLY,
+            H5P_DEFAULT);
+    dset = H5Dopen(parameter_file, "/parameters/niterations", H5P_DEFAULT);
+    H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->niterations);
+    H5Dclose(dset);
+    H5Fclose(parameter_file);
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+double vorticity_equation_step_benchmark<rnumber>::time_steps(
+        const bool use_tables)
+{
+    const double dt = 1e-3;
+    this->fs->use_integrating_factor_tables = use_tables;
+    // first step is not timed, it includes the building of the tables
+    this->fs->step(dt);
+    MPI_Barrier(this->comm);
+    const double time_start = MPI_Wtime();
+    for (int iteration = 0; iteration < this->niterations; iteration++)
+        this->fs->step(dt);
+    const double local_time = (MPI_Wtime() - time_start) / this->niterations;
+    double max_time;
+    MPI_Allreduce(&local_time, &max_time, 1, MPI_DOUBLE, MPI_MAX, this->comm);
+    return max_time;
+}
+
+template <typename rnumber>
+int vorticity_equation_step_benchmark<rnumber>::do_work(void)
+{
+    double step_time[2];
+    step_time[0] = this->time_steps(false);
+    step_time[1] = this->time_steps(true);
+    if (this->myrank == 0)
+    {
+        std::cout << "vorticity_equation::step, per mode integrating factors: " <<
+                     step_time[0] << " seconds per step" << std::endl;
+        std::cout << "vorticity_equation::step, tabulated integrating factors: " <<
+                     step_time[1] << " seconds per step" << std::endl;
+        hid_t stat_file = H5Fopen(
+                (this->simname + std::string(".h5")).c_str(),
+                H5F_ACC_RDWR,
+                H5P_DEFAULT);
+        hsize_t dims[1] = {2};
+        hid_t space = H5Screate_simple(1, dims, NULL);
+        hid_t dset = H5Dcreate(
+                stat_file,
+                "step_time",
+                H5T_NATIVE_DOUBLE,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+        H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, step_time);
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(stat_file);
+    }
+    return EXIT_SUCCESS;
+}
+
+template class vorticity_equation_step_benchmark<float>;
+template class vorticity_equation_step_benchmark<double>;
+
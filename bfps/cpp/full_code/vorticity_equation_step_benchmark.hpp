@@ -0,0 +1,75 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#ifndef VORTICITY_EQUATION_STEP_BENCHMARK_HPP
+#define VORTICITY_EQUATION_STEP_BENCHMARK_HPP
+
+
+
+#include <cstdlib>
+#include "base.hpp"
+#include "vorticity_equation.hpp"
+#include "full_code/test.hpp"
+
+/** \brief Timing of `vorticity_equation::step`.
+ *
+ *  A random divergence free vorticity field is advanced `niterations` times
+ *  with the integrating factors evaluated for every mode, and `niterations`
+ *  times with the tabulated integrating factors.
+ *  The average time per step for both cases is printed, and stored in the
+ *  simulation file as `/step_time`.
+ */
+
+template <typename rnumber>
+class vorticity_equation_step_benchmark: public test
+{
+    public:
+
+        /* parameters that are read in read_parameters */
+        int niterations;
+
+        /* other stuff */
+        vorticity_equation<rnumber, FFTW> *fs;
+
+        vorticity_equation_step_benchmark(
+                const MPI_Comm COMMUNICATOR,
+                const std::string &simulation_name):
+            test(
+                    COMMUNICATOR,
+                    simulation_name){}
+        ~vorticity_equation_step_benchmark(){}
+
+        int initialize(void);
+        int do_work(void);
+        int finalize(void);
+        int read_parameters(void);
+
+        double time_steps(const bool use_tables);
+};
+
+#endif//VORTICITY_EQUATION_STEP_BENCHMARK_HPP
+
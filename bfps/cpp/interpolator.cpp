@@ -26,7 +26,9 @@
 
 #define NDEBUG
 
+#include <algorithm>
 #include "interpolator.hpp"
+#include "scope_timer.hpp"
 
 template <class rnumber, int interp_neighbours>
 interpolator<rnumber, interp_neighbours>::interpolator(
@@ -46,73 +48,122 @@ interpolator<rnumber, interp_neighbours>::interpolator(
             this->descriptor->comm);
     this->buffer_size = (interp_neighbours+1)*this->buffered_descriptor->slice_size;
     this->field = new rnumber[this->buffered_descriptor->local_size];
-}
 
-template <class rnumber, int interp_neighbours>
-interpolator<rnumber, interp_neighbours>::~interpolator()
-{
-    delete[] this->field;
-    delete this->buffered_descriptor;
-}
-
-template <class rnumber, int interp_neighbours>
-int interpolator<rnumber, interp_neighbours>::read_rFFTW(const void *void_src)
-{
-    rnumber *src = (rnumber*)void_src;
-    rnumber *dst = this->field;
-    /* do big copy of middle stuff */
-    std::copy(src,
-              src + this->buffered_descriptor->slice_size*this->descriptor->subsizes[0],
-              dst + this->buffer_size);
+    /* the ghost slices are exchanged directly from and into the buffered
+     * field, so the requests can be set up once:
+     * every process receives the slices above its slab from the owner of
+     * the next slice, and the slices below from the owner of the previous
+     * one. As before, slabs must be at least interp_neighbours+1 thick. */
     MPI_Datatype MPI_RNUM = (sizeof(rnumber) == 4) ? MPI_FLOAT : MPI_DOUBLE;
-    int rsrc;
-    /* get upper slices */
+    rnumber *slab = this->field + this->buffer_size;
+    const ptrdiff_t slab_size = this->buffered_descriptor->slice_size*this->descriptor->subsizes[0];
+    this->upper_ghosts_from_self = false;
+    this->lower_ghosts_from_self = false;
     for (int rdst = 0; rdst < this->descriptor->nprocs; rdst++)
     {
-        rsrc = this->descriptor->rank[(this->descriptor->all_start0[rdst] +
-                                       this->descriptor->all_size0[rdst]) %
-                                       this->descriptor->sizes[0]];
-        if (this->descriptor->myrank == rsrc)
-            MPI_Send(
-                    src,
+        /* upper slices */
+        int rsrc = this->descriptor->rank[(this->descriptor->all_start0[rdst] +
+                                           this->descriptor->all_size0[rdst]) %
+                                           this->descriptor->sizes[0]];
+        if (this->descriptor->myrank == rsrc && this->descriptor->myrank == rdst)
+            this->upper_ghosts_from_self = true;
+        else if (this->descriptor->myrank == rsrc)
+        {
+            this->ghost_requests.emplace_back();
+            MPI_Send_init(
+                    slab,
                     this->buffer_size,
                     MPI_RNUM,
                     rdst,
-                    2*(rsrc*this->descriptor->nprocs + rdst),
-                    this->buffered_descriptor->comm);
-        if (this->descriptor->myrank == rdst)
-            MPI_Recv(
-                    dst + this->buffer_size + this->buffered_descriptor->slice_size*this->descriptor->subsizes[0],
+                    0,
+                    this->descriptor->comm,
+                    &this->ghost_requests.back());
+        }
+        else if (this->descriptor->myrank == rdst)
+        {
+            this->ghost_requests.emplace_back();
+            MPI_Recv_init(
+                    slab + slab_size,
                     this->buffer_size,
                     MPI_RNUM,
                     rsrc,
-                    2*(rsrc*this->descriptor->nprocs + rdst),
-                    this->buffered_descriptor->comm,
-                    MPI_STATUS_IGNORE);
-    }
-    /* get lower slices */
-    for (int rdst = 0; rdst < this->descriptor->nprocs; rdst++)
-    {
+                    0,
+                    this->descriptor->comm,
+                    &this->ghost_requests.back());
+        }
+        /* lower slices */
         rsrc = this->descriptor->rank[MOD(this->descriptor->all_start0[rdst] - 1,
                                           this->descriptor->sizes[0])];
-        if (this->descriptor->myrank == rsrc)
-            MPI_Send(
-                    src + this->buffered_descriptor->slice_size*this->descriptor->subsizes[0] - this->buffer_size,
+        if (this->descriptor->myrank == rsrc && this->descriptor->myrank == rdst)
+            this->lower_ghosts_from_self = true;
+        else if (this->descriptor->myrank == rsrc)
+        {
+            this->ghost_requests.emplace_back();
+            MPI_Send_init(
+                    slab + slab_size - this->buffer_size,
                     this->buffer_size,
                     MPI_RNUM,
                     rdst,
-                    2*(rsrc*this->descriptor->nprocs + rdst)+1,
-                    this->descriptor->comm);
-        if (this->descriptor->myrank == rdst)
-            MPI_Recv(
-                    dst,
+                    1,
+                    this->descriptor->comm,
+                    &this->ghost_requests.back());
+        }
+        else if (this->descriptor->myrank == rdst)
+        {
+            this->ghost_requests.emplace_back();
+            MPI_Recv_init(
+                    this->field,
                     this->buffer_size,
                     MPI_RNUM,
                     rsrc,
-                    2*(rsrc*this->descriptor->nprocs + rdst)+1,
+                    1,
                     this->descriptor->comm,
-                    MPI_STATUS_IGNORE);
+                    &this->ghost_requests.back());
+        }
     }
+}
+
+template <class rnumber, int interp_neighbours>
+interpolator<rnumber, interp_neighbours>::~interpolator()
+{
+    for (auto &request : this->ghost_requests)
+        MPI_Request_free(&request);
+    delete[] this->field;
+    delete this->buffered_descriptor;
+}
+
+template <class rnumber, int interp_neighbours>
+int interpolator<rnumber, interp_neighbours>::read_rFFTW(const void *void_src)
+{
+    TIMEZONE("interpolator::read_rFFTW");
+    rnumber *src = (rnumber*)void_src;
+    rnumber *slab = this->field + this->buffer_size;
+    const ptrdiff_t slab_size = this->buffered_descriptor->slice_size*this->descriptor->subsizes[0];
+    const ptrdiff_t edge_size = std::min(this->buffer_size, slab_size);
+    /* copy the slices that are sent to the neighbours first */
+    std::copy(src,
+              src + edge_size,
+              slab);
+    std::copy(src + slab_size - edge_size,
+              src + slab_size,
+              slab + slab_size - edge_size);
+    if (this->ghost_requests.size() > 0)
+        MPI_Startall(this->ghost_requests.size(), &this->ghost_requests.front());
+    /* do big copy of middle stuff while the slices are in flight */
+    if (slab_size > 2*edge_size)
+        std::copy(src + edge_size,
+                  src + slab_size - edge_size,
+                  slab + edge_size);
+    if (this->upper_ghosts_from_self)
+        std::copy(slab,
+                  slab + this->buffer_size,
+                  slab + slab_size);
+    if (this->lower_ghosts_from_self)
+        std::copy(slab + slab_size - this->buffer_size,
+                  slab + slab_size,
+                  this->field);
+    if (this->ghost_requests.size() > 0)
+        MPI_Waitall(this->ghost_requests.size(), &this->ghost_requests.front(), MPI_STATUSES_IGNORE);
     return EXIT_SUCCESS;
 }
 
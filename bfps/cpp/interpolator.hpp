@@ -25,6 +25,7 @@
 
 
 #include <cmath>
+#include <vector>
 #include "field_descriptor.hpp"
 #include "fftw_tools.hpp"
 #include "fluid_solver_base.hpp"
@@ -41,6 +42,12 @@ class interpolator:public interpolator_base<rnumber, interp_neighbours>
         /* pointer to buffered field */
         rnumber *field;
 
+        /* persistent requests for the exchange of the ghost slices with the
+         * neighbouring processes, and whether a process is its own upper
+         * or lower neighbour (single process) */
+        std::vector<MPI_Request> ghost_requests;
+        bool upper_ghosts_from_self, lower_ghosts_from_self;
+
     public:
         using interpolator_base<rnumber, interp_neighbours>::operator();
         ptrdiff_t buffer_size;
@@ -57,12 +57,15 @@ kspace<be, dt>::kspace(
     switch(be)
     {
         case FFTW:
-            this->kx.resize(this->layout->sizes[2]);
+        case PENCIL:
+            /* only the local modes are stored, the slab decomposition
+             * splits ky, the pencil decomposition also splits kx */
+            this->kx.resize(this->layout->subsizes[2]);
             this->ky.resize(this->layout->subsizes[0]);
-            this->kz.resize(this->layout->sizes[1]);
+            this->kz.resize(this->layout->subsizes[1]);
             int i, ii;
-            for (i = 0; i<int(this->layout->sizes[2]); i++)
-                this->kx[i] = i*this->dkx;
+            for (i = 0; i<int(this->layout->subsizes[2]); i++)
+                this->kx[i] = (i + this->layout->starts[2])*this->dkx;
             for (i = 0; i<int(this->layout->subsizes[0]); i++)
             {
                 ii = i + this->layout->starts[0];
@@ -71,12 +74,13 @@ kspace<be, dt>::kspace(
                 else
                     this->ky[i] = this->dky*(ii - int(this->layout->sizes[1]));
             }
-            for (i = 0; i<int(this->layout->sizes[1]); i++)
+            for (i = 0; i<int(this->layout->subsizes[1]); i++)
             {
-                if (i <= int(this->layout->sizes[0]/2))
-                    this->kz[i] = this->dkz*i;
+                ii = i + this->layout->starts[1];
+                if (ii <= int(this->layout->sizes[0]/2))
+                    this->kz[i] = this->dkz*ii;
                 else
-                    this->kz[i] = this->dkz*(i - int(this->layout->sizes[0]));
+                    this->kz[i] = this->dkz*(ii - int(this->layout->sizes[0]));
             }
             switch(dt)
             {
@@ -116,6 +120,46 @@ kspace<be, dt>::kspace(
         std::fill_n(nshell_local, this->nshells, 0);
     });
 
+    /* k2 / dk2 is an integer for every mode if the squared ratios of the
+     * dk values are integers, in which case the values that depend only on
+     * k2 can be tabulated once per shell */
+    bool k2_on_shells = true;
+    for (double dkk : {this->dkx, this->dky, this->dkz})
+    {
+        const double ratio = dkk*dkk / this->dk2;
+        k2_on_shells = k2_on_shells && (ratio == round(ratio));
+    }
+    if (k2_on_shells)
+    {
+        /* largest |kx|, |ky| and |kz| over all the modes; the k values
+         * are only known locally, the global y index runs over sizes[0]
+         * values and wraps at sizes[1], and vice versa for z */
+        const double kxM = this->dkx*(int(this->layout->sizes[2]) - 1);
+        double kyM = 0;
+        for (int ii = 0; ii < int(this->layout->sizes[0]); ii++)
+            kyM = std::max(kyM, this->dky*std::abs(
+                        (ii <= int(this->layout->sizes[1]/2)) ?
+                        ii : ii - int(this->layout->sizes[1])));
+        double kzM = 0;
+        for (int ii = 0; ii < int(this->layout->sizes[1]); ii++)
+            kzM = std::max(kzM, this->dkz*std::abs(
+                        (ii <= int(this->layout->sizes[0]/2)) ?
+                        ii : ii - int(this->layout->sizes[0])));
+        this->nk2shells = this->get_k2shell(kxM*kxM + kyM*kyM + kzM*kzM) + 1;
+        this->spectrum_shell.resize(this->nk2shells);
+        for (int k2shell = 0; k2shell < this->nk2shells; k2shell++)
+            this->spectrum_shell[k2shell] = int(sqrt(k2shell*this->dk2) / this->dk);
+        if (dt == SMOOTH)
+        {
+            this->dealias_filter_table.resize(this->nk2shells);
+            for (int k2shell = 0; k2shell < this->nk2shells; k2shell++)
+                this->dealias_filter_table[k2shell] = exp(
+                        -36.0 * pow(k2shell*this->dk2/this->kM2, 18.));
+        }
+    }
+    else
+        this->nk2shells = 0;
+
     std::vector<std::unordered_map<int, double>> dealias_filter_threaded(omp_get_max_threads());
 
     this->CLOOP_K2_NXMODES(
@@ -131,7 +175,7 @@ kspace<be, dt>::kspace(
                 kshell_local_thread.getMine()[int(knorm/this->dk)] += nxmodes*knorm;
                 nshell_local_thread.getMine()[int(knorm/this->dk)] += nxmodes;
             }
-            if (dt == SMOOTH){
+            if (dt == SMOOTH && !k2_on_shells){
                 dealias_filter_threaded[omp_get_thread_num()][int(round(k2 / this->dk2))] = exp(-36.0 * pow(k2/this->kM2, 18.));
             }
     });
@@ -141,7 +185,7 @@ kspace<be, dt>::kspace(
     kshell_local_thread.mergeParallel();
     nshell_local_thread.mergeParallel();
 
-    if (dt == SMOOTH){
+    if (dt == SMOOTH && !k2_on_shells){
         for(int idxMerge = 0 ; idxMerge < int(dealias_filter_threaded.size()) ; ++idxMerge){
             for(const auto kv : dealias_filter_threaded[idxMerge]){
                 this->dealias_filter[kv.first] = kv.second;
@@ -232,6 +276,50 @@ int kspace<be, dt>::store(hid_t stat_file)
     return EXIT_SUCCESS;
 }
 
+/** \brief Multiply a field by a function of \f$ k^2 \f$.
+ *
+ *  When the dense shell tables are available, `filter_value` is evaluated
+ *  once per shell rather than once per mode.
+ */
+template <field_backend be,
+          kspace_dealias_type dt>
+template <typename rnumber,
+          field_components fc,
+          class func_type>
+void kspace<be, dt>::apply_isotropic_filter(
+        typename fftw_interface<rnumber>::complex *__restrict__ a,
+        func_type filter_value)
+{
+    if (this->nk2shells > 0)
+    {
+        std::vector<double> filter_table(this->nk2shells);
+        #pragma omp parallel for schedule(static)
+        for (int k2shell = 0; k2shell < this->nk2shells; k2shell++)
+            filter_table[k2shell] = filter_value(k2shell*this->dk2);
+        this->CLOOP_K2(
+                [&](ptrdiff_t cindex,
+                    ptrdiff_t xindex,
+                    ptrdiff_t yindex,
+                    ptrdiff_t zindex,
+                    double k2){
+                    const double tval = filter_table[this->get_k2shell(k2)];
+                    for (unsigned int tcounter=0; tcounter<2*ncomp(fc); tcounter++)
+                        ((rnumber*)a)[2*ncomp(fc)*cindex + tcounter] *= tval;
+                    });
+    }
+    else
+        this->CLOOP_K2(
+                [&](ptrdiff_t cindex,
+                    ptrdiff_t xindex,
+                    ptrdiff_t yindex,
+                    ptrdiff_t zindex,
+                    double k2){
+                    const double tval = filter_value(k2);
+                    for (unsigned int tcounter=0; tcounter<2*ncomp(fc); tcounter++)
+                        ((rnumber*)a)[2*ncomp(fc)*cindex + tcounter] *= tval;
+                    });
+}
+
 template <field_backend be,
           kspace_dealias_type dt>
 template <typename rnumber,
@@ -275,21 +363,16 @@ void kspace<be, dt>::ball_filter(
         const double ell)
 {
     const double prefactor0 = double(3) / pow(ell/2, 3);
-    this->CLOOP_K2(
-            [&](ptrdiff_t cindex,
-                ptrdiff_t xindex,
-                ptrdiff_t yindex,
-                ptrdiff_t zindex,
-                double k2){
+    this->template apply_isotropic_filter<rnumber, fc>(
+            a,
+            [&](double k2){
                 if (k2 > 0)
                 {
                     double argument = sqrt(k2)*ell / 2;
                     double prefactor = prefactor0 / pow(k2, 1.5);
-                    for (unsigned int tcounter=0; tcounter<2*ncomp(fc); tcounter++)
-                        ((rnumber*)a)[2*ncomp(fc)*cindex + tcounter] *= (
-                            prefactor *
-                            (sin(argument) - argument * cos(argument)));
+                    return prefactor * (sin(argument) - argument * cos(argument));
                 }
+                return 1.0;
                 });
 }
 
@@ -309,16 +392,10 @@ void kspace<be, dt>::Gauss_filter(
         const double sigma)
 {
     const double prefactor = - sigma*sigma/2;
-    this->CLOOP_K2(
-            [&](ptrdiff_t cindex,
-                ptrdiff_t xindex,
-                ptrdiff_t yindex,
-                ptrdiff_t zindex,
-                double k2){
-                {
-                    for (unsigned int tcounter=0; tcounter<2*ncomp(fc); tcounter++)
-                        ((rnumber*)a)[2*ncomp(fc)*cindex + tcounter] *= exp(prefactor*k2);
-                }
+    this->template apply_isotropic_filter<rnumber, fc>(
+            a,
+            [&](double k2){
+                return exp(prefactor*k2);
                 });
 }
 
@@ -476,7 +553,7 @@ void kspace<be, dt>::dealias(typename fftw_interface<rnumber>::complex *__restri
                     ptrdiff_t yindex,
                     ptrdiff_t zindex,
                     double k2){
-                    double tval = this->dealias_filter[int(round(k2 / this->dk2))];
+                    double tval = this->get_dealias_factor(k2);
                     for (unsigned int tcounter=0; tcounter<2*ncomp(fc); tcounter++)
                         ((rnumber*)a)[2*ncomp(fc)*cindex + tcounter] *= tval;
                 });
@@ -544,7 +621,9 @@ void kspace<be, dt>::cospectrum(
             if (k2 <= this->kM2)
             {
                 double* spec_local = spec_local_thread.getMine();
-                int tmp_int = int(sqrt(k2) / this->dk)*ncomp(fc)*ncomp(fc);
+                int tmp_int = ((this->nk2shells > 0) ?
+                        this->spectrum_shell[this->get_k2shell(k2)] :
+                        int(sqrt(k2) / this->dk))*ncomp(fc)*ncomp(fc);
                 for (hsize_t i=0; i<ncomp(fc); i++)
                 for (hsize_t j=0; j<ncomp(fc); j++){
                     spec_local[tmp_int + i*ncomp(fc)+j] += nxmodes * (
@@ -806,3 +885,211 @@ template void kspace<FFTW, SMOOTH>::force_divfree<float>(
 template void kspace<FFTW, SMOOTH>::force_divfree<double>(
        typename fftw_interface<double>::complex *__restrict__ a);
 
+template class kspace<PENCIL, TWO_THIRDS>;
+template class kspace<PENCIL, SMOOTH>;
+
+template kspace<PENCIL, TWO_THIRDS>::kspace<>(
+        const field_layout<ONE> *,
+        const double, const double, const double);
+template kspace<PENCIL, TWO_THIRDS>::kspace<>(
+        const field_layout<THREE> *,
+        const double, const double, const double);
+template kspace<PENCIL, TWO_THIRDS>::kspace<>(
+        const field_layout<THREExTHREE> *,
+        const double, const double, const double);
+
+template kspace<PENCIL, SMOOTH>::kspace<>(
+        const field_layout<ONE> *,
+        const double, const double, const double);
+template kspace<PENCIL, SMOOTH>::kspace<>(
+        const field_layout<THREE> *,
+        const double, const double, const double);
+template kspace<PENCIL, SMOOTH>::kspace<>(
+        const field_layout<THREExTHREE> *,
+        const double, const double, const double);
+
+template void kspace<PENCIL, SMOOTH>::low_pass<float, ONE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::low_pass<float, THREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::low_pass<float, THREExTHREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax);
+
+template void kspace<PENCIL, SMOOTH>::low_pass<double, ONE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::low_pass<double, THREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::low_pass<double, THREExTHREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax);
+
+template void kspace<PENCIL, SMOOTH>::Gauss_filter<float, ONE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::Gauss_filter<float, THREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::Gauss_filter<float, THREExTHREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax);
+
+template void kspace<PENCIL, SMOOTH>::Gauss_filter<double, ONE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::Gauss_filter<double, THREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::Gauss_filter<double, THREExTHREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax);
+
+template int kspace<PENCIL, SMOOTH>::filter<float, ONE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter<float, THREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter<float, THREExTHREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+
+template int kspace<PENCIL, SMOOTH>::filter<double, ONE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter<double, THREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter<double, THREExTHREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+
+template int kspace<PENCIL, SMOOTH>::filter_calibrated_ell<float, ONE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter_calibrated_ell<float, THREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter_calibrated_ell<float, THREExTHREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+
+template int kspace<PENCIL, SMOOTH>::filter_calibrated_ell<double, ONE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter_calibrated_ell<double, THREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter_calibrated_ell<double, THREExTHREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+
+template void kspace<PENCIL, SMOOTH>::dealias<float, ONE>(
+        typename fftw_interface<float>::complex *__restrict__ a);
+template void kspace<PENCIL, SMOOTH>::dealias<float, THREE>(
+        typename fftw_interface<float>::complex *__restrict__ a);
+template void kspace<PENCIL, SMOOTH>::dealias<float, THREExTHREE>(
+        typename fftw_interface<float>::complex *__restrict__ a);
+
+template void kspace<PENCIL, SMOOTH>::dealias<double, ONE>(
+        typename fftw_interface<double>::complex *__restrict__ a);
+template void kspace<PENCIL, SMOOTH>::dealias<double, THREE>(
+        typename fftw_interface<double>::complex *__restrict__ a);
+template void kspace<PENCIL, SMOOTH>::dealias<double, THREExTHREE>(
+        typename fftw_interface<double>::complex *__restrict__ a);
+
+template void kspace<PENCIL, TWO_THIRDS>::cospectrum<float, ONE>(
+        const typename fftw_interface<float>::complex *__restrict__ a,
+        const typename fftw_interface<float>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectrum<float, THREE>(
+        const typename fftw_interface<float>::complex *__restrict__ a,
+        const typename fftw_interface<float>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectrum<float, THREExTHREE>(
+        const typename fftw_interface<float>::complex *__restrict__ a,
+        const typename fftw_interface<float>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectrum<double, ONE>(
+        const typename fftw_interface<double>::complex *__restrict__ a,
+        const typename fftw_interface<double>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectrum<double, THREE>(
+        const typename fftw_interface<double>::complex *__restrict__ a,
+        const typename fftw_interface<double>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectrum<double, THREExTHREE>(
+        const typename fftw_interface<double>::complex *__restrict__ a,
+        const typename fftw_interface<double>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+
+template void kspace<PENCIL, SMOOTH>::cospectrum<float, ONE>(
+        const typename fftw_interface<float>::complex *__restrict__ a,
+        const typename fftw_interface<float>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectrum<float, THREE>(
+        const typename fftw_interface<float>::complex *__restrict__ a,
+        const typename fftw_interface<float>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectrum<float, THREExTHREE>(
+        const typename fftw_interface<float>::complex *__restrict__ a,
+        const typename fftw_interface<float>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectrum<double, ONE>(
+        const typename fftw_interface<double>::complex *__restrict__ a,
+        const typename fftw_interface<double>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectrum<double, THREE>(
+        const typename fftw_interface<double>::complex *__restrict__ a,
+        const typename fftw_interface<double>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectrum<double, THREExTHREE>(
+        const typename fftw_interface<double>::complex *__restrict__ a,
+        const typename fftw_interface<double>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+
+template void kspace<PENCIL, SMOOTH>::force_divfree<float>(
+       typename fftw_interface<float>::complex *__restrict__ a);
+template void kspace<PENCIL, SMOOTH>::force_divfree<double>(
+       typename fftw_interface<double>::complex *__restrict__ a);
+
@@ -25,6 +25,7 @@
 
 
 #include <hdf5.h>
+#include <cmath>
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -36,7 +37,9 @@
 
 #define KSPACE_HPP
 
-enum field_backend {FFTW};
+/* FFTW: slab decomposition of the FFTW MPI transforms.
+ * PENCIL: 2D decomposition, see `pencil_decomposition`. */
+enum field_backend {FFTW, PENCIL};
 enum kspace_dealias_type {TWO_THIRDS, SMOOTH};
 
 
@@ -59,6 +62,14 @@ class kspace
         std::vector<int64_t> nshell;
         int nshells;
 
+        /* dense tables indexed by the k2 shell, int(round(k2 / dk2)).
+         * They are only built when k2 / dk2 is an integer for every mode,
+         * otherwise nk2shells is 0 and the per mode expressions (or the
+         * `dealias_filter` map) are used instead. */
+        int nk2shells;
+        std::vector<double> dealias_filter_table;
+        std::vector<int> spectrum_shell;
+
         /* methods */
         template <field_components fc>
         kspace(
@@ -70,6 +81,33 @@ class kspace
 
         int store(hid_t stat_file);
 
+        inline int get_k2shell(const double k2) const
+        {
+            return int(round(k2 / this->dk2));
+        }
+
+        /* factor applied by `dealias` to a mode with wavenumber squared k2 */
+        inline double get_dealias_factor(const double k2)
+        {
+            switch(dt)
+            {
+                case TWO_THIRDS:
+                    return (k2 < this->kM2) ? 1.0 : 0.0;
+                case SMOOTH:
+                    return (this->nk2shells > 0) ?
+                        this->dealias_filter_table[this->get_k2shell(k2)] :
+                        this->dealias_filter[this->get_k2shell(k2)];
+            }
+            return 1.0;
+        }
+
+        template <typename rnumber,
+                  field_components fc,
+                  class func_type>
+        void apply_isotropic_filter(
+                typename fftw_interface<rnumber>::complex *__restrict__ a,
+                func_type filter_value);
+
         template <typename rnumber,
                   field_components fc>
         void low_pass(
@@ -172,13 +210,18 @@ class kspace
                         ptrdiff_t cindex = yindex*this->layout->subsizes[1]*this->layout->subsizes[2]
                                             + zindex*this->layout->subsizes[2];
                         hsize_t xindex = 0;
-                        double k2 = (
-                                this->kx[xindex]*this->kx[xindex] +
-                                this->ky[yindex]*this->ky[yindex] +
-                                this->kz[zindex]*this->kz[zindex]);
-                        expression(cindex, xindex, yindex, zindex, k2, 1);
-                        cindex++;
-                        for (xindex = 1; xindex < this->layout->subsizes[2]; xindex++)
+                        double k2;
+                        /* only the kx = 0 modes are not doubled */
+                        if (this->layout->starts[2] == 0)
+                        {
+                            k2 = (this->kx[xindex]*this->kx[xindex] +
+                                  this->ky[yindex]*this->ky[yindex] +
+                                  this->kz[zindex]*this->kz[zindex]);
+                            expression(cindex, xindex, yindex, zindex, k2, 1);
+                            cindex++;
+                            xindex++;
+                        }
+                        for (; xindex < this->layout->subsizes[2]; xindex++)
                         {
                             k2 = (this->kx[xindex]*this->kx[xindex] +
                                   this->ky[yindex]*this->ky[yindex] +
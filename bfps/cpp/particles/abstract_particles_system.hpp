@@ -6,6 +6,7 @@
 //- Not generic to enable sampling begin
 #include "field.hpp"
 #include "kspace.hpp"
+#include "particles_field_set.hpp"
 //- Not generic to enable sampling end
 
 
@@ -51,6 +52,12 @@ public:
                                 real_number sample_rhs[]) = 0;
     virtual void sample_compute_field(const field<double, FFTW, THREExTHREE>& sample_field,
                                 real_number sample_rhs[]) = 0;
+    // All the fields of the set are interpolated with a single exchange of
+    // the positions, sample_rhs receives get_nb_values() values per particle
+    virtual void sample_compute_fields(const particles_field_set<float>& sample_fields,
+                                real_number sample_rhs[]) = 0;
+    virtual void sample_compute_fields(const particles_field_set<double>& sample_fields,
+                                real_number sample_rhs[]) = 0;
     //- Not generic to enable sampling end
 };
 
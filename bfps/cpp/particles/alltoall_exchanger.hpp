@@ -2,30 +2,52 @@
 #define ALLTOALL_EXCHANGER_HPP
 
 #include <mpi.h>
+#include <algorithm>
 #include <cassert>
+#include <limits>
+#include <vector>
 
 #include "base.hpp"
 #include "particles_utils.hpp"
 #include "scope_timer.hpp"
 
+/** All-to-all exchange of blocks of items.
+ *
+ *  Counts are kept in 64 bits. When all the counts and offsets (in items)
+ *  fit in an int on every process, the exchange is a single MPI_Alltoallv,
+ *  where items of several values are described by a contiguous datatype so
+ *  that the counts are not multiplied by the number of values.
+ *  Otherwise the blocks are exchanged with point to point messages of at
+ *  most INT_MAX items.
+ *  When the processes only exchange with a few known partners (e.g. their
+ *  neighbors), the counts and the blocks can be exchanged with point to
+ *  point messages between partners only, see the second constructor.
+ */
 class alltoall_exchanger {
     const MPI_Comm mpi_com;
 
     int my_rank;
     int nb_processes;
 
-    const std::vector<int> nb_items_to_send;
+    std::vector<long long int> nb_items_to_send;
+    std::vector<long long int> offset_items_to_send;
 
-    std::vector<int> offset_items_to_send;
+    std::vector<long long int> nb_items_to_recv;
+    std::vector<long long int> offset_items_to_recv;
 
-    std::vector<int> nb_items_to_sendrecv_all;
-    std::vector<int> nb_items_to_recv;
-    std::vector<int> offset_items_to_recv;
+    long long int total_to_recv;
 
-    int total_to_recv;
+    // Processes exchanged with by the point to point messages
+    std::vector<int> partners;
 
-    template <class index_type>
-    static std::vector<int> ConvertVector(const std::vector<index_type>& vector){
+    // true if the counts and offsets of all the processes fit in an int
+    bool use_alltoallv;
+    std::vector<int> nb_items_to_send_int;
+    std::vector<int> offset_items_to_send_int;
+    std::vector<int> nb_items_to_recv_int;
+    std::vector<int> offset_items_to_recv_int;
+
+    static std::vector<int> ConvertVector(const std::vector<long long int>& vector){
         std::vector<int> resVector(vector.size());
         for(size_t idx = 0 ; idx < vector.size() ; ++idx){
             assert(vector[idx] <= std::numeric_limits<int>::max());
@@ -34,16 +56,100 @@ class alltoall_exchanger {
         return resVector;
     }
 
+    void exchange(const void* in_to_send, void* out_to_recv,
+                  const MPI_Datatype& in_item_type, const size_t in_item_bytes) const {
+        if(use_alltoallv){
+            AssertMpi(MPI_Alltoallv(const_cast<void*>(in_to_send), const_cast<int*>(nb_items_to_send_int.data()),
+                              const_cast<int*>(offset_items_to_send_int.data()), in_item_type, out_to_recv,
+                              const_cast<int*>(nb_items_to_recv_int.data()), const_cast<int*>(offset_items_to_recv_int.data()), in_item_type,
+                              mpi_com));
+            return;
+        }
+
+        const long long int max_items_per_message = std::numeric_limits<int>::max();
+        const char* send_bytes = static_cast<const char*>(in_to_send);
+        char* recv_bytes = static_cast<char*>(out_to_recv);
+        std::vector<MPI_Request> requests;
+        for(const int idx_proc : partners){
+            int tag = 0;
+            for(long long int idx_item = 0 ; idx_item < nb_items_to_recv[idx_proc] ; idx_item += max_items_per_message, ++tag){
+                const int nb_items = int(std::min(max_items_per_message, nb_items_to_recv[idx_proc]-idx_item));
+                requests.emplace_back();
+                AssertMpi(MPI_Irecv(recv_bytes + size_t(offset_items_to_recv[idx_proc]+idx_item)*in_item_bytes, nb_items,
+                                    in_item_type, idx_proc, tag, mpi_com, &requests.back()));
+            }
+            tag = 0;
+            for(long long int idx_item = 0 ; idx_item < nb_items_to_send[idx_proc] ; idx_item += max_items_per_message, ++tag){
+                const int nb_items = int(std::min(max_items_per_message, nb_items_to_send[idx_proc]-idx_item));
+                requests.emplace_back();
+                AssertMpi(MPI_Isend(const_cast<char*>(send_bytes) + size_t(offset_items_to_send[idx_proc]+idx_item)*in_item_bytes, nb_items,
+                                    in_item_type, idx_proc, tag, mpi_com, &requests.back()));
+            }
+        }
+        assert(nb_items_to_send[my_rank] == nb_items_to_recv[my_rank]);
+        memcpy(recv_bytes + size_t(offset_items_to_recv[my_rank])*in_item_bytes,
+               send_bytes + size_t(offset_items_to_send[my_rank])*in_item_bytes,
+               size_t(nb_items_to_send[my_rank])*in_item_bytes);
+        AssertMpi(MPI_Waitall(int(requests.size()), requests.data(), MPI_STATUSES_IGNORE));
+    }
+
 public:
     template <class index_type>
     alltoall_exchanger(const MPI_Comm& in_mpi_com, const std::vector<index_type>& in_nb_items_to_send)
-        : alltoall_exchanger(in_mpi_com, ConvertVector(in_nb_items_to_send)){
+        :mpi_com(in_mpi_com), nb_items_to_send(in_nb_items_to_send.begin(), in_nb_items_to_send.end()),
+          total_to_recv(0), use_alltoallv(true){
+        TIMEZONE("alltoall_exchanger::constructor");
+
+        AssertMpi(MPI_Comm_rank(mpi_com, &my_rank));
+        AssertMpi(MPI_Comm_size(mpi_com, &nb_processes));
+
+        assert(int(nb_items_to_send.size()) == nb_processes);
+
+        offset_items_to_send.resize(nb_processes+1, 0);
+        for(int idx_proc = 0 ; idx_proc < nb_processes ; ++idx_proc){
+            offset_items_to_send[idx_proc+1] = offset_items_to_send[idx_proc]
+                                             + nb_items_to_send[idx_proc];
+            if(idx_proc != my_rank){
+                partners.push_back(idx_proc);
+            }
+        }
+
+        nb_items_to_recv.resize(nb_processes, 0);
+        AssertMpi(MPI_Alltoall(nb_items_to_send.data(), 1, MPI_LONG_LONG_INT,
+                               nb_items_to_recv.data(), 1, MPI_LONG_LONG_INT,
+                               mpi_com));
 
+        offset_items_to_recv.resize(nb_processes+1, 0);
+        for(int idx_proc = 0 ; idx_proc < nb_processes ; ++idx_proc){
+            offset_items_to_recv[idx_proc+1] = nb_items_to_recv[idx_proc]
+                                                    + offset_items_to_recv[idx_proc];
+        }
+        total_to_recv = offset_items_to_recv[nb_processes];
+
+        // The offsets are the largest values
+        int fits_in_int = (offset_items_to_send[nb_processes] <= std::numeric_limits<int>::max()
+                           && offset_items_to_recv[nb_processes] <= std::numeric_limits<int>::max());
+        AssertMpi(MPI_Allreduce(MPI_IN_PLACE, &fits_in_int, 1, MPI_INT, MPI_LAND, mpi_com));
+        use_alltoallv = (fits_in_int != 0);
+        if(use_alltoallv){
+            nb_items_to_send_int = ConvertVector(nb_items_to_send);
+            offset_items_to_send_int = ConvertVector(offset_items_to_send);
+            nb_items_to_recv_int = ConvertVector(nb_items_to_recv);
+            offset_items_to_recv_int = ConvertVector(offset_items_to_recv);
+        }
     }
 
-    alltoall_exchanger(const MPI_Comm& in_mpi_com, std::vector<int>/*no ref to move here*/ in_nb_items_to_send)
-        :mpi_com(in_mpi_com), nb_items_to_send(std::move(in_nb_items_to_send)), total_to_recv(0){
-        TIMEZONE("alltoall_exchanger::constructor");
+    /** Exchange with in_partners only, where nothing is sent to the other
+     *  processes. The partners must be symmetric: every process sends to
+     *  the processes it receives from. Not a collective call, the counts
+     *  are exchanged with the partners.
+     */
+    template <class index_type>
+    alltoall_exchanger(const MPI_Comm& in_mpi_com, const std::vector<index_type>& in_nb_items_to_send,
+                       const std::vector<int>& in_partners)
+        :mpi_com(in_mpi_com), nb_items_to_send(in_nb_items_to_send.begin(), in_nb_items_to_send.end()),
+          total_to_recv(0), partners(in_partners), use_alltoallv(false){
+        TIMEZONE("alltoall_exchanger::constructor_partners");
 
         AssertMpi(MPI_Comm_rank(mpi_com, &my_rank));
         AssertMpi(MPI_Comm_size(mpi_com, &nb_processes));
@@ -52,29 +158,33 @@ public:
 
         offset_items_to_send.resize(nb_processes+1, 0);
         for(int idx_proc = 0 ; idx_proc < nb_processes ; ++idx_proc){
+            assert(idx_proc == my_rank || nb_items_to_send[idx_proc] == 0
+                   || std::find(partners.begin(), partners.end(), idx_proc) != partners.end());
             offset_items_to_send[idx_proc+1] = offset_items_to_send[idx_proc]
                                              + nb_items_to_send[idx_proc];
         }
 
-        nb_items_to_sendrecv_all.resize(nb_processes*nb_processes);
-        AssertMpi(MPI_Allgather(const_cast<int*>(nb_items_to_send.data()), nb_processes, MPI_INT,
-                          nb_items_to_sendrecv_all.data(), nb_processes, MPI_INT,
-                          mpi_com));
-
         nb_items_to_recv.resize(nb_processes, 0);
+        nb_items_to_recv[my_rank] = nb_items_to_send[my_rank];
+        std::vector<MPI_Request> requests(2*partners.size());
+        for(size_t idx_partner = 0 ; idx_partner < partners.size() ; ++idx_partner){
+            assert(partners[idx_partner] != my_rank);
+            AssertMpi(MPI_Irecv(&nb_items_to_recv[partners[idx_partner]], 1, MPI_LONG_LONG_INT,
+                                partners[idx_partner], 0, mpi_com, &requests[2*idx_partner]));
+            AssertMpi(MPI_Isend(&nb_items_to_send[partners[idx_partner]], 1, MPI_LONG_LONG_INT,
+                                partners[idx_partner], 0, mpi_com, &requests[2*idx_partner+1]));
+        }
+        AssertMpi(MPI_Waitall(int(requests.size()), requests.data(), MPI_STATUSES_IGNORE));
+
         offset_items_to_recv.resize(nb_processes+1, 0);
         for(int idx_proc = 0 ; idx_proc < nb_processes ; ++idx_proc){
-            const int nbrecv = nb_items_to_sendrecv_all[idx_proc*nb_processes + my_rank];
-            assert(static_cast<long long int>(total_to_recv) + static_cast<long long int>(nbrecv) <= std::numeric_limits<int>::max());
-            total_to_recv += nbrecv;
-            nb_items_to_recv[idx_proc] = nbrecv;
-            assert(static_cast<long long int>(nb_items_to_recv[idx_proc]) + static_cast<long long int>(offset_items_to_recv[idx_proc]) <= std::numeric_limits<int>::max());
             offset_items_to_recv[idx_proc+1] = nb_items_to_recv[idx_proc]
                                                     + offset_items_to_recv[idx_proc];
         }
+        total_to_recv = offset_items_to_recv[nb_processes];
     }
 
-    int getTotalToRecv() const{
+    long long int getTotalToRecv() const{
         return total_to_recv;
     }
 
@@ -82,10 +192,7 @@ public:
     void alltoallv_dt(const ItemType in_to_send[],
                    ItemType out_to_recv[], const MPI_Datatype& in_type) const {
         TIMEZONE("alltoallv");
-        AssertMpi(MPI_Alltoallv(const_cast<ItemType*>(in_to_send), const_cast<int*>(nb_items_to_send.data()),
-                          const_cast<int*>(offset_items_to_send.data()), in_type, out_to_recv,
-                          const_cast<int*>(nb_items_to_recv.data()), const_cast<int*>(offset_items_to_recv.data()), in_type,
-                          mpi_com));
+        exchange(in_to_send, out_to_recv, in_type, sizeof(ItemType));
     }
 
     template <class ItemType>
@@ -98,27 +205,11 @@ public:
     void alltoallv_dt(const ItemType in_to_send[],
                    ItemType out_to_recv[], const MPI_Datatype& in_type, const int in_nb_values_per_item) const {
         TIMEZONE("alltoallv");
-        std::vector<int> nb_items_to_send_tmp = nb_items_to_send;
-        particles_utils::transform(nb_items_to_send_tmp.begin(), nb_items_to_send_tmp.end(), nb_items_to_send_tmp.begin(),
-                                   [&](const int val) -> int { assert(static_cast<long long int>(val) * static_cast<long long int>(in_nb_values_per_item) <= std::numeric_limits<int>::max());
-                                                               return val * in_nb_values_per_item ;});
-        std::vector<int> offset_items_to_send_tmp = offset_items_to_send;
-        particles_utils::transform(offset_items_to_send_tmp.begin(), offset_items_to_send_tmp.end(), offset_items_to_send_tmp.begin(),
-                                   [&](const int val) -> int { assert(static_cast<long long int>(val) * static_cast<long long int>(in_nb_values_per_item) <= std::numeric_limits<int>::max());
-                                                               return val * in_nb_values_per_item ;});
-        std::vector<int> nb_items_to_recv_tmp = nb_items_to_recv;
-        particles_utils::transform(nb_items_to_recv_tmp.begin(), nb_items_to_recv_tmp.end(), nb_items_to_recv_tmp.begin(),
-                                   [&](const int val) -> int { assert(static_cast<long long int>(val) * static_cast<long long int>(in_nb_values_per_item) <= std::numeric_limits<int>::max());
-                                                               return val * in_nb_values_per_item ;});
-        std::vector<int> offset_items_to_recv_tmp = offset_items_to_recv;
-        particles_utils::transform(offset_items_to_recv_tmp.begin(), offset_items_to_recv_tmp.end(), offset_items_to_recv_tmp.begin(),
-                                   [&](const int val) -> int { assert(static_cast<long long int>(val) * static_cast<long long int>(in_nb_values_per_item) <= std::numeric_limits<int>::max());
-                                                               return val * in_nb_values_per_item ;});
-
-        AssertMpi(MPI_Alltoallv(const_cast<ItemType*>(in_to_send), const_cast<int*>(nb_items_to_send_tmp.data()),
-                          const_cast<int*>(offset_items_to_send_tmp.data()), in_type, out_to_recv,
-                          const_cast<int*>(nb_items_to_recv_tmp.data()), const_cast<int*>(offset_items_to_recv_tmp.data()), in_type,
-                          mpi_com));
+        MPI_Datatype item_type;
+        AssertMpi(MPI_Type_contiguous(in_nb_values_per_item, in_type, &item_type));
+        AssertMpi(MPI_Type_commit(&item_type));
+        exchange(in_to_send, out_to_recv, item_type, sizeof(ItemType)*size_t(in_nb_values_per_item));
+        AssertMpi(MPI_Type_free(&item_type));
     }
 
     template <class ItemType>
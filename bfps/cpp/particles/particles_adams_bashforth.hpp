@@ -7,11 +7,127 @@
 #include "scope_timer.hpp"
 #include "particles_utils.hpp"
 
+/** Coefficients of the Adams-Bashforth formulation with nb_rhs steps,
+ *  the move being dt × (Σ numerator(idx_rhs) [idx_rhs])/denominator,
+ *  where [0] is the most recent rhs.
+ */
+template <int nb_rhs>
+struct particles_adams_bashforth_coefficients;
+
+template <>
+struct particles_adams_bashforth_coefficients<1>{
+    // dt × [0]
+    static constexpr double numerator(const int /*idx_rhs*/){
+        return 1.;
+    }
+    static constexpr double denominator = 1.;
+};
+
+template <>
+struct particles_adams_bashforth_coefficients<2>{
+    // dt × (3[0] - [1])/2
+    static constexpr double numerator(const int idx_rhs){
+        return (idx_rhs == 0 ? 3. : -1.);
+    }
+    static constexpr double denominator = 2.;
+};
+
+template <>
+struct particles_adams_bashforth_coefficients<3>{
+    // dt × (23[0] - 16[1] + 5[2])/12
+    static constexpr double numerator(const int idx_rhs){
+        return (idx_rhs == 0 ? 23. : idx_rhs == 1 ? -16. : 5.);
+    }
+    static constexpr double denominator = 12.;
+};
+
+template <>
+struct particles_adams_bashforth_coefficients<4>{
+    // dt × (55[0] - 59[1] + 37[2] - 9[3])/24
+    static constexpr double numerator(const int idx_rhs){
+        return (idx_rhs == 0 ? 55. : idx_rhs == 1 ? -59. : idx_rhs == 2 ? 37. : -9.);
+    }
+    static constexpr double denominator = 24.;
+};
+
+template <>
+struct particles_adams_bashforth_coefficients<5>{
+    // dt × (1901[0] - 2774[1] + 2616[2] - 1274[3] + 251[4])/720
+    static constexpr double numerator(const int idx_rhs){
+        return (idx_rhs == 0 ? 1901. : idx_rhs == 1 ? -2774. : idx_rhs == 2 ? 2616. : idx_rhs == 3 ? -1274. : 251.);
+    }
+    static constexpr double denominator = 720.;
+};
+
+template <>
+struct particles_adams_bashforth_coefficients<6>{
+    // dt × (4277[0] - 7923[1] + 9982[2] - 7298[3] + 2877[4] - 475[5])/1440
+    static constexpr double numerator(const int idx_rhs){
+        return (idx_rhs == 0 ? 4277. : idx_rhs == 1 ? -7923. : idx_rhs == 2 ? 9982. :
+                idx_rhs == 3 ? -7298. : idx_rhs == 4 ? 2877. : -475.);
+    }
+    static constexpr double denominator = 1440.;
+};
+
 template <class partsize_t, class real_number, int size_particle_positions = 3, int size_particle_rhs = 3>
 class particles_adams_bashforth {
     static_assert(size_particle_positions == size_particle_rhs,
                   "Not having the same dimension for positions and rhs looks like a bug,"
                   "otherwise comment this assertion.");
+
+    // Moves the particles of thread idx_thread, the ones of
+    // IntervalSplitter(nb_particles, nb_threads, idx_thread), and calls
+    // in_moved(idx_thread, idx_part, position) on each particle once moved
+    template <int nb_rhs, class MovedFunc>
+    static void move_particles_interval(real_number*__restrict__ particles_positions,
+                                        const partsize_t nb_particles,
+                                        const std::unique_ptr<real_number[]> particles_rhs[],
+                                        const real_number dt,
+                                        const int nb_threads, const int idx_thread,
+                                        MovedFunc&& in_moved){
+        typedef particles_adams_bashforth_coefficients<nb_rhs> coefficients;
+
+        particles_utils::IntervalSplitter<partsize_t> interval(nb_particles,
+                                                               partsize_t(nb_threads),
+                                                               partsize_t(idx_thread));
+
+        const real_number* __restrict__ rhs[nb_rhs];
+        for(int idx_rhs = 0 ; idx_rhs < nb_rhs ; ++idx_rhs){
+            rhs[idx_rhs] = particles_rhs[idx_rhs].get();
+        }
+
+        const partsize_t part_end = interval.getMyOffset()+interval.getMySize();
+        for(partsize_t idx_part = interval.getMyOffset() ; idx_part < part_end ; ++idx_part){
+            for(int idx_dim = 0 ; idx_dim < size_particle_positions ; ++idx_dim){
+                const partsize_t idx_value = idx_part*size_particle_positions + idx_dim;
+                double sum = 0;
+                for(int idx_rhs = 0 ; idx_rhs < nb_rhs ; ++idx_rhs){
+                    sum += coefficients::numerator(idx_rhs)*rhs[idx_rhs][idx_value];
+                }
+                particles_positions[idx_value] += dt * sum/coefficients::denominator;
+            }
+            in_moved(idx_thread, idx_part, &particles_positions[idx_part*size_particle_positions]);
+        }
+    }
+
+    template <int nb_rhs, class MovedFunc>
+    static void move_particles_parallel(real_number*__restrict__ particles_positions,
+                                        const partsize_t nb_particles,
+                                        const std::unique_ptr<real_number[]> particles_rhs[],
+                                        const real_number dt,
+                                        const int nb_threads,
+                                        MovedFunc&& in_moved){
+#pragma omp parallel default(shared) num_threads(nb_threads)
+        {
+            // The team might be smaller than requested
+            for(int idx_thread = omp_get_thread_num() ; idx_thread < nb_threads ;
+                idx_thread += omp_get_num_threads()){
+                move_particles_interval<nb_rhs>(particles_positions, nb_particles, particles_rhs, dt,
+                                                nb_threads, idx_thread, in_moved);
+            }
+        }
+    }
+
 public:
     static const int Max_steps = 6;
 
@@ -20,6 +136,24 @@ public:
                         const std::unique_ptr<real_number[]> particles_rhs[],
                         const int nb_rhs, const real_number dt) const{
         TIMEZONE("particles_adams_bashforth::move_particles");
+        move_particles(particles_positions, nb_particles, particles_rhs, nb_rhs, dt, omp_get_max_threads(),
+                       [](const int /*idx_thread*/, const partsize_t /*idx_part*/, const real_number /*position*/[]){});
+    }
+
+    /** Same as above, but also calls in_moved(idx_thread, idx_part, position)
+     *  on each particle right after it is moved, in the same sweep, so that
+     *  the new positions can be classified while they are in cache.
+     *  The particles are split in nb_threads intervals, idx_thread being
+     *  the one of particles_utils::IntervalSplitter(nb_particles, nb_threads, idx_thread),
+     *  and each interval is moved by a single thread.
+     */
+    template <class MovedFunc>
+    void move_particles(real_number*__restrict__ particles_positions,
+                        const partsize_t nb_particles,
+                        const std::unique_ptr<real_number[]> particles_rhs[],
+                        const int nb_rhs, const real_number dt,
+                        const int nb_threads, MovedFunc&& in_moved) const{
+        TIMEZONE("particles_adams_bashforth::move_particles");
 
         if(Max_steps < nb_rhs){
             throw std::runtime_error("Error, in bfps particles_adams_bashforth.\n"
@@ -27,108 +161,27 @@ public:
                                      "you must add formulation up this number or limit the number of steps.");
         }
 
-        // Not needed: TIMEZONE_OMP_INIT_PREPARALLEL(omp_get_max_threads())
-#pragma omp parallel default(shared)
-        {
-            particles_utils::IntervalSplitter<partsize_t> interval(nb_particles,
-                                                            omp_get_num_threads(),
-                                                            omp_get_thread_num());
-
-            const partsize_t value_start = interval.getMyOffset()*size_particle_positions;
-            const partsize_t value_end = (interval.getMyOffset()+interval.getMySize())*size_particle_positions;
-
-            // TODO full unroll + blocking
-            switch (nb_rhs){
-            case 1:
-            {
-                const real_number* __restrict__ rhs_0 = particles_rhs[0].get();
-                for(partsize_t idx_value = value_start ; idx_value < value_end ; ++idx_value){
-                    // dt × [0]
-                    particles_positions[idx_value] += dt * rhs_0[idx_value];
-                }
-            }
-                break;
-            case 2:
-            {
-                const real_number* __restrict__ rhs_0 = particles_rhs[0].get();
-                const real_number* __restrict__ rhs_1 = particles_rhs[1].get();
-                for(partsize_t idx_value = value_start ; idx_value < value_end ; ++idx_value){
-                    // dt × (3[0] - [1])/2
-                    particles_positions[idx_value]
-                            += dt * (3.*rhs_0[idx_value]
-                                     - rhs_1[idx_value])/2.;
-                }
-            }
-                break;
-            case 3:
-            {
-                const real_number* __restrict__ rhs_0 = particles_rhs[0].get();
-                const real_number* __restrict__ rhs_1 = particles_rhs[1].get();
-                const real_number* __restrict__ rhs_2 = particles_rhs[2].get();
-                for(partsize_t idx_value = value_start ; idx_value < value_end ; ++idx_value){
-                    // dt × (23[0] - 16[1] + 5[2])/12
-                    particles_positions[idx_value]
-                            += dt * (23.*rhs_0[idx_value]
-                                     - 16.*rhs_1[idx_value]
-                                     +  5.*rhs_2[idx_value])/12.;
-                }
-            }
-                break;
-            case 4:
-            {
-                const real_number* __restrict__ rhs_0 = particles_rhs[0].get();
-                const real_number* __restrict__ rhs_1 = particles_rhs[1].get();
-                const real_number* __restrict__ rhs_2 = particles_rhs[2].get();
-                const real_number* __restrict__ rhs_3 = particles_rhs[3].get();
-                for(partsize_t idx_value = value_start ; idx_value < value_end ; ++idx_value){
-                    // dt × (55[0] - 59[1] + 37[2] - 9[3])/24
-                    particles_positions[idx_value]
-                            += dt * (55.*rhs_0[idx_value]
-                                     - 59.*rhs_1[idx_value]
-                                     + 37.*rhs_2[idx_value]
-                                     -  9.*rhs_3[idx_value])/24.;
-                }
-            }
-                break;
-            case 5:
-            {
-                const real_number* __restrict__ rhs_0 = particles_rhs[0].get();
-                const real_number* __restrict__ rhs_1 = particles_rhs[1].get();
-                const real_number* __restrict__ rhs_2 = particles_rhs[2].get();
-                const real_number* __restrict__ rhs_3 = particles_rhs[3].get();
-                const real_number* __restrict__ rhs_4 = particles_rhs[4].get();
-                for(partsize_t idx_value = value_start ; idx_value < value_end ; ++idx_value){
-                    // dt × (1901[0] - 2774[1] + 2616[2] - 1274[3] + 251[4])/720
-                    particles_positions[idx_value]
-                            += dt * (1901.*rhs_0[idx_value]
-                                     - 2774.*rhs_1[idx_value]
-                                     + 2616.*rhs_2[idx_value]
-                                     - 1274.*rhs_3[idx_value]
-                                     +  251.*rhs_4[idx_value])/720.;
-                }
-            }
-                break;
-            case 6:
-            {
-                const real_number* __restrict__ rhs_0 = particles_rhs[0].get();
-                const real_number* __restrict__ rhs_1 = particles_rhs[1].get();
-                const real_number* __restrict__ rhs_2 = particles_rhs[2].get();
-                const real_number* __restrict__ rhs_3 = particles_rhs[3].get();
-                const real_number* __restrict__ rhs_4 = particles_rhs[4].get();
-                const real_number* __restrict__ rhs_5 = particles_rhs[5].get();
-                for(partsize_t idx_value = value_start ; idx_value < value_end ; ++idx_value){
-                    // dt × (4277[0] - 7923[1] + 9982[2] - 7298[3] + 2877[4] - 475[5])/1440
-                    particles_positions[idx_value]
-                            += dt * (4277.*rhs_0[idx_value]
-                                     - 7923.*rhs_1[idx_value]
-                                     + 9982.*rhs_2[idx_value]
-                                     - 7298.*rhs_3[idx_value]
-                                     + 2877.*rhs_4[idx_value]
-                                     -  475.*rhs_5[idx_value])/1440.;
-                }
-            }
-                break;
-            }
+        // The number of rhs is only known here: the loops are specialized
+        // for each one, with the coefficients as compile time constants
+        switch (nb_rhs){
+        case 1:
+            move_particles_parallel<1>(particles_positions, nb_particles, particles_rhs, dt, nb_threads, in_moved);
+            break;
+        case 2:
+            move_particles_parallel<2>(particles_positions, nb_particles, particles_rhs, dt, nb_threads, in_moved);
+            break;
+        case 3:
+            move_particles_parallel<3>(particles_positions, nb_particles, particles_rhs, dt, nb_threads, in_moved);
+            break;
+        case 4:
+            move_particles_parallel<4>(particles_positions, nb_particles, particles_rhs, dt, nb_threads, in_moved);
+            break;
+        case 5:
+            move_particles_parallel<5>(particles_positions, nb_particles, particles_rhs, dt, nb_threads, in_moved);
+            break;
+        case 6:
+            move_particles_parallel<6>(particles_positions, nb_particles, particles_rhs, dt, nb_threads, in_moved);
+            break;
         }
     }
 };
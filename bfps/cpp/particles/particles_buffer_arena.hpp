@@ -0,0 +1,103 @@
+#ifndef PARTICLES_BUFFER_ARENA_HPP
+#define PARTICLES_BUFFER_ARENA_HPP
+
+#include <mpi.h>
+#include <cassert>
+#include <vector>
+
+#include "particles_utils.hpp"
+
+/** Memory for the buffers of a communication round.
+ *
+ *  Buffers are handed out from a single block allocated with MPI_Alloc_mem,
+ *  so that the MPI library can use registered memory, and stay valid until
+ *  the next call to reset().
+ *  When a round needs more than the block holds, the extra buffers are
+ *  allocated separately and the block is grown to the high-water mark of
+ *  that round at the next reset(), so that in steady state there is no
+ *  allocation at all.
+ *  Not thread safe.
+ */
+class particles_buffer_arena {
+    static const size_t Alignment = 64;
+
+    char* block;
+    size_t block_size;
+    size_t block_used;
+    size_t round_high_water;
+
+    std::vector<char*> extra_blocks;
+
+    static char* allocate(const size_t in_size){
+        void* ptr = nullptr;
+        AssertMpi(MPI_Alloc_mem(MPI_Aint(in_size), MPI_INFO_NULL, &ptr));
+        return static_cast<char*>(ptr);
+    }
+
+    // Also called from the destructor, so errors are not turned into exceptions
+    static void deallocate(char* ptr){
+        if(ptr != nullptr){
+            MPI_Free_mem(ptr);
+        }
+    }
+
+    static size_t aligned(const size_t in_size){
+        return ((in_size + Alignment - 1)/Alignment)*Alignment;
+    }
+
+public:
+    particles_buffer_arena()
+        : block(nullptr), block_size(0), block_used(0), round_high_water(0){
+    }
+
+    ~particles_buffer_arena(){
+        release_extra_blocks();
+        deallocate(block);
+    }
+
+    particles_buffer_arena(const particles_buffer_arena&) = delete;
+    particles_buffer_arena& operator=(const particles_buffer_arena&) = delete;
+
+    /** Invalidates all the buffers, and grows the block if the previous
+     *  round did not fit into it. */
+    void reset(){
+        release_extra_blocks();
+        if(round_high_water > block_size){
+            deallocate(block);
+            block = allocate(round_high_water);
+            block_size = round_high_water;
+        }
+        block_used = 0;
+        round_high_water = 0;
+    }
+
+    template <class ItemType>
+    ItemType* get(const size_t nb_items){
+        const size_t size = aligned(nb_items*sizeof(ItemType));
+        round_high_water += size;
+        if(size == 0){
+            return nullptr;
+        }
+        if(block_used + size <= block_size){
+            char* ptr = block + block_used;
+            block_used += size;
+            return reinterpret_cast<ItemType*>(ptr);
+        }
+        extra_blocks.push_back(allocate(size));
+        return reinterpret_cast<ItemType*>(extra_blocks.back());
+    }
+
+    size_t capacity() const{
+        return block_size;
+    }
+
+private:
+    void release_extra_blocks(){
+        for(char* ptr : extra_blocks){
+            deallocate(ptr);
+        }
+        extra_blocks.clear();
+    }
+};
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <mpi.h>
 
+#include <algorithm>
 #include <vector>
 #include <memory>
 #include <cassert>
@@ -12,6 +13,9 @@
 
 #include "scope_timer.hpp"
 #include "particles_utils.hpp"
+#include "alltoall_exchanger.hpp"
+#include "particles_buffer_arena.hpp"
+#include "particles_field_computer.hpp"
 
 
 template <class partsize_t, class real_number>
@@ -52,9 +56,10 @@ protected:
         bool isLower;
         int idxLowerUpper;
 
-        std::unique_ptr<real_number[]> toRecvAndMerge;
-        std::unique_ptr<real_number[]> toCompute;
-        std::unique_ptr<real_number[]> results;
+        // Buffers from comm_buffers, only valid during the current call
+        real_number* toRecvAndMerge = nullptr;
+        real_number* toCompute = nullptr;
+        real_number* results = nullptr;
     };
 
     enum Action{
@@ -83,12 +88,27 @@ protected:
     std::unique_ptr<int[]> partition_interval_size_per_proc;
     std::unique_ptr<int[]> partition_interval_offset_per_proc;
 
+    std::unique_ptr<int[]> rank_per_layer;
+
     std::unique_ptr<partsize_t[]> current_offset_particles_for_partition;
 
     std::vector<std::pair<Action,int>> whatNext;
     std::vector<MPI_Request> mpiRequests;
     std::vector<NeighborDescriptor> neigDescriptors;
 
+    // Communication buffers, reused from one call to the next
+    particles_buffer_arena comm_buffers;
+
+    // Classification done by bin_particle, used by redistribute_binned.
+    // The bins are the local partitions followed by the processes.
+    int binning_nb_threads;
+    int binning_nb_bins;
+    // Number of counts per thread, padded to whole cache lines
+    int binning_counts_stride;
+    partsize_t binning_nb_particles;
+    std::vector<int> bin_per_particle;
+    std::vector<partsize_t> binning_counts;
+
 public:
     ////////////////////////////////////////////////////////////////////////////
 
@@ -99,7 +119,8 @@ public:
             my_rank(-1), nb_processes(-1),nb_processes_involved(-1),
             current_partition_interval(in_current_partitions),
             current_partition_size(current_partition_interval.second-current_partition_interval.first),
-            field_grid_dim(in_field_grid_dim){
+            field_grid_dim(in_field_grid_dim),
+            binning_nb_threads(0), binning_nb_bins(0), binning_counts_stride(0), binning_nb_particles(0){
 
         AssertMpi(MPI_Comm_rank(current_com, &my_rank));
         AssertMpi(MPI_Comm_size(current_com, &nb_processes));
@@ -128,6 +149,14 @@ public:
         }
 
         assert(int(field_grid_dim[IDX_Z]) == partition_interval_offset_per_proc[nb_processes_involved]);
+
+        rank_per_layer.reset(new int[field_grid_dim[IDX_Z]]);
+        for(int idx_proc_involved = 0 ; idx_proc_involved < nb_processes_involved ; ++idx_proc_involved){
+            for(int idx_layer = partition_interval_offset_per_proc[idx_proc_involved] ;
+                idx_layer < partition_interval_offset_per_proc[idx_proc_involved+1] ; ++idx_layer){
+                rank_per_layer[idx_layer] = idx_proc_involved;
+            }
+        }
     }
 
     virtual ~particles_distr_mpi(){}
@@ -165,6 +194,7 @@ public:
         assert(mpiRequests.size() == 0);
 
         neigDescriptors.clear();
+        comm_buffers.reset();
 
         int nbProcToRecvLower;
         {
@@ -256,11 +286,11 @@ public:
                                   current_com, &mpiRequests.back()));
 
                         assert(descriptor.toRecvAndMerge == nullptr);
-                        descriptor.toRecvAndMerge.reset(new real_number[descriptor.nbParticlesToSend*size_particle_rhs]);
+                        descriptor.toRecvAndMerge = comm_buffers.template get<real_number>(descriptor.nbParticlesToSend*size_particle_rhs);
                         whatNext.emplace_back(std::pair<Action,int>{MERGE_PARTICLES, idxDescr});
                         mpiRequests.emplace_back();
                         assert(descriptor.nbParticlesToSend*size_particle_rhs < std::numeric_limits<int>::max());
-                        AssertMpi(MPI_Irecv(descriptor.toRecvAndMerge.get(), int(descriptor.nbParticlesToSend*size_particle_rhs), particles_utils::GetMpiType(real_number()), descriptor.destProc, TAG_UP_LOW_RESULTS,
+                        AssertMpi(MPI_Irecv(descriptor.toRecvAndMerge, int(descriptor.nbParticlesToSend*size_particle_rhs), particles_utils::GetMpiType(real_number()), descriptor.destProc, TAG_UP_LOW_RESULTS,
                                   current_com, &mpiRequests.back()));
                     }
                 }
@@ -290,11 +320,11 @@ public:
                                         current_com, &mpiRequests.back()));
 
                     assert(descriptor.toRecvAndMerge == nullptr);
-                    descriptor.toRecvAndMerge.reset(new real_number[descriptor.nbParticlesToSend*size_particle_rhs]);
+                    descriptor.toRecvAndMerge = comm_buffers.template get<real_number>(descriptor.nbParticlesToSend*size_particle_rhs);
                     whatNext.emplace_back(std::pair<Action,int>{MERGE_PARTICLES, idxDescr});
                     mpiRequests.emplace_back();
                     assert(descriptor.nbParticlesToSend*size_particle_rhs < std::numeric_limits<int>::max());
-                    AssertMpi(MPI_Irecv(descriptor.toRecvAndMerge.get(), int(descriptor.nbParticlesToSend*size_particle_rhs), particles_utils::GetMpiType(real_number()), descriptor.destProc, TAG_LOW_UP_RESULTS,
+                    AssertMpi(MPI_Irecv(descriptor.toRecvAndMerge, int(descriptor.nbParticlesToSend*size_particle_rhs), particles_utils::GetMpiType(real_number()), descriptor.destProc, TAG_LOW_UP_RESULTS,
                               current_com, &mpiRequests.back()));
                 }
 
@@ -343,11 +373,11 @@ public:
                             assert(NbParticlesToReceive != -1);
                             assert(descriptor.toCompute == nullptr);
                             if(NbParticlesToReceive){
-                                descriptor.toCompute.reset(new real_number[NbParticlesToReceive*size_particle_positions]);
+                                descriptor.toCompute = comm_buffers.template get<real_number>(NbParticlesToReceive*size_particle_positions);
                                 whatNext.emplace_back(std::pair<Action,int>{COMPUTE_PARTICLES, releasedAction.second});
                                 mpiRequests.emplace_back();
                                 assert(NbParticlesToReceive*size_particle_positions < std::numeric_limits<int>::max());
-                                AssertMpi(MPI_Irecv(descriptor.toCompute.get(), int(NbParticlesToReceive*size_particle_positions),
+                                AssertMpi(MPI_Irecv(descriptor.toCompute, int(NbParticlesToReceive*size_particle_positions),
                                                     particles_utils::GetMpiType(real_number()), destProc, TAG_UP_LOW_PARTICLES,
                                                     current_com, &mpiRequests.back()));
                             }
@@ -360,11 +390,11 @@ public:
                             assert(NbParticlesToReceive != -1);
                             assert(descriptor.toCompute == nullptr);
                             if(NbParticlesToReceive){
-                                descriptor.toCompute.reset(new real_number[NbParticlesToReceive*size_particle_positions]);
+                                descriptor.toCompute = comm_buffers.template get<real_number>(NbParticlesToReceive*size_particle_positions);
                                 whatNext.emplace_back(std::pair<Action,int>{COMPUTE_PARTICLES, releasedAction.second});
                                 mpiRequests.emplace_back();
                                 assert(NbParticlesToReceive*size_particle_positions < std::numeric_limits<int>::max());
-                                AssertMpi(MPI_Irecv(descriptor.toCompute.get(), int(NbParticlesToReceive*size_particle_positions),
+                                AssertMpi(MPI_Irecv(descriptor.toCompute, int(NbParticlesToReceive*size_particle_positions),
                                                     particles_utils::GetMpiType(real_number()), destProc, TAG_LOW_UP_PARTICLES,
                                                     current_com, &mpiRequests.back()));
                             }
@@ -379,11 +409,11 @@ public:
                         const partsize_t NbParticlesToReceive = descriptor.nbParticlesToRecv;
 
                         assert(descriptor.toCompute != nullptr);
-                        descriptor.results.reset(new real_number[NbParticlesToReceive*size_particle_rhs]);
-                        in_computer.template init_result_array<size_particle_rhs>(descriptor.results.get(), NbParticlesToReceive);
+                        descriptor.results = comm_buffers.template get<real_number>(NbParticlesToReceive*size_particle_rhs);
+                        in_computer.template init_result_array<size_particle_rhs>(descriptor.results, NbParticlesToReceive);
 
                         if(more_than_one_thread == false){
-                            in_computer.template apply_computation<field_class, size_particle_rhs>(in_field, descriptor.toCompute.get(), descriptor.results.get(), NbParticlesToReceive);
+                            in_computer.template apply_computation<field_class, size_particle_rhs>(in_field, descriptor.toCompute, descriptor.results, NbParticlesToReceive);
                         }
                         else{
                             TIMEZONE_OMP_INIT_PRETASK(timeZoneTaskKey)
@@ -408,7 +438,7 @@ public:
                         mpiRequests.emplace_back();
                         const int tag = descriptor.isLower? TAG_LOW_UP_RESULTS : TAG_UP_LOW_RESULTS;                        
                         assert(NbParticlesToReceive*size_particle_rhs < std::numeric_limits<int>::max());
-                        AssertMpi(MPI_Isend(descriptor.results.get(), int(NbParticlesToReceive*size_particle_rhs), particles_utils::GetMpiType(real_number()), destProc, tag,
+                        AssertMpi(MPI_Isend(descriptor.results, int(NbParticlesToReceive*size_particle_rhs), particles_utils::GetMpiType(real_number()), destProc, tag,
                                   current_com, &mpiRequests.back()));
                     }
                     //////////////////////////////////////////////////////////////////////
@@ -417,7 +447,7 @@ public:
                     if(releasedAction.first == RELEASE_BUFFER_PARTICLES){
                         NeighborDescriptor& descriptor = neigDescriptors[releasedAction.second];
                         assert(descriptor.toCompute != nullptr);
-                        descriptor.toCompute.release();
+                        descriptor.toCompute = nullptr;
                     }
                     //////////////////////////////////////////////////////////////////////
                     /// Merge
@@ -428,15 +458,15 @@ public:
                         if(descriptor.isLower){
                             TIMEZONE("reduce");
                             assert(descriptor.toRecvAndMerge != nullptr);
-                            in_computer.template reduce_particles_rhs<size_particle_rhs>(&particles_current_rhs[0], descriptor.toRecvAndMerge.get(), descriptor.nbParticlesToSend);
-                            descriptor.toRecvAndMerge.release();
+                            in_computer.template reduce_particles_rhs<size_particle_rhs>(&particles_current_rhs[0], descriptor.toRecvAndMerge, descriptor.nbParticlesToSend);
+                            descriptor.toRecvAndMerge = nullptr;
                         }
                         else {
                             TIMEZONE("reduce");
                             assert(descriptor.toRecvAndMerge != nullptr);
                             in_computer.template reduce_particles_rhs<size_particle_rhs>(&particles_current_rhs[(current_offset_particles_for_partition[current_partition_size]-descriptor.nbParticlesToSend)*size_particle_rhs],
-                                             descriptor.toRecvAndMerge.get(), descriptor.nbParticlesToSend);
-                            descriptor.toRecvAndMerge.release();
+                                             descriptor.toRecvAndMerge, descriptor.nbParticlesToSend);
+                            descriptor.toRecvAndMerge = nullptr;
                         }
                     }
                 }
@@ -473,15 +503,15 @@ public:
                     if(descriptor.isLower){
                         TIMEZONE("reduce_later");
                         assert(descriptor.toRecvAndMerge != nullptr);
-                        in_computer.template reduce_particles_rhs<size_particle_rhs>(&particles_current_rhs[0], descriptor.toRecvAndMerge.get(), descriptor.nbParticlesToSend);
-                        descriptor.toRecvAndMerge.release();
+                        in_computer.template reduce_particles_rhs<size_particle_rhs>(&particles_current_rhs[0], descriptor.toRecvAndMerge, descriptor.nbParticlesToSend);
+                        descriptor.toRecvAndMerge = nullptr;
                     }
                     else {
                         TIMEZONE("reduce_later");
                         assert(descriptor.toRecvAndMerge != nullptr);
                         in_computer.template reduce_particles_rhs<size_particle_rhs>(&particles_current_rhs[(current_offset_particles_for_partition[current_partition_size]-descriptor.nbParticlesToSend)*size_particle_rhs],
-                                         descriptor.toRecvAndMerge.get(), descriptor.nbParticlesToSend);
-                        descriptor.toRecvAndMerge.release();
+                                         descriptor.toRecvAndMerge, descriptor.nbParticlesToSend);
+                        descriptor.toRecvAndMerge = nullptr;
                     }
                 }
             }
@@ -500,6 +530,42 @@ public:
         assert(mpiRequests.size() == 0);
     }
 
+    ////////////////////////////////////////////////////////////////////////////
+
+    // Compute all the particles with a field that already holds the ghost
+    // layers of the current partitions (no particle is sent)
+    template <class computer_class, class field_class, int size_particle_positions, int size_particle_rhs>
+    void compute_local(computer_class& in_computer,
+                       const field_class& in_field,
+                       const partsize_t current_my_nb_particles_per_partition[],
+                       const real_number particles_positions[],
+                       real_number particles_current_rhs[]){
+        TIMEZONE("compute_local");
+        static_assert(particles_field_has_ghost_layers<field_class>::value,
+                      "the field must hold the ghost layers");
+
+        // Some processes might not be involved
+        if(nb_processes_involved <= my_rank){
+            return;
+        }
+
+        partsize_t myTotalNbParticles = 0;
+        for(int idxPartition = 0 ; idxPartition < current_partition_size ; ++idxPartition){
+            myTotalNbParticles += current_my_nb_particles_per_partition[idxPartition];
+        }
+
+        const partsize_t nbParticlesPerChunk = 300;
+        const partsize_t nbChunks = (myTotalNbParticles+nbParticlesPerChunk-1)/nbParticlesPerChunk;
+        #pragma omp parallel for schedule(dynamic)
+        for(partsize_t idxChunk = 0 ; idxChunk < nbChunks ; ++idxChunk){
+            const partsize_t idxPart = idxChunk*nbParticlesPerChunk;
+            const partsize_t sizeToDo = std::min(nbParticlesPerChunk, myTotalNbParticles-idxPart);
+            in_computer.template apply_computation<field_class, size_particle_rhs>(in_field, &particles_positions[idxPart*size_particle_positions],
+                                                                                   &particles_current_rhs[idxPart*size_particle_rhs],
+                                                                                   sizeToDo);
+        }
+    }
+
 
     ////////////////////////////////////////////////////////////////////////////
 
@@ -512,11 +578,6 @@ public:
                       std::unique_ptr<partsize_t[]>* inout_index_particles){
         TIMEZONE("redistribute");
 
-        // Some latest processes might not be involved
-        if(nb_processes_involved <= my_rank){
-            return;
-        }
-
         current_offset_particles_for_partition[0] = 0;
         partsize_t myTotalNbParticles = 0;
         for(int idxPartition = 0 ; idxPartition < current_partition_size ; ++idxPartition){
@@ -525,6 +586,20 @@ public:
         }
         assert((*nb_particles) == myTotalNbParticles);
 
+        // Use the neighbors exchange only if no particle jumped further (collective)
+        if(!particles_stay_within_one_hop<computer_class, size_particle_positions>(in_computer,
+                    current_my_nb_particles_per_partition, (*inout_positions_particles).get())){
+            redistribute_multi_hop<computer_class, size_particle_positions, size_particle_rhs, size_particle_index>(
+                        in_computer, current_my_nb_particles_per_partition, nb_particles,
+                        inout_positions_particles, inout_rhs_particles, in_nb_rhs, inout_index_particles);
+            return;
+        }
+
+        // Some latest processes might not be involved
+        if(nb_processes_involved <= my_rank){
+            return;
+        }
+
         // Find particles outside my interval
         const partsize_t nbOutLower = particles_utils::partition_extra<partsize_t, size_particle_positions>(&(*inout_positions_particles)[0], current_my_nb_particles_per_partition[0],
                     [&](const real_number val[]){
@@ -577,12 +652,13 @@ public:
         int eventsBeforeWaitall = 0;
         partsize_t nbNewFromLow = 0;
         partsize_t nbNewFromUp = 0;
-        std::unique_ptr<real_number[]> newParticlesLow;
-        std::unique_ptr<real_number[]> newParticlesUp;
-        std::unique_ptr<partsize_t[]> newParticlesLowIndexes;
-        std::unique_ptr<partsize_t[]> newParticlesUpIndexes;
-        std::vector<std::unique_ptr<real_number[]>> newParticlesLowRhs(in_nb_rhs);
-        std::vector<std::unique_ptr<real_number[]>> newParticlesUpRhs(in_nb_rhs);
+        comm_buffers.reset();
+        real_number* newParticlesLow = nullptr;
+        real_number* newParticlesUp = nullptr;
+        partsize_t* newParticlesLowIndexes = nullptr;
+        partsize_t* newParticlesUpIndexes = nullptr;
+        real_number** newParticlesLowRhs = comm_buffers.template get<real_number*>(in_nb_rhs);
+        real_number** newParticlesUpRhs = comm_buffers.template get<real_number*>(in_nb_rhs);
 
         {
             assert(whatNext.size() == 0);
@@ -676,7 +752,7 @@ public:
                 if(releasedAction.first == RECV_MOVE_NB_LOW){
                     if(nbNewFromLow){
                         assert(newParticlesLow == nullptr);
-                        newParticlesLow.reset(new real_number[nbNewFromLow*size_particle_positions]);
+                        newParticlesLow = comm_buffers.template get<real_number>(nbNewFromLow*size_particle_positions);
                         whatNext.emplace_back(std::pair<Action,int>{RECV_MOVE_LOW, -1});
                         mpiRequests.emplace_back();
                         assert(nbNewFromLow*size_particle_positions < std::numeric_limits<int>::max());
@@ -684,7 +760,7 @@ public:
                                   (my_rank-1+nb_processes_involved)%nb_processes_involved, TAG_UP_LOW_MOVED_PARTICLES,
                                   MPI_COMM_WORLD, &mpiRequests.back()));
 
-                        newParticlesLowIndexes.reset(new partsize_t[nbNewFromLow]);
+                        newParticlesLowIndexes = comm_buffers.template get<partsize_t>(nbNewFromLow);
                         whatNext.emplace_back(std::pair<Action,int>{NOTHING_TODO, -1});
                         mpiRequests.emplace_back();
                         assert(nbNewFromLow < std::numeric_limits<int>::max());
@@ -693,7 +769,7 @@ public:
                                   MPI_COMM_WORLD, &mpiRequests.back()));
 
                         for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs ; ++idx_rhs){
-                            newParticlesLowRhs[idx_rhs].reset(new real_number[nbNewFromLow*size_particle_rhs]);
+                            newParticlesLowRhs[idx_rhs] = comm_buffers.template get<real_number>(nbNewFromLow*size_particle_rhs);
                             whatNext.emplace_back(std::pair<Action,int>{NOTHING_TODO, -1});
                             mpiRequests.emplace_back();
                             assert(nbNewFromLow*size_particle_rhs < std::numeric_limits<int>::max());
@@ -706,14 +782,14 @@ public:
                 else if(releasedAction.first == RECV_MOVE_NB_UP){
                     if(nbNewFromUp){
                         assert(newParticlesUp == nullptr);
-                        newParticlesUp.reset(new real_number[nbNewFromUp*size_particle_positions]);
+                        newParticlesUp = comm_buffers.template get<real_number>(nbNewFromUp*size_particle_positions);
                         whatNext.emplace_back(std::pair<Action,int>{RECV_MOVE_UP, -1});
                         mpiRequests.emplace_back();
                         assert(nbNewFromUp*size_particle_positions < std::numeric_limits<int>::max());
                         AssertMpi(MPI_Irecv(&newParticlesUp[0], int(nbNewFromUp*size_particle_positions), particles_utils::GetMpiType(real_number()), (my_rank+1)%nb_processes_involved, TAG_LOW_UP_MOVED_PARTICLES,
                                   MPI_COMM_WORLD, &mpiRequests.back()));
 
-                        newParticlesUpIndexes.reset(new partsize_t[nbNewFromUp]);
+                        newParticlesUpIndexes = comm_buffers.template get<partsize_t>(nbNewFromUp);
                         whatNext.emplace_back(std::pair<Action,int>{NOTHING_TODO, -1});
                         mpiRequests.emplace_back();
                         assert(nbNewFromUp < std::numeric_limits<int>::max());
@@ -722,7 +798,7 @@ public:
                                   MPI_COMM_WORLD, &mpiRequests.back()));
 
                         for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs ; ++idx_rhs){
-                            newParticlesUpRhs[idx_rhs].reset(new real_number[nbNewFromUp*size_particle_rhs]);
+                            newParticlesUpRhs[idx_rhs] = comm_buffers.template get<real_number>(nbNewFromUp*size_particle_rhs);
                             whatNext.emplace_back(std::pair<Action,int>{NOTHING_TODO, -1});
                             mpiRequests.emplace_back();
                             assert(nbNewFromUp*size_particle_rhs < std::numeric_limits<int>::max());
@@ -759,10 +835,10 @@ public:
             // Copy new particles recv form lower first
             if(nbNewFromLow){
                 const particles_utils::fixed_copy fcp(0, 0, nbNewFromLow);
-                fcp.copy(newArray, newParticlesLow, size_particle_positions);
-                fcp.copy(newArrayIndexes, newParticlesLowIndexes);
+                fcp.copy(newArray.get(), newParticlesLow, size_particle_positions);
+                fcp.copy(newArrayIndexes.get(), newParticlesLowIndexes);
                 for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs ; ++idx_rhs){
-                    fcp.copy(newArrayRhs[idx_rhs], newParticlesLowRhs[idx_rhs], size_particle_rhs);
+                    fcp.copy(newArrayRhs[idx_rhs].get(), newParticlesLowRhs[idx_rhs], size_particle_rhs);
                 }
             }
 
@@ -779,10 +855,10 @@ public:
             // Copy new particles from upper at the back
             if(nbNewFromUp){
                 const particles_utils::fixed_copy fcp(nbNewFromLow+nbOldParticlesInside, 0, nbNewFromUp);
-                fcp.copy(newArray, newParticlesUp, size_particle_positions);
-                fcp.copy(newArrayIndexes, newParticlesUpIndexes);
+                fcp.copy(newArray.get(), newParticlesUp, size_particle_positions);
+                fcp.copy(newArrayIndexes.get(), newParticlesUpIndexes);
                 for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs ; ++idx_rhs){
-                    fcp.copy(newArrayRhs[idx_rhs], newParticlesUpRhs[idx_rhs], size_particle_rhs);
+                    fcp.copy(newArrayRhs[idx_rhs].get(), newParticlesUpRhs[idx_rhs], size_particle_rhs);
                 }
             }
 
@@ -796,42 +872,428 @@ public:
         }
 
         // Partitions all particles
+        repartition<computer_class, size_particle_positions, size_particle_rhs, size_particle_index>(
+                    in_computer, current_my_nb_particles_per_partition, myTotalNbParticles,
+                    inout_positions_particles, inout_rhs_particles, in_nb_rhs, inout_index_particles);
+        (*nb_particles) = myTotalNbParticles;
+
+        assert(mpiRequests.size() == 0);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+
+    /** Starts the classification of in_nb_particles particles by bin_particle,
+     *  done by in_nb_threads threads.
+     */
+    void prepare_binning(const partsize_t in_nb_particles, const int in_nb_threads){
+        binning_nb_threads = in_nb_threads;
+        binning_nb_bins = current_partition_size + nb_processes;
+        const int countsPerCacheLine = int(64/sizeof(partsize_t));
+        binning_counts_stride = ((binning_nb_bins+countsPerCacheLine-1)/countsPerCacheLine)*countsPerCacheLine;
+        binning_nb_particles = in_nb_particles;
+        bin_per_particle.resize(in_nb_particles);
+        binning_counts.assign(size_t(binning_counts_stride)*size_t(in_nb_threads), 0);
+    }
+
+    /** Records the partition of particle idx_part if it stays on the current
+     *  process, its destination process otherwise. Can be called concurrently
+     *  for different particles by different threads.
+     */
+    template <class computer_class>
+    void bin_particle(const computer_class& in_computer, const int idx_thread,
+                      const partsize_t idx_part, const real_number position[]){
+        assert(0 <= idx_thread && idx_thread < binning_nb_threads);
+        assert(0 <= idx_part && idx_part < binning_nb_particles);
+        const int partition_level = in_computer.pbc_field_layer(position[IDX_Z], IDX_Z);
+        const int bin = (current_partition_interval.first <= partition_level && partition_level < current_partition_interval.second ?
+                             partition_level - current_partition_interval.first
+                           : current_partition_size + rank_per_layer[partition_level]);
+        bin_per_particle[idx_part] = bin;
+        binning_counts[size_t(idx_thread)*size_t(binning_counts_stride) + size_t(bin)] += 1;
+    }
+
+    /** Same as redistribute, for particles classified by bin_particle since
+     *  prepare_binning, where thread idx_thread handled the particles of
+     *  particles_utils::IntervalSplitter(nb_particles, nb_threads, idx_thread).
+     *  The leaving particles are packed per destination and exchanged with the
+     *  neighbors only if no particle goes further, with all the processes
+     *  otherwise. The particles are then scattered once into new arrays,
+     *  per partition, the ones that stay first in their current order.
+     *  The rhs from in_nb_rhs_exchanged to in_nb_rhs are not exchanged, their
+     *  arrays are only made large enough for the new number of particles
+     *  (with undefined values), for the rhs that are overwritten next.
+     *  This is a collective call on current_com.
+     */
+    template <class computer_class, int size_particle_positions, int size_particle_rhs, int size_particle_index>
+    void redistribute_binned(computer_class& in_computer,
+                             partsize_t current_my_nb_particles_per_partition[],
+                             partsize_t* nb_particles,
+                             std::unique_ptr<real_number[]>* inout_positions_particles,
+                             std::unique_ptr<real_number[]> inout_rhs_particles[], const int in_nb_rhs,
+                             const int in_nb_rhs_exchanged,
+                             std::unique_ptr<partsize_t[]>* inout_index_particles){
+        TIMEZONE("redistribute_binned");
+        assert(binning_nb_particles == (*nb_particles));
+        assert(0 <= in_nb_rhs_exchanged && in_nb_rhs_exchanged <= in_nb_rhs);
+        const partsize_t myTotalNbParticles = (*nb_particles);
+        const int nb_threads = binning_nb_threads;
+
+        // The counts of each thread become its offsets inside the bins
+        std::vector<partsize_t> nbParticlesPerBin(binning_nb_bins, 0);
+        for(int idxBin = 0 ; idxBin < binning_nb_bins ; ++idxBin){
+            for(int idx_thread = 0 ; idx_thread < nb_threads ; ++idx_thread){
+                partsize_t& count = binning_counts[size_t(idx_thread)*size_t(binning_counts_stride) + size_t(idxBin)];
+                const partsize_t nbParticlesOfThread = count;
+                count = nbParticlesPerBin[idxBin];
+                nbParticlesPerBin[idxBin] += nbParticlesOfThread;
+            }
+        }
+
+        std::vector<partsize_t> nbParticlesToSendPerProc(nbParticlesPerBin.begin()+current_partition_size, nbParticlesPerBin.end());
+        assert(nbParticlesToSendPerProc[my_rank] == 0);
+        std::vector<partsize_t> offsetParticlesToSendPerProc(nb_processes+1, 0);
+        for(int idxProc = 0 ; idxProc < nb_processes ; ++idxProc){
+            offsetParticlesToSendPerProc[idxProc+1] = offsetParticlesToSendPerProc[idxProc] + nbParticlesToSendPerProc[idxProc];
+        }
+        const partsize_t myTotalNbParticlesToSend = offsetParticlesToSendPerProc[nb_processes];
+
+        comm_buffers.reset();
+        real_number* toSendPositions = comm_buffers.template get<real_number>(myTotalNbParticlesToSend*size_particle_positions);
+        partsize_t* toSendIndexes = comm_buffers.template get<partsize_t>(myTotalNbParticlesToSend);
+        real_number** toSendRhs = comm_buffers.template get<real_number*>(in_nb_rhs_exchanged);
+        for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs_exchanged ; ++idx_rhs){
+            toSendRhs[idx_rhs] = comm_buffers.template get<real_number>(myTotalNbParticlesToSend*size_particle_rhs);
+        }
+
+        if(myTotalNbParticlesToSend){
+            TIMEZONE("pack");
+#pragma omp parallel default(shared) num_threads(nb_threads)
+            {
+                // Same intervals as the binning, whatever the size of the team
+                for(int idx_thread = omp_get_thread_num() ; idx_thread < nb_threads ;
+                    idx_thread += omp_get_num_threads()){
+                    partsize_t* threadOffsets = &binning_counts[size_t(idx_thread)*size_t(binning_counts_stride)];
+                    particles_utils::IntervalSplitter<partsize_t> interval(myTotalNbParticles, partsize_t(nb_threads), partsize_t(idx_thread));
+                    const partsize_t part_end = interval.getMyOffset()+interval.getMySize();
+                    for(partsize_t idx_part = interval.getMyOffset() ; idx_part < part_end ; ++idx_part){
+                        const int idxBin = bin_per_particle[idx_part];
+                        if(current_partition_size <= idxBin){
+                            const partsize_t dest = offsetParticlesToSendPerProc[idxBin-current_partition_size] + (threadOffsets[idxBin]++);
+                            for(int idx_val = 0 ; idx_val < size_particle_positions ; ++idx_val){
+                                toSendPositions[dest*size_particle_positions + idx_val] = (*inout_positions_particles)[idx_part*size_particle_positions + idx_val];
+                            }
+                            toSendIndexes[dest] = (*inout_index_particles)[idx_part];
+                            for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs_exchanged ; ++idx_rhs){
+                                for(int idx_val = 0 ; idx_val < size_particle_rhs ; ++idx_val){
+                                    toSendRhs[idx_rhs][dest*size_particle_rhs + idx_val] = inout_rhs_particles[idx_rhs][idx_part*size_particle_rhs + idx_val];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Exchange with the neighbors only if it is enough for all (collective)
+        const int lowerRank = (my_rank < nb_processes_involved ? (my_rank-1+nb_processes_involved)%nb_processes_involved : -1);
+        const int upperRank = (my_rank < nb_processes_involved ? (my_rank+1)%nb_processes_involved : -1);
+        int onlyNeighbors = 1;
+        for(int idxProc = 0 ; idxProc < nb_processes ; ++idxProc){
+            if(nbParticlesToSendPerProc[idxProc] && idxProc != lowerRank && idxProc != upperRank){
+                onlyNeighbors = 0;
+            }
+        }
+        AssertMpi(MPI_Allreduce(MPI_IN_PLACE, &onlyNeighbors, 1, MPI_INT, MPI_LAND, current_com));
+
+        std::vector<int> neighbors;
+        if(onlyNeighbors && my_rank < nb_processes_involved){
+            if(lowerRank != my_rank){
+                neighbors.push_back(lowerRank);
+            }
+            if(upperRank != my_rank && upperRank != lowerRank){
+                neighbors.push_back(upperRank);
+            }
+        }
+        const alltoall_exchanger exchanger = (onlyNeighbors ?
+                                                  alltoall_exchanger(current_com, nbParticlesToSendPerProc, neighbors)
+                                                : alltoall_exchanger(current_com, nbParticlesToSendPerProc));
+        const partsize_t myTotalNbParticlesRecv = exchanger.getTotalToRecv();
+
+        real_number* recvPositions = comm_buffers.template get<real_number>(myTotalNbParticlesRecv*size_particle_positions);
+        exchanger.alltoallv<real_number>(toSendPositions, recvPositions, size_particle_positions);
+        partsize_t* recvIndexes = comm_buffers.template get<partsize_t>(myTotalNbParticlesRecv);
+        exchanger.alltoallv<partsize_t>(toSendIndexes, recvIndexes);
+        real_number** recvRhs = comm_buffers.template get<real_number*>(in_nb_rhs_exchanged);
+        for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs_exchanged ; ++idx_rhs){
+            recvRhs[idx_rhs] = comm_buffers.template get<real_number>(myTotalNbParticlesRecv*size_particle_rhs);
+            exchanger.alltoallv<real_number>(toSendRhs[idx_rhs], recvRhs[idx_rhs], size_particle_rhs);
+        }
+
+        // Some latest processes might not be involved
+        if(nb_processes_involved <= my_rank){
+            assert(myTotalNbParticlesRecv == 0);
+            assert(myTotalNbParticles == myTotalNbParticlesToSend);
+            (*nb_particles) = 0;
+            return;
+        }
+
+        // The received particles go after the ones that stay in their partition
+        int* recvPartitions = comm_buffers.template get<int>(myTotalNbParticlesRecv);
+        std::vector<partsize_t> recvOffsetPerPartition(nbParticlesPerBin.begin(), nbParticlesPerBin.begin()+current_partition_size);
+        std::copy(nbParticlesPerBin.begin(), nbParticlesPerBin.begin()+current_partition_size, current_my_nb_particles_per_partition);
+        for(partsize_t idx_part = 0 ; idx_part < myTotalNbParticlesRecv ; ++idx_part){
+            const int partition_level = in_computer.pbc_field_layer(recvPositions[idx_part*size_particle_positions+IDX_Z], IDX_Z);
+            assert(current_partition_interval.first <= partition_level && partition_level < current_partition_interval.second);
+            recvPartitions[idx_part] = partition_level - current_partition_interval.first;
+            current_my_nb_particles_per_partition[recvPartitions[idx_part]] += 1;
+        }
+
+        current_offset_particles_for_partition[0] = 0;
+        for(int idxPartition = 0 ; idxPartition < current_partition_size ; ++idxPartition){
+            current_offset_particles_for_partition[idxPartition+1] = current_offset_particles_for_partition[idxPartition] + current_my_nb_particles_per_partition[idxPartition];
+            recvOffsetPerPartition[idxPartition] += current_offset_particles_for_partition[idxPartition];
+        }
+        const partsize_t myTotalNewNbParticles = current_offset_particles_for_partition[current_partition_size];
+        assert(myTotalNewNbParticles == myTotalNbParticles - myTotalNbParticlesToSend + myTotalNbParticlesRecv);
+
+        std::unique_ptr<real_number[]> newPositions(new real_number[myTotalNewNbParticles*size_particle_positions]);
+        std::unique_ptr<partsize_t[]> newIndexes(new partsize_t[myTotalNewNbParticles]);
+        std::vector<std::unique_ptr<real_number[]>> newRhs(in_nb_rhs_exchanged);
+        for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs_exchanged ; ++idx_rhs){
+            newRhs[idx_rhs].reset(new real_number[myTotalNewNbParticles*size_particle_rhs]);
+        }
+
         {
-            TIMEZONE("repartition");
-            particles_utils::partition_extra_z<partsize_t, size_particle_positions>(&(*inout_positions_particles)[0],
-                                             myTotalNbParticles,current_partition_size,
-                                             current_my_nb_particles_per_partition, current_offset_particles_for_partition.get(),
-                                             [&](const real_number& z_pos){
-                const int partition_level = in_computer.pbc_field_layer(z_pos, IDX_Z);
-                assert(current_partition_interval.first <= partition_level && partition_level < current_partition_interval.second);
-                return partition_level - current_partition_interval.first;
-            },
-            [&](const partsize_t idx1, const partsize_t idx2){
-                for(int idx_val = 0 ; idx_val < size_particle_index ; ++idx_val){
-                    std::swap((*inout_index_particles)[idx1], (*inout_index_particles)[idx2]);
+            TIMEZONE("scatter");
+#pragma omp parallel default(shared) num_threads(nb_threads)
+            {
+                // Same intervals as the binning, whatever the size of the team
+                for(int idx_thread = omp_get_thread_num() ; idx_thread < nb_threads ;
+                    idx_thread += omp_get_num_threads()){
+                    partsize_t* threadOffsets = &binning_counts[size_t(idx_thread)*size_t(binning_counts_stride)];
+                    particles_utils::IntervalSplitter<partsize_t> interval(myTotalNbParticles, partsize_t(nb_threads), partsize_t(idx_thread));
+                    const partsize_t part_end = interval.getMyOffset()+interval.getMySize();
+                    for(partsize_t idx_part = interval.getMyOffset() ; idx_part < part_end ; ++idx_part){
+                        const int idxPartition = bin_per_particle[idx_part];
+                        if(idxPartition < current_partition_size){
+                            const partsize_t dest = current_offset_particles_for_partition[idxPartition] + (threadOffsets[idxPartition]++);
+                            for(int idx_val = 0 ; idx_val < size_particle_positions ; ++idx_val){
+                                newPositions[dest*size_particle_positions + idx_val] = (*inout_positions_particles)[idx_part*size_particle_positions + idx_val];
+                            }
+                            newIndexes[dest] = (*inout_index_particles)[idx_part];
+                            for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs_exchanged ; ++idx_rhs){
+                                for(int idx_val = 0 ; idx_val < size_particle_rhs ; ++idx_val){
+                                    newRhs[idx_rhs][dest*size_particle_rhs + idx_val] = inout_rhs_particles[idx_rhs][idx_part*size_particle_rhs + idx_val];
+                                }
+                            }
+                        }
+                    }
                 }
+            }
 
-                for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs ; ++idx_rhs){
+            for(partsize_t idx_part = 0 ; idx_part < myTotalNbParticlesRecv ; ++idx_part){
+                const partsize_t dest = recvOffsetPerPartition[recvPartitions[idx_part]]++;
+                for(int idx_val = 0 ; idx_val < size_particle_positions ; ++idx_val){
+                    newPositions[dest*size_particle_positions + idx_val] = recvPositions[idx_part*size_particle_positions + idx_val];
+                }
+                newIndexes[dest] = recvIndexes[idx_part];
+                for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs_exchanged ; ++idx_rhs){
                     for(int idx_val = 0 ; idx_val < size_particle_rhs ; ++idx_val){
-                        std::swap(inout_rhs_particles[idx_rhs][idx1*size_particle_rhs + idx_val],
-                                  inout_rhs_particles[idx_rhs][idx2*size_particle_rhs + idx_val]);
+                        newRhs[idx_rhs][dest*size_particle_rhs + idx_val] = recvRhs[idx_rhs][idx_part*size_particle_rhs + idx_val];
                     }
                 }
-            });
-
-            {// TODO remove
-                for(int idxPartition = 0 ; idxPartition < current_partition_size ; ++idxPartition){
-                    assert(current_my_nb_particles_per_partition[idxPartition] ==
-                           current_offset_particles_for_partition[idxPartition+1] - current_offset_particles_for_partition[idxPartition]);
-                    for(partsize_t idx = current_offset_particles_for_partition[idxPartition] ; idx < current_offset_particles_for_partition[idxPartition+1] ; ++idx){
-                        assert(in_computer.pbc_field_layer((*inout_positions_particles)[idx*3+IDX_Z], IDX_Z)-current_partition_interval.first == idxPartition);
+            }
+        }
+
+        (*inout_positions_particles) = std::move(newPositions);
+        (*inout_index_particles) = std::move(newIndexes);
+        for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs_exchanged ; ++idx_rhs){
+            inout_rhs_particles[idx_rhs] = std::move(newRhs[idx_rhs]);
+        }
+        if(myTotalNbParticles < myTotalNewNbParticles){
+            for(int idx_rhs = in_nb_rhs_exchanged ; idx_rhs < in_nb_rhs ; ++idx_rhs){
+                inout_rhs_particles[idx_rhs].reset(new real_number[myTotalNewNbParticles*size_particle_rhs]);
+            }
+        }
+        (*nb_particles) = myTotalNewNbParticles;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+
+    /** Returns true on all processes if every particle moved by at most one
+     *  layer since the last partitioning, for the particles of the first and
+     *  last partitions, or stayed inside the interval of its process, for the
+     *  other partitions. This is what the neighbors exchange of redistribute
+     *  supports.
+     *  This is a collective call on current_com.
+     */
+    template <class computer_class, int size_particle_positions>
+    bool particles_stay_within_one_hop(computer_class& in_computer,
+                                       const partsize_t current_my_nb_particles_per_partition[],
+                                       const real_number positions_particles[]) const {
+        TIMEZONE("particles_stay_within_one_hop");
+        int allWithinOneHop = 1;
+
+        if(my_rank < nb_processes_involved){
+            const int nbLayers = int(field_grid_dim[IDX_Z]);
+            const int firstLayer = current_partition_interval.first;
+            const int lastLayer = current_partition_interval.second-1;
+
+            for(int idxPartition = 0 ; allWithinOneHop && idxPartition < current_partition_size ; ++idxPartition){
+                for(partsize_t idx_part = current_offset_particles_for_partition[idxPartition] ;
+                    idx_part < current_offset_particles_for_partition[idxPartition+1] ; ++idx_part){
+                    const int partition_level = in_computer.pbc_field_layer(positions_particles[idx_part*size_particle_positions+IDX_Z], IDX_Z);
+                    const bool isInside = (firstLayer <= partition_level && partition_level <= lastLayer);
+                    const bool isAroundFirst = (partition_level == (firstLayer-1+nbLayers)%nbLayers
+                                                || partition_level == firstLayer
+                                                || partition_level == (firstLayer+1)%nbLayers);
+                    const bool isAroundLast = (partition_level == (lastLayer-1+nbLayers)%nbLayers
+                                               || partition_level == lastLayer
+                                               || partition_level == (lastLayer+1)%nbLayers);
+                    if((idxPartition == 0 && !isAroundFirst)
+                            || (idxPartition == current_partition_size-1 && !isAroundLast)
+                            || (idxPartition != 0 && idxPartition != current_partition_size-1 && !isInside)){
+                        allWithinOneHop = 0;
+                        break;
                     }
                 }
             }
         }
-        (*nb_particles) = myTotalNbParticles;
 
-        assert(mpiRequests.size() == 0);
+        AssertMpi(MPI_Allreduce(MPI_IN_PLACE, &allWithinOneHop, 1, MPI_INT, MPI_LAND, current_com));
+        return allWithinOneHop != 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+
+    /** Sends every particle directly to the process that owns its layer,
+     *  whatever the number of intervals it went through, with a single
+     *  all-to-all exchange.
+     *  This is a collective call on current_com.
+     */
+    template <class computer_class, int size_particle_positions, int size_particle_rhs, int size_particle_index>
+    void redistribute_multi_hop(computer_class& in_computer,
+                                partsize_t current_my_nb_particles_per_partition[],
+                                partsize_t* nb_particles,
+                                std::unique_ptr<real_number[]>* inout_positions_particles,
+                                std::unique_ptr<real_number[]> inout_rhs_particles[], const int in_nb_rhs,
+                                std::unique_ptr<partsize_t[]>* inout_index_particles){
+        TIMEZONE("redistribute_multi_hop");
+        const partsize_t myTotalNbParticles = (*nb_particles);
+
+        // Bin the particles per destination process
+        comm_buffers.reset();
+        int* destProcPerParticle = comm_buffers.template get<int>(myTotalNbParticles);
+        std::vector<partsize_t> nbParticlesToSendPerProc(nb_processes, 0);
+        for(partsize_t idx_part = 0 ; idx_part < myTotalNbParticles ; ++idx_part){
+            const int partition_level = in_computer.pbc_field_layer((*inout_positions_particles)[idx_part*size_particle_positions+IDX_Z], IDX_Z);
+            destProcPerParticle[idx_part] = rank_per_layer[partition_level];
+            nbParticlesToSendPerProc[destProcPerParticle[idx_part]] += 1;
+        }
+
+        std::vector<partsize_t> offsetParticlesToSendPerProc(nb_processes+1, 0);
+        for(int idxProc = 0 ; idxProc < nb_processes ; ++idxProc){
+            offsetParticlesToSendPerProc[idxProc+1] = offsetParticlesToSendPerProc[idxProc] + nbParticlesToSendPerProc[idxProc];
+        }
+
+        real_number* toSendPositions = comm_buffers.template get<real_number>(myTotalNbParticles*size_particle_positions);
+        partsize_t* toSendIndexes = comm_buffers.template get<partsize_t>(myTotalNbParticles);
+        real_number** toSendRhs = comm_buffers.template get<real_number*>(in_nb_rhs);
+        for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs ; ++idx_rhs){
+            toSendRhs[idx_rhs] = comm_buffers.template get<real_number>(myTotalNbParticles*size_particle_rhs);
+        }
+
+        {
+            TIMEZONE("pack");
+            std::vector<partsize_t> currentOffsetPerProc(offsetParticlesToSendPerProc.begin(), offsetParticlesToSendPerProc.end()-1);
+            for(partsize_t idx_part = 0 ; idx_part < myTotalNbParticles ; ++idx_part){
+                const partsize_t dest = currentOffsetPerProc[destProcPerParticle[idx_part]]++;
+                for(int idx_val = 0 ; idx_val < size_particle_positions ; ++idx_val){
+                    toSendPositions[dest*size_particle_positions + idx_val] = (*inout_positions_particles)[idx_part*size_particle_positions + idx_val];
+                }
+                toSendIndexes[dest] = (*inout_index_particles)[idx_part];
+                for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs ; ++idx_rhs){
+                    for(int idx_val = 0 ; idx_val < size_particle_rhs ; ++idx_val){
+                        toSendRhs[idx_rhs][dest*size_particle_rhs + idx_val] = inout_rhs_particles[idx_rhs][idx_part*size_particle_rhs + idx_val];
+                    }
+                }
+            }
+        }
+
+        // Exchange
+        alltoall_exchanger exchanger(current_com, nbParticlesToSendPerProc);
+        const partsize_t myTotalNewNbParticles = exchanger.getTotalToRecv();
+
+        std::unique_ptr<real_number[]> newArray(new real_number[myTotalNewNbParticles*size_particle_positions]);
+        exchanger.alltoallv<real_number>(toSendPositions, newArray.get(), size_particle_positions);
+        (*inout_positions_particles) = std::move(newArray);
+
+        std::unique_ptr<partsize_t[]> newArrayIndexes(new partsize_t[myTotalNewNbParticles]);
+        exchanger.alltoallv<partsize_t>(toSendIndexes, newArrayIndexes.get());
+        (*inout_index_particles) = std::move(newArrayIndexes);
+
+        for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs ; ++idx_rhs){
+            std::unique_ptr<real_number[]> newArrayRhs(new real_number[myTotalNewNbParticles*size_particle_rhs]);
+            exchanger.alltoallv<real_number>(toSendRhs[idx_rhs], newArrayRhs.get(), size_particle_rhs);
+            inout_rhs_particles[idx_rhs] = std::move(newArrayRhs);
+        }
+
+        (*nb_particles) = myTotalNewNbParticles;
+
+        // Some latest processes might not be involved
+        if(nb_processes_involved <= my_rank){
+            assert(myTotalNewNbParticles == 0);
+            return;
+        }
+
+        repartition<computer_class, size_particle_positions, size_particle_rhs, size_particle_index>(
+                    in_computer, current_my_nb_particles_per_partition, myTotalNewNbParticles,
+                    inout_positions_particles, inout_rhs_particles, in_nb_rhs, inout_index_particles);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+
+    /** Sorts the particles of the current process per partition (z layer),
+     *  which must all be inside the current interval.
+     */
+    template <class computer_class, int size_particle_positions, int size_particle_rhs, int size_particle_index>
+    void repartition(computer_class& in_computer,
+                     partsize_t current_my_nb_particles_per_partition[],
+                     const partsize_t myTotalNbParticles,
+                     std::unique_ptr<real_number[]>* inout_positions_particles,
+                     std::unique_ptr<real_number[]> inout_rhs_particles[], const int in_nb_rhs,
+                     std::unique_ptr<partsize_t[]>* inout_index_particles){
+        TIMEZONE("repartition");
+        particles_utils::partition_extra_z<partsize_t, size_particle_positions>(&(*inout_positions_particles)[0],
+                                         myTotalNbParticles,current_partition_size,
+                                         current_my_nb_particles_per_partition, current_offset_particles_for_partition.get(),
+                                         [&](const real_number& z_pos){
+            const int partition_level = in_computer.pbc_field_layer(z_pos, IDX_Z);
+            assert(current_partition_interval.first <= partition_level && partition_level < current_partition_interval.second);
+            return partition_level - current_partition_interval.first;
+        },
+        [&](const partsize_t idx1, const partsize_t idx2){
+            for(int idx_val = 0 ; idx_val < size_particle_index ; ++idx_val){
+                std::swap((*inout_index_particles)[idx1], (*inout_index_particles)[idx2]);
+            }
+
+            for(int idx_rhs = 0 ; idx_rhs < in_nb_rhs ; ++idx_rhs){
+                for(int idx_val = 0 ; idx_val < size_particle_rhs ; ++idx_val){
+                    std::swap(inout_rhs_particles[idx_rhs][idx1*size_particle_rhs + idx_val],
+                              inout_rhs_particles[idx_rhs][idx2*size_particle_rhs + idx_val]);
+                }
+            }
+        });
+
+        {// TODO remove
+            for(int idxPartition = 0 ; idxPartition < current_partition_size ; ++idxPartition){
+                assert(current_my_nb_particles_per_partition[idxPartition] ==
+                       current_offset_particles_for_partition[idxPartition+1] - current_offset_particles_for_partition[idxPartition]);
+                for(partsize_t idx = current_offset_particles_for_partition[idxPartition] ; idx < current_offset_particles_for_partition[idxPartition+1] ; ++idx){
+                    assert(in_computer.pbc_field_layer((*inout_positions_particles)[idx*3+IDX_Z], IDX_Z)-current_partition_interval.first == idxPartition);
+                }
+            }
+        }
     }
 };
 
@@ -2,11 +2,18 @@
 #define PARTICLES_FIELD_COMPUTER_HPP
 
 #include <array>
+#include <vector>
 #include <utility>
+#include <type_traits>
 
 #include "scope_timer.hpp"
 #include "particles_utils.hpp"
 
+// True for the fields that hold every z layer used by the stencils of the
+// local particles, ghost layers included (see particles_field_halo)
+template <class field_class>
+struct particles_field_has_ghost_layers : std::false_type {};
+
 template <class partsize_t,
           class real_number,
           class interpolator_class,
@@ -24,6 +31,14 @@ class particles_field_computer {
 
     int deriv[3];
 
+    // Number of particles for which the betas are computed together
+    static const int batch_size = 32;
+    // Number of grid nodes used in each direction
+    static const int stencil_width = interp_neighbours*2+2;
+
+    // Periodic grid index of the nodes [-interp_neighbours, dim+interp_neighbours]
+    std::array<std::vector<int>,3> pbc_grid_index;
+
 public:
 
     particles_field_computer(const std::array<size_t,3>& in_field_grid_dim,
@@ -37,6 +52,14 @@ public:
         deriv[IDX_X] = 0;
         deriv[IDX_Y] = 0;
         deriv[IDX_Z] = 0;
+
+        for(int idx_dim = 0 ; idx_dim < 3 ; ++idx_dim){
+            const int dim_size = field_grid_dim[idx_dim];
+            pbc_grid_index[idx_dim].resize(dim_size+interp_neighbours*2+1);
+            for(int idx_node = 0 ; idx_node < int(pbc_grid_index[idx_dim].size()) ; ++idx_node){
+                pbc_grid_index[idx_dim][idx_node] = (((idx_node-interp_neighbours)%dim_size)+dim_size)%dim_size;
+            }
+        }
     }
 
     ////////////////////////////////////////////////////////////////////////
@@ -69,89 +92,85 @@ public:
                                    const partsize_t nb_particles) const {
         TIMEZONE("particles_field_computer::apply_computation");
         //DEBUG_MSG("just entered particles_field_computer::apply_computation\n");
-        for(partsize_t idxPart = 0 ; idxPart < nb_particles ; ++idxPart){
-            const real_number reltv_x = get_norm_pos_in_cell(particles_positions[idxPart*3+IDX_X], IDX_X);
-            const real_number reltv_y = get_norm_pos_in_cell(particles_positions[idxPart*3+IDX_Y], IDX_Y);
-            const real_number reltv_z = get_norm_pos_in_cell(particles_positions[idxPart*3+IDX_Z], IDX_Z);
-
-            typename interpolator_class::real_number
-                bx[interp_neighbours*2+2],
-                by[interp_neighbours*2+2],
-                bz[interp_neighbours*2+2];
-            interpolator.compute_beta(deriv[IDX_X], reltv_x, bx);
-            interpolator.compute_beta(deriv[IDX_Y], reltv_y, by);
-            interpolator.compute_beta(deriv[IDX_Z], reltv_z, bz);
-
-            const int partGridIdx_x = pbc_field_layer(particles_positions[idxPart*3+IDX_X], IDX_X);
-            const int partGridIdx_y = pbc_field_layer(particles_positions[idxPart*3+IDX_Y], IDX_Y);
-            const int partGridIdx_z = pbc_field_layer(particles_positions[idxPart*3+IDX_Z], IDX_Z);
-
-            assert(0 <= partGridIdx_x && partGridIdx_x < int(field_grid_dim[IDX_X]));
-            assert(0 <= partGridIdx_y && partGridIdx_y < int(field_grid_dim[IDX_Y]));
-            assert(0 <= partGridIdx_z && partGridIdx_z < int(field_grid_dim[IDX_Z]));
-
-            const int interp_limit_mx = partGridIdx_x-interp_neighbours;
-            const int interp_limit_x = partGridIdx_x+interp_neighbours+1;
-            const int interp_limit_my = partGridIdx_y-interp_neighbours;
-            const int interp_limit_y = partGridIdx_y+interp_neighbours+1;
-            const int interp_limit_mz_bz = partGridIdx_z-interp_neighbours;
-
-            int interp_limit_mz[2];
-            int interp_limit_z[2];
-            int nb_z_intervals;
-
-            if((partGridIdx_z-interp_neighbours) < 0){
-                assert(partGridIdx_z+interp_neighbours+1 < int(field_grid_dim[IDX_Z]));
-                interp_limit_mz[0] = std::max(current_partition_interval.first, partGridIdx_z-interp_neighbours+int(field_grid_dim[IDX_Z]));
-                interp_limit_z[0] = current_partition_interval.second-1;
-
-                interp_limit_mz[1] = std::max(0, current_partition_interval.first);
-                interp_limit_z[1] = std::min(partGridIdx_z+interp_neighbours+1, current_partition_interval.second-1);
-
-                nb_z_intervals = 2;
-            }
-            else if(int(field_grid_dim[IDX_Z]) <= (partGridIdx_z+interp_neighbours+1)){
-                interp_limit_mz[0] = std::max(current_partition_interval.first, partGridIdx_z-interp_neighbours);
-                interp_limit_z[0] = std::min(int(field_grid_dim[IDX_Z])-1,current_partition_interval.second-1);
-
-                interp_limit_mz[1] = std::max(0, current_partition_interval.first);
-                interp_limit_z[1] = std::min(partGridIdx_z+interp_neighbours+1-int(field_grid_dim[IDX_Z]), current_partition_interval.second-1);
-
-                nb_z_intervals = 2;
-            }
-            else{
-                interp_limit_mz[0] = std::max(partGridIdx_z-interp_neighbours, current_partition_interval.first);
-                interp_limit_z[0] = std::min(partGridIdx_z+interp_neighbours+1, current_partition_interval.second-1);
-                nb_z_intervals = 1;
+        // The particles are processed by batches: the betas and the periodic
+        // grid indexes are first computed for all the particles of a batch,
+        // then the tensor product is accumulated in z->y->x order so that
+        // the innermost loop walks the field contiguously in x.
+        // The betas are stored by stencil node, bx[idx_x][idxLane], so that
+        // the interpolator evaluates them for the whole batch at once.
+        typedef typename interpolator_class::real_number beta_number;
+        beta_number pos_in_cell[3][batch_size];
+        beta_number bx[stencil_width][batch_size],
+                    by[stencil_width][batch_size],
+                    bz[stencil_width][batch_size];
+        int idx_x_pbc[batch_size][stencil_width];
+        int idx_y_pbc[batch_size][stencil_width];
+        int idx_z_pbc[batch_size][stencil_width];
+
+        for(partsize_t idxBatch = 0 ; idxBatch < nb_particles ; idxBatch += batch_size){
+            const int nb_parts_in_batch = int(std::min(partsize_t(batch_size), nb_particles-idxBatch));
+
+            for(int idxLane = 0 ; idxLane < nb_parts_in_batch ; ++idxLane){
+                const real_number* part_pos = &particles_positions[(idxBatch+idxLane)*3];
+
+                pos_in_cell[IDX_X][idxLane] = beta_number(get_norm_pos_in_cell(part_pos[IDX_X], IDX_X));
+                pos_in_cell[IDX_Y][idxLane] = beta_number(get_norm_pos_in_cell(part_pos[IDX_Y], IDX_Y));
+                pos_in_cell[IDX_Z][idxLane] = beta_number(get_norm_pos_in_cell(part_pos[IDX_Z], IDX_Z));
+
+                const int partGridIdx_x = pbc_field_layer(part_pos[IDX_X], IDX_X);
+                const int partGridIdx_y = pbc_field_layer(part_pos[IDX_Y], IDX_Y);
+                const int partGridIdx_z = pbc_field_layer(part_pos[IDX_Z], IDX_Z);
+
+                assert(0 <= partGridIdx_x && partGridIdx_x < int(field_grid_dim[IDX_X]));
+                assert(0 <= partGridIdx_y && partGridIdx_y < int(field_grid_dim[IDX_Y]));
+                assert(0 <= partGridIdx_z && partGridIdx_z < int(field_grid_dim[IDX_Z]));
+
+                // The tables are shifted by interp_neighbours, so that
+                // entry partGridIdx+idx_stencil gives the periodic index of
+                // the grid node partGridIdx-interp_neighbours+idx_stencil
+                for(int idx_stencil = 0 ; idx_stencil < stencil_width ; ++idx_stencil){
+                    idx_x_pbc[idxLane][idx_stencil] = pbc_grid_index[IDX_X][partGridIdx_x+idx_stencil];
+                    idx_y_pbc[idxLane][idx_stencil] = pbc_grid_index[IDX_Y][partGridIdx_y+idx_stencil];
+                    idx_z_pbc[idxLane][idx_stencil] = pbc_grid_index[IDX_Z][partGridIdx_z+idx_stencil];
+                }
             }
 
-            for(int idx_inter = 0 ; idx_inter < nb_z_intervals ; ++idx_inter){
-                for(int idx_z = interp_limit_mz[idx_inter] ; idx_z <= interp_limit_z[idx_inter] ; ++idx_z ){
-                    const int idx_z_pbc = (idx_z + field_grid_dim[IDX_Z])%field_grid_dim[IDX_Z];
-                    assert(current_partition_interval.first <= idx_z_pbc && idx_z_pbc < current_partition_interval.second);
-                    assert(((idx_z+field_grid_dim[IDX_Z]-interp_limit_mz_bz)%field_grid_dim[IDX_Z]) < interp_neighbours*2+2);
-
-                    for(int idx_x = interp_limit_mx ; idx_x <= interp_limit_x ; ++idx_x ){
-                        const int idx_x_pbc = (idx_x + field_grid_dim[IDX_X])%field_grid_dim[IDX_X];
-                        assert(idx_x-interp_limit_mx < interp_neighbours*2+2);
-
-                        for(int idx_y = interp_limit_my ; idx_y <= interp_limit_y ; ++idx_y ){
-                            const int idx_y_pbc = (idx_y + field_grid_dim[IDX_Y])%field_grid_dim[IDX_Y];
-                            assert(idx_y-interp_limit_my < interp_neighbours*2+2);
+            interpolator.compute_beta_batch(deriv[IDX_X], pos_in_cell[IDX_X], nb_parts_in_batch, &bx[0][0], batch_size);
+            interpolator.compute_beta_batch(deriv[IDX_Y], pos_in_cell[IDX_Y], nb_parts_in_batch, &by[0][0], batch_size);
+            interpolator.compute_beta_batch(deriv[IDX_Z], pos_in_cell[IDX_Z], nb_parts_in_batch, &bz[0][0], batch_size);
+
+            for(int idxLane = 0 ; idxLane < nb_parts_in_batch ; ++idxLane){
+                real_number rhs_val[size_particle_rhs] = {0};
+
+                for(int idx_z = 0 ; idx_z < stencil_width ; ++idx_z){
+                    const int idx_z_pbc_val = idx_z_pbc[idxLane][idx_z];
+                    // Only the z layers that belong to the current partition are used,
+                    // unless the field also holds the ghost layers
+                    if(!particles_field_has_ghost_layers<field_class>::value
+                            && (idx_z_pbc_val < current_partition_interval.first
+                                || current_partition_interval.second <= idx_z_pbc_val)){
+                        continue;
+                    }
 
-                            const real_number coef = (bz[((idx_z+field_grid_dim[IDX_Z]-interp_limit_mz_bz)%field_grid_dim[IDX_Z])]
-                                                    * by[idx_y-interp_limit_my]
-                                                    * bx[idx_x-interp_limit_mx]);
+                    for(int idx_y = 0 ; idx_y < stencil_width ; ++idx_y){
+                        const real_number coef_zy = bz[idx_z][idxLane] * by[idx_y][idxLane];
+                        const ptrdiff_t row_index = field.get_rindex_from_global(0, idx_y_pbc[idxLane][idx_y], idx_z_pbc_val);
 
-                            const ptrdiff_t tindex = field.get_rindex_from_global(idx_x_pbc, idx_y_pbc, idx_z_pbc);
+                        for(int idx_x = 0 ; idx_x < stencil_width ; ++idx_x){
+                            const ptrdiff_t tindex = row_index + idx_x_pbc[idxLane][idx_x];
+                            const real_number coef = coef_zy * bx[idx_x][idxLane];
 
                             // getValue does not necessary return real_number
                             for(int idx_rhs_val = 0 ; idx_rhs_val < size_particle_rhs ; ++idx_rhs_val){
-                                particles_current_rhs[idxPart*size_particle_rhs+idx_rhs_val] += real_number(field.rval(tindex,idx_rhs_val))*coef;
+                                rhs_val[idx_rhs_val] += real_number(field.rval(tindex,idx_rhs_val))*coef;
                             }
                         }
                     }
                 }
+
+                for(int idx_rhs_val = 0 ; idx_rhs_val < size_particle_rhs ; ++idx_rhs_val){
+                    particles_current_rhs[(idxBatch+idxLane)*size_particle_rhs+idx_rhs_val] += rhs_val[idx_rhs_val];
+                }
             }
         }
     }
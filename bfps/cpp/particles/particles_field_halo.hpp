@@ -0,0 +1,283 @@
+#ifndef PARTICLES_FIELD_HALO_HPP
+#define PARTICLES_FIELD_HALO_HPP
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "scope_timer.hpp"
+#include "particles_utils.hpp"
+#include "particles_field_computer.hpp"
+
+/** How the particles of the boundary partitions get their field values */
+enum particles_exchange_mode {
+    // Choose from the number of particles and the size of a field plane
+    PARTICLES_EXCHANGE_AUTO = 0,
+    // Send the positions to the neighbours and the results back (compute_distr)
+    PARTICLES_EXCHANGE_POSITIONS = 1,
+    // Exchange ghost z layers of the field and interpolate everything locally
+    PARTICLES_EXCHANGE_FIELD_HALO = 2
+};
+
+/** Ghost padded copy of the local slab of a real space field.
+ *
+ *  The copy holds the local z layers plus the interp_neighbours layers below
+ *  and the interp_neighbours+1 layers above them (periodic), which are all the
+ *  layers touched by the stencils of the particles of the local partitions.
+ *  It is filled by update(): the ghost layers are received from the processes
+ *  that own them with one round of nonblocking messages, while the local
+ *  layers are copied. A layer may come from several processes away when the
+ *  slabs are thinner than the halo.
+ *
+ *  For the interpolation it has the same interface as field, so that
+ *  particles_field_computer can use it to compute all the local particles.
+ *  The halo is only possible when no process needs a layer twice, i.e. when
+ *  every slab plus the ghost layers fits in the grid.
+ */
+template <class rnumber, int nb_components, int interp_neighbours>
+class particles_field_halo {
+    static const int nb_lower_layers = interp_neighbours;
+    static const int nb_upper_layers = interp_neighbours+1;
+
+    struct halo_message {
+        int proc;
+        // Position of the layers in the halo of the receiver
+        int first_slot;
+        // Position of the layers in the slab of the sender
+        int first_layer;
+        int nb_layers;
+    };
+
+    MPI_Comm current_com;
+
+    int my_rank;
+    int nb_processes;
+    int nb_processes_involved;
+
+    const std::pair<int,int> current_partition_interval;
+    const int current_partition_size;
+    const int nb_slots;
+
+    const int field_dim_z;
+    const ptrdiff_t field_mem_dim_y;
+    const ptrdiff_t field_mem_dim_x;
+    // Number of values of one z layer
+    const ptrdiff_t layer_size;
+
+    std::unique_ptr<int[]> partition_interval_size_per_proc;
+    std::unique_ptr<int[]> partition_interval_offset_per_proc;
+    std::unique_ptr<int[]> rank_per_layer;
+
+    bool halo_possible;
+
+    // Halo position of each z layer, -1 if not in the halo
+    std::vector<int> slot_per_layer;
+
+    std::vector<halo_message> messages_to_recv;
+    std::vector<halo_message> messages_to_send;
+    std::vector<halo_message> local_copies;
+    std::vector<MPI_Request> mpiRequests;
+
+    std::unique_ptr<rnumber[]> halo_data;
+
+    int pbc_layer(const int in_layer) const {
+        return ((in_layer%field_dim_z)+field_dim_z)%field_dim_z;
+    }
+
+    // Calls func(owner, first_slot, first_global_layer, nb_layers) for each
+    // run of consecutive ghost layers of in_proc owned by the same process
+    template <class Func>
+    void for_each_ghost_run(const int in_proc, Func&& func) const {
+        const int proc_first_layer = partition_interval_offset_per_proc[in_proc];
+        const int proc_nb_slots = partition_interval_size_per_proc[in_proc] + nb_lower_layers + nb_upper_layers;
+        const int first_upper_slot = nb_lower_layers + partition_interval_size_per_proc[in_proc];
+
+        int idx_slot = 0;
+        while(idx_slot < proc_nb_slots){
+            if(idx_slot == nb_lower_layers){
+                idx_slot = first_upper_slot;
+                continue;
+            }
+            const int first_layer = pbc_layer(proc_first_layer - nb_lower_layers + idx_slot);
+            const int owner = rank_per_layer[first_layer];
+            int nb_layers = 1;
+            while(idx_slot + nb_layers < proc_nb_slots
+                  && idx_slot + nb_layers != nb_lower_layers
+                  && first_layer + nb_layers < field_dim_z
+                  && rank_per_layer[first_layer + nb_layers] == owner){
+                nb_layers += 1;
+            }
+            func(owner, idx_slot, first_layer, nb_layers);
+            idx_slot += nb_layers;
+        }
+    }
+
+public:
+    particles_field_halo(MPI_Comm in_current_com,
+                         const std::pair<int,int>& in_current_partitions,
+                         const int in_field_dim_z,
+                         const ptrdiff_t in_field_mem_dim_y,
+                         const ptrdiff_t in_field_mem_dim_x)
+        : current_com(in_current_com),
+          my_rank(-1), nb_processes(-1), nb_processes_involved(-1),
+          current_partition_interval(in_current_partitions),
+          current_partition_size(current_partition_interval.second-current_partition_interval.first),
+          nb_slots(current_partition_size + nb_lower_layers + nb_upper_layers),
+          field_dim_z(in_field_dim_z), field_mem_dim_y(in_field_mem_dim_y), field_mem_dim_x(in_field_mem_dim_x),
+          layer_size(in_field_mem_dim_y*in_field_mem_dim_x*nb_components),
+          halo_possible(true){
+
+        AssertMpi(MPI_Comm_rank(current_com, &my_rank));
+        AssertMpi(MPI_Comm_size(current_com, &nb_processes));
+
+        partition_interval_size_per_proc.reset(new int[nb_processes]);
+        AssertMpi( MPI_Allgather( const_cast<int*>(&current_partition_size), 1, MPI_INT,
+                                  partition_interval_size_per_proc.get(), 1, MPI_INT,
+                                  current_com) );
+
+        partition_interval_offset_per_proc.reset(new int[nb_processes+1]);
+        partition_interval_offset_per_proc[0] = 0;
+        for(int idxProc = 0 ; idxProc < nb_processes ; ++idxProc){
+            partition_interval_offset_per_proc[idxProc+1] = partition_interval_offset_per_proc[idxProc] + partition_interval_size_per_proc[idxProc];
+        }
+
+        nb_processes_involved = nb_processes;
+        while(nb_processes_involved != 0 && partition_interval_size_per_proc[nb_processes_involved-1] == 0){
+            nb_processes_involved -= 1;
+        }
+        assert(nb_processes_involved != 0);
+        assert(field_dim_z == partition_interval_offset_per_proc[nb_processes_involved]);
+
+        rank_per_layer.reset(new int[field_dim_z]);
+        for(int idx_proc_involved = 0 ; idx_proc_involved < nb_processes_involved ; ++idx_proc_involved){
+            for(int idx_layer = partition_interval_offset_per_proc[idx_proc_involved] ;
+                idx_layer < partition_interval_offset_per_proc[idx_proc_involved+1] ; ++idx_layer){
+                rank_per_layer[idx_layer] = idx_proc_involved;
+            }
+            // Same result on all the processes
+            if(partition_interval_size_per_proc[idx_proc_involved] + nb_lower_layers + nb_upper_layers > field_dim_z){
+                halo_possible = false;
+            }
+        }
+
+        if(halo_possible == false || nb_processes_involved <= my_rank){
+            return;
+        }
+
+        slot_per_layer.resize(field_dim_z, -1);
+        for(int idx_slot = 0 ; idx_slot < nb_slots ; ++idx_slot){
+            const int layer = pbc_layer(current_partition_interval.first - nb_lower_layers + idx_slot);
+            assert(slot_per_layer[layer] == -1);
+            slot_per_layer[layer] = idx_slot;
+        }
+
+        for_each_ghost_run(my_rank, [&](const int owner, const int first_slot, const int first_layer, const int nb_layers){
+            const halo_message message{owner, first_slot,
+                                       first_layer - partition_interval_offset_per_proc[owner], nb_layers};
+            if(owner == my_rank){
+                local_copies.push_back(message);
+            }
+            else{
+                messages_to_recv.push_back(message);
+            }
+        });
+
+        for(int idx_proc_involved = 0 ; idx_proc_involved < nb_processes_involved ; ++idx_proc_involved){
+            if(idx_proc_involved == my_rank){
+                continue;
+            }
+            for_each_ghost_run(idx_proc_involved, [&](const int owner, const int first_slot, const int first_layer, const int nb_layers){
+                if(owner == my_rank){
+                    messages_to_send.push_back(halo_message{idx_proc_involved, first_slot,
+                                                            first_layer - current_partition_interval.first, nb_layers});
+                }
+            });
+        }
+    }
+
+    /** True on all the processes or on none */
+    bool is_possible() const {
+        return halo_possible;
+    }
+
+    /** Number of values received per update, summed over the processes */
+    ptrdiff_t get_nb_ghost_values() const {
+        return ptrdiff_t(nb_lower_layers + nb_upper_layers)*nb_processes_involved*layer_size;
+    }
+
+    template <class field_class>
+    void update(const field_class& in_field){
+        TIMEZONE("particles_field_halo::update");
+        assert(halo_possible);
+        if(nb_processes_involved <= my_rank){
+            return;
+        }
+        // Allocated at the first use, since the auto mode may never need it
+        if(!halo_data){
+            halo_data.reset(new rnumber[nb_slots*layer_size]);
+        }
+
+        const rnumber* local_data = in_field.get_rdata();
+
+        mpiRequests.resize(messages_to_recv.size() + messages_to_send.size());
+        int idx_request = 0;
+        for(const halo_message& message : messages_to_recv){
+            assert(message.nb_layers*layer_size < std::numeric_limits<int>::max());
+            AssertMpi(MPI_Irecv(&halo_data[message.first_slot*layer_size], int(message.nb_layers*layer_size),
+                                particles_utils::GetMpiType(rnumber()), message.proc, message.first_slot,
+                                current_com, &mpiRequests[idx_request++]));
+        }
+        for(const halo_message& message : messages_to_send){
+            assert(message.nb_layers*layer_size < std::numeric_limits<int>::max());
+            AssertMpi(MPI_Isend(const_cast<rnumber*>(&local_data[message.first_layer*layer_size]), int(message.nb_layers*layer_size),
+                                particles_utils::GetMpiType(rnumber()), message.proc, message.first_slot,
+                                current_com, &mpiRequests[idx_request++]));
+        }
+
+        // The local layers and the ghost layers that wrap around to this
+        // process are copied while the messages are in flight
+        {
+            TIMEZONE("particles_field_halo::update::copy");
+            const ptrdiff_t nb_local_values = current_partition_size*layer_size;
+            rnumber* local_slots = &halo_data[nb_lower_layers*layer_size];
+            #pragma omp parallel for schedule(static)
+            for(ptrdiff_t idx_val = 0 ; idx_val < nb_local_values ; ++idx_val){
+                local_slots[idx_val] = local_data[idx_val];
+            }
+            for(const halo_message& message : local_copies){
+                std::copy(&local_data[message.first_layer*layer_size],
+                          &local_data[(message.first_layer+message.nb_layers)*layer_size],
+                          &halo_data[message.first_slot*layer_size]);
+            }
+        }
+
+        {
+            TIMEZONE("particles_field_halo::update::wait");
+            AssertMpi(MPI_Waitall(int(mpiRequests.size()), mpiRequests.data(), MPI_STATUSES_IGNORE));
+        }
+    }
+
+    // Same interface as field, used by particles_field_computer
+
+    ptrdiff_t get_rindex_from_global(const ptrdiff_t in_global_x, const ptrdiff_t in_global_y, const ptrdiff_t in_global_z) const {
+        assert(slot_per_layer[in_global_z] != -1);
+        return ((ptrdiff_t(slot_per_layer[in_global_z])*field_mem_dim_y + in_global_y)*field_mem_dim_x + in_global_x);
+    }
+
+    const rnumber& rval(const ptrdiff_t rindex, const int idx_value) const {
+        assert(0 <= idx_value && idx_value < nb_components);
+        return halo_data[rindex*nb_components + idx_value];
+    }
+};
+
+template <class rnumber, int nb_components, int interp_neighbours>
+struct particles_field_has_ghost_layers<particles_field_halo<rnumber, nb_components, interp_neighbours>> : std::true_type {};
+
+#endif
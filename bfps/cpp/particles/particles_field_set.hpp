@@ -0,0 +1,104 @@
+#ifndef PARTICLES_FIELD_SET_HPP
+#define PARTICLES_FIELD_SET_HPP
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+#include "field.hpp"
+
+/** A list of real space fields to be sampled together at the particles
+ *  positions.
+ *
+ *  The fields may have different numbers of components, but they must share
+ *  the same layout. For the interpolation the set behaves as a single field
+ *  whose components are the components of all the fields, one field after
+ *  the other; components past get_nb_values() read as zero, so that the set
+ *  can be interpolated with a number of values rounded up to the next
+ *  supported size.
+ */
+template <class rnumber>
+class particles_field_set {
+public:
+    static const int MaxNbFields = 6;
+    static const int MaxNbValues = 18;
+
+private:
+    struct value_source {
+        const rnumber* data;
+        ptrdiff_t stride;
+    };
+
+    static const rnumber zero;
+
+    // starts of the local slab (z, y, x) and sizes of the y and x memory
+    // dimensions, shared by all the fields
+    std::array<ptrdiff_t, 3> local_starts;
+    std::array<ptrdiff_t, 3> local_mem_sizes;
+
+    int nb_fields;
+    int nb_values;
+    std::array<int, MaxNbFields> nb_components_per_field;
+    std::array<value_source, MaxNbValues> sources;
+
+public:
+    particles_field_set()
+        : nb_fields(0), nb_values(0){
+        local_starts.fill(0);
+        local_mem_sizes.fill(0);
+        nb_components_per_field.fill(0);
+        sources.fill(value_source{&zero, 0});
+    }
+
+    template <field_components fc>
+    void add(const field<rnumber, FFTW, fc>& in_field){
+        assert(in_field.real_space_representation);
+        assert(nb_fields < MaxNbFields);
+        assert(nb_values + int(ncomp(fc)) <= MaxNbValues);
+        for(int idx_dim = 0 ; idx_dim < 3 ; ++idx_dim){
+            assert(nb_fields == 0 || local_starts[idx_dim] == ptrdiff_t(in_field.rlayout->starts[idx_dim]));
+            assert(nb_fields == 0 || local_mem_sizes[idx_dim] == ptrdiff_t(in_field.rmemlayout->subsizes[idx_dim]));
+            local_starts[idx_dim] = ptrdiff_t(in_field.rlayout->starts[idx_dim]);
+            local_mem_sizes[idx_dim] = ptrdiff_t(in_field.rmemlayout->subsizes[idx_dim]);
+        }
+        for(int idx_comp = 0 ; idx_comp < int(ncomp(fc)) ; ++idx_comp){
+            sources[nb_values + idx_comp] = value_source{in_field.get_rdata() + idx_comp, ptrdiff_t(ncomp(fc))};
+        }
+        nb_components_per_field[nb_fields] = int(ncomp(fc));
+        nb_fields += 1;
+        nb_values += int(ncomp(fc));
+    }
+
+    int get_nb_fields() const{
+        return nb_fields;
+    }
+
+    int get_nb_components(const int idx_field) const{
+        assert(0 <= idx_field && idx_field < nb_fields);
+        return nb_components_per_field[idx_field];
+    }
+
+    /** Total number of components */
+    int get_nb_values() const{
+        return nb_values;
+    }
+
+    // Same interface as field, used by particles_field_computer
+
+    ptrdiff_t get_rindex_from_global(const ptrdiff_t in_global_x, const ptrdiff_t in_global_y, const ptrdiff_t in_global_z) const {
+        assert(nb_fields != 0);
+        return (((in_global_z - local_starts[0])*local_mem_sizes[1] +
+                 (in_global_y - local_starts[1]))*local_mem_sizes[2] +
+                (in_global_x - local_starts[2]));
+    }
+
+    const rnumber& rval(const ptrdiff_t rindex, const int idx_value) const {
+        assert(0 <= idx_value && idx_value < MaxNbValues);
+        return sources[idx_value].data[rindex*sources[idx_value].stride];
+    }
+};
+
+template <class rnumber>
+const rnumber particles_field_set<rnumber>::zero = 0;
+
+#endif
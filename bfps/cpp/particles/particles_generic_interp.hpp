@@ -1,316 +1,34 @@
 #ifndef PARTICLES_GENERIC_INTERP_HPP
 #define PARTICLES_GENERIC_INTERP_HPP
 
-template <class real_number, int interp_neighbours, int mode>
-class particles_generic_interp;
+#include <type_traits>
 
-#include "Lagrange_polys.hpp"
-#include "spline.hpp"
+#include "spline_table.hpp"
 
-template <>
-class particles_generic_interp<double, 1,0>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_Lagrange_n1(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 1,1>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n1_m1(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 1,2>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n1_m2(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 2,0>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_Lagrange_n2(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 2,1>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n2_m1(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 2,2>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n2_m2(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 3,0>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_Lagrange_n3(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 3,1>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n3_m1(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 3,2>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n3_m2(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 4,0>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_Lagrange_n4(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 4,1>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n4_m1(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 4,2>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n4_m2(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 5,0>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_Lagrange_n5(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 5,1>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n5_m1(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 5,2>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n5_m2(in_derivative, in_part_val, poly_val);
-    }
-};
+/** Betas of the interpolation kernels, for particles_field_computer.
+ *
+ *  mode 0 is the Lagrange interpolation, mode m > 0 the spline of
+ *  smoothness m; the betas are evaluated from the tables of spline_table.hpp,
+ *  they match the beta_Lagrange_n* and beta_n*_m* functions up to rounding.
+ */
+template <class rnumber, int interp_neighbours, int mode>
+class particles_generic_interp{
+    typedef typename std::conditional<mode == 0,
+                                      Lagrange_coefficients<interp_neighbours>,
+                                      spline_coefficients<interp_neighbours, mode>>::type coefficients;
 
-
-template <>
-class particles_generic_interp<double, 6,0>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_Lagrange_n6(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 6,1>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n6_m1(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 6,2>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n6_m2(in_derivative, in_part_val, poly_val);
-    }
-};
-
-
-template <>
-class particles_generic_interp<double, 7,0>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_Lagrange_n7(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 7,1>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n7_m1(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 7,2>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n7_m2(in_derivative, in_part_val, poly_val);
-    }
-};
-
-
-template <>
-class particles_generic_interp<double, 8,0>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_Lagrange_n8(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 8,1>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n8_m1(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 8,2>{
 public:
-    using real_number = double;
+    using real_number = rnumber;
 
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n8_m2(in_derivative, in_part_val, poly_val);
+    void compute_beta(const int in_derivative, const real_number in_part_val, real_number poly_val[]) const {
+        spline_table_evaluate<coefficients>(in_derivative, &in_part_val, 1, poly_val, 1);
     }
-};
-
-
-template <>
-class particles_generic_interp<double, 9, 0>{
-public:
-    using real_number = double;
 
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_Lagrange_n9(in_derivative, in_part_val, poly_val);
+    // Betas of nb_part_vals positions, stored in poly_val[idx_poly*poly_stride + idx_part_val]
+    void compute_beta_batch(const int in_derivative, const real_number in_part_vals[], const int nb_part_vals,
+                            real_number poly_val[], const int poly_stride) const {
+        spline_table_evaluate<coefficients>(in_derivative, in_part_vals, nb_part_vals, poly_val, poly_stride);
     }
 };
 
-template <>
-class particles_generic_interp<double, 9,1>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n9_m1(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 9,2>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n9_m2(in_derivative, in_part_val, poly_val);
-    }
-};
-
-
-template <>
-class particles_generic_interp<double, 10,0>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_Lagrange_n10(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 10,1>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n10_m1(in_derivative, in_part_val, poly_val);
-    }
-};
-
-template <>
-class particles_generic_interp<double, 10,2>{
-public:
-    using real_number = double;
-
-    void compute_beta(const int in_derivative, const double in_part_val, double poly_val[]) const {
-        beta_n10_m2(in_derivative, in_part_val, poly_val);
-    }
-};
-
-#endif//PARTICLES_INTERP_SPLINE_HPP
-
+#endif//PARTICLES_GENERIC_INTERP_HPP
@@ -6,6 +6,7 @@
 #include <hdf5.h>
 #include <cassert>
 #include <vector>
+#include <algorithm>
 
 #include "abstract_particles_input.hpp"
 #include "base.hpp"
@@ -207,45 +208,52 @@ public:
             assert(rethdf >= 0);
         }
 
-        std::unique_ptr<partsize_t[]> split_particles_indexes(new partsize_t[load_splitter.getMySize()]);
-        for(partsize_t idx_part = 0 ; idx_part < partsize_t(load_splitter.getMySize()) ; ++idx_part){
-            split_particles_indexes[idx_part] = idx_part + partsize_t(load_splitter.getMyOffset());
-        }
-
         // Permute
-        std::vector<partsize_t> nb_particles_per_proc(nb_processes);
+        std::vector<partsize_t> nb_particles_per_proc;
+        std::unique_ptr<partsize_t[]> split_particles_indexes(new partsize_t[load_splitter.getMySize()]);
         {
             TIMEZONE("partition");
+            const partsize_t nb_loaded_particles = partsize_t(load_splitter.getMySize());
 
             const real_number spatial_box_offset = in_spatial_limit_per_proc[0];
             const real_number spatial_box_width = in_spatial_limit_per_proc[nb_processes] - in_spatial_limit_per_proc[0];
-
-            partsize_t previousOffset = 0;
+            // A particle goes to the first process whose upper limit is above its position
+            std::vector<real_number> upper_limit_shifted(nb_processes-1);
             for(int idx_proc = 0 ; idx_proc < nb_processes-1 ; ++idx_proc){
-                const real_number limitPartitionShifted = in_spatial_limit_per_proc[idx_proc+1]-spatial_box_offset;
-                const partsize_t localOffset = particles_utils::partition_extra<partsize_t, size_particle_positions>(
-                                                &split_particles_positions[previousOffset*size_particle_positions],
-                                                 partsize_t(load_splitter.getMySize())-previousOffset,
-                                                 [&](const real_number val[]){
-                    const real_number shiftPos = val[IDX_Z]-spatial_box_offset;
-                    const real_number nbRepeat = floor(shiftPos/spatial_box_width);
-                    const real_number posInBox = shiftPos - (spatial_box_width*nbRepeat);
-                    return posInBox < limitPartitionShifted;
-                },
-                [&](const partsize_t idx1, const partsize_t idx2){
-                    std::swap(split_particles_indexes[idx1], split_particles_indexes[idx2]);
-                    for(int idx_rhs = 0 ; idx_rhs < int(nb_rhs) ; ++idx_rhs){
-                        for(int idx_val = 0 ; idx_val < size_particle_rhs ; ++idx_val){
-                            std::swap(split_particles_rhs[idx_rhs][idx1*size_particle_rhs + idx_val],
-                                      split_particles_rhs[idx_rhs][idx2*size_particle_rhs + idx_val]);
-                        }
-                    }
-                }, previousOffset);
-
-                nb_particles_per_proc[idx_proc] = localOffset;
-                previousOffset += localOffset;
+                upper_limit_shifted[idx_proc] = in_spatial_limit_per_proc[idx_proc+1]-spatial_box_offset;
+            }
+
+            std::unique_ptr<int[]> dest_proc_per_particle(new int[nb_loaded_particles]);
+            #pragma omp parallel for schedule(static)
+            for(partsize_t idx_part = 0 ; idx_part < nb_loaded_particles ; ++idx_part){
+                const real_number shiftPos = split_particles_positions[idx_part*size_particle_positions+IDX_Z]-spatial_box_offset;
+                const real_number nbRepeat = floor(shiftPos/spatial_box_width);
+                const real_number posInBox = shiftPos - (spatial_box_width*nbRepeat);
+                dest_proc_per_particle[idx_part] = int(std::upper_bound(upper_limit_shifted.begin(), upper_limit_shifted.end(), posInBox)
+                                                       - upper_limit_shifted.begin());
+            }
+
+            std::unique_ptr<partsize_t[]> new_position(new partsize_t[nb_loaded_particles]);
+            nb_particles_per_proc = particles_utils::bin_permutation<partsize_t>(dest_proc_per_particle.get(), nb_loaded_particles,
+                                                                                 nb_processes, new_position.get());
+            dest_proc_per_particle.reset();
+
+            {
+                std::unique_ptr<real_number[]> sorted_positions(new real_number[nb_loaded_particles*size_particle_positions]);
+                particles_utils::permute(new_position.get(), nb_loaded_particles, split_particles_positions.get(),
+                                         sorted_positions.get(), size_particle_positions);
+                split_particles_positions = std::move(sorted_positions);
+            }
+            #pragma omp parallel for schedule(static)
+            for(partsize_t idx_part = 0 ; idx_part < nb_loaded_particles ; ++idx_part){
+                split_particles_indexes[new_position[idx_part]] = idx_part + partsize_t(load_splitter.getMyOffset());
+            }
+            for(int idx_rhs = 0 ; idx_rhs < int(nb_rhs) ; ++idx_rhs){
+                std::unique_ptr<real_number[]> sorted_rhs(new real_number[nb_loaded_particles*size_particle_rhs]);
+                particles_utils::permute(new_position.get(), nb_loaded_particles, split_particles_rhs[idx_rhs].get(),
+                                         sorted_rhs.get(), size_particle_rhs);
+                split_particles_rhs[idx_rhs] = std::move(sorted_rhs);
             }
-            nb_particles_per_proc[nb_processes-1] = partsize_t(load_splitter.getMySize()) - previousOffset;
         }
 
         {
@@ -256,16 +264,17 @@ public:
 
             my_particles_positions.reset(new real_number[exchanger.getTotalToRecv()*size_particle_positions]);
             exchanger.alltoallv<real_number>(split_particles_positions.get(), my_particles_positions.get(), size_particle_positions);
-            split_particles_positions.release();
+            split_particles_positions.reset();
 
             my_particles_indexes.reset(new partsize_t[exchanger.getTotalToRecv()]);
             exchanger.alltoallv<partsize_t>(split_particles_indexes.get(), my_particles_indexes.get());
-            split_particles_indexes.release();
+            split_particles_indexes.reset();
 
             my_particles_rhs.resize(nb_rhs);
             for(int idx_rhs = 0 ; idx_rhs < int(nb_rhs) ; ++idx_rhs){
                 my_particles_rhs[idx_rhs].reset(new real_number[exchanger.getTotalToRecv()*size_particle_rhs]);
                 exchanger.alltoallv<real_number>(split_particles_rhs[idx_rhs].get(), my_particles_rhs[idx_rhs].get(), size_particle_rhs);
+                split_particles_rhs[idx_rhs].reset();
             }
         }
 
@@ -6,6 +6,7 @@
 #include <hdf5.h>
 
 #include "abstract_particles_output.hpp"
+#include "async_file_writer.hpp"
 #include "scope_timer.hpp"
 
 template <class partsize_t,
@@ -31,6 +32,27 @@ class particles_output_hdf5 : public abstract_particles_output<partsize_t,
 
     bool use_collective_io;
 
+    // When set, the datasets are only created by write, and their content is
+    // given to the async writer when the file is closed
+    async_file_writer* async_writer;
+    std::string current_filename;
+    std::vector<async_file_writer::block> pending_blocks;
+
+    hid_t create_dataset_properties() const {
+        hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+        assert(dcpl_id >= 0);
+        if(async_writer != nullptr){
+            // contiguous storage, allocated at creation, to know its offset
+            int rethdf = H5Pset_layout(dcpl_id, H5D_CONTIGUOUS);
+            assert(rethdf >= 0);
+            rethdf = H5Pset_alloc_time(dcpl_id, H5D_ALLOC_TIME_EARLY);
+            assert(rethdf >= 0);
+            rethdf = H5Pset_fill_time(dcpl_id, H5D_FILL_TIME_NEVER);
+            assert(rethdf >= 0);
+        }
+        return dcpl_id;
+    }
+
 public:
     particles_output_hdf5(MPI_Comm in_mpi_com,
                           const std::string ps_name,
@@ -49,13 +71,19 @@ public:
               total_nb_particles(inTotalNbParticles),
               dset_id_state(0),
               dset_id_rhs(0),
-              use_collective_io(in_use_collective_io){}
+              use_collective_io(in_use_collective_io),
+              async_writer(nullptr){}
+
+    void set_async_writer(async_file_writer* in_async_writer){
+        async_writer = in_async_writer;
+    }
 
     int open_file(std::string filename){
         if(Parent::isInvolved()){
             TIMEZONE("particles_output_hdf5::open_file");
 
             this->require_checkpoint_groups(filename);
+            current_filename = filename;
 
             hid_t plist_id_par = H5Pcreate(H5P_FILE_ACCESS);
             assert(plist_id_par >= 0);
@@ -102,6 +130,11 @@ public:
 
             rethdf = H5Fclose(file_id);
             assert(rethdf >= 0);
+
+            if(async_writer != nullptr){
+                async_writer->start_write(Parent::getComWriter(), current_filename, pending_blocks);
+                pending_blocks.clear();
+            }
         }
         return EXIT_SUCCESS;
     }
@@ -206,46 +239,57 @@ public:
             hid_t dataspace = H5Screate_simple(2, datacount, NULL);
             assert(dataspace >= 0);
 
+            hid_t dcpl_id = create_dataset_properties();
             hid_t dataset_id = H5Dcreate( dset_id_state,
                                           std::to_string(idx_time_step).c_str(),
                                           type_id,
                                           dataspace,
                                           H5P_DEFAULT,
-                                          H5P_DEFAULT,
+                                          dcpl_id,
                                           H5P_DEFAULT);
             assert(dataset_id >= 0);
+            int rethdf = H5Pclose(dcpl_id);
+            assert(rethdf >= 0);
 
             assert(nb_particles >= 0);
             assert(particles_idx_offset >= 0);
-            const hsize_t count[2] = {hsize_t(nb_particles), size_particle_positions};
-            const hsize_t offset[2] = {hsize_t(particles_idx_offset), 0};
-            hid_t memspace = H5Screate_simple(2, count, NULL);
-            assert(memspace >= 0);
-
-            hid_t filespace = H5Dget_space(dataset_id);
-            int rethdf = H5Sselect_hyperslab(
-                    filespace,
-                    H5S_SELECT_SET,
-                    offset,
-                    NULL,
-                    count,
-                    NULL);
-            assert(rethdf >= 0);
+            const haddr_t dataset_offset = (async_writer != nullptr ? H5Dget_offset(dataset_id) : HADDR_UNDEF);
+            if(dataset_offset != HADDR_UNDEF){
+                pending_blocks.push_back({MPI_Offset(dataset_offset + particles_idx_offset*size_particle_positions*sizeof(real_number)),
+                                          particles_positions,
+                                          size_t(nb_particles*size_particle_positions*sizeof(real_number))});
+            }
+            else{
+                const hsize_t count[2] = {hsize_t(nb_particles), size_particle_positions};
+                const hsize_t offset[2] = {hsize_t(particles_idx_offset), 0};
+                hid_t memspace = H5Screate_simple(2, count, NULL);
+                assert(memspace >= 0);
 
-            herr_t	status = H5Dwrite(
-                    dataset_id,
-                    type_id,
-                    memspace,
-                    filespace,
-                    plist_id,
-                    particles_positions);
-            assert(status >= 0);
-            rethdf = H5Sclose(memspace);
-            assert(rethdf >= 0);
+                hid_t filespace = H5Dget_space(dataset_id);
+                rethdf = H5Sselect_hyperslab(
+                        filespace,
+                        H5S_SELECT_SET,
+                        offset,
+                        NULL,
+                        count,
+                        NULL);
+                assert(rethdf >= 0);
+
+                herr_t	status = H5Dwrite(
+                        dataset_id,
+                        type_id,
+                        memspace,
+                        filespace,
+                        plist_id,
+                        particles_positions);
+                assert(status >= 0);
+                rethdf = H5Sclose(memspace);
+                assert(rethdf >= 0);
+                rethdf = H5Sclose(filespace);
+                assert(rethdf >= 0);
+            }
             rethdf = H5Dclose(dataset_id);
             assert(rethdf >= 0);
-            rethdf = H5Sclose(filespace);
-            assert(rethdf >= 0);
         }
         {
             assert(size_particle_rhs >= 0);
@@ -255,17 +299,28 @@ public:
             hid_t dataspace = H5Screate_simple(3, datacount, NULL);
             assert(dataspace >= 0);
 
+            hid_t dcpl_id = create_dataset_properties();
             hid_t dataset_id = H5Dcreate( dset_id_rhs,
                                           std::to_string(idx_time_step).c_str(),
                                           type_id,
                                           dataspace,
                                           H5P_DEFAULT,
-                                          H5P_DEFAULT,
+                                          dcpl_id,
                                           H5P_DEFAULT);
             assert(dataset_id >= 0);
+            {
+                int rethdf = H5Pclose(dcpl_id);
+                assert(rethdf >= 0);
+            }
 
             assert(particles_idx_offset >= 0);
-            for(int idx_rhs = 0 ; idx_rhs < Parent::getNbRhs() ; ++idx_rhs){
+            const haddr_t dataset_offset = (async_writer != nullptr ? H5Dget_offset(dataset_id) : HADDR_UNDEF);
+            for(int idx_rhs = 0 ; idx_rhs < Parent::getNbRhs() && dataset_offset != HADDR_UNDEF ; ++idx_rhs){
+                pending_blocks.push_back({MPI_Offset(dataset_offset + (idx_rhs*total_nb_particles + particles_idx_offset)*size_particle_rhs*sizeof(real_number)),
+                                          particles_rhs[idx_rhs].get(),
+                                          size_t(nb_particles*size_particle_rhs*sizeof(real_number))});
+            }
+            for(int idx_rhs = 0 ; idx_rhs < Parent::getNbRhs() && dataset_offset == HADDR_UNDEF ; ++idx_rhs){
                 const hsize_t count[3] = {
                     1,
                     hsize_t(nb_particles),
@@ -4,6 +4,9 @@
 #include "abstract_particles_output.hpp"
 
 #include <hdf5.h>
+#include <string>
+#include <vector>
+#include <utility>
 
 template <class partsize_t,
           class real_number,
@@ -18,20 +21,36 @@ class particles_output_sampling_hdf5 : public abstract_particles_output<partsize
                                              size_particle_positions,
                                              size_particle_rhs>;
 
+    const std::string filename;
+    const std::string groupname;
+    const bool use_collective_io;
+
     hid_t file_id, pgroup_id;
 
-    const std::string dataset_name;
-    const bool use_collective_io;
+    // Name and number of values of the datasets written by the current
+    // call to save_datasets; the values of a particle are the values of
+    // all the datasets, one dataset after the other
+    std::vector<std::pair<std::string,int>> current_datasets;
 
 public:
     static bool DatasetExistsCol(MPI_Comm in_mpi_com,
                                   const std::string& in_filename,
                                   const std::string& in_groupname,
                                  const std::string& in_dataset_name){
+        return DatasetsExistCol(in_mpi_com, in_filename, in_groupname,
+                                std::vector<std::string>(1, in_dataset_name));
+    }
+
+    /** True if all the datasets exist, write() overwrites the ones that
+     *  exist when only some of them do */
+    static bool DatasetsExistCol(MPI_Comm in_mpi_com,
+                                 const std::string& in_filename,
+                                 const std::string& in_groupname,
+                                 const std::vector<std::string>& in_dataset_names){
         int my_rank;
         AssertMpi(MPI_Comm_rank(in_mpi_com, &my_rank));
 
-        int dataset_exists = -1;
+        int datasets_exist = -1;
 
         if(my_rank == 0){
             // Parallel HDF5 write
@@ -41,28 +60,56 @@ public:
                     H5P_DEFAULT);
             assert(file_id >= 0);
 
-            dataset_exists = H5Lexists(
-                    file_id,
-                    (in_groupname + "/" + in_dataset_name).c_str(),
-                    H5P_DEFAULT);
+            datasets_exist = 1;
+            for(const std::string& dataset_name : in_dataset_names){
+                if(H5Lexists(file_id,
+                             (in_groupname + "/" + dataset_name).c_str(),
+                             H5P_DEFAULT) <= 0){
+                    datasets_exist = 0;
+                    break;
+                }
+            }
 
             int retTest = H5Fclose(file_id);
             assert(retTest >= 0);
         }
 
-        AssertMpi(MPI_Bcast( &dataset_exists, 1, MPI_INT, 0, in_mpi_com ));
-        return dataset_exists;
+        AssertMpi(MPI_Bcast( &datasets_exist, 1, MPI_INT, 0, in_mpi_com ));
+        return datasets_exist;
     }
 
+    /** The file is only open during save_datasets, so that a single object
+     *  can be kept for the whole run. */
     particles_output_sampling_hdf5(MPI_Comm in_mpi_com,
                           const partsize_t inTotalNbParticles,
                                    const std::string& in_filename,
                                    const std::string& in_groupname,
-                          const std::string& in_dataset_name,
                           const bool in_use_collective_io = false)
             : Parent(in_mpi_com, inTotalNbParticles, 1),
-              dataset_name(in_dataset_name),
-              use_collective_io(in_use_collective_io){
+              filename(in_filename),
+              groupname(in_groupname),
+              use_collective_io(in_use_collective_io),
+              file_id(-1), pgroup_id(-1){
+    }
+
+    /** Writes one dataset per entry of in_datasets (name, number of values),
+     *  in_particles_rhs holds the values of all the datasets for each
+     *  particle. The particles are sent to the writers only once. */
+    void save_datasets(const std::vector<std::pair<std::string,int>>& in_datasets,
+                       const real_number input_particles_positions[],
+                       const std::unique_ptr<real_number[]> input_particles_rhs[],
+                       const partsize_t index_particles[],
+                       const partsize_t nb_particles,
+                       const int idx_time_step){
+        TIMEZONE("particles_output_sampling_hdf5::save_datasets");
+        int nb_values = 0;
+        for(const auto& dataset : in_datasets){
+            nb_values += dataset.second;
+        }
+        assert(nb_values == size_particle_rhs);
+        variable_used_only_in_assert(nb_values);
+        current_datasets = in_datasets;
+
         if(Parent::isInvolved()){
             hid_t plist_id_par = H5Pcreate(H5P_FILE_ACCESS);
             assert(plist_id_par >= 0);
@@ -74,7 +121,7 @@ public:
 
             // Parallel HDF5 write
             file_id = H5Fopen(
-                    in_filename.c_str(),
+                    filename.c_str(),
                     H5F_ACC_RDWR | H5F_ACC_DEBUG,
                     plist_id_par);
             assert(file_id >= 0);
@@ -83,18 +130,21 @@ public:
 
             pgroup_id = H5Gopen(
                     file_id,
-                    in_groupname.c_str(),
+                    groupname.c_str(),
                     H5P_DEFAULT);
             assert(pgroup_id >= 0);
         }
-    }
 
-    ~particles_output_sampling_hdf5(){
+        Parent::save(input_particles_positions, input_particles_rhs, index_particles,
+                     nb_particles, idx_time_step);
+
         if(Parent::isInvolved()){
             int retTest = H5Gclose(pgroup_id);
             assert(retTest >= 0);
             retTest = H5Fclose(file_id);
             assert(retTest >= 0);
+            pgroup_id = -1;
+            file_id = -1;
         }
     }
 
@@ -106,7 +156,7 @@ public:
             const partsize_t particles_idx_offset) final{
         assert(Parent::isInvolved());
 
-        TIMEZONE("particles_output_hdf5::write");
+        TIMEZONE("particles_output_sampling_hdf5::write");
 
         assert(particles_idx_offset < Parent::getTotalNbParticles() || (particles_idx_offset == Parent::getTotalNbParticles() && nb_particles == 0));
         assert(particles_idx_offset+nb_particles <= Parent::getTotalNbParticles());
@@ -122,38 +172,76 @@ public:
             int rethdf = H5Pset_dxpl_mpio(plist_id, use_collective_io ? H5FD_MPIO_COLLECTIVE : H5FD_MPIO_INDEPENDENT);
             assert(rethdf >= 0);
         }
-        {
-            assert(size_particle_rhs >= 0);
+        int first_value = 0;
+        for(const auto& dataset : current_datasets){
+            const int nb_values = dataset.second;
             const hsize_t datacount[3] = {hsize_t(Parent::getNbRhs()),
                                           hsize_t(Parent::getTotalNbParticles()),
-                                          hsize_t(size_particle_rhs)};
+                                          hsize_t(nb_values)};
             hid_t dataspace = H5Screate_simple(3, datacount, NULL);
             assert(dataspace >= 0);
 
-            hid_t dataset_id = H5Dcreate( pgroup_id,
-                                          dataset_name.c_str(),
-                                          type_id,
-                                          dataspace,
-                                          H5P_DEFAULT,
-                                          H5P_DEFAULT,
-                                          H5P_DEFAULT);
-            assert(dataset_id >= 0);
+            // A restart can find some of the datasets of a step already
+            // written, they are overwritten with the same values
+            hid_t dataset_id;
+            if(H5Lexists(pgroup_id, dataset.first.c_str(), H5P_DEFAULT) > 0){
+                dataset_id = H5Dopen(pgroup_id, dataset.first.c_str(), H5P_DEFAULT);
+                assert(dataset_id >= 0);
+                hid_t existing_space = H5Dget_space(dataset_id);
+                assert(existing_space >= 0);
+                assert(H5Sget_simple_extent_ndims(existing_space) == 3);
+                hsize_t existing_count[3];
+                H5Sget_simple_extent_dims(existing_space, existing_count, NULL);
+                assert(existing_count[0] == datacount[0]
+                       && existing_count[1] == datacount[1]
+                       && existing_count[2] == datacount[2]);
+                int rethdf = H5Sclose(existing_space);
+                assert(rethdf >= 0);
+            }
+            else{
+                dataset_id = H5Dcreate( pgroup_id,
+                                        dataset.first.c_str(),
+                                        type_id,
+                                        dataspace,
+                                        H5P_DEFAULT,
+                                        H5P_DEFAULT,
+                                        H5P_DEFAULT);
+                assert(dataset_id >= 0);
+            }
 
             assert(particles_idx_offset >= 0);
             const hsize_t count[3] = {
                 1,
                 hsize_t(nb_particles),
-                hsize_t(size_particle_rhs)};
+                hsize_t(nb_values)};
             const hsize_t offset[3] = {
                 0,
                 hsize_t(particles_idx_offset),
                 0};
-            hid_t memspace = H5Screate_simple(3, count, NULL);
+            // the values of this dataset inside the values of all the datasets
+            const hsize_t memcount[2] = {
+                hsize_t(nb_particles),
+                hsize_t(size_particle_rhs)};
+            const hsize_t memoffset[2] = {
+                0,
+                hsize_t(first_value)};
+            const hsize_t memselection[2] = {
+                hsize_t(nb_particles),
+                hsize_t(nb_values)};
+            hid_t memspace = H5Screate_simple(2, memcount, NULL);
             assert(memspace >= 0);
+            int rethdf = H5Sselect_hyperslab(
+                    memspace,
+                    H5S_SELECT_SET,
+                    memoffset,
+                    NULL,
+                    memselection,
+                    NULL);
+            assert(rethdf >= 0);
 
             hid_t filespace = H5Dget_space(dataset_id);
             assert(filespace >= 0);
-            int rethdf = H5Sselect_hyperslab(
+            rethdf = H5Sselect_hyperslab(
                     filespace,
                     H5S_SELECT_SET,
                     offset,
@@ -176,6 +264,10 @@ public:
             assert(rethdf >= 0);
             rethdf = H5Dclose(dataset_id);
             assert(rethdf >= 0);
+            rethdf = H5Sclose(dataspace);
+            assert(rethdf >= 0);
+
+            first_value += nb_values;
         }
 
         {
@@ -3,8 +3,11 @@
 
 #include <memory>
 #include <string>
+#include <vector>
+#include <utility>
 
 #include "abstract_particles_system.hpp"
+#include "particles_field_set.hpp"
 #include "particles_output_sampling_hdf5.hpp"
 
 #include "field.hpp"
@@ -39,14 +42,58 @@ void sample_from_particles_system(const field<rnumber, be, fc>& in_field, // a p
     particles_output_sampling_hdf5<partsize_t, particles_rnumber, 3, size_particle_rhs> outputclass(MPI_COMM_WORLD,
                                                                                                     ps->getGlobalNbParticles(),
                                                                                                     filename,
-                                                                                                    parent_groupname,
-                                                                                                    datasetname);
-    outputclass.save(ps->getParticlesPositions(),
+                                                                                                    parent_groupname);
+    outputclass.save_datasets(std::vector<std::pair<std::string,int>>(1, {datasetname, size_particle_rhs}),
+                     ps->getParticlesPositions(),
                      &sample_rhs,
                      ps->getParticlesIndexes(),
                      ps->getLocalNbParticles(),
                      ps->get_step_idx());
 }
 
+/** Sample all the fields of in_fields with a single exchange of the
+ *  particles, and write field idx to the dataset
+ *  in_basenames[idx]/<step index> through the persistent outputclass,
+ *  whose number of values must be in_fields.get_nb_values().
+ */
+template <class partsize_t, class particles_rnumber, class rnumber, int size_particle_rhs>
+void sample_from_particles_system(const particles_field_set<rnumber>& in_fields,
+                                  const std::vector<std::string>& in_basenames,
+                                  std::unique_ptr<abstract_particles_system<partsize_t, particles_rnumber>>& ps,
+                                  particles_output_sampling_hdf5<partsize_t, particles_rnumber, 3, size_particle_rhs>& outputclass,
+                                  const std::string& filename,
+                                  const std::string& parent_groupname){
+    assert(in_fields.get_nb_values() == size_particle_rhs);
+    assert(int(in_basenames.size()) == in_fields.get_nb_fields());
+
+    std::vector<std::pair<std::string,int>> datasets;
+    std::vector<std::string> datasetnames;
+    for(int idx_field = 0 ; idx_field < in_fields.get_nb_fields() ; ++idx_field){
+        datasetnames.push_back(in_basenames[idx_field] + std::string("/") + std::to_string(ps->get_step_idx()));
+        datasets.emplace_back(datasetnames.back(), in_fields.get_nb_components(idx_field));
+    }
+
+    // Stop here if they all exist already, the ones of an interrupted
+    // output are overwritten
+    if(particles_output_sampling_hdf5<partsize_t, particles_rnumber, 3, size_particle_rhs>::DatasetsExistCol(MPI_COMM_WORLD,
+                                                                                                             filename,
+                                                                                                             parent_groupname,
+                                                                                                             datasetnames)){
+        return;
+    }
+
+    const partsize_t nb_particles = ps->getLocalNbParticles();
+    std::unique_ptr<particles_rnumber[]> sample_rhs(new particles_rnumber[size_particle_rhs*nb_particles]);
+
+    ps->sample_compute_fields(in_fields, sample_rhs.get());
+
+    outputclass.save_datasets(datasets,
+                              ps->getParticlesPositions(),
+                              &sample_rhs,
+                              ps->getParticlesIndexes(),
+                              ps->getLocalNbParticles(),
+                              ps->get_step_idx());
+}
+
 #endif
 
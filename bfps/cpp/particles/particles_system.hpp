@@ -2,12 +2,18 @@
 #define PARTICLES_SYSTEM_HPP
 
 #include <array>
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include <omp.h>
 
 #include "abstract_particles_system.hpp"
 #include "particles_distr_mpi.hpp"
 #include "particles_output_hdf5.hpp"
 #include "particles_output_mpiio.hpp"
 #include "particles_field_computer.hpp"
+#include "particles_field_halo.hpp"
 #include "abstract_particles_input.hpp"
 #include "particles_adams_bashforth.hpp"
 #include "scope_timer.hpp"
@@ -31,6 +37,11 @@ class particles_system : public abstract_particles_system<partsize_t, real_numbe
 
     field_class default_field;
 
+    // Ghost padded copy of default_field, used when the boundary particles
+    // are interpolated locally instead of being sent to the neighbours
+    particles_field_halo<field_rnumber, size_particle_rhs, interp_neighbours> default_field_halo;
+    bool use_field_halo;
+
     std::unique_ptr<partsize_t[]> current_my_nb_particles_per_partition;
     std::unique_ptr<partsize_t[]> current_offset_particles_for_partition;
 
@@ -47,6 +58,106 @@ class particles_system : public abstract_particles_system<partsize_t, real_numbe
 
     int step_idx;
 
+    // If true, the particles of each partition are kept in the Morton order
+    // of their cells, so that neighbouring particles share field nodes
+    // during the interpolation
+    const bool cell_order;
+    std::vector<std::pair<unsigned long long, partsize_t>> cell_order_keys;
+    std::vector<partsize_t> cell_order_new_position;
+    std::vector<real_number> cell_order_values;
+    std::vector<partsize_t> cell_order_indexes;
+
+    // Results of sample_compute_fields when the number of values is padded
+    std::vector<real_number> sample_buffer;
+
+    // Both strategies exchange 2*interp_neighbours+1 z layers worth of data:
+    // the particles of the boundary partitions (positions there, rhs back)
+    // or the ghost layers of the field. With a uniform density, the halo is
+    // cheaper when a layer holds more particle bytes than field bytes.
+    // Only depends on global values, so all the processes agree.
+    bool select_field_halo(const particles_exchange_mode in_exchange_mode,
+                           const std::array<size_t,3>& field_grid_dim) const {
+        if(in_exchange_mode == PARTICLES_EXCHANGE_POSITIONS){
+            return false;
+        }
+        if(default_field_halo.is_possible() == false){
+            int my_rank;
+            AssertMpi(MPI_Comm_rank(mpi_com, &my_rank));
+            if(in_exchange_mode == PARTICLES_EXCHANGE_FIELD_HALO && my_rank == 0){
+                std::cerr << "WARNING: the z slabs are too thick for a field halo of "
+                          << 2*interp_neighbours+1 << " layers, the particles are sent instead" << std::endl;
+            }
+            return false;
+        }
+        if(in_exchange_mode == PARTICLES_EXCHANGE_FIELD_HALO){
+            return true;
+        }
+        const double particle_bytes_per_layer = double(total_nb_particles)/double(field_grid_dim[IDX_Z])
+                                                * double((3+size_particle_rhs)*sizeof(real_number));
+        const double field_bytes_per_layer = double(field_grid_dim[IDX_X])*double(field_grid_dim[IDX_Y])
+                                             * double(size_particle_rhs*sizeof(field_rnumber));
+        return particle_bytes_per_layer > field_bytes_per_layer;
+    }
+
+    void sort_particles_by_cell(){
+        TIMEZONE("particles_system::sort_particles_by_cell");
+        cell_order_keys.resize(my_nb_particles);
+
+        current_offset_particles_for_partition[0] = 0;
+        for(int idxPartition = 0 ; idxPartition < partition_interval_size ; ++idxPartition){
+            current_offset_particles_for_partition[idxPartition+1] = current_offset_particles_for_partition[idxPartition]
+                                                                     + current_my_nb_particles_per_partition[idxPartition];
+        }
+        assert(current_offset_particles_for_partition[partition_interval_size] == my_nb_particles);
+
+        int nb_unsorted_partitions = 0;
+        #pragma omp parallel for schedule(dynamic) reduction(+:nb_unsorted_partitions)
+        for(int idxPartition = 0 ; idxPartition < partition_interval_size ; ++idxPartition){
+            const partsize_t first = current_offset_particles_for_partition[idxPartition];
+            const partsize_t last = current_offset_particles_for_partition[idxPartition+1];
+            for(partsize_t idx_part = first ; idx_part < last ; ++idx_part){
+                cell_order_keys[idx_part].first = particles_utils::morton_code_3d(
+                            computer.pbc_field_layer(my_particles_positions[idx_part*3+IDX_X], IDX_X),
+                            computer.pbc_field_layer(my_particles_positions[idx_part*3+IDX_Y], IDX_Y),
+                            computer.pbc_field_layer(my_particles_positions[idx_part*3+IDX_Z], IDX_Z));
+                cell_order_keys[idx_part].second = idx_part;
+            }
+            const auto part_begin = cell_order_keys.begin() + first;
+            const auto part_end = cell_order_keys.begin() + last;
+            if(!std::is_sorted(part_begin, part_end)){
+                std::sort(part_begin, part_end);
+                nb_unsorted_partitions += 1;
+            }
+        }
+        // Most steps move few particles out of their cells
+        if(nb_unsorted_partitions == 0){
+            return;
+        }
+
+        cell_order_new_position.resize(my_nb_particles);
+        #pragma omp parallel for schedule(static)
+        for(partsize_t idx_part = 0 ; idx_part < my_nb_particles ; ++idx_part){
+            cell_order_new_position[cell_order_keys[idx_part].second] = idx_part;
+        }
+
+        cell_order_values.resize(my_nb_particles*std::max(3, size_particle_rhs));
+        particles_utils::permute(cell_order_new_position.data(), my_nb_particles,
+                                 my_particles_positions.get(), cell_order_values.data(), 3);
+        std::copy(cell_order_values.begin(), cell_order_values.begin() + my_nb_particles*3,
+                  my_particles_positions.get());
+        for(int idx_rhs = 0 ; idx_rhs < int(my_particles_rhs.size()) ; ++idx_rhs){
+            particles_utils::permute(cell_order_new_position.data(), my_nb_particles,
+                                     my_particles_rhs[idx_rhs].get(), cell_order_values.data(), size_particle_rhs);
+            std::copy(cell_order_values.begin(), cell_order_values.begin() + my_nb_particles*size_particle_rhs,
+                      my_particles_rhs[idx_rhs].get());
+        }
+        cell_order_indexes.resize(my_nb_particles);
+        particles_utils::permute(cell_order_new_position.data(), my_nb_particles,
+                                 my_particles_positions_indexes.get(), cell_order_indexes.data());
+        std::copy(cell_order_indexes.begin(), cell_order_indexes.end(),
+                  my_particles_positions_indexes.get());
+    }
+
 public:
     particles_system(const std::array<size_t,3>& field_grid_dim, const std::array<real_number,3>& in_spatial_box_width,
                      const std::array<real_number,3>& in_spatial_box_offset,
@@ -57,7 +168,9 @@ public:
                      const field_class& in_field,
                      MPI_Comm in_mpi_com,
                      const partsize_t in_total_nb_particles,
-                     const int in_current_iteration = 1)
+                     const int in_current_iteration = 1,
+                     const bool in_cell_order = false,
+                     const particles_exchange_mode in_exchange_mode = PARTICLES_EXCHANGE_AUTO)
         : mpi_com(in_mpi_com),
           current_partition_interval({in_local_field_offset[IDX_Z], in_local_field_offset[IDX_Z] + in_local_field_dims[IDX_Z]}),
           partition_interval_size(current_partition_interval.second - current_partition_interval.first),
@@ -67,9 +180,15 @@ public:
           computer(field_grid_dim, current_partition_interval,
                    interpolator, in_spatial_box_width, in_spatial_box_offset, in_spatial_partition_width),
           default_field(in_field),
+          default_field_halo(in_mpi_com, current_partition_interval, int(field_grid_dim[IDX_Z]),
+                             ptrdiff_t(in_field.rmemlayout->subsizes[FIELD_IDX_Y]),
+                             ptrdiff_t(in_field.rmemlayout->subsizes[FIELD_IDX_X])),
+          use_field_halo(false),
           spatial_box_width(in_spatial_box_width), spatial_partition_width(in_spatial_partition_width),
           my_spatial_low_limit(in_my_spatial_low_limit), my_spatial_up_limit(in_my_spatial_up_limit),
-          my_nb_particles(0), total_nb_particles(in_total_nb_particles), step_idx(in_current_iteration){
+          my_nb_particles(0), total_nb_particles(in_total_nb_particles), step_idx(in_current_iteration),
+          cell_order(in_cell_order){
+        use_field_halo = select_field_halo(in_exchange_mode, field_grid_dim);
 
         current_my_nb_particles_per_partition.reset(new partsize_t[partition_interval_size]);
         current_offset_particles_for_partition.reset(new partsize_t[partition_interval_size+1]);
@@ -118,11 +237,24 @@ public:
                 }
             }
         }
+
+        if(cell_order){
+            sort_particles_by_cell();
+        }
     }
 
 
     void compute() final {
         TIMEZONE("particles_system::compute");
+        if(use_field_halo){
+            default_field_halo.update(default_field);
+            particles_distr.template compute_local<computer_class, decltype(default_field_halo), 3, size_particle_rhs>(
+                               computer, default_field_halo,
+                               current_my_nb_particles_per_partition.get(),
+                               my_particles_positions.get(),
+                               my_particles_rhs.front().get());
+            return;
+        }
         particles_distr.template compute_distr<computer_class, field_class, 3, size_particle_rhs>(
                                computer, default_field,
                                current_my_nb_particles_per_partition.get(),
@@ -131,6 +263,8 @@ public:
                                interp_neighbours);
     }
 
+    // Only default_field has a halo, the sampled fields are always computed
+    // by sending the particles
     template <class sample_field_class, int sample_size_particle_rhs>
     void sample_compute(const sample_field_class& sample_field,
                         real_number sample_rhs[]) {
@@ -168,8 +302,63 @@ public:
                                 real_number sample_rhs[]) final {
         sample_compute<decltype(sample_field), 9>(sample_field, sample_rhs);
     }
+    void sample_compute_fields(const particles_field_set<float>& sample_fields,
+                               real_number sample_rhs[]) final {
+        sample_compute_set(sample_fields, sample_rhs);
+    }
+    void sample_compute_fields(const particles_field_set<double>& sample_fields,
+                               real_number sample_rhs[]) final {
+        sample_compute_set(sample_fields, sample_rhs);
+    }
     //- Not generic to enable sampling end
 
+    template <class sample_rnumber>
+    void sample_compute_set(const particles_field_set<sample_rnumber>& sample_fields,
+                            real_number sample_rhs[]) {
+        TIMEZONE("particles_system::sample_compute_set");
+        static_assert(particles_field_set<sample_rnumber>::MaxNbValues == 18, "update the cases below");
+        const int nb_values = sample_fields.get_nb_values();
+        assert(0 < nb_values && nb_values <= particles_field_set<sample_rnumber>::MaxNbValues);
+        // Only multiples of 3 values are instantiated, the extra values are zero
+        const int nb_padded_values = ((nb_values+2)/3)*3;
+        real_number* padded_rhs = sample_rhs;
+        if(nb_padded_values != nb_values){
+            sample_buffer.resize(size_t(my_nb_particles)*nb_padded_values);
+            padded_rhs = sample_buffer.data();
+        }
+        std::fill_n(padded_rhs, size_t(my_nb_particles)*nb_padded_values, real_number(0));
+
+        switch(nb_padded_values){
+        case 3:
+            sample_compute<decltype(sample_fields), 3>(sample_fields, padded_rhs);
+            break;
+        case 6:
+            sample_compute<decltype(sample_fields), 6>(sample_fields, padded_rhs);
+            break;
+        case 9:
+            sample_compute<decltype(sample_fields), 9>(sample_fields, padded_rhs);
+            break;
+        case 12:
+            sample_compute<decltype(sample_fields), 12>(sample_fields, padded_rhs);
+            break;
+        case 15:
+            sample_compute<decltype(sample_fields), 15>(sample_fields, padded_rhs);
+            break;
+        case 18:
+            sample_compute<decltype(sample_fields), 18>(sample_fields, padded_rhs);
+            break;
+        default:
+            assert(0);
+        }
+
+        if(nb_padded_values != nb_values){
+            for(partsize_t idx_part = 0 ; idx_part < my_nb_particles ; ++idx_part){
+                std::copy(&padded_rhs[idx_part*nb_padded_values], &padded_rhs[idx_part*nb_padded_values + nb_values],
+                          &sample_rhs[idx_part*nb_values]);
+            }
+        }
+    }
+
     void move(const real_number dt) final {
         TIMEZONE("particles_system::move");
         positions_updater.move_particles(my_particles_positions.get(), my_nb_particles,
@@ -186,6 +375,35 @@ public:
                               &my_particles_positions,
                               my_particles_rhs.data(), int(my_particles_rhs.size()),
                               &my_particles_positions_indexes);
+        if(cell_order){
+            sort_particles_by_cell();
+        }
+    }
+
+    // Same as move then redistribute, where the particles are classified
+    // per partition or destination process during the move. The last rhs
+    // is not moved with the particles since shift_rhs_vectors resets it.
+    void move_and_redistribute(const real_number dt){
+        TIMEZONE("particles_system::move_and_redistribute");
+        const int nb_threads = omp_get_max_threads();
+        particles_distr.prepare_binning(my_nb_particles, nb_threads);
+        positions_updater.move_particles(my_particles_positions.get(), my_nb_particles,
+                                my_particles_rhs.data(), std::min(step_idx,int(my_particles_rhs.size())),
+                                dt, nb_threads,
+                                [&](const int idx_thread, const partsize_t idx_part, const real_number position[]){
+            particles_distr.bin_particle(computer, idx_thread, idx_part, position);
+        });
+        particles_distr.template redistribute_binned<computer_class, 3, size_particle_rhs, 1>(
+                              computer,
+                              current_my_nb_particles_per_partition.get(),
+                              &my_nb_particles,
+                              &my_particles_positions,
+                              my_particles_rhs.data(), int(my_particles_rhs.size()),
+                              std::max(int(my_particles_rhs.size())-1, 0),
+                              &my_particles_positions_indexes);
+        if(cell_order){
+            sort_particles_by_cell();
+        }
     }
 
     void inc_step_idx() final {
@@ -210,8 +428,7 @@ public:
     void completeLoop(const real_number dt) final {
         TIMEZONE("particles_system::completeLoop");
         compute();
-        move(dt);
-        redistribute();
+        move_and_redistribute(dt);
         inc_step_idx();
         shift_rhs_vectors();
     }
@@ -119,7 +119,9 @@ struct particles_system_build_container {
              const std::string& fname_input, // particles input filename
             const std::string& inDatanameState, const std::string& inDatanameRhs, // input dataset names
              MPI_Comm mpi_comm,
-            const int in_current_iteration){
+            const int in_current_iteration,
+            const bool in_cell_order,
+            const particles_exchange_mode in_exchange_mode){
 
         // The size of the field grid (global size) all_size seems
         std::array<size_t,3> field_grid_dim;
@@ -207,7 +209,9 @@ struct particles_system_build_container {
                                                (*fs_field),
                                                mpi_comm,
                                                nparticles,
-                                               in_current_iteration);
+                                               in_current_iteration,
+                                               in_cell_order,
+                                               in_exchange_mode);
 
         // Load particles from hdf5
         particles_input_hdf5<partsize_t, particles_rnumber, 3,3> generator(mpi_comm, fname_input,
@@ -246,14 +250,16 @@ inline std::unique_ptr<abstract_particles_system<partsize_t, particles_rnumber>>
         const int interpolation_size,
         const int spline_mode,
         MPI_Comm mpi_comm,
-        const int in_current_iteration){
+        const int in_current_iteration,
+        const bool in_cell_order = false,
+        const particles_exchange_mode in_exchange_mode = PARTICLES_EXCHANGE_AUTO){
     return Template_double_for_if::evaluate<std::unique_ptr<abstract_particles_system<partsize_t, particles_rnumber>>,
                        int, 1, 11, 1, // interpolation_size
                        int, 0, 3, 1, // spline_mode
                        particles_system_build_container<partsize_t, field_rnumber,be,fc,particles_rnumber>>(
                            interpolation_size, // template iterator 1
                            spline_mode, // template iterator 2
-                           fs_field,fs_kk, nsteps, nparticles, fname_input, inDatanameState, inDatanameRhs, mpi_comm, in_current_iteration);
+                           fs_field,fs_kk, nsteps, nparticles, fname_input, inDatanameState, inDatanameRhs, mpi_comm, in_current_iteration, in_cell_order, in_exchange_mode);
 }
 
 
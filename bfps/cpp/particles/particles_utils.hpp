@@ -8,6 +8,7 @@
 #include <vector>
 #include <memory>
 #include <cstring>
+#include <omp.h>
 
 #if _OPENMP < 201511
 #warning Openmp priority is not supported here
@@ -178,6 +179,85 @@ inline std::pair<std::vector<partsize_t>,std::vector<partsize_t>> partition_extr
 }
 
 
+/** Stable counting sort of items by bin, in two parallel passes.
+ *  On return new_position[idx] is the position of item idx once the items
+ *  are sorted by bin, and the returned vector holds the number of items per
+ *  bin. Use permute to apply the result to the arrays of values.
+ */
+template <class partsize_t>
+inline std::vector<partsize_t> bin_permutation(const int bin_per_item[], const partsize_t nb_items,
+                                               const int nb_bins, partsize_t new_position[]){
+    const int nb_threads = omp_get_max_threads();
+    // count_per_thread[idx_thread*nb_bins + idx_bin], later the offsets
+    std::vector<partsize_t> count_per_thread(size_t(nb_threads)*size_t(nb_bins), 0);
+    std::vector<partsize_t> nb_items_per_bin(nb_bins, 0);
+
+    #pragma omp parallel num_threads(nb_threads)
+    {
+        const int idx_thread = omp_get_thread_num();
+        const partsize_t first = partsize_t((double(nb_items)*idx_thread)/nb_threads);
+        const partsize_t last = (idx_thread == nb_threads-1 ? nb_items : partsize_t((double(nb_items)*(idx_thread+1))/nb_threads));
+        partsize_t* my_count = &count_per_thread[size_t(idx_thread)*size_t(nb_bins)];
+
+        for(partsize_t idx_item = first ; idx_item < last ; ++idx_item){
+            assert(0 <= bin_per_item[idx_item] && bin_per_item[idx_item] < nb_bins);
+            my_count[bin_per_item[idx_item]] += 1;
+        }
+        #pragma omp barrier
+
+        #pragma omp single
+        {
+            partsize_t offset = 0;
+            for(int idx_bin = 0 ; idx_bin < nb_bins ; ++idx_bin){
+                for(int idx_other = 0 ; idx_other < nb_threads ; ++idx_other){
+                    const partsize_t count = count_per_thread[size_t(idx_other)*size_t(nb_bins) + idx_bin];
+                    count_per_thread[size_t(idx_other)*size_t(nb_bins) + idx_bin] = offset;
+                    offset += count;
+                    nb_items_per_bin[idx_bin] += count;
+                }
+            }
+            assert(offset == nb_items);
+        }
+
+        for(partsize_t idx_item = first ; idx_item < last ; ++idx_item){
+            new_position[idx_item] = my_count[bin_per_item[idx_item]]++;
+        }
+    }
+
+    return nb_items_per_bin;
+}
+
+/** Morton (Z-order) code of a 3D cell, from the 21 lower bits of each
+ *  index, x being the fastest varying dimension.
+ */
+inline unsigned long long morton_code_3d(const int idx_x, const int idx_y, const int idx_z){
+    auto spread_bits = [](const unsigned long long in_value) -> unsigned long long {
+        unsigned long long value = in_value & 0x1fffffULL;
+        value = (value | (value << 32)) & 0x1f00000000ffffULL;
+        value = (value | (value << 16)) & 0x1f0000ff0000ffULL;
+        value = (value | (value << 8))  & 0x100f00f00f00f00fULL;
+        value = (value | (value << 4))  & 0x10c30c30c30c30c3ULL;
+        value = (value | (value << 2))  & 0x1249249249249249ULL;
+        return value;
+    };
+    return spread_bits((unsigned long long)(idx_x))
+            | (spread_bits((unsigned long long)(idx_y)) << 1)
+            | (spread_bits((unsigned long long)(idx_z)) << 2);
+}
+
+/** dest[new_position[idx]] = source[idx], for items of nb_values values. */
+template <class partsize_t, class ItemType>
+inline void permute(const partsize_t new_position[], const partsize_t nb_items,
+                    const ItemType source[], ItemType dest[], const int nb_values = 1){
+    #pragma omp parallel for schedule(static)
+    for(partsize_t idx_item = 0 ; idx_item < nb_items ; ++idx_item){
+        for(int idx_val = 0 ; idx_val < nb_values ; ++idx_val){
+            dest[new_position[idx_item]*nb_values + idx_val] = source[idx_item*nb_values + idx_val];
+        }
+    }
+}
+
+
 template <class NumType = int>
 class IntervalSplitter {
     const NumType nb_items;
@@ -0,0 +1,441 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include "base.hpp"
+#include "pencil_fft.hpp"
+#include "scope_timer.hpp"
+
+int pencil_process_rows = 0;
+
+/* split n points into nblocks contiguous blocks, with sizes that differ by
+ * at most one */
+static void get_blocks(
+        const ptrdiff_t n,
+        const int nblocks,
+        std::vector<ptrdiff_t> &start,
+        std::vector<ptrdiff_t> &size)
+{
+    start.resize(nblocks);
+    size.resize(nblocks);
+    for (int b = 0; b < nblocks; b++)
+    {
+        size[b] = n / nblocks + ((b < n % nblocks) ? 1 : 0);
+        start[b] = b*(n / nblocks) + std::min(ptrdiff_t(b), n % nblocks);
+    }
+}
+
+/* exclusive prefix sum of the message sizes */
+static void get_displacements(
+        const std::vector<int> &counts,
+        std::vector<int> &displs)
+{
+    displs.resize(counts.size());
+    int offset = 0;
+    for (unsigned int i = 0; i < counts.size(); i++)
+    {
+        displs[i] = offset;
+        offset += counts[i];
+    }
+}
+
+pencil_decomposition::pencil_decomposition(
+        const int NX,
+        const int NY,
+        const int NZ,
+        const MPI_Comm COMM_TO_USE)
+{
+    TIMEZONE("pencil_decomposition::pencil_decomposition");
+    this->nx = NX;
+    this->ny = NY;
+    this->nz = NZ;
+    this->comm = COMM_TO_USE;
+    int myrank, nprocs;
+    MPI_Comm_rank(this->comm, &myrank);
+    MPI_Comm_size(this->comm, &nprocs);
+
+    /* rows split z and ky, columns split y and kx */
+    const int max_rows = std::min(this->ny, this->nz);
+    const int max_cols = std::min(this->ny, this->nx/2+1);
+    if (pencil_process_rows > 0)
+        this->nrows = pencil_process_rows;
+    else
+    {
+        /* the most square grid, with more rows than columns for ties */
+        this->nrows = 0;
+        for (int rows = 1; rows <= nprocs; rows++)
+        {
+            if (nprocs % rows != 0 ||
+                rows > max_rows ||
+                nprocs / rows > max_cols)
+                continue;
+            if (this->nrows == 0 ||
+                rows + nprocs / rows <= this->nrows + nprocs / this->nrows)
+                this->nrows = rows;
+        }
+    }
+    assert(this->nrows > 0 && nprocs % this->nrows == 0);
+    this->ncols = nprocs / this->nrows;
+    assert(this->nrows <= max_rows);
+    assert(this->ncols <= max_cols);
+    this->row = myrank / this->ncols;
+    this->col = myrank % this->ncols;
+    MPI_Comm_split(this->comm, this->row, this->col, &this->row_comm);
+    MPI_Comm_split(this->comm, this->col, this->row, &this->col_comm);
+
+    get_blocks(this->nz, this->nrows, this->z_start, this->z_size);
+    get_blocks(this->ny, this->nrows, this->ky_start, this->ky_size);
+    get_blocks(this->ny, this->ncols, this->y_start, this->y_size);
+    get_blocks(this->nx/2+1, this->ncols, this->kx_start, this->kx_size);
+
+    /* the same padding is used by all processes, large enough for the
+     * largest Fourier space block relative to its real space block */
+    ptrdiff_t line_size = this->nx/2+1;
+    for (int rr = 0; rr < this->nrows; rr++)
+        for (int cc = 0; cc < this->ncols; cc++)
+        {
+            const ptrdiff_t nlines = this->z_size[rr]*this->y_size[cc];
+            const ptrdiff_t cpoints = this->ky_size[rr]*this->nz*this->kx_size[cc];
+            line_size = std::max(line_size, (cpoints + nlines - 1) / nlines);
+        }
+    this->padded_nx = 2*line_size;
+}
+
+pencil_decomposition::~pencil_decomposition()
+{
+    MPI_Comm_free(&this->row_comm);
+    MPI_Comm_free(&this->col_comm);
+}
+
+template <typename rnumber>
+typename fftw_interface<rnumber>::complex *pencil_fft<rnumber>::buffer0 = nullptr;
+
+template <typename rnumber>
+typename fftw_interface<rnumber>::complex *pencil_fft<rnumber>::buffer1 = nullptr;
+
+template <typename rnumber>
+ptrdiff_t pencil_fft<rnumber>::buffer_size = 0;
+
+template <typename rnumber>
+int pencil_fft<rnumber>::users = 0;
+
+template <typename rnumber>
+pencil_fft<rnumber>::pencil_fft(
+        const pencil_decomposition *DECOMPOSITION,
+        const ptrdiff_t HOWMANY,
+        rnumber *DATA,
+        const unsigned FFTW_PLAN_RIGOR):
+    decomposition(DECOMPOSITION),
+    howmany(HOWMANY),
+    data(DATA)
+{
+    TIMEZONE("pencil_fft::pencil_fft");
+    const pencil_decomposition *dd = this->decomposition;
+    const ptrdiff_t hh = this->howmany;
+    const ptrdiff_t nxc = dd->nx/2+1;
+    const ptrdiff_t zl = dd->z_size[dd->row];
+    const ptrdiff_t yl = dd->y_size[dd->col];
+    const ptrdiff_t kyl = dd->ky_size[dd->row];
+    const ptrdiff_t kxl = dd->kx_size[dd->col];
+
+    /* all the pieces of the local arrays are exchanged at every transpose */
+    const ptrdiff_t scratch_size = std::max(
+            zl*yl*nxc,
+            std::max(dd->ny*zl*kxl, kyl*dd->nz*kxl))*hh;
+    assert(scratch_size < INT_MAX);
+    this->xpencil_counts.resize(dd->ncols);
+    this->ypencil_row_counts.resize(dd->ncols);
+    for (int qq = 0; qq < dd->ncols; qq++)
+    {
+        this->xpencil_counts[qq] = int(zl*yl*dd->kx_size[qq]*hh);
+        this->ypencil_row_counts[qq] = int(dd->y_size[qq]*zl*kxl*hh);
+    }
+    this->ypencil_col_counts.resize(dd->nrows);
+    this->zpencil_counts.resize(dd->nrows);
+    for (int qq = 0; qq < dd->nrows; qq++)
+    {
+        this->ypencil_col_counts[qq] = int(dd->ky_size[qq]*zl*kxl*hh);
+        this->zpencil_counts[qq] = int(kyl*dd->z_size[qq]*kxl*hh);
+    }
+    get_displacements(this->xpencil_counts, this->xpencil_displs);
+    get_displacements(this->ypencil_row_counts, this->ypencil_row_displs);
+    get_displacements(this->ypencil_col_counts, this->ypencil_col_displs);
+    get_displacements(this->zpencil_counts, this->zpencil_displs);
+
+    if (scratch_size > buffer_size)
+    {
+        if (buffer0 != nullptr)
+        {
+            fftw_interface<rnumber>::free(buffer0);
+            fftw_interface<rnumber>::free(buffer1);
+        }
+        buffer0 = fftw_interface<rnumber>::alloc_complex(scratch_size);
+        buffer1 = fftw_interface<rnumber>::alloc_complex(scratch_size);
+        buffer_size = scratch_size;
+    }
+    users++;
+
+    typename fftw_interface<rnumber>::iodim dims[1], howmany_dims[2];
+    complex *cdata = (complex*)this->data;
+
+    /* x: real lines of [z][y][x] */
+    dims[0].n = dd->nx;
+    dims[0].is = int(hh);
+    dims[0].os = int(hh);
+    howmany_dims[0].n = int(zl*yl);
+    howmany_dims[0].is = int(dd->padded_nx*hh);
+    howmany_dims[0].os = int((dd->padded_nx/2)*hh);
+    howmany_dims[1].n = int(hh);
+    howmany_dims[1].is = 1;
+    howmany_dims[1].os = 1;
+    this->x_r2c_plan = fftw_interface<rnumber>::plan_guru_dft_r2c(
+            1, dims, 2, howmany_dims,
+            this->data, cdata,
+            FFTW_PLAN_RIGOR);
+    std::swap(howmany_dims[0].is, howmany_dims[0].os);
+    this->x_c2r_plan = fftw_interface<rnumber>::plan_guru_dft_c2r(
+            1, dims, 2, howmany_dims,
+            cdata, this->data,
+            FFTW_PLAN_RIGOR);
+
+    /* y: scratch array [y][z][kx] */
+    dims[0].n = dd->ny;
+    dims[0].is = int(zl*kxl*hh);
+    dims[0].os = int(zl*kxl*hh);
+    howmany_dims[0].n = int(zl*kxl*hh);
+    howmany_dims[0].is = 1;
+    howmany_dims[0].os = 1;
+    this->y_forward_plan = fftw_interface<rnumber>::plan_guru_dft(
+            1, dims, 1, howmany_dims,
+            buffer1, buffer1,
+            FFTW_FORWARD, FFTW_PLAN_RIGOR);
+    this->y_backward_plan = fftw_interface<rnumber>::plan_guru_dft(
+            1, dims, 1, howmany_dims,
+            buffer1, buffer1,
+            FFTW_BACKWARD, FFTW_PLAN_RIGOR);
+
+    /* z: Fourier space array [ky][kz][kx] */
+    dims[0].n = dd->nz;
+    dims[0].is = int(kxl*hh);
+    dims[0].os = int(kxl*hh);
+    howmany_dims[0].n = int(kyl);
+    howmany_dims[0].is = int(dd->nz*kxl*hh);
+    howmany_dims[0].os = int(dd->nz*kxl*hh);
+    howmany_dims[1].n = int(kxl*hh);
+    howmany_dims[1].is = 1;
+    howmany_dims[1].os = 1;
+    this->z_forward_plan = fftw_interface<rnumber>::plan_guru_dft(
+            1, dims, 2, howmany_dims,
+            cdata, cdata,
+            FFTW_FORWARD, FFTW_PLAN_RIGOR);
+    this->z_backward_plan = fftw_interface<rnumber>::plan_guru_dft(
+            1, dims, 2, howmany_dims,
+            cdata, cdata,
+            FFTW_BACKWARD, FFTW_PLAN_RIGOR);
+}
+
+template <typename rnumber>
+pencil_fft<rnumber>::~pencil_fft()
+{
+    fftw_interface<rnumber>::destroy_plan(this->x_r2c_plan);
+    fftw_interface<rnumber>::destroy_plan(this->x_c2r_plan);
+    fftw_interface<rnumber>::destroy_plan(this->y_forward_plan);
+    fftw_interface<rnumber>::destroy_plan(this->y_backward_plan);
+    fftw_interface<rnumber>::destroy_plan(this->z_forward_plan);
+    fftw_interface<rnumber>::destroy_plan(this->z_backward_plan);
+    users--;
+    if (users == 0)
+    {
+        fftw_interface<rnumber>::free(buffer0);
+        fftw_interface<rnumber>::free(buffer1);
+        buffer0 = nullptr;
+        buffer1 = nullptr;
+        buffer_size = 0;
+    }
+}
+
+template <typename rnumber>
+void pencil_fft<rnumber>::r2c()
+{
+    TIMEZONE("pencil_fft::r2c");
+    const pencil_decomposition *dd = this->decomposition;
+    const ptrdiff_t hh = this->howmany;
+    const ptrdiff_t zl = dd->z_size[dd->row];
+    const ptrdiff_t yl = dd->y_size[dd->col];
+    const ptrdiff_t kyl = dd->ky_size[dd->row];
+    const ptrdiff_t kxl = dd->kx_size[dd->col];
+    const ptrdiff_t line_size = dd->padded_nx/2;
+
+    fftw_interface<rnumber>::execute(this->x_r2c_plan);
+
+    /* [z][y][kx] -> one [y][z][kx] block per column */
+    for (int qq = 0; qq < dd->ncols; qq++)
+    {
+        const ptrdiff_t nvalues = 2*dd->kx_size[qq]*hh;
+        rnumber *dst = (rnumber*)(buffer0 + this->xpencil_displs[qq]);
+        #pragma omp parallel for schedule(static)
+        for (ptrdiff_t yz = 0; yz < yl*zl; yz++)
+        {
+            const ptrdiff_t yy = yz / zl;
+            const ptrdiff_t zz = yz % zl;
+            const rnumber *src = this->data + 2*((zz*yl + yy)*line_size + dd->kx_start[qq])*hh;
+            std::copy(src, src + nvalues, dst + yz*nvalues);
+        }
+    }
+    {
+        TIMEZONE("pencil_fft::r2c::row_transpose");
+        MPI_Alltoallv(
+                buffer0,
+                &this->xpencil_counts.front(),
+                &this->xpencil_displs.front(),
+                mpi_real_type<rnumber>::complex(),
+                buffer1,
+                &this->ypencil_row_counts.front(),
+                &this->ypencil_row_displs.front(),
+                mpi_real_type<rnumber>::complex(),
+                dd->row_comm);
+    }
+
+    fftw_interface<rnumber>::execute_dft(this->y_forward_plan, buffer1, buffer1);
+
+    /* the ky blocks of [ky][z][kx] are contiguous */
+    {
+        TIMEZONE("pencil_fft::r2c::column_transpose");
+        MPI_Alltoallv(
+                buffer1,
+                &this->ypencil_col_counts.front(),
+                &this->ypencil_col_displs.front(),
+                mpi_real_type<rnumber>::complex(),
+                buffer0,
+                &this->zpencil_counts.front(),
+                &this->zpencil_displs.front(),
+                mpi_real_type<rnumber>::complex(),
+                dd->col_comm);
+    }
+    /* one [ky][z][kx] block per row -> [ky][kz][kx] */
+    for (int qq = 0; qq < dd->nrows; qq++)
+    {
+        const ptrdiff_t nvalues = 2*kxl*hh;
+        const ptrdiff_t zq = dd->z_size[qq];
+        const rnumber *src = (rnumber*)(buffer0 + this->zpencil_displs[qq]);
+        #pragma omp parallel for schedule(static)
+        for (ptrdiff_t yz = 0; yz < kyl*zq; yz++)
+        {
+            const ptrdiff_t yy = yz / zq;
+            const ptrdiff_t zz = yz % zq;
+            std::copy(src + yz*nvalues,
+                      src + (yz+1)*nvalues,
+                      this->data + (yy*dd->nz + dd->z_start[qq] + zz)*nvalues);
+        }
+    }
+
+    fftw_interface<rnumber>::execute(this->z_forward_plan);
+}
+
+template <typename rnumber>
+void pencil_fft<rnumber>::c2r()
+{
+    TIMEZONE("pencil_fft::c2r");
+    const pencil_decomposition *dd = this->decomposition;
+    const ptrdiff_t hh = this->howmany;
+    const ptrdiff_t zl = dd->z_size[dd->row];
+    const ptrdiff_t yl = dd->y_size[dd->col];
+    const ptrdiff_t kyl = dd->ky_size[dd->row];
+    const ptrdiff_t kxl = dd->kx_size[dd->col];
+    const ptrdiff_t line_size = dd->padded_nx/2;
+
+    fftw_interface<rnumber>::execute(this->z_backward_plan);
+
+    /* [ky][kz][kx] -> one [ky][z][kx] block per row */
+    for (int qq = 0; qq < dd->nrows; qq++)
+    {
+        const ptrdiff_t nvalues = 2*kxl*hh;
+        const ptrdiff_t zq = dd->z_size[qq];
+        rnumber *dst = (rnumber*)(buffer0 + this->zpencil_displs[qq]);
+        #pragma omp parallel for schedule(static)
+        for (ptrdiff_t yz = 0; yz < kyl*zq; yz++)
+        {
+            const ptrdiff_t yy = yz / zq;
+            const ptrdiff_t zz = yz % zq;
+            const rnumber *src = this->data + (yy*dd->nz + dd->z_start[qq] + zz)*nvalues;
+            std::copy(src, src + nvalues, dst + yz*nvalues);
+        }
+    }
+    {
+        TIMEZONE("pencil_fft::c2r::column_transpose");
+        MPI_Alltoallv(
+                buffer0,
+                &this->zpencil_counts.front(),
+                &this->zpencil_displs.front(),
+                mpi_real_type<rnumber>::complex(),
+                buffer1,
+                &this->ypencil_col_counts.front(),
+                &this->ypencil_col_displs.front(),
+                mpi_real_type<rnumber>::complex(),
+                dd->col_comm);
+    }
+
+    fftw_interface<rnumber>::execute_dft(this->y_backward_plan, buffer1, buffer1);
+
+    /* the y blocks of [y][z][kx] are contiguous */
+    {
+        TIMEZONE("pencil_fft::c2r::row_transpose");
+        MPI_Alltoallv(
+                buffer1,
+                &this->ypencil_row_counts.front(),
+                &this->ypencil_row_displs.front(),
+                mpi_real_type<rnumber>::complex(),
+                buffer0,
+                &this->xpencil_counts.front(),
+                &this->xpencil_displs.front(),
+                mpi_real_type<rnumber>::complex(),
+                dd->row_comm);
+    }
+    /* one [y][z][kx] block per column -> [z][y][kx] */
+    for (int qq = 0; qq < dd->ncols; qq++)
+    {
+        const ptrdiff_t nvalues = 2*dd->kx_size[qq]*hh;
+        const rnumber *src = (rnumber*)(buffer0 + this->xpencil_displs[qq]);
+        #pragma omp parallel for schedule(static)
+        for (ptrdiff_t yz = 0; yz < yl*zl; yz++)
+        {
+            const ptrdiff_t yy = yz / zl;
+            const ptrdiff_t zz = yz % zl;
+            std::copy(src + yz*nvalues,
+                      src + (yz+1)*nvalues,
+                      this->data + 2*((zz*yl + yy)*line_size + dd->kx_start[qq])*hh);
+        }
+    }
+
+    fftw_interface<rnumber>::execute(this->x_c2r_plan);
+}
+
+template class pencil_fft<float>;
+template class pencil_fft<double>;
+
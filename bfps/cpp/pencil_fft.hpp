@@ -0,0 +1,131 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#include <mpi.h>
+#include <vector>
+#include "fftw_interface.hpp"
+
+#ifndef PENCIL_FFT_HPP
+
+#define PENCIL_FFT_HPP
+
+/* number of rows of the process grid of new pencil decompositions,
+ * 0 lets `pencil_decomposition` choose the grid */
+extern int pencil_process_rows;
+
+/** \class pencil_decomposition
+ *  \brief Distribution of a 3D grid over a 2D grid of processes.
+ *
+ *  Process `row*ncols + col` of `comm` holds:
+ *   - in real space, the [z][y][x] block with the z range of its row and
+ *     the y range of its column; x lines are complete, and padded to
+ *     `padded_nx` real numbers.
+ *   - in Fourier space, the [ky][kz][kx] block with the ky range of its
+ *     row and the kx range of its column; kz lines are complete.
+ *
+ *  The x padding is chosen so that the real space array is large enough
+ *  to also hold the Fourier space representation.
+ *  With a single column this is the slab decomposition of the FFTW
+ *  backend; in general the number of processes can go up to
+ *  min(ny, nz)*min(ny, nx/2+1), instead of nz.
+ */
+class pencil_decomposition
+{
+    public:
+        int nx, ny, nz;
+        int nrows, ncols;
+        int row, col;
+        MPI_Comm comm;
+        MPI_Comm row_comm; /**< processes of the same row, ranked by column. */
+        MPI_Comm col_comm; /**< processes of the same column, ranked by row. */
+
+        /* ranges of the distributed directions, indexed by row */
+        std::vector<ptrdiff_t> z_start, z_size, ky_start, ky_size;
+        /* ranges of the distributed directions, indexed by column */
+        std::vector<ptrdiff_t> y_start, y_size, kx_start, kx_size;
+
+        ptrdiff_t padded_nx;
+
+        pencil_decomposition(
+                const int NX,
+                const int NY,
+                const int NZ,
+                const MPI_Comm COMM_TO_USE);
+        ~pencil_decomposition();
+};
+
+/** \class pencil_fft
+ *  \brief In-place 3D FFTs of `howmany` interleaved fields on a pencil
+ *  decomposition.
+ *
+ *  The transforms are computed one direction at a time with serial FFTW
+ *  plans, and the data is redistributed in between with all-to-all
+ *  exchanges inside the rows (y <-> kx) and inside the columns
+ *  (z <-> ky) of the process grid.
+ *  The exchanges go through two scratch arrays that are shared by all the
+ *  transforms of the same precision, so that their memory is only needed
+ *  once.
+ *  Like FFTW, the transforms are not normalized.
+ */
+template <typename rnumber>
+class pencil_fft
+{
+    private:
+        typedef typename fftw_interface<rnumber>::complex complex;
+
+        const pencil_decomposition *decomposition;
+        const ptrdiff_t howmany;
+        rnumber *data;
+
+        typename fftw_interface<rnumber>::plan x_r2c_plan, x_c2r_plan;
+        typename fftw_interface<rnumber>::plan y_forward_plan, y_backward_plan;
+        typename fftw_interface<rnumber>::plan z_forward_plan, z_backward_plan;
+
+        /* message sizes and offsets of the exchanges, in complex numbers */
+        std::vector<int> xpencil_counts, xpencil_displs;         /**< x lines, inside rows. */
+        std::vector<int> ypencil_row_counts, ypencil_row_displs; /**< y lines, inside rows. */
+        std::vector<int> ypencil_col_counts, ypencil_col_displs; /**< y lines, inside columns. */
+        std::vector<int> zpencil_counts, zpencil_displs;         /**< z lines, inside columns. */
+
+        static complex *buffer0, *buffer1;
+        static ptrdiff_t buffer_size;
+        static int users;
+
+    public:
+        pencil_fft(
+                const pencil_decomposition *DECOMPOSITION,
+                const ptrdiff_t HOWMANY,
+                rnumber *DATA,
+                const unsigned FFTW_PLAN_RIGOR);
+        ~pencil_fft();
+
+        void r2c();
+        void c2r();
+};
+
+#endif//PENCIL_FFT_HPP
+
@@ -0,0 +1,138 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+
+#ifndef QUANTILE_SKETCH_HPP
+
+#define QUANTILE_SKETCH_HPP
+
+/** \class quantile_sketch
+ *  \brief Mergeable estimate of the quantiles of a distribution.
+ *
+ *  Values are counted in buckets whose widths grow geometrically with the
+ *  magnitude of the value, so any quantile is recovered with a relative error
+ *  of at most `relative_accuracy`, whatever the range of the values.
+ *  Magnitudes below `min_magnitude` are counted as zero, magnitudes above
+ *  `max_magnitude` in the last bucket.
+ *
+ *  The sketch itself only describes the buckets; the counts live in a plain
+ *  `ptrdiff_t` array with the same layout as the histograms, i.e.
+ *  `counts[bucket*nvals + i]` for value `i`. Partial counts (threads, MPI
+ *  processes) are merged by adding them, so a `shared_array` and `MPI_SUM`
+ *  are all that is needed.
+ */
+
+class quantile_sketch
+{
+    private:
+        double log_gamma;
+        double inverse_log_gamma;
+        double bucket_value_factor;
+        int nmagnitudes;
+
+    public:
+        const double relative_accuracy;
+        const double min_magnitude;
+        const double max_magnitude;
+
+        quantile_sketch(
+                const double RELATIVE_ACCURACY = 1e-2,
+                const double MIN_MAGNITUDE = 1e-12,
+                const double MAX_MAGNITUDE = 1e12):
+            relative_accuracy(RELATIVE_ACCURACY),
+            min_magnitude(MIN_MAGNITUDE),
+            max_magnitude(MAX_MAGNITUDE)
+        {
+            const double gamma = (1 + RELATIVE_ACCURACY) / (1 - RELATIVE_ACCURACY);
+            this->log_gamma = std::log(gamma);
+            this->inverse_log_gamma = 1 / this->log_gamma;
+            this->bucket_value_factor = 2 / (1 + gamma);
+            this->nmagnitudes = int(std::ceil(
+                        std::log(MAX_MAGNITUDE / MIN_MAGNITUDE) *
+                        this->inverse_log_gamma));
+        }
+
+        /* negative values, zero, positive values */
+        inline int get_nbuckets() const
+        {
+            return 2*this->nmagnitudes + 1;
+        }
+
+        /* buckets are sorted by value */
+        inline int get_bucket(const double value) const
+        {
+            const double magnitude = std::abs(value);
+            if (!(magnitude >= this->min_magnitude))
+                return this->nmagnitudes;
+            int k = int(std::ceil(
+                        std::log(magnitude / this->min_magnitude) *
+                        this->inverse_log_gamma));
+            k = std::min(std::max(k, 1), this->nmagnitudes);
+            return (value > 0) ? this->nmagnitudes + k : this->nmagnitudes - k;
+        }
+
+        /* value within `relative_accuracy` of any value counted in `bucket` */
+        inline double get_bucket_value(const int bucket) const
+        {
+            const int k = bucket - this->nmagnitudes;
+            if (k == 0)
+                return 0.0;
+            const double magnitude = (this->min_magnitude *
+                                      std::exp(std::abs(k)*this->log_gamma) *
+                                      this->bucket_value_factor);
+            return (k > 0) ? magnitude : -magnitude;
+        }
+
+        /* quantile of value `i` out of `nvals`, for merged counts */
+        double get_quantile(
+                const ptrdiff_t *counts,
+                const int nvals,
+                const int i,
+                const double level) const
+        {
+            const int nbuckets = this->get_nbuckets();
+            ptrdiff_t total = 0;
+            for (int bucket = 0; bucket < nbuckets; bucket++)
+                total += counts[bucket*nvals + i];
+            if (total == 0)
+                return std::nan("");
+            const double rank = std::min(std::max(level, 0.0), 1.0) * (total - 1);
+            ptrdiff_t cumulative = 0;
+            for (int bucket = 0; bucket < nbuckets; bucket++)
+            {
+                cumulative += counts[bucket*nvals + i];
+                if (cumulative > rank)
+                    return this->get_bucket_value(bucket);
+            }
+            return this->get_bucket_value(nbuckets-1);
+        }
+};
+
+#endif//QUANTILE_SKETCH_HPP
+
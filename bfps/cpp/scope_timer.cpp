@@ -6,3 +6,9 @@
 #ifdef USE_TIMINGOUTPUT
 EventManager global_timer_manager("BFPS", std::cout);
 #endif
+
+thread_local EventTracer::ThreadBuffer* EventTracer::t_threadBuffer = nullptr;
+
+#ifdef USE_TRACEOUTPUT
+EventTracer global_event_tracer;
+#endif
@@ -40,6 +40,8 @@
 #include <omp.h>
 #include <iomanip>
 #include <fstream>
+#include <chrono>
+#include <cstdlib>
 
 #include "base.hpp"
 #include "bfps_timer.hpp"
@@ -782,24 +784,206 @@ public:
 
 #define ScopeEventMultiRefKey std::string("-- multiref event --")
 
-#ifdef USE_TIMINGOUTPUT
+///////////////////////////////////////////////////////////////
 
-extern EventManager global_timer_manager;
+/** Records the start and end of every traced scope, to export them as
+ * a timeline in the Chrome trace format (readable by chrome://tracing
+ * and Perfetto).
+ * Each thread writes into its own ring buffer, without locks; when a
+ * buffer is full the oldest records are overwritten.
+ * The names are interned once per call site, and records only hold
+ * the interned id.
+ * write must be called outside of parallel regions.
+ */
+class EventTracer {
+    struct TraceRecord {
+      int m_eventId;
+      double m_start;
+      double m_end;
+    };
+
+    struct ThreadBuffer {
+      int m_threadId;
+      std::vector<TraceRecord> m_records;
+      //< Total number of records, the next one goes at m_nbWritten % capacity
+      size_t m_nbWritten;
+    };
+
+    //< Interned names, the id is the position
+    std::vector<std::string> m_names;
+    omp_lock_t m_namesLock;
+
+    //< One buffer per thread that has recorded something
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    omp_lock_t m_buffersLock;
+
+    //< Number of records kept per thread
+    const size_t m_capacity;
+
+    static thread_local ThreadBuffer* t_threadBuffer;
+
+    ThreadBuffer* registerThread() {
+      omp_set_lock(&m_buffersLock);
+      m_buffers.emplace_back(new ThreadBuffer);
+      ThreadBuffer* buffer = m_buffers.back().get();
+      buffer->m_threadId = int(m_buffers.size()) - 1;
+      buffer->m_records.resize(m_capacity);
+      buffer->m_nbWritten = 0;
+      omp_unset_lock(&m_buffersLock);
+      t_threadBuffer = buffer;
+      return buffer;
+    }
+
+    static void writeEscaped(std::ostream& inStream, const std::string& inString) {
+      for (const char character : inString) {
+        if (character == '"' || character == '\\') {
+          inStream << '\\';
+        }
+        inStream << character;
+      }
+    }
+
+public:
+    /** The capacity is taken from the TRACEEVENTS environment variable
+     * if it is set. */
+    explicit EventTracer(const size_t inDefaultCapacity = 65536)
+        : m_capacity(getenv("TRACEEVENTS") ?
+                         std::max(size_t(1), size_t(std::strtoull(getenv("TRACEEVENTS"), nullptr, 10))) :
+                         inDefaultCapacity) {
+      omp_init_lock(&m_namesLock);
+      omp_init_lock(&m_buffersLock);
+    }
+
+    ~EventTracer() {
+      omp_destroy_lock(&m_namesLock);
+      omp_destroy_lock(&m_buffersLock);
+    }
+
+    EventTracer(const EventTracer&) = delete;
+    EventTracer& operator=(const EventTracer&) = delete;
+
+    static double now() {
+      return std::chrono::duration<double>(
+                 std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /** Return the id of a name, meant to be called once per call site */
+    int intern(const std::string& inName) {
+      omp_set_lock(&m_namesLock);
+      const int eventId = int(m_names.size());
+      m_names.push_back(inName);
+      omp_unset_lock(&m_namesLock);
+      return eventId;
+    }
+
+    void record(const int inEventId, const double inStart, const double inEnd) {
+      ThreadBuffer* buffer = t_threadBuffer;
+      if (buffer == nullptr) {
+        buffer = registerThread();
+      }
+      TraceRecord& newRecord = buffer->m_records[buffer->m_nbWritten % m_capacity];
+      newRecord.m_eventId = inEventId;
+      newRecord.m_start = inStart;
+      newRecord.m_end = inEnd;
+      buffer->m_nbWritten += 1;
+    }
+
+    /** Each process writes its events in inFilePrefix_<rank>.json.
+     * The timelines of the processes are aligned on a barrier done here.
+     */
+    void write(const MPI_Comm inComm, const std::string& inFilePrefix) const {
+      int myRank;
+      int retMpi = MPI_Comm_rank(inComm, &myRank);
+      variable_used_only_in_assert(retMpi);
+      assert(retMpi == MPI_SUCCESS);
+
+      double firstStart = std::numeric_limits<double>::max();
+      size_t nbDropped = 0;
+      for (const auto& buffer : m_buffers) {
+        const size_t nbKept = std::min(buffer->m_nbWritten, m_capacity);
+        nbDropped += buffer->m_nbWritten - nbKept;
+        for (size_t idxRecord = 0; idxRecord < nbKept; ++idxRecord) {
+          firstStart = std::min(firstStart, buffer->m_records[idxRecord].m_start);
+        }
+      }
+
+      retMpi = MPI_Barrier(inComm);
+      assert(retMpi == MPI_SUCCESS);
+      const double syncTime = now();
+      double localSpan = (firstStart == std::numeric_limits<double>::max() ? 0 : syncTime - firstStart);
+      double globalSpan;
+      retMpi = MPI_Allreduce(&localSpan, &globalSpan, 1, MPI_DOUBLE, MPI_MAX, inComm);
+      assert(retMpi == MPI_SUCCESS);
+      // Time t of this process is written as t - syncTime + globalSpan (in us)
+      const double timeShift = globalSpan - syncTime;
+
+      std::ofstream traceFile(inFilePrefix + "_" + std::to_string(myRank) + ".json");
+      traceFile << std::fixed << std::setprecision(3);
+      traceFile << "{\"displayTimeUnit\": \"ms\",\n";
+      traceFile << "\"otherData\": {\"rank\": " << myRank << ", \"dropped_events\": " << nbDropped << "},\n";
+      traceFile << "\"traceEvents\": [\n";
+      traceFile << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << myRank
+                << ", \"args\": {\"name\": \"rank " << myRank << "\"}}";
+      for (const auto& buffer : m_buffers) {
+        traceFile << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << myRank
+                  << ", \"tid\": " << buffer->m_threadId
+                  << ", \"args\": {\"name\": \"thread " << buffer->m_threadId << "\"}}";
+        const size_t nbKept = std::min(buffer->m_nbWritten, m_capacity);
+        // Oldest first
+        const size_t firstRecord = (buffer->m_nbWritten > m_capacity ? buffer->m_nbWritten % m_capacity : 0);
+        for (size_t idxKept = 0; idxKept < nbKept; ++idxKept) {
+          const TraceRecord& traceRecord = buffer->m_records[(firstRecord + idxKept) % m_capacity];
+          traceFile << ",\n{\"name\": \"";
+          writeEscaped(traceFile, m_names[traceRecord.m_eventId]);
+          traceFile << "\", \"ph\": \"X\", \"pid\": " << myRank
+                    << ", \"tid\": " << buffer->m_threadId
+                    << ", \"ts\": " << (traceRecord.m_start + timeShift)*1e6
+                    << ", \"dur\": " << (traceRecord.m_end - traceRecord.m_start)*1e6 << "}";
+        }
+      }
+      traceFile << "\n]}\n";
+    }
+};
+
+/** Records a scope in an EventTracer, the id comes from intern. */
+class ScopeTrace {
+    EventTracer& m_tracer;
+    const int m_eventId;
+    const double m_start;
+
+public:
+    ScopeTrace(const int inEventId, EventTracer& inTracer)
+        : m_tracer(inTracer), m_eventId(inEventId), m_start(EventTracer::now()) {
+    }
+
+    ~ScopeTrace() {
+      m_tracer.record(m_eventId, m_start, EventTracer::now());
+    }
+
+    ScopeTrace(const ScopeTrace&) = delete;
+    ScopeTrace& operator=(const ScopeTrace&) = delete;
+    ScopeTrace(ScopeTrace&&) = delete;
+    ScopeTrace& operator=(ScopeTrace&&) = delete;
+};
 
 #define TIMEZONE_Core_Merge(x, y) x##y
 #define TIMEZONE_Core_Pre_Merge(x, y) TIMEZONE_Core_Merge(x, y)
 
-#define TIMEZONE(NAME)                                                      \
+#ifdef USE_TIMINGOUTPUT
+
+extern EventManager global_timer_manager;
+
+#define TIMEZONE_EVENT(NAME)                                                \
   ScopeEvent TIMEZONE_Core_Pre_Merge(____TIMEZONE_AUTO_ID, __LINE__)( \
       NAME, global_timer_manager, ScopeEventUniqueKey);
-#define TIMEZONE_MULTI_REF(NAME)                                            \
+#define TIMEZONE_MULTI_REF_EVENT(NAME)                                      \
   ScopeEvent TIMEZONE_Core_Pre_Merge(____TIMEZONE_AUTO_ID, __LINE__)( \
       NAME, global_timer_manager, ScopeEventMultiRefKey);
 
 #define TIMEZONE_OMP_INIT_PRETASK(VARNAME)                         \
   auto VARNAME##core = global_timer_manager.getCurrentThreadEvent(); \
   auto VARNAME = &VARNAME##core;
-#define TIMEZONE_OMP_TASK(NAME, VARNAME)                                    \
+#define TIMEZONE_OMP_TASK_EVENT(NAME, VARNAME)                              \
   ScopeEvent TIMEZONE_Core_Pre_Merge(____TIMEZONE_AUTO_ID, __LINE__)( \
       NAME, global_timer_manager, ScopeEventUniqueKey, *VARNAME);
 #define TIMEZONE_OMP_PRAGMA_TASK_KEY(VARNAME) \
@@ -810,14 +994,36 @@ extern EventManager global_timer_manager;
 
 #else
 
-#define TIMEZONE(NAME)
-#define TIMEZONE_MULTI_REF(NAME)
+#define TIMEZONE_EVENT(NAME)
+#define TIMEZONE_MULTI_REF_EVENT(NAME)
 #define TIMEZONE_OMP_INIT_PRETASK(VARNAME)
-#define TIMEZONE_OMP_TASK(NAME, VARNAME)
+#define TIMEZONE_OMP_TASK_EVENT(NAME, VARNAME)
 #define TIMEZONE_OMP_PRAGMA_TASK_KEY(VARNAME)
 #define TIMEZONE_OMP_INIT_PREPARALLEL(NBTHREADS)
 
 #endif
 
+#ifdef USE_TRACEOUTPUT
+
+extern EventTracer global_event_tracer;
+
+// The name is interned the first time the call site is reached, so it
+// should not change from one call to the next
+#define TIMEZONE_TRACE(NAME)                                                \
+  static const int TIMEZONE_Core_Pre_Merge(____TIMEZONE_TRACE_ID, __LINE__) = \
+      global_event_tracer.intern(NAME);                                     \
+  ScopeTrace TIMEZONE_Core_Pre_Merge(____TIMEZONE_TRACE_AUTO_ID, __LINE__)( \
+      TIMEZONE_Core_Pre_Merge(____TIMEZONE_TRACE_ID, __LINE__), global_event_tracer);
+
+#else
+
+#define TIMEZONE_TRACE(NAME)
+
+#endif
+
+#define TIMEZONE(NAME) TIMEZONE_EVENT(NAME) TIMEZONE_TRACE(NAME)
+#define TIMEZONE_MULTI_REF(NAME) TIMEZONE_MULTI_REF_EVENT(NAME) TIMEZONE_TRACE(NAME)
+#define TIMEZONE_OMP_TASK(NAME, VARNAME) TIMEZONE_OMP_TASK_EVENT(NAME, VARNAME) TIMEZONE_TRACE(NAME)
+
 
 #endif
@@ -2,12 +2,37 @@
 #define SHAREDARRAY_HPP
 
 #include <omp.h>
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
 #include <functional>
 #include <iostream>
+#include <new>
+#include <type_traits>
+
+#include "omputils.hpp"
 
 // Cannot be used by different parallel section at the same time
+//
+// Each thread has its own copy of the array, aligned on and padded to whole
+// cache lines so that no two copies share a line. The copies are allocated
+// (and initialized, if there is an init function) by their own thread when
+// the shared_array is created, so that their pages are first touched there
+// and not inside the hot loop. Without an init function the copies are left
+// uninitialized.
 template <class ValueType>
 class shared_array{
+    static_assert(std::is_pod<ValueType>::value,
+                  "shared_array copies are allocated as raw memory");
+
+public:
+    static const size_t CacheLineSize = 64;
+    // Below this many additions (values times copies), the copies are merged
+    // by the calling thread alone since starting a parallel region costs more
+    // than the merge
+    static const size_t MinParallelMergeWork = 32768;
+
+private:
     int currentNbThreads;
     ValueType** __restrict__ values;
     size_t dim;
@@ -16,15 +41,39 @@ class shared_array{
 
     bool hasBeenMerged;
 
+    static ValueType* allocateCopy(const size_t inDim){
+        const size_t nbBytes = ((inDim*sizeof(ValueType) + CacheLineSize - 1)/CacheLineSize)*CacheLineSize;
+        void* ptr = nullptr;
+        if(posix_memalign(&ptr, CacheLineSize, (nbBytes ? nbBytes : CacheLineSize)) != 0){
+            throw std::bad_alloc();
+        }
+        return static_cast<ValueType*>(ptr);
+    }
+
+    // Copy idxThread is handled by thread idxThread; if the team is smaller
+    // than expected, threads take care of the missing copies round robin.
+    template <class Func>
+    void forEachCopyInParallel(Func func){
+#pragma omp parallel num_threads(currentNbThreads)
+        {
+            for(int idxThread = omp_get_thread_num() ; idxThread < currentNbThreads ;
+                idxThread += omp_get_num_threads()){
+                func(idxThread);
+            }
+        }
+    }
+
 public:
     shared_array(const size_t inDim)
             : currentNbThreads(omp_get_max_threads()),
               values(nullptr), dim(inDim), hasBeenMerged(false){
         values = new ValueType*[currentNbThreads];
-        values[0] = new ValueType[dim];
-        for(int idxThread = 1 ; idxThread < currentNbThreads ; ++idxThread){
+        for(int idxThread = 0 ; idxThread < currentNbThreads ; ++idxThread){
             values[idxThread] = nullptr;
         }
+        forEachCopyInParallel([&](const int idxThread){
+            values[idxThread] = allocateCopy(dim);
+        });
     }
 
     shared_array(const size_t inDim, std::function<void(ValueType*)> inInitFunc)
@@ -34,7 +83,7 @@ public:
 
     ~shared_array(){
         for(int idxThread = 0 ; idxThread < currentNbThreads ; ++idxThread){
-            delete[] values[idxThread];
+            free(values[idxThread]);
         }
         delete[] values;
         if(hasBeenMerged == false){
@@ -50,59 +99,64 @@ public:
     }
 
     void merge(){
-        ValueType* __restrict__ dest = values[0];
-        for(int idxThread = 1 ; idxThread < currentNbThreads ; ++idxThread){
-            if(values[idxThread]){
-                const ValueType* __restrict__ src = values[idxThread];
-                for( size_t idxVal = 0 ; idxVal < dim ; ++idxVal){
-                    dest[idxVal] += src[idxVal];
-                }
-            }
-        }
-        hasBeenMerged = true;
+        merge([](const size_t /*idxVal*/, const ValueType& v1, const ValueType& v2) -> ValueType {
+            return v1 + v2;
+        });
     }
-    
+
     template <class Func>
     void merge(Func func){
         ValueType* __restrict__ dest = values[0];
         for(int idxThread = 1 ; idxThread < currentNbThreads ; ++idxThread){
-            if(values[idxThread]){
-                const ValueType* __restrict__ src = values[idxThread];
-                for( size_t idxVal = 0 ; idxVal < dim ; ++idxVal){
-                    dest[idxVal] = func(idxVal, dest[idxVal], src[idxVal]);
-                }
+            const ValueType* __restrict__ src = values[idxThread];
+            for( size_t idxVal = 0 ; idxVal < dim ; ++idxVal){
+                dest[idxVal] = func(idxVal, dest[idxVal], src[idxVal]);
             }
         }
         hasBeenMerged = true;
     }
 
     void mergeParallel(){
-        merge(); // not done yet
+        mergeParallel([](const size_t /*idxVal*/, const ValueType& v1, const ValueType& v2) -> ValueType {
+            return v1 + v2;
+        });
     }
-    
+
+    // Each thread merges all the copies over its own slice of whole cache
+    // lines of the master copy, in the same order as merge() does, so the
+    // result does not depend on the number of threads used for the merge.
     template <class Func>
     void mergeParallel(Func func){
-        merge(func); // not done yet
+        if(currentNbThreads == 1 || dim*size_t(currentNbThreads-1) < MinParallelMergeWork || omp_in_parallel()){
+            merge(func);
+            return;
+        }
+        const size_t valuesPerLine = (sizeof(ValueType) < CacheLineSize ? CacheLineSize/sizeof(ValueType) : 1);
+        const size_t nbLines = (dim + valuesPerLine - 1)/valuesPerLine;
+#pragma omp parallel num_threads(currentNbThreads)
+        {
+            const size_t firstVal = std::min(dim, OmpUtils::ForIntervalStart(nbLines)*valuesPerLine);
+            const size_t lastVal = std::min(dim, OmpUtils::ForIntervalEnd(nbLines)*valuesPerLine);
+            ValueType* __restrict__ dest = values[0];
+            for(int idxThread = 1 ; idxThread < currentNbThreads ; ++idxThread){
+                const ValueType* __restrict__ src = values[idxThread];
+                for( size_t idxVal = firstVal ; idxVal < lastVal ; ++idxVal){
+                    dest[idxVal] = func(idxVal, dest[idxVal], src[idxVal]);
+                }
+            }
+        }
+        hasBeenMerged = true;
     }
 
     void setInitFunction(std::function<void(ValueType*)> inInitFunc){
         initFunc = inInitFunc;
-        initFunc(values[0]);
+        forEachCopyInParallel([&](const int idxThread){
+            initFunc(values[idxThread]);
+        });
     }
 
     ValueType* getMine(){
         assert(omp_get_thread_num() < currentNbThreads);
-
-        if(values[omp_get_thread_num()] == nullptr){
-            ValueType* myValue = new ValueType[dim];
-            if(initFunc){
-                initFunc(myValue);
-            }
-
-            values[omp_get_thread_num()] = myValue;
-	        return myValue;
-        }
-
         return values[omp_get_thread_num()];
     }
 };
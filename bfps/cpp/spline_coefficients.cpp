@@ -0,0 +1,106 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+#include "spline_coefficients.hpp"
+
+constexpr double Lagrange_coefficients<1>::values[];
+constexpr double Lagrange_coefficients<2>::values[];
+constexpr double Lagrange_coefficients<3>::values[];
+constexpr double Lagrange_coefficients<4>::values[];
+constexpr double Lagrange_coefficients<5>::values[];
+constexpr double Lagrange_coefficients<6>::values[];
+constexpr double Lagrange_coefficients<7>::values[];
+constexpr double Lagrange_coefficients<8>::values[];
+constexpr double Lagrange_coefficients<9>::values[];
+constexpr double Lagrange_coefficients<10>::values[];
+constexpr double spline_coefficients<1,0>::values[];
+constexpr double spline_coefficients<1,1>::values[];
+constexpr double spline_coefficients<1,2>::values[];
+constexpr double spline_coefficients<2,0>::values[];
+constexpr double spline_coefficients<2,1>::values[];
+constexpr double spline_coefficients<2,2>::values[];
+constexpr double spline_coefficients<2,3>::values[];
+constexpr double spline_coefficients<2,4>::values[];
+constexpr double spline_coefficients<3,0>::values[];
+constexpr double spline_coefficients<3,1>::values[];
+constexpr double spline_coefficients<3,2>::values[];
+constexpr double spline_coefficients<3,3>::values[];
+constexpr double spline_coefficients<3,4>::values[];
+constexpr double spline_coefficients<3,5>::values[];
+constexpr double spline_coefficients<3,6>::values[];
+constexpr double spline_coefficients<4,0>::values[];
+constexpr double spline_coefficients<4,1>::values[];
+constexpr double spline_coefficients<4,2>::values[];
+constexpr double spline_coefficients<4,3>::values[];
+constexpr double spline_coefficients<4,4>::values[];
+constexpr double spline_coefficients<4,5>::values[];
+constexpr double spline_coefficients<4,6>::values[];
+constexpr double spline_coefficients<4,7>::values[];
+constexpr double spline_coefficients<4,8>::values[];
+constexpr double spline_coefficients<5,0>::values[];
+constexpr double spline_coefficients<5,1>::values[];
+constexpr double spline_coefficients<5,2>::values[];
+constexpr double spline_coefficients<5,3>::values[];
+constexpr double spline_coefficients<5,4>::values[];
+constexpr double spline_coefficients<5,5>::values[];
+constexpr double spline_coefficients<5,6>::values[];
+constexpr double spline_coefficients<5,7>::values[];
+constexpr double spline_coefficients<5,8>::values[];
+constexpr double spline_coefficients<5,9>::values[];
+constexpr double spline_coefficients<5,10>::values[];
+constexpr double spline_coefficients<6,0>::values[];
+constexpr double spline_coefficients<6,1>::values[];
+constexpr double spline_coefficients<6,2>::values[];
+constexpr double spline_coefficients<6,3>::values[];
+constexpr double spline_coefficients<6,4>::values[];
+constexpr double spline_coefficients<6,5>::values[];
+constexpr double spline_coefficients<6,6>::values[];
+constexpr double spline_coefficients<6,7>::values[];
+constexpr double spline_coefficients<6,8>::values[];
+constexpr double spline_coefficients<6,9>::values[];
+constexpr double spline_coefficients<6,10>::values[];
+constexpr double spline_coefficients<6,11>::values[];
+constexpr double spline_coefficients<6,12>::values[];
+constexpr double spline_coefficients<7,0>::values[];
+constexpr double spline_coefficients<7,1>::values[];
+constexpr double spline_coefficients<7,2>::values[];
+constexpr double spline_coefficients<7,3>::values[];
+constexpr double spline_coefficients<7,4>::values[];
+constexpr double spline_coefficients<8,0>::values[];
+constexpr double spline_coefficients<8,1>::values[];
+constexpr double spline_coefficients<8,2>::values[];
+constexpr double spline_coefficients<8,3>::values[];
+constexpr double spline_coefficients<8,4>::values[];
+constexpr double spline_coefficients<9,0>::values[];
+constexpr double spline_coefficients<9,1>::values[];
+constexpr double spline_coefficients<9,2>::values[];
+constexpr double spline_coefficients<9,3>::values[];
+constexpr double spline_coefficients<9,4>::values[];
+constexpr double spline_coefficients<10,0>::values[];
+constexpr double spline_coefficients<10,1>::values[];
+constexpr double spline_coefficients<10,2>::values[];
+constexpr double spline_coefficients<10,3>::values[];
+constexpr double spline_coefficients<10,4>::values[];
+
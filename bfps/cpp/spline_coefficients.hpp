@@ -0,0 +1,3467 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+#ifndef SPLINE_COEFFICIENTS_HPP
+
+#define SPLINE_COEFFICIENTS_HPP
+
+/** \file spline_coefficients.hpp
+ *  \brief Coefficients of the beta polynomials, for spline_table.hpp.
+ *
+ *  One structure per interpolation kernel of `spline_n*.cpp` (neighbours,
+ *  smoothness) and of `Lagrange_polys.cpp` (neighbours).
+ *  `values[idx_poly*(degree+1) + k]` is the coefficient of \f$ (x-1/2)^k \f$
+ *  in beta number `idx_poly`; all the betas are padded to the same degree.
+ *  Expanding around the middle of the cell keeps the Horner evaluation well
+ *  conditioned: the coefficients in powers of \f$ x \f$ grow to \f$10^8\f$
+ *  for the smoothest kernels, while these stay of order one.
+ *
+ *  The values are the exact rational coefficients of the polynomials of
+ *  `spline_n*.cpp` and `Lagrange_polys.cpp`, shifted by 1/2.
+ *  The definitions of the arrays are in spline_coefficients.cpp.
+ */
+
+template <int neighbours, int smoothness>
+struct spline_coefficients;
+
+template <int neighbours>
+struct Lagrange_coefficients;
+
+template <>
+struct Lagrange_coefficients<1>{
+    static const int nb_polys = 4;
+    static const int degree = 3;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -1.0/16.0, 1.0/24.0, 1.0/4.0, -1.0/6.0,
+        9.0/16.0, -9.0/8.0, -1.0/4.0, 1.0/2.0,
+        9.0/16.0, 9.0/8.0, -1.0/4.0, -1.0/2.0,
+        -1.0/16.0, -1.0/24.0, 1.0/4.0, 1.0/6.0
+    };
+};
+
+template <>
+struct Lagrange_coefficients<2>{
+    static const int nb_polys = 6;
+    static const int degree = 5;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        3.0/256.0, -3.0/640.0, -5.0/96.0, 1.0/48.0,
+        1.0/48.0, -1.0/120.0,
+        -25.0/256.0, 25.0/384.0, 13.0/32.0, -13.0/48.0,
+        -1.0/16.0, 1.0/24.0,
+        75.0/128.0, -75.0/64.0, -17.0/48.0, 17.0/24.0,
+        1.0/24.0, -1.0/12.0,
+        75.0/128.0, 75.0/64.0, -17.0/48.0, -17.0/24.0,
+        1.0/24.0, 1.0/12.0,
+        -25.0/256.0, -25.0/384.0, 13.0/32.0, 13.0/48.0,
+        -1.0/16.0, -1.0/24.0,
+        3.0/256.0, 3.0/640.0, -5.0/96.0, -1.0/48.0,
+        1.0/48.0, 1.0/120.0
+    };
+};
+
+template <>
+struct Lagrange_coefficients<3>{
+    static const int nb_polys = 8;
+    static const int degree = 7;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -5.0/2048.0, 5.0/7168.0, 259.0/23040.0, -37.0/11520.0,
+        -7.0/1152.0, 1.0/576.0, 1.0/1440.0, -1.0/5040.0,
+        49.0/2048.0, -49.0/5120.0, -499.0/4608.0, 499.0/11520.0,
+        59.0/1152.0, -59.0/2880.0, -1.0/288.0, 1.0/720.0,
+        -245.0/2048.0, 245.0/3072.0, 1299.0/2560.0, -433.0/1280.0,
+        -15.0/128.0, 5.0/64.0, 1.0/160.0, -1.0/240.0,
+        1225.0/2048.0, -1225.0/1024.0, -1891.0/4608.0, 1891.0/2304.0,
+        83.0/1152.0, -83.0/576.0, -1.0/288.0, 1.0/144.0,
+        1225.0/2048.0, 1225.0/1024.0, -1891.0/4608.0, -1891.0/2304.0,
+        83.0/1152.0, 83.0/576.0, -1.0/288.0, -1.0/144.0,
+        -245.0/2048.0, -245.0/3072.0, 1299.0/2560.0, 433.0/1280.0,
+        -15.0/128.0, -5.0/64.0, 1.0/160.0, 1.0/240.0,
+        49.0/2048.0, 49.0/5120.0, -499.0/4608.0, -499.0/11520.0,
+        59.0/1152.0, 59.0/2880.0, -1.0/288.0, -1.0/720.0,
+        -5.0/2048.0, -5.0/7168.0, 259.0/23040.0, 37.0/11520.0,
+        -7.0/1152.0, -1.0/576.0, 1.0/1440.0, 1.0/5040.0
+    };
+};
+
+template <>
+struct Lagrange_coefficients<4>{
+    static const int nb_polys = 10;
+    static const int degree = 9;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        35.0/65536.0, -35.0/294912.0, -3229.0/1290240.0, 3229.0/5806080.0,
+        47.0/30720.0, -47.0/138240.0, -1.0/3840.0, 1.0/17280.0,
+        1.0/80640.0, -1.0/362880.0,
+        -405.0/65536.0, 405.0/229376.0, 589.0/20480.0, -589.0/71680.0,
+        -1547.0/92160.0, 221.0/46080.0, 29.0/11520.0, -29.0/40320.0,
+        -1.0/11520.0, 1.0/40320.0,
+        567.0/16384.0, -567.0/40960.0, -1135.0/7168.0, 227.0/3584.0,
+        377.0/4608.0, -377.0/11520.0, -5.0/576.0, 1.0/288.0,
+        1.0/4032.0, -1.0/10080.0,
+        -2205.0/16384.0, 735.0/8192.0, 26611.0/46080.0, -26611.0/69120.0,
+        -1229.0/7680.0, 1229.0/11520.0, 13.0/960.0, -13.0/1440.0,
+        -1.0/2880.0, 1.0/4320.0,
+        19845.0/32768.0, -19845.0/16384.0, -4561.0/10240.0, 4561.0/5120.0,
+        4307.0/46080.0, -4307.0/23040.0, -41.0/5760.0, 41.0/2880.0,
+        1.0/5760.0, -1.0/2880.0,
+        19845.0/32768.0, 19845.0/16384.0, -4561.0/10240.0, -4561.0/5120.0,
+        4307.0/46080.0, 4307.0/23040.0, -41.0/5760.0, -41.0/2880.0,
+        1.0/5760.0, 1.0/2880.0,
+        -2205.0/16384.0, -735.0/8192.0, 26611.0/46080.0, 26611.0/69120.0,
+        -1229.0/7680.0, -1229.0/11520.0, 13.0/960.0, 13.0/1440.0,
+        -1.0/2880.0, -1.0/4320.0,
+        567.0/16384.0, 567.0/40960.0, -1135.0/7168.0, -227.0/3584.0,
+        377.0/4608.0, 377.0/11520.0, -5.0/576.0, -1.0/288.0,
+        1.0/4032.0, 1.0/10080.0,
+        -405.0/65536.0, -405.0/229376.0, 589.0/20480.0, 589.0/71680.0,
+        -1547.0/92160.0, -221.0/46080.0, 29.0/11520.0, 29.0/40320.0,
+        -1.0/11520.0, -1.0/40320.0,
+        35.0/65536.0, 35.0/294912.0, -3229.0/1290240.0, -3229.0/5806080.0,
+        47.0/30720.0, 47.0/138240.0, -1.0/3840.0, -1.0/17280.0,
+        1.0/80640.0, 1.0/362880.0
+    };
+};
+
+template <>
+struct Lagrange_coefficients<5>{
+    static const int nb_polys = 12;
+    static const int degree = 11;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -63.0/524288.0, 63.0/2883584.0, 117469.0/206438400.0, -10679.0/103219200.0,
+        -17281.0/46448640.0, 1571.0/23224320.0, 209.0/2764800.0, -19.0/1382400.0,
+        -11.0/1935360.0, 1.0/967680.0, 1.0/7257600.0, -1.0/39916800.0,
+        847.0/524288.0, -847.0/2359296.0, -1573861.0/206438400.0, 1573861.0/928972800.0,
+        25177.0/5160960.0, -25177.0/23224320.0, -289.0/307200.0, 289.0/1382400.0,
+        41.0/645120.0, -41.0/2903040.0, -1.0/806400.0, 1.0/3628800.0,
+        -5445.0/524288.0, 5445.0/1835008.0, 287101.0/5898240.0, -287101.0/20643840.0,
+        -197789.0/6635520.0, 197789.0/23224320.0, 571.0/110592.0, -571.0/387072.0,
+        -79.0/276480.0, 79.0/967680.0, 1.0/207360.0, -1.0/725760.0,
+        22869.0/524288.0, -22869.0/1310720.0, -553309.0/2752512.0, 553309.0/6881280.0,
+        339749.0/3096576.0, -339749.0/7741440.0, -529.0/36864.0, 529.0/92160.0,
+        29.0/43008.0, -29.0/107520.0, -1.0/96768.0, 1.0/241920.0,
+        -38115.0/262144.0, 12705.0/131072.0, 12978949.0/20643840.0, -12978949.0/30965760.0,
+        -499349.0/2580480.0, 499349.0/3870720.0, 125.0/6144.0, -125.0/9216.0,
+        -277.0/322560.0, 277.0/483840.0, 1.0/80640.0, -1.0/120960.0,
+        160083.0/262144.0, -160083.0/131072.0, -2306749.0/4915200.0, 2306749.0/2457600.0,
+        120649.0/1105920.0, -120649.0/552960.0, -527.0/51200.0, 527.0/25600.0,
+        19.0/46080.0, -19.0/23040.0, -1.0/172800.0, 1.0/86400.0,
+        160083.0/262144.0, 160083.0/131072.0, -2306749.0/4915200.0, -2306749.0/2457600.0,
+        120649.0/1105920.0, 120649.0/552960.0, -527.0/51200.0, -527.0/25600.0,
+        19.0/46080.0, 19.0/23040.0, -1.0/172800.0, -1.0/86400.0,
+        -38115.0/262144.0, -12705.0/131072.0, 12978949.0/20643840.0, 12978949.0/30965760.0,
+        -499349.0/2580480.0, -499349.0/3870720.0, 125.0/6144.0, 125.0/9216.0,
+        -277.0/322560.0, -277.0/483840.0, 1.0/80640.0, 1.0/120960.0,
+        22869.0/524288.0, 22869.0/1310720.0, -553309.0/2752512.0, -553309.0/6881280.0,
+        339749.0/3096576.0, 339749.0/7741440.0, -529.0/36864.0, -529.0/92160.0,
+        29.0/43008.0, 29.0/107520.0, -1.0/96768.0, -1.0/241920.0,
+        -5445.0/524288.0, -5445.0/1835008.0, 287101.0/5898240.0, 287101.0/20643840.0,
+        -197789.0/6635520.0, -197789.0/23224320.0, 571.0/110592.0, 571.0/387072.0,
+        -79.0/276480.0, -79.0/967680.0, 1.0/207360.0, 1.0/725760.0,
+        847.0/524288.0, 847.0/2359296.0, -1573861.0/206438400.0, -1573861.0/928972800.0,
+        25177.0/5160960.0, 25177.0/23224320.0, -289.0/307200.0, -289.0/1382400.0,
+        41.0/645120.0, 41.0/2903040.0, -1.0/806400.0, -1.0/3628800.0,
+        -63.0/524288.0, -63.0/2883584.0, 117469.0/206438400.0, 10679.0/103219200.0,
+        -17281.0/46448640.0, -1571.0/23224320.0, 209.0/2764800.0, 19.0/1382400.0,
+        -11.0/1935360.0, -1.0/967680.0, 1.0/7257600.0, 1.0/39916800.0
+    };
+};
+
+template <>
+struct Lagrange_coefficients<6>{
+    static const int nb_polys = 14;
+    static const int degree = 13;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        231.0/8388608.0, -231.0/54525952.0, -7156487.0/54499737600.0, 550499.0/27249868800.0,
+        1997021.0/22295347200.0, -153617.0/11147673600.0, -28067.0/1393459200.0, 2159.0/696729600.0,
+        871.0/464486400.0, -67.0/232243200.0, -13.0/174182400.0, 1.0/87091200.0,
+        1.0/958003200.0, -1.0/6227020800.0,
+        -3549.0/8388608.0, 3549.0/46137344.0, 9975743.0/4954521600.0, -9975743.0/27249868800.0,
+        -30262111.0/22295347200.0, 2751101.0/11147673600.0, 414073.0/1393459200.0, -37643.0/696729600.0,
+        -12221.0/464486400.0, 1111.0/232243200.0, 167.0/174182400.0, -167.0/958003200.0,
+        -1.0/87091200.0, 1.0/479001600.0,
+        13013.0/4194304.0, -13013.0/18874368.0, -133658267.0/9083289600.0, 133658267.0/40874803200.0,
+        4011181.0/412876800.0, -4011181.0/1857945600.0, -52343.0/25804800.0, 52343.0/116121600.0,
+        4253.0/25804800.0, -4253.0/116121600.0, -17.0/3225600.0, 17.0/14515200.0,
+        1.0/17740800.0, -1.0/79833600.0,
+        -61347.0/4194304.0, 61347.0/14680064.0, 24382547.0/353894400.0, -3483221.0/176947200.0,
+        -69436591.0/1592524800.0, 9919513.0/796262400.0, 822637.0/99532800.0, -822637.0/348364800.0,
+        -19061.0/33177600.0, 2723.0/16588800.0, 203.0/12441600.0, -29.0/6220800.0,
+        -1.0/6220800.0, 1.0/21772800.0,
+        429429.0/8388608.0, -429429.0/20971520.0, -46994735.0/198180864.0, 9398947.0/99090432.0,
+        119814943.0/891813888.0, -119814943.0/2229534720.0, -1108585.0/55738368.0, 221717.0/27869184.0,
+        22109.0/18579456.0, -22109.0/46448640.0, -215.0/6967296.0, 43.0/3483648.0,
+        1.0/3483648.0, -1.0/8709120.0,
+        -1288287.0/8388608.0, 429429.0/4194304.0, 1102724303.0/1651507200.0, -1102724303.0/2477260800.0,
+        -181758911.0/825753600.0, 181758911.0/1238630400.0, 1358737.0/51609600.0, -1358737.0/77414400.0,
+        -73063.0/51609600.0, 73063.0/77414400.0, 223.0/6451200.0, -223.0/9676800.0,
+        -1.0/3225600.0, 1.0/4838400.0,
+        1288287.0/2097152.0, -1288287.0/1048576.0, -200923403.0/412876800.0, 200923403.0/206438400.0,
+        224657551.0/1857945600.0, -224657551.0/928972800.0, -1503973.0/116121600.0, 1503973.0/58060800.0,
+        25541.0/38707200.0, -25541.0/19353600.0, -227.0/14515200.0, 227.0/7257600.0,
+        1.0/7257600.0, -1.0/3628800.0,
+        1288287.0/2097152.0, 1288287.0/1048576.0, -200923403.0/412876800.0, -200923403.0/206438400.0,
+        224657551.0/1857945600.0, 224657551.0/928972800.0, -1503973.0/116121600.0, -1503973.0/58060800.0,
+        25541.0/38707200.0, 25541.0/19353600.0, -227.0/14515200.0, -227.0/7257600.0,
+        1.0/7257600.0, 1.0/3628800.0,
+        -1288287.0/8388608.0, -429429.0/4194304.0, 1102724303.0/1651507200.0, 1102724303.0/2477260800.0,
+        -181758911.0/825753600.0, -181758911.0/1238630400.0, 1358737.0/51609600.0, 1358737.0/77414400.0,
+        -73063.0/51609600.0, -73063.0/77414400.0, 223.0/6451200.0, 223.0/9676800.0,
+        -1.0/3225600.0, -1.0/4838400.0,
+        429429.0/8388608.0, 429429.0/20971520.0, -46994735.0/198180864.0, -9398947.0/99090432.0,
+        119814943.0/891813888.0, 119814943.0/2229534720.0, -1108585.0/55738368.0, -221717.0/27869184.0,
+        22109.0/18579456.0, 22109.0/46448640.0, -215.0/6967296.0, -43.0/3483648.0,
+        1.0/3483648.0, 1.0/8709120.0,
+        -61347.0/4194304.0, -61347.0/14680064.0, 24382547.0/353894400.0, 3483221.0/176947200.0,
+        -69436591.0/1592524800.0, -9919513.0/796262400.0, 822637.0/99532800.0, 822637.0/348364800.0,
+        -19061.0/33177600.0, -2723.0/16588800.0, 203.0/12441600.0, 29.0/6220800.0,
+        -1.0/6220800.0, -1.0/21772800.0,
+        13013.0/4194304.0, 13013.0/18874368.0, -133658267.0/9083289600.0, -133658267.0/40874803200.0,
+        4011181.0/412876800.0, 4011181.0/1857945600.0, -52343.0/25804800.0, -52343.0/116121600.0,
+        4253.0/25804800.0, 4253.0/116121600.0, -17.0/3225600.0, -17.0/14515200.0,
+        1.0/17740800.0, 1.0/79833600.0,
+        -3549.0/8388608.0, -3549.0/46137344.0, 9975743.0/4954521600.0, 9975743.0/27249868800.0,
+        -30262111.0/22295347200.0, -2751101.0/11147673600.0, 414073.0/1393459200.0, 37643.0/696729600.0,
+        -12221.0/464486400.0, -1111.0/232243200.0, 167.0/174182400.0, 167.0/958003200.0,
+        -1.0/87091200.0, -1.0/479001600.0,
+        231.0/8388608.0, 231.0/54525952.0, -7156487.0/54499737600.0, -550499.0/27249868800.0,
+        1997021.0/22295347200.0, 153617.0/11147673600.0, -28067.0/1393459200.0, -2159.0/696729600.0,
+        871.0/464486400.0, 67.0/232243200.0, -13.0/174182400.0, -1.0/87091200.0,
+        1.0/958003200.0, 1.0/6227020800.0
+    };
+};
+
+template <>
+struct Lagrange_coefficients<7>{
+    static const int nb_polys = 16;
+    static const int degree = 15;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -429.0/67108864.0, 143.0/167772160.0, 2430898831.0/79351617945600.0, -2430898831.0/595137134592000.0,
+        -1206053.0/56056872960.0, 1206053.0/420426547200.0, 230443.0/44590694400.0, -230443.0/334430208000.0,
+        -8521.0/15606743040.0, 8521.0/117050572800.0, 11.0/398131200.0, -11.0/2985984000.0,
+        -1.0/1532805120.0, 1.0/11496038400.0, 1.0/174356582400.0, -1.0/1307674368000.0,
+        7425.0/67108864.0, -7425.0/436207616.0, -14366335.0/27128758272.0, 14366335.0/176336928768.0,
+        80499107.0/217998950400.0, -6192239.0/108999475200.0, -3893903.0/44590694400.0, 299531.0/22295347200.0,
+        700193.0/78033715200.0, -53861.0/39016857600.0, -403.0/928972800.0, 31.0/464486400.0,
+        73.0/7664025600.0, -73.0/49816166400.0, -1.0/13412044800.0, 1.0/87178291200.0,
+        -61425.0/67108864.0, 61425.0/369098752.0, 20026015.0/4580179968.0, -20026015.0/25190989824.0,
+        -59731097.0/19818086400.0, 59731097.0/108999475200.0, 30994447.0/44590694400.0, -2817677.0/22295347200.0,
+        -761959.0/11147673600.0, 69269.0/5573836800.0, 2867.0/928972800.0, -2867.0/5109350400.0,
+        -43.0/696729600.0, 43.0/3832012800.0, 1.0/2264371200.0, -1.0/12454041600.0,
+        325325.0/67108864.0, -325325.0/301989888.0, -268318535.0/11626610688.0, 268318535.0/52319748096.0,
+        10194989509.0/653996851200.0, -10194989509.0/2942985830400.0, -51119881.0/14863564800.0, 51119881.0/66886041600.0,
+        1166297.0/3715891200.0, -1166297.0/16721510400.0, -11903.0/928972800.0, 11903.0/4180377600.0,
+        599.0/2554675200.0, -599.0/11496038400.0, -1.0/638668800.0, 1.0/2874009600.0,
+        -1254825.0/67108864.0, 1254825.0/234881024.0, 48949135.0/553648128.0, -48949135.0/1937768448.0,
+        -1784679869.0/31142707200.0, 254954267.0/15571353600.0, 73619081.0/6370099200.0, -73619081.0/22295347200.0,
+        -1468793.0/1592524800.0, 1468793.0/5573836800.0, 4501.0/132710400.0, -643.0/66355200.0,
+        -631.0/1094860800.0, 631.0/3832012800.0, 1.0/273715200.0, -1.0/958003200.0,
+        3864861.0/67108864.0, -3864861.0/167772160.0, -2358754759.0/8808038400.0, 2358754759.0/22020096000.0,
+        617872609.0/3963617280.0, -617872609.0/9909043200.0, -1117541443.0/44590694400.0, 1117541443.0/111476736000.0,
+        3871583.0/2229534720.0, -3871583.0/5573836800.0, -54359.0/928972800.0, 54359.0/2322432000.0,
+        131.0/139345920.0, -131.0/348364800.0, -1.0/174182400.0, 1.0/435456000.0,
+        -10735725.0/67108864.0, 3578575.0/33554432.0, 2214466615.0/3170893824.0, -2214466615.0/4756340736.0,
+        -43101203581.0/178362777600.0, 43101203581.0/267544166400.0, 1404622211.0/44590694400.0, -1404622211.0/66886041600.0,
+        -21874123.0/11147673600.0, 21874123.0/16721510400.0, 173413.0/2786918400.0, -173413.0/4180377600.0,
+        -671.0/696729600.0, 671.0/1045094400.0, 1.0/174182400.0, -1.0/261273600.0,
+        41409225.0/67108864.0, -41409225.0/33554432.0, -410864815.0/822083584.0, 410864815.0/411041792.0,
+        859755083.0/6606028800.0, -859755083.0/3303014400.0, -225461893.0/14863564800.0, 225461893.0/7431782400.0,
+        23256067.0/26011238400.0, -23256067.0/13005619200.0, -8513.0/309657600.0, 8513.0/154828800.0,
+        97.0/232243200.0, -97.0/116121600.0, -1.0/406425600.0, 1.0/203212800.0,
+        41409225.0/67108864.0, 41409225.0/33554432.0, -410864815.0/822083584.0, -410864815.0/411041792.0,
+        859755083.0/6606028800.0, 859755083.0/3303014400.0, -225461893.0/14863564800.0, -225461893.0/7431782400.0,
+        23256067.0/26011238400.0, 23256067.0/13005619200.0, -8513.0/309657600.0, -8513.0/154828800.0,
+        97.0/232243200.0, 97.0/116121600.0, -1.0/406425600.0, -1.0/203212800.0,
+        -10735725.0/67108864.0, -3578575.0/33554432.0, 2214466615.0/3170893824.0, 2214466615.0/4756340736.0,
+        -43101203581.0/178362777600.0, -43101203581.0/267544166400.0, 1404622211.0/44590694400.0, 1404622211.0/66886041600.0,
+        -21874123.0/11147673600.0, -21874123.0/16721510400.0, 173413.0/2786918400.0, 173413.0/4180377600.0,
+        -671.0/696729600.0, -671.0/1045094400.0, 1.0/174182400.0, 1.0/261273600.0,
+        3864861.0/67108864.0, 3864861.0/167772160.0, -2358754759.0/8808038400.0, -2358754759.0/22020096000.0,
+        617872609.0/3963617280.0, 617872609.0/9909043200.0, -1117541443.0/44590694400.0, -1117541443.0/111476736000.0,
+        3871583.0/2229534720.0, 3871583.0/5573836800.0, -54359.0/928972800.0, -54359.0/2322432000.0,
+        131.0/139345920.0, 131.0/348364800.0, -1.0/174182400.0, -1.0/435456000.0,
+        -1254825.0/67108864.0, -1254825.0/234881024.0, 48949135.0/553648128.0, 48949135.0/1937768448.0,
+        -1784679869.0/31142707200.0, -254954267.0/15571353600.0, 73619081.0/6370099200.0, 73619081.0/22295347200.0,
+        -1468793.0/1592524800.0, -1468793.0/5573836800.0, 4501.0/132710400.0, 643.0/66355200.0,
+        -631.0/1094860800.0, -631.0/3832012800.0, 1.0/273715200.0, 1.0/958003200.0,
+        325325.0/67108864.0, 325325.0/301989888.0, -268318535.0/11626610688.0, -268318535.0/52319748096.0,
+        10194989509.0/653996851200.0, 10194989509.0/2942985830400.0, -51119881.0/14863564800.0, -51119881.0/66886041600.0,
+        1166297.0/3715891200.0, 1166297.0/16721510400.0, -11903.0/928972800.0, -11903.0/4180377600.0,
+        599.0/2554675200.0, 599.0/11496038400.0, -1.0/638668800.0, -1.0/2874009600.0,
+        -61425.0/67108864.0, -61425.0/369098752.0, 20026015.0/4580179968.0, 20026015.0/25190989824.0,
+        -59731097.0/19818086400.0, -59731097.0/108999475200.0, 30994447.0/44590694400.0, 2817677.0/22295347200.0,
+        -761959.0/11147673600.0, -69269.0/5573836800.0, 2867.0/928972800.0, 2867.0/5109350400.0,
+        -43.0/696729600.0, -43.0/3832012800.0, 1.0/2264371200.0, 1.0/12454041600.0,
+        7425.0/67108864.0, 7425.0/436207616.0, -14366335.0/27128758272.0, -14366335.0/176336928768.0,
+        80499107.0/217998950400.0, 6192239.0/108999475200.0, -3893903.0/44590694400.0, -299531.0/22295347200.0,
+        700193.0/78033715200.0, 53861.0/39016857600.0, -403.0/928972800.0, -31.0/464486400.0,
+        73.0/7664025600.0, 73.0/49816166400.0, -1.0/13412044800.0, -1.0/87178291200.0,
+        -429.0/67108864.0, -143.0/167772160.0, 2430898831.0/79351617945600.0, 2430898831.0/595137134592000.0,
+        -1206053.0/56056872960.0, -1206053.0/420426547200.0, 230443.0/44590694400.0, 230443.0/334430208000.0,
+        -8521.0/15606743040.0, -8521.0/117050572800.0, 11.0/398131200.0, 11.0/2985984000.0,
+        -1.0/1532805120.0, -1.0/11496038400.0, 1.0/174356582400.0, 1.0/1307674368000.0
+    };
+};
+
+template <>
+struct Lagrange_coefficients<8>{
+    static const int nb_polys = 18;
+    static const int degree = 17;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        6435.0/4294967296.0, -6435.0/36507222016.0, -60997921.0/8464172580864.0, 3588113.0/4232086290432.0,
+        24615717239.0/4761097076736000.0, -1447983367.0/2380548538368000.0, -15313957.0/11771943321600.0, 900821.0/5885971660800.0,
+        5599613.0/37456183296000.0, -329389.0/18728091648000.0, -4097.0/468202291200.0, 241.0/234101145600.0,
+        493.0/1839366144000.0, -29.0/919683072000.0, -17.0/4184557977600.0, 1.0/2092278988800.0,
+        1.0/41845579776000.0, -1.0/355687428096000.0,
+        -123981.0/4294967296.0, 41327.0/10737418240.0, 88069851773.0/634812943564800.0, -88069851773.0/4761097076736000.0,
+        -283001916031.0/2856658246041600.0, 1.3208996510667605e-05, 32282923.0/1307993702400.0, -32282923.0/9809952768000.0,
+        -2320991.0/832359628800.0, 2320991.0/6242697216000.0, 24797.0/156067430400.0, -24797.0/1170505728000.0,
+        -191.0/40874803200.0, 191.0/306561024000.0, 31.0/464950886400.0, -31.0/3487131648000.0,
+        -1.0/2789705318400.0, 1.0/20922789888000.0,
+        143055.0/536870912.0, -143055.0/3489660928.0, -52048463.0/40693137408.0, 52048463.0/264505393152.0,
+        41520529709.0/45779779584000.0, -41520529709.0/297568567296000.0, -4094753.0/18393661440.0, 314981.0/9196830720.0,
+        114806549.0/4682022912000.0, -8831273.0/2341011456000.0, -1573.0/1170505728.0, 121.0/585252864.0,
+        8599.0/229920768000.0, -8599.0/1494484992000.0, -1.0/2011806720.0, 1.0/13076743680.0,
+        1.0/402361344000.0, -1.0/2615348736000.0,
+        -845325.0/536870912.0, 845325.0/2952790016.0, 45345995.0/6011486208.0, -45345995.0/33063174144.0,
+        -57228896201.0/10820675174400.0, 57228896201.0/59513713459200.0, 84776563.0/66886041600.0, -84776563.0/367873228800.0,
+        -125600299.0/936404582400.0, 11418209.0/468202291200.0, 101489.0/14631321600.0, -101489.0/80472268800.0,
+        -751.0/4180377600.0, 751.0/22992076800.0, 53.0/23775897600.0, -53.0/130767436800.0,
+        -1.0/95103590400.0, 1.0/523069747200.0,
+        7232225.0/1073741824.0, -7232225.0/4831838208.0, -9721188355.0/302291877888.0, 9721188355.0/1360313450496.0,
+        751680909619.0/34007836262400.0, -751680909619.0/153035263180800.0, -553541959.0/108999475200.0, 553541959.0/490497638400.0,
+        4976663.0/9909043200.0, -4976663.0/44590694400.0, -44291.0/1857945600.0, 44291.0/8360755200.0,
+        1949.0/3406233600.0, -1949.0/15328051200.0, -37.0/5535129600.0, 37.0/24908083200.0,
+        1.0/33210777600.0, -1.0/149448499200.0,
+        -24176295.0/1073741824.0, 24176295.0/3758096384.0, 354692731.0/3321888768.0, -354692731.0/11626610688.0,
+        -131696509379.0/1868562432000.0, 131696509379.0/6539968512000.0, 6252429433.0/420426547200.0, -6252429433.0/1471492915200.0,
+        -249050129.0/191102976000.0, 249050129.0/668860416000.0, 134279.0/2388787200.0, -134279.0/8360755200.0,
+        -82723.0/65691648000.0, 82723.0/229920768000.0, 23.0/1642291200.0, -23.0/5748019200.0,
+        -1.0/16422912000.0, 1.0/57480192000.0,
+        33846813.0/536870912.0, -33846813.0/1342177280.0, -21365911793.0/72666316800.0, 21365911793.0/181665792000.0,
+        228513678209.0/1307993702400.0, -228513678209.0/3269984256000.0, -21923359027.0/735746457600.0, 21923359027.0/1839366144000.0,
+        305089949.0/133772083200.0, -305089949.0/334430208000.0, -47221.0/522547200.0, 47221.0/1306368000.0,
+        88093.0/45984153600.0, -88093.0/114960384000.0, -59.0/2874009600.0, 59.0/7185024000.0,
+        1.0/11496038400.0, -1.0/28740096000.0,
+        -88646415.0/536870912.0, 29548805.0/268435456.0, 8025123797.0/11098128384.0, -8025123797.0/16647192576.0,
+        -3238625705821.0/12485394432000.0, 3238625705821.0/18728091648000.0, 133641971.0/3715891200.0, -133641971.0/5573836800.0,
+        -1287707293.0/520224768000.0, 1287707293.0/780337152000.0, 899881.0/9754214400.0, -899881.0/14631321600.0,
+        -4373.0/2322432000.0, 4373.0/3483648000.0, 1.0/50803200.0, -1.0/76204800.0,
+        -1.0/12192768000.0, 1.0/18289152000.0,
+        1329696225.0/2147483648.0, -1329696225.0/1073741824.0, -15096122945.0/29595009024.0, 15096122945.0/14797504512.0,
+        457932279071.0/3329438515200.0, -457932279071.0/1664719257600.0, -9112035353.0/535088332800.0, 9112035353.0/267544166400.0,
+        4149618307.0/3745618329600.0, -4149618307.0/1872809164800.0, -9365183.0/234101145600.0, 9365183.0/117050572800.0,
+        13393.0/16721510400.0, -13393.0/8360755200.0, -121.0/14631321600.0, 121.0/7315660800.0,
+        1.0/29262643200.0, -1.0/14631321600.0,
+        1329696225.0/2147483648.0, 1329696225.0/1073741824.0, -15096122945.0/29595009024.0, -15096122945.0/14797504512.0,
+        457932279071.0/3329438515200.0, 457932279071.0/1664719257600.0, -9112035353.0/535088332800.0, -9112035353.0/267544166400.0,
+        4149618307.0/3745618329600.0, 4149618307.0/1872809164800.0, -9365183.0/234101145600.0, -9365183.0/117050572800.0,
+        13393.0/16721510400.0, 13393.0/8360755200.0, -121.0/14631321600.0, -121.0/7315660800.0,
+        1.0/29262643200.0, 1.0/14631321600.0,
+        -88646415.0/536870912.0, -29548805.0/268435456.0, 8025123797.0/11098128384.0, 8025123797.0/16647192576.0,
+        -3238625705821.0/12485394432000.0, -3238625705821.0/18728091648000.0, 133641971.0/3715891200.0, 133641971.0/5573836800.0,
+        -1287707293.0/520224768000.0, -1287707293.0/780337152000.0, 899881.0/9754214400.0, 899881.0/14631321600.0,
+        -4373.0/2322432000.0, -4373.0/3483648000.0, 1.0/50803200.0, 1.0/76204800.0,
+        -1.0/12192768000.0, -1.0/18289152000.0,
+        33846813.0/536870912.0, 33846813.0/1342177280.0, -21365911793.0/72666316800.0, -21365911793.0/181665792000.0,
+        228513678209.0/1307993702400.0, 228513678209.0/3269984256000.0, -21923359027.0/735746457600.0, -21923359027.0/1839366144000.0,
+        305089949.0/133772083200.0, 305089949.0/334430208000.0, -47221.0/522547200.0, -47221.0/1306368000.0,
+        88093.0/45984153600.0, 88093.0/114960384000.0, -59.0/2874009600.0, -59.0/7185024000.0,
+        1.0/11496038400.0, 1.0/28740096000.0,
+        -24176295.0/1073741824.0, -24176295.0/3758096384.0, 354692731.0/3321888768.0, 354692731.0/11626610688.0,
+        -131696509379.0/1868562432000.0, -131696509379.0/6539968512000.0, 6252429433.0/420426547200.0, 6252429433.0/1471492915200.0,
+        -249050129.0/191102976000.0, -249050129.0/668860416000.0, 134279.0/2388787200.0, 134279.0/8360755200.0,
+        -82723.0/65691648000.0, -82723.0/229920768000.0, 23.0/1642291200.0, 23.0/5748019200.0,
+        -1.0/16422912000.0, -1.0/57480192000.0,
+        7232225.0/1073741824.0, 7232225.0/4831838208.0, -9721188355.0/302291877888.0, -9721188355.0/1360313450496.0,
+        751680909619.0/34007836262400.0, 751680909619.0/153035263180800.0, -553541959.0/108999475200.0, -553541959.0/490497638400.0,
+        4976663.0/9909043200.0, 4976663.0/44590694400.0, -44291.0/1857945600.0, -44291.0/8360755200.0,
+        1949.0/3406233600.0, 1949.0/15328051200.0, -37.0/5535129600.0, -37.0/24908083200.0,
+        1.0/33210777600.0, 1.0/149448499200.0,
+        -845325.0/536870912.0, -845325.0/2952790016.0, 45345995.0/6011486208.0, 45345995.0/33063174144.0,
+        -57228896201.0/10820675174400.0, -57228896201.0/59513713459200.0, 84776563.0/66886041600.0, 84776563.0/367873228800.0,
+        -125600299.0/936404582400.0, -11418209.0/468202291200.0, 101489.0/14631321600.0, 101489.0/80472268800.0,
+        -751.0/4180377600.0, -751.0/22992076800.0, 53.0/23775897600.0, 53.0/130767436800.0,
+        -1.0/95103590400.0, -1.0/523069747200.0,
+        143055.0/536870912.0, 143055.0/3489660928.0, -52048463.0/40693137408.0, -52048463.0/264505393152.0,
+        41520529709.0/45779779584000.0, 41520529709.0/297568567296000.0, -4094753.0/18393661440.0, -314981.0/9196830720.0,
+        114806549.0/4682022912000.0, 8831273.0/2341011456000.0, -1573.0/1170505728.0, -121.0/585252864.0,
+        8599.0/229920768000.0, 8599.0/1494484992000.0, -1.0/2011806720.0, -1.0/13076743680.0,
+        1.0/402361344000.0, 1.0/2615348736000.0,
+        -123981.0/4294967296.0, -41327.0/10737418240.0, 88069851773.0/634812943564800.0, 88069851773.0/4761097076736000.0,
+        -283001916031.0/2856658246041600.0, -1.3208996510667605e-05, 32282923.0/1307993702400.0, 32282923.0/9809952768000.0,
+        -2320991.0/832359628800.0, -2320991.0/6242697216000.0, 24797.0/156067430400.0, 24797.0/1170505728000.0,
+        -191.0/40874803200.0, -191.0/306561024000.0, 31.0/464950886400.0, 31.0/3487131648000.0,
+        -1.0/2789705318400.0, -1.0/20922789888000.0,
+        6435.0/4294967296.0, 6435.0/36507222016.0, -60997921.0/8464172580864.0, -3588113.0/4232086290432.0,
+        24615717239.0/4761097076736000.0, 1447983367.0/2380548538368000.0, -15313957.0/11771943321600.0, -900821.0/5885971660800.0,
+        5599613.0/37456183296000.0, 329389.0/18728091648000.0, -4097.0/468202291200.0, -241.0/234101145600.0,
+        493.0/1839366144000.0, 29.0/919683072000.0, -17.0/4184557977600.0, -1.0/2092278988800.0,
+        1.0/41845579776000.0, 1.0/355687428096000.0
+    };
+};
+
+template <>
+struct Lagrange_coefficients<9>{
+    static const int nb_polys = 20;
+    static const int degree = 19;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -12155.0/34359738368.0, 12155.0/326417514496.0, 1.7064550398580812e-06, -1.7962684630085064e-07,
+        -1.2442873530754756e-06, 1.3097761611320797e-07, 3.2404965881263263e-07, -3.411049040132975e-08,
+        -3.954932810076127e-08, 20583203.0/4944216195072000.0, 574123.0/224737099776000.0, -30217.0/112368549888000.0,
+        -85177.0/927040536576000.0, 4483.0/463520268288000.0, 1843.0/1004293914624000.0, -97.0/502146957312000.0,
+        -19.0/1004293914624000.0, 1.0/502146957312000.0, 7.809603484293113e-17, -8.22063524662433e-18,
+        258115.0/34359738368.0, -258115.0/292057776128.0, -176567806253.0/4875363406577664.0, 4.260745580639688e-06,
+        2.632306255637645e-05, -3.0968308889854648e-06, -6.809730262687727e-06, 8.011447367867914e-07,
+        8.218362709442215e-07, -478039553.0/4944216195072000.0, -11726651.0/224737099776000.0, 689803.0/112368549888000.0,
+        1696481.0/927040536576000.0, -99793.0/463520268288000.0, -35411.0/1004293914624000.0, 2083.0/502146957312000.0,
+        347.0/1004293914624000.0, -347.0/8536498274304000.0, -1.0/753220435968000.0, 1.0/6402373705728000.0,
+        -2632773.0/34359738368.0, 877591.0/85899345920.0, 0.0003691049780593786, -4.921399707458381e-05,
+        -93890451601.0/351588707205120.0, 93890451601.0/2636915304038400.0, 390950572757.0/5713316492083200.0, -9.12372754187474e-06,
+        -119065613.0/14649529466880.0, 119065613.0/109871471001600.0, 2515873.0/4994157772800.0, -2515873.0/37456183296000.0,
+        -23453.0/1373393387520.0, 23453.0/10300450406400.0, 2339.0/7439214182400.0, -2339.0/55794106368000.0,
+        -1.0/343348346880.0, 1.0/2575112601600.0, 1.0/94849980825600.0, -1.0/711374856192000.0,
+        17214285.0/34359738368.0, -17214285.0/223338299392.0, -301325882093.0/125009318117376.0, 301325882093.0/812560567762944.0,
+        15223129308449.0/8789717680128000.0, -0.0002664499565102565, -0.0004374625365697126, 6.73019287030327e-05,
+        167252679893.0/3296144130048000.0, -12865590761.0/1648072065024000.0, -25283687.0/8323596288000.0, 1944899.0/4161798144000.0,
+        30381173.0/309013512192000.0, -30381173.0/2008587829248000.0, -44131.0/25751126016000.0, 44131.0/167382319104000.0,
+        43.0/2861236224000.0, -43.0/18598035456000.0, -1.0/19313344512000.0, 1.0/125536739328000.0,
+        -20344155.0/8589934592.0, 20344155.0/47244640256.0, 420038797037.0/36934571261952.0, -420038797037.0/203140141940736.0,
+        -1614317130197.0/199766310912000.0, 1614317130197.0/1098714710016000.0, 11655039550261.0/5843164594176000.0, -0.0003626627430895242,
+        -5565466163.0/24970788864000.0, 5565466163.0/137339338752000.0, 237266921.0/18728091648000.0, -237266921.0/103004504064000.0,
+        -2709689.0/7023034368000.0, 2709689.0/38626689024000.0, 16097.0/2536095744000.0, -16097.0/13948526592000.0,
+        -31.0/585252864000.0, 31.0/3218890752000.0, 1.0/5706215424000.0, -1.0/31384184832000.0,
+        74595235.0/8589934592.0, -74595235.0/38654705664.0, -5627989416853.0/135426761293824.0, 5627989416853.0/609420425822208.0,
+        0.028956702487700416, -0.006434822775044536, -16338315391141.0/2380548538368000.0, 0.001525168126198327,
+        21976496609.0/30519853056000.0, -21976496609.0/137339338752000.0, -78886193.0/2080899072000.0, 78886193.0/9364045824000.0,
+        3085169.0/2861236224000.0, -3085169.0/12875563008000.0, -52051.0/3099672576000.0, 52051.0/13948526592000.0,
+        1249.0/9299017728000.0, -1249.0/41845579776000.0, -1.0/2324754432000.0, 1.0/10461394944000.0,
+        -223785705.0/8589934592.0, 223785705.0/30064771072.0, 1026746060333.0/8291434364928.0, -146678008619.0/4145717182464.0,
+        -48340498530569.0/582991478784000.0, 6905785504367.0/291495739392000.0, 23756538837541.0/1311730827264000.0, -23756538837541.0/4591057895424000.0,
+        -9521595307.0/5605687296000.0, 1360227901.0/2802843648000.0, 31244731.0/382205952000.0, -4463533.0/191102976000.0,
+        -3433361.0/1576599552000.0, 3433361.0/5518098432000.0, 6139.0/189775872000.0, -877.0/94887936000.0,
+        -427.0/1707982848000.0, 61.0/853991424000.0, 1.0/1280987136000.0, -1.0/4483454976000.0,
+        581842833.0/8589934592.0, -581842833.0/21474836480.0, -247405409067961.0/781308238233600.0, 247405409067961.0/1953270595584000.0,
+        16806356696509.0/87897176801280.0, -16806356696509.0/219742942003200.0, -33713953538869.0/988843239014400.0, 33713953538869.0/2472108097536000.0,
+        92459937313.0/32961441300480.0, -92459937313.0/82403603251200.0, -155120437.0/1248539443200.0, 155120437.0/3121348608000.0,
+        9684673.0/3090135121920.0, -9684673.0/7725337804800.0, -57763.0/1287556300800.0, 57763.0/3218890752000.0,
+        29.0/85837086720.0, -29.0/214592716800.0, -1.0/965667225600.0, 1.0/2414168064000.0,
+        -2909214165.0/17179869184.0, 969738055.0/8589934592.0, 46470394258517.0/62504659058688.0, -46470394258517.0/93756988588032.0,
+        -1205256936887881.0/4394858840064000.0, 1205256936887881.0/6592288260096000.0, 43764216991861.0/1098714710016000.0, -43764216991861.0/1648072065024000.0,
+        -539701836533.0/183119118336000.0, 539701836533.0/274678677504000.0, 1532491229.0/12485394432000.0, -1532491229.0/18728091648000.0,
+        -51149333.0/17167417344000.0, 51149333.0/25751126016000.0, 59491.0/1430618112000.0, -59491.0/2145927168000.0,
+        -1321.0/4291854336000.0, 1321.0/6437781504000.0, 1.0/1072963584000.0, -1.0/1609445376000.0,
+        10667118605.0/17179869184.0, -10667118605.0/8589934592.0, -8836799820077.0/17046725197824.0, 8836799820077.0/8523362598912.0,
+        172106808069881.0/1198597865472000.0, -172106808069881.0/599298932736000.0, -50173617185701.0/2696845197312000.0, 50173617185701.0/1348422598656000.0,
+        584383066237.0/449474199552000.0, -584383066237.0/224737099776000.0, -5890980853.0/112368549888000.0, 5890980853.0/56184274944000.0,
+        52574477.0/42138206208000.0, -52574477.0/21069103104000.0, -60371.0/3511517184000.0, 60371.0/1755758592000.0,
+        443.0/3511517184000.0, -443.0/1755758592000.0, -1.0/2633637888000.0, 1.0/1316818944000.0,
+        10667118605.0/17179869184.0, 10667118605.0/8589934592.0, -8836799820077.0/17046725197824.0, -8836799820077.0/8523362598912.0,
+        172106808069881.0/1198597865472000.0, 172106808069881.0/599298932736000.0, -50173617185701.0/2696845197312000.0, -50173617185701.0/1348422598656000.0,
+        584383066237.0/449474199552000.0, 584383066237.0/224737099776000.0, -5890980853.0/112368549888000.0, -5890980853.0/56184274944000.0,
+        52574477.0/42138206208000.0, 52574477.0/21069103104000.0, -60371.0/3511517184000.0, -60371.0/1755758592000.0,
+        443.0/3511517184000.0, 443.0/1755758592000.0, -1.0/2633637888000.0, -1.0/1316818944000.0,
+        -2909214165.0/17179869184.0, -969738055.0/8589934592.0, 46470394258517.0/62504659058688.0, 46470394258517.0/93756988588032.0,
+        -1205256936887881.0/4394858840064000.0, -1205256936887881.0/6592288260096000.0, 43764216991861.0/1098714710016000.0, 43764216991861.0/1648072065024000.0,
+        -539701836533.0/183119118336000.0, -539701836533.0/274678677504000.0, 1532491229.0/12485394432000.0, 1532491229.0/18728091648000.0,
+        -51149333.0/17167417344000.0, -51149333.0/25751126016000.0, 59491.0/1430618112000.0, 59491.0/2145927168000.0,
+        -1321.0/4291854336000.0, -1321.0/6437781504000.0, 1.0/1072963584000.0, 1.0/1609445376000.0,
+        581842833.0/8589934592.0, 581842833.0/21474836480.0, -247405409067961.0/781308238233600.0, -247405409067961.0/1953270595584000.0,
+        16806356696509.0/87897176801280.0, 16806356696509.0/219742942003200.0, -33713953538869.0/988843239014400.0, -33713953538869.0/2472108097536000.0,
+        92459937313.0/32961441300480.0, 92459937313.0/82403603251200.0, -155120437.0/1248539443200.0, -155120437.0/3121348608000.0,
+        9684673.0/3090135121920.0, 9684673.0/7725337804800.0, -57763.0/1287556300800.0, -57763.0/3218890752000.0,
+        29.0/85837086720.0, 29.0/214592716800.0, -1.0/965667225600.0, -1.0/2414168064000.0,
+        -223785705.0/8589934592.0, -223785705.0/30064771072.0, 1026746060333.0/8291434364928.0, 146678008619.0/4145717182464.0,
+        -48340498530569.0/582991478784000.0, -6905785504367.0/291495739392000.0, 23756538837541.0/1311730827264000.0, 23756538837541.0/4591057895424000.0,
+        -9521595307.0/5605687296000.0, -1360227901.0/2802843648000.0, 31244731.0/382205952000.0, 4463533.0/191102976000.0,
+        -3433361.0/1576599552000.0, -3433361.0/5518098432000.0, 6139.0/189775872000.0, 877.0/94887936000.0,
+        -427.0/1707982848000.0, -61.0/853991424000.0, 1.0/1280987136000.0, 1.0/4483454976000.0,
+        74595235.0/8589934592.0, 74595235.0/38654705664.0, -5627989416853.0/135426761293824.0, -5627989416853.0/609420425822208.0,
+        0.028956702487700416, 0.006434822775044536, -16338315391141.0/2380548538368000.0, -0.001525168126198327,
+        21976496609.0/30519853056000.0, 21976496609.0/137339338752000.0, -78886193.0/2080899072000.0, -78886193.0/9364045824000.0,
+        3085169.0/2861236224000.0, 3085169.0/12875563008000.0, -52051.0/3099672576000.0, -52051.0/13948526592000.0,
+        1249.0/9299017728000.0, 1249.0/41845579776000.0, -1.0/2324754432000.0, -1.0/10461394944000.0,
+        -20344155.0/8589934592.0, -20344155.0/47244640256.0, 420038797037.0/36934571261952.0, 420038797037.0/203140141940736.0,
+        -1614317130197.0/199766310912000.0, -1614317130197.0/1098714710016000.0, 11655039550261.0/5843164594176000.0, 0.0003626627430895242,
+        -5565466163.0/24970788864000.0, -5565466163.0/137339338752000.0, 237266921.0/18728091648000.0, 237266921.0/103004504064000.0,
+        -2709689.0/7023034368000.0, -2709689.0/38626689024000.0, 16097.0/2536095744000.0, 16097.0/13948526592000.0,
+        -31.0/585252864000.0, -31.0/3218890752000.0, 1.0/5706215424000.0, 1.0/31384184832000.0,
+        17214285.0/34359738368.0, 17214285.0/223338299392.0, -301325882093.0/125009318117376.0, -301325882093.0/812560567762944.0,
+        15223129308449.0/8789717680128000.0, 0.0002664499565102565, -0.0004374625365697126, -6.73019287030327e-05,
+        167252679893.0/3296144130048000.0, 12865590761.0/1648072065024000.0, -25283687.0/8323596288000.0, -1944899.0/4161798144000.0,
+        30381173.0/309013512192000.0, 30381173.0/2008587829248000.0, -44131.0/25751126016000.0, -44131.0/167382319104000.0,
+        43.0/2861236224000.0, 43.0/18598035456000.0, -1.0/19313344512000.0, -1.0/125536739328000.0,
+        -2632773.0/34359738368.0, -877591.0/85899345920.0, 0.0003691049780593786, 4.921399707458381e-05,
+        -93890451601.0/351588707205120.0, -93890451601.0/2636915304038400.0, 390950572757.0/5713316492083200.0, 9.12372754187474e-06,
+        -119065613.0/14649529466880.0, -119065613.0/109871471001600.0, 2515873.0/4994157772800.0, 2515873.0/37456183296000.0,
+        -23453.0/1373393387520.0, -23453.0/10300450406400.0, 2339.0/7439214182400.0, 2339.0/55794106368000.0,
+        -1.0/343348346880.0, -1.0/2575112601600.0, 1.0/94849980825600.0, 1.0/711374856192000.0,
+        258115.0/34359738368.0, 258115.0/292057776128.0, -176567806253.0/4875363406577664.0, -4.260745580639688e-06,
+        2.632306255637645e-05, 3.0968308889854648e-06, -6.809730262687727e-06, -8.011447367867914e-07,
+        8.218362709442215e-07, 478039553.0/4944216195072000.0, -11726651.0/224737099776000.0, -689803.0/112368549888000.0,
+        1696481.0/927040536576000.0, 99793.0/463520268288000.0, -35411.0/1004293914624000.0, -2083.0/502146957312000.0,
+        347.0/1004293914624000.0, 347.0/8536498274304000.0, -1.0/753220435968000.0, -1.0/6402373705728000.0,
+        -12155.0/34359738368.0, -12155.0/326417514496.0, 1.7064550398580812e-06, 1.7962684630085064e-07,
+        -1.2442873530754756e-06, -1.3097761611320797e-07, 3.2404965881263263e-07, 3.411049040132975e-08,
+        -3.954932810076127e-08, -20583203.0/4944216195072000.0, 574123.0/224737099776000.0, 30217.0/112368549888000.0,
+        -85177.0/927040536576000.0, -4483.0/463520268288000.0, 1843.0/1004293914624000.0, 97.0/502146957312000.0,
+        -19.0/1004293914624000.0, -1.0/502146957312000.0, 7.809603484293113e-17, 8.22063524662433e-18
+    };
+};
+
+template <>
+struct Lagrange_coefficients<10>{
+    static const int nb_polys = 22;
+    static const int degree = 21;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        46189.0/549755813888.0, -46189.0/5772436045824.0, -4.0621401159577214e-07, 3.868704872340687e-08,
+        3.0000891751294673e-07, -2.8572277858375878e-08, -8.023623437083045e-08, 7.641546130555282e-09,
+        1.0245727683964045e-08, -9.757835889489566e-10, -2008213.0/2825266397184000.0, 6.769569805630083e-11,
+        2.854437611513294e-11, -2.718512010965042e-12, -6.776319728288469e-13, 6.453637836465208e-14,
+        9.32247010926602e-15, -8.878542961205733e-16, -6.833403048756475e-17, 6.508002903577594e-18,
+        2.0551588116560824e-19, -1.9572941063391263e-20,
+        -1072071.0/549755813888.0, 1072071.0/5222680231936.0, 70849471501.0/7517567157534720.0, -9.92054869492395e-07,
+        -6.944456785821464e-06, 7.309954511391014e-07, 1.8485381118584112e-06, -1.9458295914299065e-07,
+        -2.3421815409607812e-07, 2.4654542536429275e-08, 1.605993450066835e-08, -1.690519421122984e-09,
+        -6.342237022574892e-10, 6.676038971131464e-11, 1.4710127634495997e-11, -1.548434487841684e-12,
+        -1.9604569651675443e-13, 2.0636389107026783e-14, 1.3764426141066612e-15, -1.448886962217538e-16,
+        -3.904801742146557e-18, 4.110317623312165e-19,
+        5990985.0/274877906944.0, -5990985.0/2336462209024.0, -88450000129.0/840198682312704.0, 88450000129.0/7141688799657984.0,
+        7.73245785335774e-05, -9.097009239244399e-06, -179748760619.0/8789717680128000.0, 10573456507.0/4394858840064000.0,
+        2.5636099772181093e-06, -3.016011737903658e-07, -1.730162387220494e-07, 100638787.0/4944216195072000.0,
+        1321597.0/197768647802880.0, -77741.0/98884323901440.0, -1.5045703367614767e-10, 106661.0/6025763487744000.0,
+        1193.0/618027024384000.0, -1193.0/5253229707264000.0, -1.0/77253378048000.0, 1.0/656653713408000.0,
+        3.4937699798153404e-17, -4.110317623312165e-18,
+        -43001959.0/274877906944.0, 43001959.0/2061584302080.0, 0.0007550082890753621, -0.00010066777187671495,
+        -0.0005520547381324956, 7.360729841766608e-05, 0.00014465237921634948, -1.9286983895513265e-05,
+        -1.7861047941957754e-05, 2.3814730589277004e-06, 2331747353.0/1977686478028800.0, -1.5720370772648788e-07,
+        -131102333.0/2966529717043200.0, 5.8925117001995334e-09, 2309471.0/2410305395097600.0, -1.2775537377669012e-10,
+        -18911.0/1606870263398400.0, 1.5691787470968377e-12, 7.54602936669822e-14, -1.006137248893096e-14,
+        -1.0/5121898964582400.0, 2.6032011614310378e-17,
+        446558805.0/549755813888.0, -446558805.0/3573412790272.0, -150946976749.0/38551626448896.0, 150946976749.0/250585571917824.0,
+        0.002843457756702135, -0.00043745503949263616, -4305425132209.0/5859811786752000.0, 0.00011303658229440606,
+        8.870234050407351e-05, -1.3646513923703616e-05, -37385681489.0/6592288260096000.0, 2875821653.0/3296144130048000.0,
+        1793749.0/8789717680128.0, -1793749.0/57133164920832.0, -2610779.0/618027024384000.0, 2610779.0/4017175658496000.0,
+        20423.0/412018016256000.0, -1571.0/206009008128000.0, -89.0/291846094848000.0, 89.0/1896999616512000.0,
+        1.0/1313307426816000.0, -1.0/8536498274304000.0,
+        -1794354471.0/549755813888.0, 1794354471.0/3023656976384.0, 210416109541.0/13400297963520.0, -19128737231.0/6700148981760.0,
+        -0.011278822942945455, 0.0020506950805355374, 3947220404369.0/1385046422323200.0, -358838218579.0/692523211161600.0,
+        -0.000332088279934693, 6.037968726085327e-05, 808874071.0/39953262182400.0, -808874071.0/219742942003200.0,
+        -1033915487.0/1498247331840000.0, 93992317.0/749123665920000.0, 1982299.0/146079114854400.0, -180209.0/73039557427200.0,
+        -123629.0/811550638080000.0, 11239.0/405775319040000.0, 11.0/12173259571200.0, -1.0/6086629785600.0,
+        -1.0/456497233920000.0, 1.0/2510734786560000.0,
+        731033303.0/68719476736.0, -731033303.0/309237645312.0, -939776089243.0/18425409699840.0, 939776089243.0/82914343649280.0,
+        0.0359337098733815, -0.007985268860751444, -57545603312503.0/6592288260096000.0, 0.0019398289854267788,
+        0.0009583468061664966, -0.00021296595692588813, -14953547069.0/274678677504000.0, 14953547069.0/1236054048768000.0,
+        3588867181.0/2060090081280000.0, -3.871316344218762e-07, -10897067.0/334764638208000.0, 10897067.0/1506440871936000.0,
+        30139.0/85837086720000.0, -30139.0/386266890240000.0, -13.0/6437781504000.0, 13.0/28970016768000.0,
+        1.0/209227898880000.0, -1.0/941525544960000.0,
+        -2014071345.0/68719476736.0, 2014071345.0/240518168576.0, 25203280511881.0/180569015058432.0, -25203280511881.0/631991552704512.0,
+        -457289569977769.0/4836670046208000.0, 0.027013247048602244, 28866926227859.0/1360313450496000.0, -28866926227859.0/4761097076736000.0,
+        -0.002095684243320791, 0.0005987669266630832, 4288880381.0/39239811072000.0, -4288880381.0/137339338752000.0,
+        -7732001.0/2354388664320.0, 7732001.0/8240360325120.0, 58865383.0/1004293914624000.0, -58865383.0/3515028701184000.0,
+        -6497.0/10627448832000.0, 6497.0/37196070912000.0, 41.0/11955879936000.0, -41.0/41845579776000.0,
+        -1.0/125536739328000.0, 1.0/439378587648000.0,
+        19737899181.0/274877906944.0, -19737899181.0/687194767360.0, -123942714702593.0/368508193996800.0, 123942714702593.0/921270484992000.0,
+        0.20574017045488693, -0.08229606818195477, -289335917814521.0/7617755322777600.0, 0.015192712580273465,
+        0.003301499387654634, -0.0013205997550618535, -104606438701.0/659228826009600.0, 104606438701.0/1648072065024000.0,
+        165431143.0/36623823667200.0, -165431143.0/91559559168000.0, -62421907.0/803435131699200.0, 62421907.0/2008587829248000.0,
+        422887.0/535623421132800.0, -422887.0/1339058552832000.0, -97.0/22317642547200.0, 97.0/55794106368000.0,
+        1.0/100429391462400.0, -1.0/251073478656000.0,
+        -47517164695.0/274877906944.0, 47517164695.0/412316860416.0, 23283199162981.0/30614526885888.0, -23283199162981.0/45921790328832.0,
+        -0.28683984291899184, 0.19122656194599458, 0.04320131303693926, -0.02880087535795951,
+        -0.0033774900311625985, 0.0022516600207750656, 0.00015258941128190563, -0.00010172627418793709,
+        -2478844609.0/593305943408640.0, 2478844609.0/889958915112960.0, 64927963.0/927040536576000.0, -64927963.0/1390560804864000.0,
+        -432151.0/618027024384000.0, 432151.0/927040536576000.0, 881.0/231760134144000.0, -881.0/347640201216000.0,
+        -1.0/115880067072000.0, 1.0/173820100608000.0,
+        85530896451.0/137438953472.0, -85530896451.0/68719476736.0, -4466401943761.0/8504035246080.0, 4466401943761.0/4252017623040.0,
+        0.14862906705454182, -0.29725813410908364, -87687135005641.0/4394858840064000.0, 87687135005641.0/2197429420032000.0,
+        0.0014722354304840305, -0.002944470860968061, -318230562241.0/4944216195072000.0, 318230562241.0/2472108097536000.0,
+        1.7270989979991457e-06, -21347877091.0/6180270243840000.0, -13244531.0/463520268288000.0, 13244531.0/231760134144000.0,
+        436847.0/1545067560960000.0, -436847.0/772533780480000.0, -59.0/38626689024000.0, 59.0/19313344512000.0,
+        1.0/289700167680000.0, -1.0/144850083840000.0,
+        85530896451.0/137438953472.0, 85530896451.0/68719476736.0, -4466401943761.0/8504035246080.0, -4466401943761.0/4252017623040.0,
+        0.14862906705454182, 0.29725813410908364, -87687135005641.0/4394858840064000.0, -87687135005641.0/2197429420032000.0,
+        0.0014722354304840305, 0.002944470860968061, -318230562241.0/4944216195072000.0, -318230562241.0/2472108097536000.0,
+        1.7270989979991457e-06, 21347877091.0/6180270243840000.0, -13244531.0/463520268288000.0, -13244531.0/231760134144000.0,
+        436847.0/1545067560960000.0, 436847.0/772533780480000.0, -59.0/38626689024000.0, -59.0/19313344512000.0,
+        1.0/289700167680000.0, 1.0/144850083840000.0,
+        -47517164695.0/274877906944.0, -47517164695.0/412316860416.0, 23283199162981.0/30614526885888.0, 23283199162981.0/45921790328832.0,
+        -0.28683984291899184, -0.19122656194599458, 0.04320131303693926, 0.02880087535795951,
+        -0.0033774900311625985, -0.0022516600207750656, 0.00015258941128190563, 0.00010172627418793709,
+        -2478844609.0/593305943408640.0, -2478844609.0/889958915112960.0, 64927963.0/927040536576000.0, 64927963.0/1390560804864000.0,
+        -432151.0/618027024384000.0, -432151.0/927040536576000.0, 881.0/231760134144000.0, 881.0/347640201216000.0,
+        -1.0/115880067072000.0, -1.0/173820100608000.0,
+        19737899181.0/274877906944.0, 19737899181.0/687194767360.0, -123942714702593.0/368508193996800.0, -123942714702593.0/921270484992000.0,
+        0.20574017045488693, 0.08229606818195477, -289335917814521.0/7617755322777600.0, -0.015192712580273465,
+        0.003301499387654634, 0.0013205997550618535, -104606438701.0/659228826009600.0, -104606438701.0/1648072065024000.0,
+        165431143.0/36623823667200.0, 165431143.0/91559559168000.0, -62421907.0/803435131699200.0, -62421907.0/2008587829248000.0,
+        422887.0/535623421132800.0, 422887.0/1339058552832000.0, -97.0/22317642547200.0, -97.0/55794106368000.0,
+        1.0/100429391462400.0, 1.0/251073478656000.0,
+        -2014071345.0/68719476736.0, -2014071345.0/240518168576.0, 25203280511881.0/180569015058432.0, 25203280511881.0/631991552704512.0,
+        -457289569977769.0/4836670046208000.0, -0.027013247048602244, 28866926227859.0/1360313450496000.0, 28866926227859.0/4761097076736000.0,
+        -0.002095684243320791, -0.0005987669266630832, 4288880381.0/39239811072000.0, 4288880381.0/137339338752000.0,
+        -7732001.0/2354388664320.0, -7732001.0/8240360325120.0, 58865383.0/1004293914624000.0, 58865383.0/3515028701184000.0,
+        -6497.0/10627448832000.0, -6497.0/37196070912000.0, 41.0/11955879936000.0, 41.0/41845579776000.0,
+        -1.0/125536739328000.0, -1.0/439378587648000.0,
+        731033303.0/68719476736.0, 731033303.0/309237645312.0, -939776089243.0/18425409699840.0, -939776089243.0/82914343649280.0,
+        0.0359337098733815, 0.007985268860751444, -57545603312503.0/6592288260096000.0, -0.0019398289854267788,
+        0.0009583468061664966, 0.00021296595692588813, -14953547069.0/274678677504000.0, -14953547069.0/1236054048768000.0,
+        3588867181.0/2060090081280000.0, 3.871316344218762e-07, -10897067.0/334764638208000.0, -10897067.0/1506440871936000.0,
+        30139.0/85837086720000.0, 30139.0/386266890240000.0, -13.0/6437781504000.0, -13.0/28970016768000.0,
+        1.0/209227898880000.0, 1.0/941525544960000.0,
+        -1794354471.0/549755813888.0, -1794354471.0/3023656976384.0, 210416109541.0/13400297963520.0, 19128737231.0/6700148981760.0,
+        -0.011278822942945455, -0.0020506950805355374, 3947220404369.0/1385046422323200.0, 358838218579.0/692523211161600.0,
+        -0.000332088279934693, -6.037968726085327e-05, 808874071.0/39953262182400.0, 808874071.0/219742942003200.0,
+        -1033915487.0/1498247331840000.0, -93992317.0/749123665920000.0, 1982299.0/146079114854400.0, 180209.0/73039557427200.0,
+        -123629.0/811550638080000.0, -11239.0/405775319040000.0, 11.0/12173259571200.0, 1.0/6086629785600.0,
+        -1.0/456497233920000.0, -1.0/2510734786560000.0,
+        446558805.0/549755813888.0, 446558805.0/3573412790272.0, -150946976749.0/38551626448896.0, -150946976749.0/250585571917824.0,
+        0.002843457756702135, 0.00043745503949263616, -4305425132209.0/5859811786752000.0, -0.00011303658229440606,
+        8.870234050407351e-05, 1.3646513923703616e-05, -37385681489.0/6592288260096000.0, -2875821653.0/3296144130048000.0,
+        1793749.0/8789717680128.0, 1793749.0/57133164920832.0, -2610779.0/618027024384000.0, -2610779.0/4017175658496000.0,
+        20423.0/412018016256000.0, 1571.0/206009008128000.0, -89.0/291846094848000.0, -89.0/1896999616512000.0,
+        1.0/1313307426816000.0, 1.0/8536498274304000.0,
+        -43001959.0/274877906944.0, -43001959.0/2061584302080.0, 0.0007550082890753621, 0.00010066777187671495,
+        -0.0005520547381324956, -7.360729841766608e-05, 0.00014465237921634948, 1.9286983895513265e-05,
+        -1.7861047941957754e-05, -2.3814730589277004e-06, 2331747353.0/1977686478028800.0, 1.5720370772648788e-07,
+        -131102333.0/2966529717043200.0, -5.8925117001995334e-09, 2309471.0/2410305395097600.0, 1.2775537377669012e-10,
+        -18911.0/1606870263398400.0, -1.5691787470968377e-12, 7.54602936669822e-14, 1.006137248893096e-14,
+        -1.0/5121898964582400.0, -2.6032011614310378e-17,
+        5990985.0/274877906944.0, 5990985.0/2336462209024.0, -88450000129.0/840198682312704.0, -88450000129.0/7141688799657984.0,
+        7.73245785335774e-05, 9.097009239244399e-06, -179748760619.0/8789717680128000.0, -10573456507.0/4394858840064000.0,
+        2.5636099772181093e-06, 3.016011737903658e-07, -1.730162387220494e-07, -100638787.0/4944216195072000.0,
+        1321597.0/197768647802880.0, 77741.0/98884323901440.0, -1.5045703367614767e-10, -106661.0/6025763487744000.0,
+        1193.0/618027024384000.0, 1193.0/5253229707264000.0, -1.0/77253378048000.0, -1.0/656653713408000.0,
+        3.4937699798153404e-17, 4.110317623312165e-18,
+        -1072071.0/549755813888.0, -1072071.0/5222680231936.0, 70849471501.0/7517567157534720.0, 9.92054869492395e-07,
+        -6.944456785821464e-06, -7.309954511391014e-07, 1.8485381118584112e-06, 1.9458295914299065e-07,
+        -2.3421815409607812e-07, -2.4654542536429275e-08, 1.605993450066835e-08, 1.690519421122984e-09,
+        -6.342237022574892e-10, -6.676038971131464e-11, 1.4710127634495997e-11, 1.548434487841684e-12,
+        -1.9604569651675443e-13, -2.0636389107026783e-14, 1.3764426141066612e-15, 1.448886962217538e-16,
+        -3.904801742146557e-18, -4.110317623312165e-19,
+        46189.0/549755813888.0, 46189.0/5772436045824.0, -4.0621401159577214e-07, -3.868704872340687e-08,
+        3.0000891751294673e-07, 2.8572277858375878e-08, -8.023623437083045e-08, -7.641546130555282e-09,
+        1.0245727683964045e-08, 9.757835889489566e-10, -2008213.0/2825266397184000.0, -6.769569805630083e-11,
+        2.854437611513294e-11, 2.718512010965042e-12, -6.776319728288469e-13, -6.453637836465208e-14,
+        9.32247010926602e-15, 8.878542961205733e-16, -6.833403048756475e-17, -6.508002903577594e-18,
+        2.0551588116560824e-19, 1.9572941063391263e-20
+    };
+};
+
+template <>
+struct spline_coefficients<1,0>{
+    static const int nb_polys = 4;
+    static const int degree = 1;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        0.0, 0.0,
+        1.0/2.0, -1.0,
+        1.0/2.0, 1.0,
+        0.0, 0.0
+    };
+};
+
+template <>
+struct spline_coefficients<1,1>{
+    static const int nb_polys = 4;
+    static const int degree = 3;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -1.0/16.0, 1.0/8.0, 1.0/4.0, -1.0/2.0,
+        9.0/16.0, -11.0/8.0, -1.0/4.0, 3.0/2.0,
+        9.0/16.0, 11.0/8.0, -1.0/4.0, -3.0/2.0,
+        -1.0/16.0, -1.0/8.0, 1.0/4.0, 1.0/2.0
+    };
+};
+
+template <>
+struct spline_coefficients<1,2>{
+    static const int nb_polys = 4;
+    static const int degree = 5;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -1.0/16.0, 3.0/16.0, 1.0/4.0, -1.0,
+        0.0, 1.0,
+        9.0/16.0, -25.0/16.0, -1.0/4.0, 3.0,
+        0.0, -3.0,
+        9.0/16.0, 25.0/16.0, -1.0/4.0, -3.0,
+        0.0, 3.0,
+        -1.0/16.0, -3.0/16.0, 1.0/4.0, 1.0,
+        0.0, -1.0
+    };
+};
+
+template <>
+struct spline_coefficients<2,0>{
+    static const int nb_polys = 6;
+    static const int degree = 1;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        0.0, 0.0,
+        0.0, 0.0,
+        1.0/2.0, -1.0,
+        1.0/2.0, 1.0,
+        0.0, 0.0,
+        0.0, 0.0
+    };
+};
+
+template <>
+struct spline_coefficients<2,1>{
+    static const int nb_polys = 6;
+    static const int degree = 3;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        1.0/96.0, -1.0/48.0, -1.0/24.0, 1.0/12.0,
+        -3.0/32.0, 7.0/48.0, 3.0/8.0, -7.0/12.0,
+        7.0/12.0, -4.0/3.0, -1.0/3.0, 4.0/3.0,
+        7.0/12.0, 4.0/3.0, -1.0/3.0, -4.0/3.0,
+        -3.0/32.0, -7.0/48.0, 3.0/8.0, 7.0/12.0,
+        1.0/96.0, 1.0/48.0, -1.0/24.0, -1.0/12.0
+    };
+};
+
+template <>
+struct spline_coefficients<2,2>{
+    static const int nb_polys = 6;
+    static const int degree = 5;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        3.0/256.0, -13.0/384.0, -5.0/96.0, 3.0/16.0,
+        1.0/48.0, -5.0/24.0,
+        -25.0/256.0, 27.0/128.0, 13.0/32.0, -53.0/48.0,
+        -1.0/16.0, 25.0/24.0,
+        75.0/128.0, -281.0/192.0, -17.0/48.0, 19.0/8.0,
+        1.0/24.0, -25.0/12.0,
+        75.0/128.0, 281.0/192.0, -17.0/48.0, -19.0/8.0,
+        1.0/24.0, 25.0/12.0,
+        -25.0/256.0, -27.0/128.0, 13.0/32.0, 53.0/48.0,
+        -1.0/16.0, -25.0/24.0,
+        3.0/256.0, 13.0/384.0, -5.0/96.0, -3.0/16.0,
+        1.0/48.0, 5.0/24.0
+    };
+};
+
+template <>
+struct spline_coefficients<2,3>{
+    static const int nb_polys = 6;
+    static const int degree = 7;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        3.0/256.0, -11.0/256.0, -5.0/96.0, 19.0/64.0,
+        1.0/48.0, -31.0/48.0, 0.0, 7.0/12.0,
+        -25.0/256.0, 197.0/768.0, 13.0/32.0, -317.0/192.0,
+        -1.0/16.0, 155.0/48.0, 0.0, -35.0/12.0,
+        75.0/128.0, -199.0/128.0, -17.0/48.0, 111.0/32.0,
+        1.0/24.0, -155.0/24.0, 0.0, 35.0/6.0,
+        75.0/128.0, 199.0/128.0, -17.0/48.0, -111.0/32.0,
+        1.0/24.0, 155.0/24.0, 0.0, -35.0/6.0,
+        -25.0/256.0, -197.0/768.0, 13.0/32.0, 317.0/192.0,
+        -1.0/16.0, -155.0/48.0, 0.0, 35.0/12.0,
+        3.0/256.0, 11.0/256.0, -5.0/96.0, -19.0/64.0,
+        1.0/48.0, 31.0/48.0, 0.0, -7.0/12.0
+    };
+};
+
+template <>
+struct spline_coefficients<2,4>{
+    static const int nb_polys = 6;
+    static const int degree = 9;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        3.0/256.0, -155.0/3072.0, -5.0/96.0, 5.0/12.0,
+        1.0/48.0, -131.0/96.0, 0.0, 5.0/2.0,
+        0.0, -23.0/12.0,
+        -25.0/256.0, 301.0/1024.0, 13.0/32.0, -9.0/4.0,
+        -1.0/16.0, 655.0/96.0, 0.0, -25.0/2.0,
+        0.0, 115.0/12.0,
+        75.0/128.0, -2503.0/1536.0, -17.0/48.0, 14.0/3.0,
+        1.0/24.0, -655.0/48.0, 0.0, 25.0,
+        0.0, -115.0/6.0,
+        75.0/128.0, 2503.0/1536.0, -17.0/48.0, -14.0/3.0,
+        1.0/24.0, 655.0/48.0, 0.0, -25.0,
+        0.0, 115.0/6.0,
+        -25.0/256.0, -301.0/1024.0, 13.0/32.0, 9.0/4.0,
+        -1.0/16.0, -655.0/96.0, 0.0, 25.0/2.0,
+        0.0, -115.0/12.0,
+        3.0/256.0, 155.0/3072.0, -5.0/96.0, -5.0/12.0,
+        1.0/48.0, 131.0/96.0, 0.0, -5.0/2.0,
+        0.0, 23.0/12.0
+    };
+};
+
+template <>
+struct spline_coefficients<3,0>{
+    static const int nb_polys = 8;
+    static const int degree = 1;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        1.0/2.0, -1.0,
+        1.0/2.0, 1.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0
+    };
+};
+
+template <>
+struct spline_coefficients<3,1>{
+    static const int nb_polys = 8;
+    static const int degree = 3;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -1.0/480.0, 1.0/240.0, 1.0/120.0, -1.0/60.0,
+        1.0/48.0, -1.0/30.0, -1.0/12.0, 2.0/15.0,
+        -9.0/80.0, 3.0/20.0, 9.0/20.0, -3.0/5.0,
+        19.0/32.0, -21.0/16.0, -3.0/8.0, 5.0/4.0,
+        19.0/32.0, 21.0/16.0, -3.0/8.0, -5.0/4.0,
+        -9.0/80.0, -3.0/20.0, 9.0/20.0, 3.0/5.0,
+        1.0/48.0, 1.0/30.0, -1.0/12.0, -2.0/15.0,
+        -1.0/480.0, -1.0/240.0, 1.0/120.0, 1.0/60.0
+    };
+};
+
+template <>
+struct spline_coefficients<3,2>{
+    static const int nb_polys = 8;
+    static const int degree = 5;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -7.0/2880.0, 1.0/144.0, 1.0/90.0, -7.0/180.0,
+        -1.0/180.0, 2.0/45.0,
+        55.0/2304.0, -307.0/5760.0, -31.0/288.0, 211.0/720.0,
+        7.0/144.0, -23.0/72.0,
+        -153.0/1280.0, 27.0/128.0, 81.0/160.0, -87.0/80.0,
+        -9.0/80.0, 39.0/40.0,
+        689.0/1152.0, -815.0/576.0, -59.0/144.0, 149.0/72.0,
+        5.0/72.0, -59.0/36.0,
+        689.0/1152.0, 815.0/576.0, -59.0/144.0, -149.0/72.0,
+        5.0/72.0, 59.0/36.0,
+        -153.0/1280.0, -27.0/128.0, 81.0/160.0, 87.0/80.0,
+        -9.0/80.0, -39.0/40.0,
+        55.0/2304.0, 307.0/5760.0, -31.0/288.0, -211.0/720.0,
+        7.0/144.0, 23.0/72.0,
+        -7.0/2880.0, -1.0/144.0, 1.0/90.0, 7.0/180.0,
+        -1.0/180.0, -2.0/45.0
+    };
+};
+
+template <>
+struct spline_coefficients<3,3>{
+    static const int nb_polys = 8;
+    static const int degree = 7;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -5.0/2048.0, 409.0/46080.0, 259.0/23040.0, -143.0/2304.0,
+        -7.0/1152.0, 79.0/576.0, 1.0/1440.0, -89.0/720.0,
+        49.0/2048.0, -3079.0/46080.0, -499.0/4608.0, 1049.0/2304.0,
+        59.0/1152.0, -2789.0/2880.0, -1.0/288.0, 623.0/720.0,
+        -245.0/2048.0, 3863.0/15360.0, 1299.0/2560.0, -403.0/256.0,
+        -15.0/128.0, 187.0/64.0, 1.0/160.0, -623.0/240.0,
+        1225.0/2048.0, -13663.0/9216.0, -1891.0/4608.0, 6637.0/2304.0,
+        83.0/1152.0, -2813.0/576.0, -1.0/288.0, 623.0/144.0,
+        1225.0/2048.0, 13663.0/9216.0, -1891.0/4608.0, -6637.0/2304.0,
+        83.0/1152.0, 2813.0/576.0, -1.0/288.0, -623.0/144.0,
+        -245.0/2048.0, -3863.0/15360.0, 1299.0/2560.0, 403.0/256.0,
+        -15.0/128.0, -187.0/64.0, 1.0/160.0, 623.0/240.0,
+        49.0/2048.0, 3079.0/46080.0, -499.0/4608.0, -1049.0/2304.0,
+        59.0/1152.0, 2789.0/2880.0, -1.0/288.0, -623.0/720.0,
+        -5.0/2048.0, -409.0/46080.0, 259.0/23040.0, 143.0/2304.0,
+        -7.0/1152.0, -79.0/576.0, 1.0/1440.0, 89.0/720.0
+    };
+};
+
+template <>
+struct spline_coefficients<3,4>{
+    static const int nb_polys = 8;
+    static const int degree = 9;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -5.0/2048.0, 107.0/10240.0, 259.0/23040.0, -67.0/768.0,
+        -7.0/1152.0, 83.0/288.0, 1.0/1440.0, -379.0/720.0,
+        0.0, 29.0/72.0,
+        49.0/2048.0, -797.0/10240.0, -499.0/4608.0, 485.0/768.0,
+        59.0/1152.0, -2917.0/1440.0, -1.0/288.0, 2653.0/720.0,
+        0.0, -203.0/72.0,
+        -245.0/2048.0, 8741.0/30720.0, 1299.0/2560.0, -1615.0/768.0,
+        -15.0/128.0, 195.0/32.0, 1.0/160.0, -2653.0/240.0,
+        0.0, 203.0/24.0,
+        1225.0/2048.0, -3149.0/2048.0, -1891.0/4608.0, 963.0/256.0,
+        83.0/1152.0, -2929.0/288.0, -1.0/288.0, 2653.0/144.0,
+        0.0, -1015.0/72.0,
+        1225.0/2048.0, 3149.0/2048.0, -1891.0/4608.0, -963.0/256.0,
+        83.0/1152.0, 2929.0/288.0, -1.0/288.0, -2653.0/144.0,
+        0.0, 1015.0/72.0,
+        -245.0/2048.0, -8741.0/30720.0, 1299.0/2560.0, 1615.0/768.0,
+        -15.0/128.0, -195.0/32.0, 1.0/160.0, 2653.0/240.0,
+        0.0, -203.0/24.0,
+        49.0/2048.0, 797.0/10240.0, -499.0/4608.0, -485.0/768.0,
+        59.0/1152.0, 2917.0/1440.0, -1.0/288.0, -2653.0/720.0,
+        0.0, 203.0/72.0,
+        -5.0/2048.0, -107.0/10240.0, 259.0/23040.0, 67.0/768.0,
+        -7.0/1152.0, -83.0/288.0, 1.0/1440.0, 379.0/720.0,
+        0.0, -29.0/72.0
+    };
+};
+
+template <>
+struct spline_coefficients<3,5>{
+    static const int nb_polys = 8;
+    static const int degree = 11;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -5.0/2048.0, 871.0/73728.0, 259.0/23040.0, -2111.0/18432.0,
+        -7.0/1152.0, 389.0/768.0, 1.0/1440.0, -4031.0/2880.0,
+        0.0, 619.0/288.0, 0.0, -503.0/360.0,
+        49.0/2048.0, -32213.0/368640.0, -499.0/4608.0, 15161.0/18432.0,
+        59.0/1152.0, -4549.0/1280.0, -1.0/288.0, 28217.0/2880.0,
+        0.0, -4333.0/288.0, 0.0, 3521.0/360.0,
+        -245.0/2048.0, 7697.0/24576.0, 1299.0/2560.0, -16441.0/6144.0,
+        -15.0/128.0, 8201.0/768.0, 1.0/160.0, -28217.0/960.0,
+        0.0, 4333.0/96.0, 0.0, -3521.0/120.0,
+        1225.0/2048.0, -116885.0/73728.0, -1891.0/4608.0, 86941.0/18432.0,
+        83.0/1152.0, -13679.0/768.0, -1.0/288.0, 28217.0/576.0,
+        0.0, -21665.0/288.0, 0.0, 3521.0/72.0,
+        1225.0/2048.0, 116885.0/73728.0, -1891.0/4608.0, -86941.0/18432.0,
+        83.0/1152.0, 13679.0/768.0, -1.0/288.0, -28217.0/576.0,
+        0.0, 21665.0/288.0, 0.0, -3521.0/72.0,
+        -245.0/2048.0, -7697.0/24576.0, 1299.0/2560.0, 16441.0/6144.0,
+        -15.0/128.0, -8201.0/768.0, 1.0/160.0, 28217.0/960.0,
+        0.0, -4333.0/96.0, 0.0, 3521.0/120.0,
+        49.0/2048.0, 32213.0/368640.0, -499.0/4608.0, -15161.0/18432.0,
+        59.0/1152.0, 4549.0/1280.0, -1.0/288.0, -28217.0/2880.0,
+        0.0, 4333.0/288.0, 0.0, -3521.0/360.0,
+        -5.0/2048.0, -871.0/73728.0, 259.0/23040.0, 2111.0/18432.0,
+        -7.0/1152.0, -389.0/768.0, 1.0/1440.0, 4031.0/2880.0,
+        0.0, -619.0/288.0, 0.0, 503.0/360.0
+    };
+};
+
+template <>
+struct spline_coefficients<3,6>{
+    static const int nb_polys = 8;
+    static const int degree = 13;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -5.0/2048.0, 9611.0/737280.0, 259.0/23040.0, -6629.0/46080.0,
+        -7.0/1152.0, 819.0/1024.0, 1.0/1440.0, -1067.0/360.0,
+        0.0, 3941.0/576.0, 0.0, -1603.0/180.0,
+        0.0, 901.0/180.0,
+        49.0/2048.0, -70733.0/737280.0, -499.0/4608.0, 47363.0/46080.0,
+        59.0/1152.0, -86123.0/15360.0, -1.0/288.0, 7469.0/360.0,
+        0.0, -27587.0/576.0, 0.0, 11221.0/180.0,
+        0.0, -6307.0/180.0,
+        -245.0/2048.0, 27759.0/81920.0, 1299.0/2560.0, -50563.0/15360.0,
+        -15.0/128.0, 51725.0/3072.0, 1.0/160.0, -7469.0/120.0,
+        0.0, 27587.0/192.0, 0.0, -11221.0/60.0,
+        0.0, 6307.0/60.0,
+        1225.0/2048.0, -240077.0/147456.0, -1891.0/4608.0, 52931.0/9216.0,
+        83.0/1152.0, -86251.0/3072.0, -1.0/288.0, 7469.0/72.0,
+        0.0, -137935.0/576.0, 0.0, 11221.0/36.0,
+        0.0, -6307.0/36.0,
+        1225.0/2048.0, 240077.0/147456.0, -1891.0/4608.0, -52931.0/9216.0,
+        83.0/1152.0, 86251.0/3072.0, -1.0/288.0, -7469.0/72.0,
+        0.0, 137935.0/576.0, 0.0, -11221.0/36.0,
+        0.0, 6307.0/36.0,
+        -245.0/2048.0, -27759.0/81920.0, 1299.0/2560.0, 50563.0/15360.0,
+        -15.0/128.0, -51725.0/3072.0, 1.0/160.0, 7469.0/120.0,
+        0.0, -27587.0/192.0, 0.0, 11221.0/60.0,
+        0.0, -6307.0/60.0,
+        49.0/2048.0, 70733.0/737280.0, -499.0/4608.0, -47363.0/46080.0,
+        59.0/1152.0, 86123.0/15360.0, -1.0/288.0, -7469.0/360.0,
+        0.0, 27587.0/576.0, 0.0, -11221.0/180.0,
+        0.0, 6307.0/180.0,
+        -5.0/2048.0, -9611.0/737280.0, 259.0/23040.0, 6629.0/46080.0,
+        -7.0/1152.0, -819.0/1024.0, 1.0/1440.0, 1067.0/360.0,
+        0.0, -3941.0/576.0, 0.0, 1603.0/180.0,
+        0.0, -901.0/180.0
+    };
+};
+
+template <>
+struct spline_coefficients<4,0>{
+    static const int nb_polys = 10;
+    static const int degree = 1;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        1.0/2.0, -1.0,
+        1.0/2.0, 1.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0
+    };
+};
+
+template <>
+struct spline_coefficients<4,1>{
+    static const int nb_polys = 10;
+    static const int degree = 3;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        1.0/2240.0, -1.0/1120.0, -1.0/560.0, 1.0/280.0,
+        -1.0/192.0, 29.0/3360.0, 1.0/48.0, -29.0/840.0,
+        5.0/168.0, -17.0/420.0, -5.0/42.0, 17.0/105.0,
+        -1.0/8.0, 3.0/20.0, 1.0/2.0, -3.0/5.0,
+        3.0/5.0, -13.0/10.0, -2.0/5.0, 6.0/5.0,
+        3.0/5.0, 13.0/10.0, -2.0/5.0, -6.0/5.0,
+        -1.0/8.0, -3.0/20.0, 1.0/2.0, 3.0/5.0,
+        5.0/168.0, 17.0/420.0, -5.0/42.0, -17.0/105.0,
+        -1.0/192.0, -29.0/3360.0, 1.0/48.0, 29.0/840.0,
+        1.0/2240.0, 1.0/1120.0, -1.0/560.0, -1.0/280.0
+    };
+};
+
+template <>
+struct spline_coefficients<4,2>{
+    static const int nb_polys = 10;
+    static const int degree = 5;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        19.0/35840.0, -27.0/17920.0, -11.0/4480.0, 19.0/2240.0,
+        3.0/2240.0, -11.0/1120.0,
+        -283.0/46080.0, 2299.0/161280.0, 163.0/5760.0, -229.0/2880.0,
+        -43.0/2880.0, 907.0/10080.0,
+        139.0/4032.0, -643.0/10080.0, -79.0/504.0, 439.0/1260.0,
+        19.0/252.0, -47.0/126.0,
+        -43.0/320.0, 33.0/160.0, 23.0/40.0, -21.0/20.0,
+        -3.0/20.0, 9.0/10.0,
+        13951.0/23040.0, -15967.0/11520.0, -1279.0/2880.0, 2719.0/1440.0,
+        127.0/1440.0, -991.0/720.0,
+        13951.0/23040.0, 15967.0/11520.0, -1279.0/2880.0, -2719.0/1440.0,
+        127.0/1440.0, 991.0/720.0,
+        -43.0/320.0, -33.0/160.0, 23.0/40.0, 21.0/20.0,
+        -3.0/20.0, -9.0/10.0,
+        139.0/4032.0, 643.0/10080.0, -79.0/504.0, -439.0/1260.0,
+        19.0/252.0, 47.0/126.0,
+        -283.0/46080.0, -2299.0/161280.0, 163.0/5760.0, 229.0/2880.0,
+        -43.0/2880.0, -907.0/10080.0,
+        19.0/35840.0, 27.0/17920.0, -11.0/4480.0, -19.0/2240.0,
+        3.0/2240.0, 11.0/1120.0
+    };
+};
+
+template <>
+struct spline_coefficients<4,3>{
+    static const int nb_polys = 10;
+    static const int degree = 7;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        689.0/1290240.0, -1247.0/645120.0, -269.0/107520.0, 731.0/53760.0,
+        41.0/26880.0, -407.0/13440.0, -1.0/4032.0, 55.0/2016.0,
+        -1139.0/184320.0, 1297.0/71680.0, 265.0/9216.0, -4051.0/32256.0,
+        -193.0/11520.0, 11059.0/40320.0, 7.0/2880.0, -2477.0/10080.0,
+        4465.0/129024.0, -2837.0/35840.0, -5107.0/32256.0, 42967.0/80640.0,
+        659.0/8064.0, -22391.0/20160.0, -17.0/2016.0, 4957.0/5040.0,
+        -12403.0/92160.0, 3719.0/15360.0, 887.0/1536.0, -379.0/256.0,
+        -307.0/1920.0, 839.0/320.0, 19.0/1440.0, -551.0/240.0,
+        27907.0/46080.0, -1843.0/1280.0, -5131.0/11520.0, 3649.0/1440.0,
+        269.0/2880.0, -2851.0/720.0, -1.0/144.0, 31.0/9.0,
+        27907.0/46080.0, 1843.0/1280.0, -5131.0/11520.0, -3649.0/1440.0,
+        269.0/2880.0, 2851.0/720.0, -1.0/144.0, -31.0/9.0,
+        -12403.0/92160.0, -3719.0/15360.0, 887.0/1536.0, 379.0/256.0,
+        -307.0/1920.0, -839.0/320.0, 19.0/1440.0, 551.0/240.0,
+        4465.0/129024.0, 2837.0/35840.0, -5107.0/32256.0, -42967.0/80640.0,
+        659.0/8064.0, 22391.0/20160.0, -17.0/2016.0, -4957.0/5040.0,
+        -1139.0/184320.0, -1297.0/71680.0, 265.0/9216.0, 4051.0/32256.0,
+        -193.0/11520.0, -11059.0/40320.0, 7.0/2880.0, 2477.0/10080.0,
+        689.0/1290240.0, 1247.0/645120.0, -269.0/107520.0, -731.0/53760.0,
+        41.0/26880.0, 407.0/13440.0, -1.0/4032.0, -55.0/2016.0
+    };
+};
+
+template <>
+struct spline_coefficients<4,4>{
+    static const int nb_polys = 10;
+    static const int degree = 9;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        35.0/65536.0, -23521.0/10321920.0, -3229.0/1290240.0, 1763.0/92160.0,
+        47.0/30720.0, -65.0/1024.0, -1.0/3840.0, 667.0/5760.0,
+        1.0/80640.0, -3569.0/40320.0,
+        -405.0/65536.0, 24321.0/1146880.0, 589.0/20480.0, -16163.0/92160.0,
+        -1547.0/92160.0, 5281.0/9216.0, 29.0/11520.0, -42029.0/40320.0,
+        -1.0/11520.0, 3569.0/4480.0,
+        567.0/16384.0, -5253.0/57344.0, -1135.0/7168.0, 3373.0/4608.0,
+        377.0/4608.0, -26561.0/11520.0, -5.0/576.0, 1201.0/288.0,
+        1.0/4032.0, -3569.0/1120.0,
+        -2205.0/16384.0, 11107.0/40960.0, 26611.0/46080.0, -14939.0/7680.0,
+        -1229.0/7680.0, 1385.0/256.0, 13.0/960.0, -1557.0/160.0,
+        -1.0/2880.0, 3569.0/480.0,
+        19845.0/32768.0, -121521.0/81920.0, -4561.0/10240.0, 148889.0/46080.0,
+        4307.0/46080.0, -37519.0/4608.0, -41.0/5760.0, 42041.0/2880.0,
+        1.0/5760.0, -3569.0/320.0,
+        19845.0/32768.0, 121521.0/81920.0, -4561.0/10240.0, -148889.0/46080.0,
+        4307.0/46080.0, 37519.0/4608.0, -41.0/5760.0, -42041.0/2880.0,
+        1.0/5760.0, 3569.0/320.0,
+        -2205.0/16384.0, -11107.0/40960.0, 26611.0/46080.0, 14939.0/7680.0,
+        -1229.0/7680.0, -1385.0/256.0, 13.0/960.0, 1557.0/160.0,
+        -1.0/2880.0, -3569.0/480.0,
+        567.0/16384.0, 5253.0/57344.0, -1135.0/7168.0, -3373.0/4608.0,
+        377.0/4608.0, 26561.0/11520.0, -5.0/576.0, -1201.0/288.0,
+        1.0/4032.0, 3569.0/1120.0,
+        -405.0/65536.0, -24321.0/1146880.0, 589.0/20480.0, 16163.0/92160.0,
+        -1547.0/92160.0, -5281.0/9216.0, 29.0/11520.0, 42029.0/40320.0,
+        -1.0/11520.0, -3569.0/4480.0,
+        35.0/65536.0, 23521.0/10321920.0, -3229.0/1290240.0, -1763.0/92160.0,
+        47.0/30720.0, 65.0/1024.0, -1.0/3840.0, -667.0/5760.0,
+        1.0/80640.0, 3569.0/40320.0
+    };
+};
+
+template <>
+struct spline_coefficients<4,5>{
+    static const int nb_polys = 10;
+    static const int degree = 11;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        35.0/65536.0, -17741.0/6881280.0, -3229.0/1290240.0, 6173.0/245760.0,
+        47.0/30720.0, -2053.0/18432.0, -1.0/3840.0, 787.0/2560.0,
+        1.0/80640.0, -4227.0/8960.0, 0.0, 883.0/2880.0,
+        -405.0/65536.0, 54823.0/2293760.0, 589.0/20480.0, -169039.0/737280.0,
+        -1547.0/92160.0, 18509.0/18432.0, 29.0/11520.0, -446261.0/161280.0,
+        -1.0/11520.0, 38043.0/8960.0, 0.0, -883.0/320.0,
+        567.0/16384.0, -58711.0/573440.0, -1135.0/7168.0, 34931.0/36864.0,
+        377.0/4608.0, -92857.0/23040.0, -5.0/576.0, 12751.0/1152.0,
+        1.0/4032.0, -38043.0/2240.0, 0.0, 883.0/80.0,
+        -2205.0/16384.0, 72823.0/245760.0, 26611.0/46080.0, -50139.0/20480.0,
+        -1229.0/7680.0, 14491.0/1536.0, 13.0/960.0, -49589.0/1920.0,
+        -1.0/2880.0, 12681.0/320.0, 0.0, -6181.0/240.0,
+        19845.0/32768.0, -249223.0/163840.0, -4561.0/10240.0, 1469257.0/368640.0,
+        4307.0/46080.0, -130667.0/9216.0, -41.0/5760.0, 446309.0/11520.0,
+        1.0/5760.0, -38043.0/640.0, 0.0, 6181.0/160.0,
+        19845.0/32768.0, 249223.0/163840.0, -4561.0/10240.0, -1469257.0/368640.0,
+        4307.0/46080.0, 130667.0/9216.0, -41.0/5760.0, -446309.0/11520.0,
+        1.0/5760.0, 38043.0/640.0, 0.0, -6181.0/160.0,
+        -2205.0/16384.0, -72823.0/245760.0, 26611.0/46080.0, 50139.0/20480.0,
+        -1229.0/7680.0, -14491.0/1536.0, 13.0/960.0, 49589.0/1920.0,
+        -1.0/2880.0, -12681.0/320.0, 0.0, 6181.0/240.0,
+        567.0/16384.0, 58711.0/573440.0, -1135.0/7168.0, -34931.0/36864.0,
+        377.0/4608.0, 92857.0/23040.0, -5.0/576.0, -12751.0/1152.0,
+        1.0/4032.0, 38043.0/2240.0, 0.0, -883.0/80.0,
+        -405.0/65536.0, -54823.0/2293760.0, 589.0/20480.0, 169039.0/737280.0,
+        -1547.0/92160.0, -18509.0/18432.0, 29.0/11520.0, 446261.0/161280.0,
+        -1.0/11520.0, -38043.0/8960.0, 0.0, 883.0/320.0,
+        35.0/65536.0, 17741.0/6881280.0, -3229.0/1290240.0, -6173.0/245760.0,
+        47.0/30720.0, 2053.0/18432.0, -1.0/3840.0, -787.0/2560.0,
+        1.0/80640.0, 4227.0/8960.0, 0.0, -883.0/2880.0
+    };
+};
+
+template <>
+struct spline_coefficients<4,6>{
+    static const int nb_polys = 10;
+    static const int degree = 13;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        35.0/65536.0, -235019.0/82575360.0, -3229.0/1290240.0, 5169.0/163840.0,
+        47.0/30720.0, -25907.0/147456.0, -1.0/3840.0, 29971.0/46080.0,
+        1.0/80640.0, -161359.0/107520.0, 0.0, 11249.0/5760.0,
+        0.0, -3161.0/2880.0,
+        -405.0/65536.0, 241419.0/9175040.0, 589.0/20480.0, -84685.0/294912.0,
+        -1547.0/92160.0, 233419.0/147456.0, 29.0/11520.0, -1888237.0/322560.0,
+        -1.0/11520.0, 484077.0/35840.0, 0.0, -11249.0/640.0,
+        0.0, 3161.0/320.0,
+        567.0/16384.0, -256971.0/2293760.0, -1135.0/7168.0, 434657.0/368640.0,
+        377.0/4608.0, -1169591.0/184320.0, -5.0/576.0, 53951.0/2304.0,
+        1.0/4032.0, -484077.0/8960.0, 0.0, 11249.0/160.0,
+        0.0, -3161.0/80.0,
+        -2205.0/16384.0, 104473.0/327680.0, 26611.0/46080.0, -24481.0/8192.0,
+        -1229.0/7680.0, 182309.0/12288.0, 13.0/960.0, -209813.0/3840.0,
+        -1.0/2880.0, 161359.0/1280.0, 0.0, -78743.0/480.0,
+        0.0, 22127.0/240.0,
+        19845.0/32768.0, -1019019.0/655360.0, -4561.0/10240.0, 3535943.0/737280.0,
+        4307.0/46080.0, -1642765.0/73728.0, -41.0/5760.0, 1888333.0/23040.0,
+        1.0/5760.0, -484077.0/2560.0, 0.0, 78743.0/320.0,
+        0.0, -22127.0/160.0,
+        19845.0/32768.0, 1019019.0/655360.0, -4561.0/10240.0, -3535943.0/737280.0,
+        4307.0/46080.0, 1642765.0/73728.0, -41.0/5760.0, -1888333.0/23040.0,
+        1.0/5760.0, 484077.0/2560.0, 0.0, -78743.0/320.0,
+        0.0, 22127.0/160.0,
+        -2205.0/16384.0, -104473.0/327680.0, 26611.0/46080.0, 24481.0/8192.0,
+        -1229.0/7680.0, -182309.0/12288.0, 13.0/960.0, 209813.0/3840.0,
+        -1.0/2880.0, -161359.0/1280.0, 0.0, 78743.0/480.0,
+        0.0, -22127.0/240.0,
+        567.0/16384.0, 256971.0/2293760.0, -1135.0/7168.0, -434657.0/368640.0,
+        377.0/4608.0, 1169591.0/184320.0, -5.0/576.0, -53951.0/2304.0,
+        1.0/4032.0, 484077.0/8960.0, 0.0, -11249.0/160.0,
+        0.0, 3161.0/80.0,
+        -405.0/65536.0, -241419.0/9175040.0, 589.0/20480.0, 84685.0/294912.0,
+        -1547.0/92160.0, -233419.0/147456.0, 29.0/11520.0, 1888237.0/322560.0,
+        -1.0/11520.0, -484077.0/35840.0, 0.0, 11249.0/640.0,
+        0.0, -3161.0/320.0,
+        35.0/65536.0, 235019.0/82575360.0, -3229.0/1290240.0, -5169.0/163840.0,
+        47.0/30720.0, 25907.0/147456.0, -1.0/3840.0, -29971.0/46080.0,
+        1.0/80640.0, 161359.0/107520.0, 0.0, -11249.0/5760.0,
+        0.0, 3161.0/2880.0
+    };
+};
+
+template <>
+struct spline_coefficients<4,7>{
+    static const int nb_polys = 10;
+    static const int degree = 15;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        35.0/65536.0, -72923.0/23592960.0, -3229.0/1290240.0, 226507.0/5898240.0,
+        47.0/30720.0, -380339.0/1474560.0, -1.0/3840.0, 441883.0/368640.0,
+        1.0/80640.0, -2382959.0/645120.0, 0.0, 33253.0/4608.0,
+        0.0, -9349.0/1152.0, 0.0, 40423.0/10080.0,
+        -405.0/65536.0, 523261.0/18350080.0, 589.0/20480.0, -2057507.0/5898240.0,
+        -1547.0/92160.0, 3425611.0/1474560.0, 29.0/11520.0, -27839141.0/2580480.0,
+        -1.0/11520.0, 2382959.0/71680.0, 0.0, -33253.0/512.0,
+        0.0, 9349.0/128.0, 0.0, -40423.0/1120.0,
+        567.0/16384.0, -15839.0/131072.0, -1135.0/7168.0, 420487.0/294912.0,
+        377.0/4608.0, -3430603.0/368640.0, -5.0/576.0, 795415.0/18432.0,
+        1.0/4032.0, -2382959.0/17920.0, 0.0, 33253.0/128.0,
+        0.0, -9349.0/32.0, 0.0, 40423.0/280.0,
+        -2205.0/16384.0, 667261.0/1966080.0, 26611.0/46080.0, -1751821.0/491520.0,
+        -1229.0/7680.0, 2671973.0/122880.0, 13.0/960.0, -1031103.0/10240.0,
+        -1.0/2880.0, 2382959.0/7680.0, 0.0, -232771.0/384.0,
+        0.0, 65443.0/96.0, 0.0, -40423.0/120.0,
+        19845.0/32768.0, -2078461.0/1310720.0, -4561.0/10240.0, 16690421.0/2949120.0,
+        4307.0/46080.0, -24067597.0/737280.0, -41.0/5760.0, 27839909.0/184320.0,
+        1.0/5760.0, -2382959.0/5120.0, 0.0, 232771.0/256.0,
+        0.0, -65443.0/64.0, 0.0, 40423.0/80.0,
+        19845.0/32768.0, 2078461.0/1310720.0, -4561.0/10240.0, -16690421.0/2949120.0,
+        4307.0/46080.0, 24067597.0/737280.0, -41.0/5760.0, -27839909.0/184320.0,
+        1.0/5760.0, 2382959.0/5120.0, 0.0, -232771.0/256.0,
+        0.0, 65443.0/64.0, 0.0, -40423.0/80.0,
+        -2205.0/16384.0, -667261.0/1966080.0, 26611.0/46080.0, 1751821.0/491520.0,
+        -1229.0/7680.0, -2671973.0/122880.0, 13.0/960.0, 1031103.0/10240.0,
+        -1.0/2880.0, -2382959.0/7680.0, 0.0, 232771.0/384.0,
+        0.0, -65443.0/96.0, 0.0, 40423.0/120.0,
+        567.0/16384.0, 15839.0/131072.0, -1135.0/7168.0, -420487.0/294912.0,
+        377.0/4608.0, 3430603.0/368640.0, -5.0/576.0, -795415.0/18432.0,
+        1.0/4032.0, 2382959.0/17920.0, 0.0, -33253.0/128.0,
+        0.0, 9349.0/32.0, 0.0, -40423.0/280.0,
+        -405.0/65536.0, -523261.0/18350080.0, 589.0/20480.0, 2057507.0/5898240.0,
+        -1547.0/92160.0, -3425611.0/1474560.0, 29.0/11520.0, 27839141.0/2580480.0,
+        -1.0/11520.0, -2382959.0/71680.0, 0.0, 33253.0/512.0,
+        0.0, -9349.0/128.0, 0.0, 40423.0/1120.0,
+        35.0/65536.0, 72923.0/23592960.0, -3229.0/1290240.0, -226507.0/5898240.0,
+        47.0/30720.0, 380339.0/1474560.0, -1.0/3840.0, -441883.0/368640.0,
+        1.0/80640.0, 2382959.0/645120.0, 0.0, -33253.0/4608.0,
+        0.0, 9349.0/1152.0, 0.0, -40423.0/10080.0
+    };
+};
+
+template <>
+struct spline_coefficients<4,8>{
+    static const int nb_polys = 10;
+    static const int degree = 17;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        35.0/65536.0, -487027.0/146800640.0, -3229.0/1290240.0, 13091.0/286720.0,
+        47.0/30720.0, -353411.0/983040.0, -1.0/3840.0, 41191.0/20480.0,
+        1.0/80640.0, -2224029.0/286720.0, 0.0, 23291.0/1152.0,
+        0.0, -26203.0/768.0, 0.0, 56663.0/1680.0,
+        0.0, -59911.0/4032.0,
+        -405.0/65536.0, 4485643.0/146800640.0, 589.0/20480.0, -1068659.0/2580480.0,
+        -1547.0/92160.0, 9547217.0/2949120.0, 29.0/11520.0, -23355553.0/1290240.0,
+        -1.0/11520.0, 20016261.0/286720.0, 0.0, -23291.0/128.0,
+        0.0, 78609.0/256.0, 0.0, -169989.0/560.0,
+        0.0, 59911.0/448.0,
+        567.0/16384.0, -946895.0/7340032.0, -1135.0/7168.0, 217663.0/129024.0,
+        377.0/4608.0, -9557201.0/737280.0, -5.0/576.0, 667307.0/9216.0,
+        1.0/4032.0, -20016261.0/71680.0, 0.0, 23291.0/32.0,
+        0.0, -78609.0/64.0, 0.0, 169989.0/140.0,
+        0.0, -59911.0/112.0,
+        -2205.0/16384.0, 5637643.0/15728640.0, 26611.0/46080.0, -42737.0/10240.0,
+        -1229.0/7680.0, 2480277.0/81920.0, 13.0/960.0, -2595097.0/15360.0,
+        -1.0/2880.0, 6672087.0/10240.0, 0.0, -163037.0/96.0,
+        0.0, 183421.0/64.0, 0.0, -56663.0/20.0,
+        0.0, 59911.0/48.0,
+        19845.0/32768.0, -16927243.0/10485760.0, -4561.0/10240.0, 1211651.0/184320.0,
+        4307.0/46080.0, -67007159.0/1474560.0, -41.0/5760.0, 23355937.0/92160.0,
+        1.0/5760.0, -20016261.0/20480.0, 0.0, 163037.0/64.0,
+        0.0, -550263.0/128.0, 0.0, 169989.0/40.0,
+        0.0, -59911.0/32.0,
+        19845.0/32768.0, 16927243.0/10485760.0, -4561.0/10240.0, -1211651.0/184320.0,
+        4307.0/46080.0, 67007159.0/1474560.0, -41.0/5760.0, -23355937.0/92160.0,
+        1.0/5760.0, 20016261.0/20480.0, 0.0, -163037.0/64.0,
+        0.0, 550263.0/128.0, 0.0, -169989.0/40.0,
+        0.0, 59911.0/32.0,
+        -2205.0/16384.0, -5637643.0/15728640.0, 26611.0/46080.0, 42737.0/10240.0,
+        -1229.0/7680.0, -2480277.0/81920.0, 13.0/960.0, 2595097.0/15360.0,
+        -1.0/2880.0, -6672087.0/10240.0, 0.0, 163037.0/96.0,
+        0.0, -183421.0/64.0, 0.0, 56663.0/20.0,
+        0.0, -59911.0/48.0,
+        567.0/16384.0, 946895.0/7340032.0, -1135.0/7168.0, -217663.0/129024.0,
+        377.0/4608.0, 9557201.0/737280.0, -5.0/576.0, -667307.0/9216.0,
+        1.0/4032.0, 20016261.0/71680.0, 0.0, -23291.0/32.0,
+        0.0, 78609.0/64.0, 0.0, -169989.0/140.0,
+        0.0, 59911.0/112.0,
+        -405.0/65536.0, -4485643.0/146800640.0, 589.0/20480.0, 1068659.0/2580480.0,
+        -1547.0/92160.0, -9547217.0/2949120.0, 29.0/11520.0, 23355553.0/1290240.0,
+        -1.0/11520.0, -20016261.0/286720.0, 0.0, 23291.0/128.0,
+        0.0, -78609.0/256.0, 0.0, 169989.0/560.0,
+        0.0, -59911.0/448.0,
+        35.0/65536.0, 487027.0/146800640.0, -3229.0/1290240.0, -13091.0/286720.0,
+        47.0/30720.0, 353411.0/983040.0, -1.0/3840.0, -41191.0/20480.0,
+        1.0/80640.0, 2224029.0/286720.0, 0.0, -23291.0/1152.0,
+        0.0, 26203.0/768.0, 0.0, -56663.0/1680.0,
+        0.0, 59911.0/4032.0
+    };
+};
+
+template <>
+struct spline_coefficients<5,0>{
+    static const int nb_polys = 12;
+    static const int degree = 1;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        1.0/2.0, -1.0,
+        1.0/2.0, 1.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0
+    };
+};
+
+template <>
+struct spline_coefficients<5,1>{
+    static const int nb_polys = 12;
+    static const int degree = 3;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -1.0/10080.0, 1.0/5040.0, 1.0/2520.0, -1.0/1260.0,
+        3.0/2240.0, -23.0/10080.0, -3.0/560.0, 23.0/2520.0,
+        -5.0/576.0, 25.0/2016.0, 5.0/144.0, -25.0/504.0,
+        25.0/672.0, -5.0/112.0, -25.0/168.0, 5.0/28.0,
+        -15.0/112.0, 25.0/168.0, 15.0/28.0, -25.0/42.0,
+        29.0/48.0, -31.0/24.0, -5.0/12.0, 7.0/6.0,
+        29.0/48.0, 31.0/24.0, -5.0/12.0, -7.0/6.0,
+        -15.0/112.0, -25.0/168.0, 15.0/28.0, 25.0/42.0,
+        25.0/672.0, 5.0/112.0, -25.0/168.0, -5.0/28.0,
+        -5.0/576.0, -25.0/2016.0, 5.0/144.0, 25.0/504.0,
+        3.0/2240.0, 23.0/10080.0, -3.0/560.0, -23.0/2520.0,
+        -1.0/10080.0, -1.0/5040.0, 1.0/2520.0, 1.0/1260.0
+    };
+};
+
+template <>
+struct spline_coefficients<5,2>{
+    static const int nb_polys = 12;
+    static const int degree = 5;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -1.0/8400.0, 17.0/50400.0, 1.0/1800.0, -1.0/525.0,
+        -1.0/3150.0, 1.0/450.0,
+        41.0/25600.0, -49.0/12800.0, -167.0/22400.0, 2167.0/100800.0,
+        47.0/11200.0, -1247.0/50400.0,
+        -95.0/9216.0, 655.0/32256.0, 55.0/1152.0, -65.0/576.0,
+        -5.0/192.0, 85.0/672.0,
+        25.0/576.0, -5.0/72.0, -25.0/126.0, 95.0/252.0,
+        25.0/252.0, -25.0/63.0,
+        -65.0/448.0, 45.0/224.0, 5.0/8.0, -85.0/84.0,
+        -5.0/28.0, 5.0/6.0,
+        70331.0/115200.0, -78731.0/57600.0, -6731.0/14400.0, 12731.0/7200.0,
+        731.0/7200.0, -4331.0/3600.0,
+        70331.0/115200.0, 78731.0/57600.0, -6731.0/14400.0, -12731.0/7200.0,
+        731.0/7200.0, 4331.0/3600.0,
+        -65.0/448.0, -45.0/224.0, 5.0/8.0, 85.0/84.0,
+        -5.0/28.0, -5.0/6.0,
+        25.0/576.0, 5.0/72.0, -25.0/126.0, -95.0/252.0,
+        25.0/252.0, 25.0/63.0,
+        -95.0/9216.0, -655.0/32256.0, 55.0/1152.0, 65.0/576.0,
+        -5.0/192.0, -85.0/672.0,
+        41.0/25600.0, 49.0/12800.0, -167.0/22400.0, -2167.0/100800.0,
+        47.0/11200.0, 1247.0/50400.0,
+        -1.0/8400.0, -17.0/50400.0, 1.0/1800.0, 1.0/525.0,
+        -1.0/3150.0, -1.0/450.0
+    };
+};
+
+template <>
+struct spline_coefficients<5,3>{
+    static const int nb_polys = 12;
+    static const int degree = 7;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -1993.0/16588800.0, 25183.0/58060800.0, 5503.0/9676800.0, -2963.0/967680.0,
+        -179.0/483840.0, 8287.0/1209600.0, 127.0/1814400.0, -5599.0/907200.0,
+        6947.0/4300800.0, -283903.0/58060800.0, -2731.0/358400.0, 4733.0/138240.0,
+        87.0/17920.0, -13081.0/172800.0, -59.0/67200.0, 61639.0/907200.0,
+        -34453.0/3317760.0, 59503.0/2322432.0, 13453.0/276480.0, -34183.0/193536.0,
+        -2053.0/69120.0, 18463.0/48384.0, 253.0/51840.0, -12343.0/36288.0,
+        67531.0/1548288.0, -330593.0/3870720.0, -25931.0/129024.0, 2911.0/5120.0,
+        1177.0/10752.0, -13399.0/11520.0, -331.0/24192.0, 61793.0/60480.0,
+        -8933.0/61440.0, 90131.0/387072.0, 22531.0/35840.0, -45011.0/32256.0,
+        -1731.0/8960.0, 19091.0/8064.0, 131.0/6720.0, -12371.0/6048.0,
+        1688371.0/2764800.0, -1951433.0/1382400.0, -36041.0/76800.0, 53117.0/23040.0,
+        251.0/2304.0, -32179.0/9600.0, -427.0/43200.0, 61889.0/21600.0,
+        1688371.0/2764800.0, 1951433.0/1382400.0, -36041.0/76800.0, -53117.0/23040.0,
+        251.0/2304.0, 32179.0/9600.0, -427.0/43200.0, -61889.0/21600.0,
+        -8933.0/61440.0, -90131.0/387072.0, 22531.0/35840.0, 45011.0/32256.0,
+        -1731.0/8960.0, -19091.0/8064.0, 131.0/6720.0, 12371.0/6048.0,
+        67531.0/1548288.0, 330593.0/3870720.0, -25931.0/129024.0, -2911.0/5120.0,
+        1177.0/10752.0, 13399.0/11520.0, -331.0/24192.0, -61793.0/60480.0,
+        -34453.0/3317760.0, -59503.0/2322432.0, 13453.0/276480.0, 34183.0/193536.0,
+        -2053.0/69120.0, -18463.0/48384.0, 253.0/51840.0, 12343.0/36288.0,
+        6947.0/4300800.0, 283903.0/58060800.0, -2731.0/358400.0, -4733.0/138240.0,
+        87.0/17920.0, 13081.0/172800.0, -59.0/67200.0, -61639.0/907200.0,
+        -1993.0/16588800.0, -25183.0/58060800.0, 5503.0/9676800.0, 2963.0/967680.0,
+        -179.0/483840.0, -8287.0/1209600.0, 127.0/1814400.0, 5599.0/907200.0
+    };
+};
+
+template <>
+struct spline_coefficients<5,4>{
+    static const int nb_polys = 12;
+    static const int degree = 9;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -27907.0/232243200.0, 29713.0/58060800.0, 16519.0/29030400.0, -4171.0/967680.0,
+        -1.0/2688.0, 17347.0/1209600.0, 137.0/1814400.0, -23719.0/907200.0,
+        -1.0/181440.0, 151.0/7560.0,
+        166753.0/103219200.0, -2669869.0/464486400.0, -49183.0/6451200.0, 55703.0/1161216.0,
+        1049.0/215040.0, -254971.0/1612800.0, -379.0/403200.0, 521923.0/1814400.0,
+        1.0/16128.0, -79729.0/362880.0,
+        -275653.0/26542080.0, 396967.0/13271040.0, 80747.0/1658880.0, -474713.0/1935360.0,
+        -2747.0/92160.0, 767909.0/967680.0, 107.0/20736.0, -522079.0/362880.0,
+        -29.0/103680.0, 132883.0/120960.0,
+        67535.0/1548288.0, -760849.0/7741440.0, -77809.0/387072.0, 49967.0/64512.0,
+        3539.0/32256.0, -12091.0/5040.0, -347.0/24192.0, 261119.0/60480.0,
+        1.0/1512.0, -33221.0/10080.0,
+        -750389.0/5160960.0, 2001947.0/7741440.0, 50699.0/80640.0, -218623.0/120960.0,
+        -10403.0/53760.0, 130079.0/26880.0, 41.0/2016.0, -130591.0/15120.0,
+        -17.0/20160.0, 199327.0/30240.0,
+        13507003.0/22118400.0, -16010119.0/11059200.0, -648773.0/1382400.0, 132811.0/46080.0,
+        5027.0/46080.0, -261601.0/38400.0, -889.0/86400.0, 522433.0/43200.0,
+        7.0/17280.0, -2953.0/320.0,
+        13507003.0/22118400.0, 16010119.0/11059200.0, -648773.0/1382400.0, -132811.0/46080.0,
+        5027.0/46080.0, 261601.0/38400.0, -889.0/86400.0, -522433.0/43200.0,
+        7.0/17280.0, 2953.0/320.0,
+        -750389.0/5160960.0, -2001947.0/7741440.0, 50699.0/80640.0, 218623.0/120960.0,
+        -10403.0/53760.0, -130079.0/26880.0, 41.0/2016.0, 130591.0/15120.0,
+        -17.0/20160.0, -199327.0/30240.0,
+        67535.0/1548288.0, 760849.0/7741440.0, -77809.0/387072.0, -49967.0/64512.0,
+        3539.0/32256.0, 12091.0/5040.0, -347.0/24192.0, -261119.0/60480.0,
+        1.0/1512.0, 33221.0/10080.0,
+        -275653.0/26542080.0, -396967.0/13271040.0, 80747.0/1658880.0, 474713.0/1935360.0,
+        -2747.0/92160.0, -767909.0/967680.0, 107.0/20736.0, 522079.0/362880.0,
+        -29.0/103680.0, -132883.0/120960.0,
+        166753.0/103219200.0, 2669869.0/464486400.0, -49183.0/6451200.0, -55703.0/1161216.0,
+        1049.0/215040.0, 254971.0/1612800.0, -379.0/403200.0, -521923.0/1814400.0,
+        1.0/16128.0, 79729.0/362880.0,
+        -27907.0/232243200.0, -29713.0/58060800.0, 16519.0/29030400.0, 4171.0/967680.0,
+        -1.0/2688.0, -17347.0/1209600.0, 137.0/1814400.0, 23719.0/907200.0,
+        -1.0/181440.0, -151.0/7560.0
+    };
+};
+
+template <>
+struct spline_coefficients<5,5>{
+    static const int nb_polys = 12;
+    static const int degree = 11;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -63.0/524288.0, 2152441.0/3715891200.0, 117469.0/206438400.0, -116849.0/20643840.0,
+        -17281.0/46448640.0, 46339.0/1843200.0, 209.0/2764800.0, -287579.0/4147200.0,
+        -11.0/1935360.0, 102931.0/967680.0, 1.0/7257600.0, -83603.0/1209600.0,
+        847.0/524288.0, -24117851.0/3715891200.0, -1573861.0/206438400.0, 11671379.0/185794560.0,
+        25177.0/5160960.0, -1531067.0/5529600.0, -289.0/307200.0, 3163609.0/4147200.0,
+        41.0/645120.0, -3396731.0/2903040.0, -1.0/806400.0, 919633.0/1209600.0,
+        -5445.0/524288.0, 24989051.0/743178240.0, 287101.0/5898240.0, -6596327.0/20643840.0,
+        -197789.0/6635520.0, 56833.0/40960.0, 571.0/110592.0, -22147759.0/5806080.0,
+        -79.0/276480.0, 808747.0/138240.0, 1.0/207360.0, -919633.0/241920.0,
+        22869.0/524288.0, -27106067.0/247726080.0, -553309.0/2752512.0, 1372507.0/1376256.0,
+        339749.0/3096576.0, -1541251.0/368640.0, -529.0/36864.0, 3164329.0/276480.0,
+        29.0/43008.0, -1887079.0/107520.0, -1.0/96768.0, 919633.0/80640.0,
+        -38115.0/262144.0, 34790051.0/123863040.0, 12978949.0/20643840.0, -69761983.0/30965760.0,
+        -499349.0/2580480.0, 1548851.0/184320.0, 125.0/6144.0, -3164617.0/138240.0,
+        -277.0/322560.0, 16983727.0/483840.0, 1.0/80640.0, -919633.0/40320.0,
+        160083.0/262144.0, -130839851.0/88473600.0, -2306749.0/4915200.0, 344639.0/98304.0,
+        120649.0/1105920.0, -10876589.0/921600.0, -527.0/51200.0, 22153423.0/691200.0,
+        19.0/46080.0, -1132249.0/23040.0, -1.0/172800.0, 919633.0/28800.0,
+        160083.0/262144.0, 130839851.0/88473600.0, -2306749.0/4915200.0, -344639.0/98304.0,
+        120649.0/1105920.0, 10876589.0/921600.0, -527.0/51200.0, -22153423.0/691200.0,
+        19.0/46080.0, 1132249.0/23040.0, -1.0/172800.0, -919633.0/28800.0,
+        -38115.0/262144.0, -34790051.0/123863040.0, 12978949.0/20643840.0, 69761983.0/30965760.0,
+        -499349.0/2580480.0, -1548851.0/184320.0, 125.0/6144.0, 3164617.0/138240.0,
+        -277.0/322560.0, -16983727.0/483840.0, 1.0/80640.0, 919633.0/40320.0,
+        22869.0/524288.0, 27106067.0/247726080.0, -553309.0/2752512.0, -1372507.0/1376256.0,
+        339749.0/3096576.0, 1541251.0/368640.0, -529.0/36864.0, -3164329.0/276480.0,
+        29.0/43008.0, 1887079.0/107520.0, -1.0/96768.0, -919633.0/80640.0,
+        -5445.0/524288.0, -24989051.0/743178240.0, 287101.0/5898240.0, 6596327.0/20643840.0,
+        -197789.0/6635520.0, -56833.0/40960.0, 571.0/110592.0, 22147759.0/5806080.0,
+        -79.0/276480.0, -808747.0/138240.0, 1.0/207360.0, 919633.0/241920.0,
+        847.0/524288.0, 24117851.0/3715891200.0, -1573861.0/206438400.0, -11671379.0/185794560.0,
+        25177.0/5160960.0, 1531067.0/5529600.0, -289.0/307200.0, -3163609.0/4147200.0,
+        41.0/645120.0, 3396731.0/2903040.0, -1.0/806400.0, -919633.0/1209600.0,
+        -63.0/524288.0, -2152441.0/3715891200.0, 117469.0/206438400.0, 116849.0/20643840.0,
+        -17281.0/46448640.0, -46339.0/1843200.0, 209.0/2764800.0, 287579.0/4147200.0,
+        -11.0/1935360.0, -102931.0/967680.0, 1.0/7257600.0, 83603.0/1209600.0
+    };
+};
+
+template <>
+struct spline_coefficients<5,6>{
+    static const int nb_polys = 12;
+    static const int degree = 13;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -63.0/524288.0, 4753603.0/7431782400.0, 117469.0/206438400.0, -137591.0/19353600.0,
+        -17281.0/46448640.0, 876583.0/22118400.0, 209.0/2764800.0, -11261.0/76800.0,
+        -11.0/1935360.0, 654583.0/1935360.0, 1.0/7257600.0, -133081.0/302400.0,
+        0.0, 64103.0/259200.0,
+        847.0/524288.0, -53171633.0/7431782400.0, -1573861.0/206438400.0, 4572793.0/58060800.0,
+        25177.0/5160960.0, -9649933.0/22118400.0, -289.0/307200.0, 1114879.0/691200.0,
+        41.0/645120.0, -4320251.0/1161216.0, -1.0/806400.0, 1463891.0/302400.0,
+        0.0, -705133.0/259200.0,
+        -5445.0/524288.0, 54914033.0/1486356480.0, 287101.0/5898240.0, -1545307.0/3870720.0,
+        -197789.0/6635520.0, 9663629.0/4423680.0, 571.0/110592.0, -2601523.0/322560.0,
+        -79.0/276480.0, 5143159.0/276480.0, 1.0/207360.0, -1463891.0/60480.0,
+        0.0, 705133.0/51840.0,
+        22869.0/524288.0, -11829613.0/99090432.0, -553309.0/2752512.0, 1595221.0/1290240.0,
+        339749.0/3096576.0, -1076741.0/163840.0, -529.0/36864.0, 1114999.0/46080.0,
+        29.0/43008.0, -36002129.0/645120.0, -1.0/96768.0, 1463891.0/20160.0,
+        0.0, -705133.0/17280.0,
+        -38115.0/262144.0, 74516033.0/247726080.0, 12978949.0/20643840.0, -5285611.0/1935360.0,
+        -499349.0/2580480.0, 9721069.0/737280.0, 125.0/6144.0, -1115047.0/23040.0,
+        -277.0/322560.0, 108006419.0/967680.0, 1.0/80640.0, -1463891.0/10080.0,
+        0.0, 705133.0/8640.0,
+        160083.0/262144.0, -266615633.0/176947200.0, -2306749.0/4915200.0, 1923991.0/460800.0,
+        120649.0/1105920.0, -68186011.0/3686400.0, -527.0/51200.0, 7805513.0/115200.0,
+        19.0/46080.0, -2400143.0/15360.0, -1.0/172800.0, 1463891.0/7200.0,
+        0.0, -4935931.0/43200.0,
+        160083.0/262144.0, 266615633.0/176947200.0, -2306749.0/4915200.0, -1923991.0/460800.0,
+        120649.0/1105920.0, 68186011.0/3686400.0, -527.0/51200.0, -7805513.0/115200.0,
+        19.0/46080.0, 2400143.0/15360.0, -1.0/172800.0, -1463891.0/7200.0,
+        0.0, 4935931.0/43200.0,
+        -38115.0/262144.0, -74516033.0/247726080.0, 12978949.0/20643840.0, 5285611.0/1935360.0,
+        -499349.0/2580480.0, -9721069.0/737280.0, 125.0/6144.0, 1115047.0/23040.0,
+        -277.0/322560.0, -108006419.0/967680.0, 1.0/80640.0, 1463891.0/10080.0,
+        0.0, -705133.0/8640.0,
+        22869.0/524288.0, 11829613.0/99090432.0, -553309.0/2752512.0, -1595221.0/1290240.0,
+        339749.0/3096576.0, 1076741.0/163840.0, -529.0/36864.0, -1114999.0/46080.0,
+        29.0/43008.0, 36002129.0/645120.0, -1.0/96768.0, -1463891.0/20160.0,
+        0.0, 705133.0/17280.0,
+        -5445.0/524288.0, -54914033.0/1486356480.0, 287101.0/5898240.0, 1545307.0/3870720.0,
+        -197789.0/6635520.0, -9663629.0/4423680.0, 571.0/110592.0, 2601523.0/322560.0,
+        -79.0/276480.0, -5143159.0/276480.0, 1.0/207360.0, 1463891.0/60480.0,
+        0.0, -705133.0/51840.0,
+        847.0/524288.0, 53171633.0/7431782400.0, -1573861.0/206438400.0, -4572793.0/58060800.0,
+        25177.0/5160960.0, 9649933.0/22118400.0, -289.0/307200.0, -1114879.0/691200.0,
+        41.0/645120.0, 4320251.0/1161216.0, -1.0/806400.0, -1463891.0/302400.0,
+        0.0, 705133.0/259200.0,
+        -63.0/524288.0, -4753603.0/7431782400.0, 117469.0/206438400.0, 137591.0/19353600.0,
+        -17281.0/46448640.0, -876583.0/22118400.0, 209.0/2764800.0, 11261.0/76800.0,
+        -11.0/1935360.0, -654583.0/1935360.0, 1.0/7257600.0, 133081.0/302400.0,
+        0.0, -64103.0/259200.0
+    };
+};
+
+template <>
+struct spline_coefficients<5,7>{
+    static const int nb_polys = 12;
+    static const int degree = 15;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -63.0/524288.0, 20653459.0/29727129600.0, 117469.0/206438400.0, -21436091.0/2477260800.0,
+        -17281.0/46448640.0, 5145379.0/88473600.0, 209.0/2764800.0, -5974913.0/22118400.0,
+        -11.0/1935360.0, 1288555.0/1548288.0, 1.0/7257600.0, -15731921.0/9676800.0,
+        0.0, 1895459.0/1036800.0, 0.0, -546349.0/604800.0,
+        847.0/524288.0, -230716049.0/29727129600.0, -1573861.0/206438400.0, 711524123.0/7431782400.0,
+        25177.0/5160960.0, -56629249.0/88473600.0, -289.0/307200.0, 21908441.0/7372800.0,
+        41.0/645120.0, -212611639.0/23224320.0, -1.0/806400.0, 173051131.0/9676800.0,
+        0.0, -20850049.0/1036800.0, 0.0, 6009839.0/604800.0,
+        -5445.0/524288.0, 237685649.0/5945425920.0, 287101.0/5898240.0, -239868169.0/495452160.0,
+        -197789.0/6635520.0, 56684033.0/17694720.0, 571.0/110592.0, -460090573.0/30965760.0,
+        -79.0/276480.0, 50621831.0/1105920.0, 1.0/207360.0, -173051131.0/1935360.0,
+        0.0, 20850049.0/207360.0, 0.0, -6009839.0/120960.0,
+        22869.0/524288.0, -254621777.0/1981808640.0, -553309.0/2752512.0, 246257161.0/165150720.0,
+        339749.0/3096576.0, -18930731.0/1966080.0, -529.0/36864.0, 21909721.0/491520.0,
+        29.0/43008.0, -118117627.0/860160.0, -1.0/96768.0, 173051131.0/645120.0,
+        0.0, -20850049.0/69120.0, 0.0, 6009839.0/40320.0,
+        -38115.0/262144.0, 316093649.0/990904320.0, 12978949.0/20643840.0, -802764827.0/247726080.0,
+        -499349.0/2580480.0, 56913793.0/2949120.0, 125.0/6144.0, -7303411.0/81920.0,
+        -277.0/322560.0, 1063058771.0/3870720.0, 1.0/80640.0, -173051131.0/322560.0,
+        0.0, 20850049.0/34560.0, 0.0, -6009839.0/20160.0,
+        160083.0/262144.0, -1084492049.0/707788800.0, -2306749.0/4915200.0, 288339721.0/58982400.0,
+        120649.0/1105920.0, -398950663.0/14745600.0, -527.0/51200.0, 460120781.0/3686400.0,
+        19.0/46080.0, -70870589.0/184320.0, -1.0/172800.0, 173051131.0/230400.0,
+        0.0, -145950343.0/172800.0, 0.0, 6009839.0/14400.0,
+        160083.0/262144.0, 1084492049.0/707788800.0, -2306749.0/4915200.0, -288339721.0/58982400.0,
+        120649.0/1105920.0, 398950663.0/14745600.0, -527.0/51200.0, -460120781.0/3686400.0,
+        19.0/46080.0, 70870589.0/184320.0, -1.0/172800.0, -173051131.0/230400.0,
+        0.0, 145950343.0/172800.0, 0.0, -6009839.0/14400.0,
+        -38115.0/262144.0, -316093649.0/990904320.0, 12978949.0/20643840.0, 802764827.0/247726080.0,
+        -499349.0/2580480.0, -56913793.0/2949120.0, 125.0/6144.0, 7303411.0/81920.0,
+        -277.0/322560.0, -1063058771.0/3870720.0, 1.0/80640.0, 173051131.0/322560.0,
+        0.0, -20850049.0/34560.0, 0.0, 6009839.0/20160.0,
+        22869.0/524288.0, 254621777.0/1981808640.0, -553309.0/2752512.0, -246257161.0/165150720.0,
+        339749.0/3096576.0, 18930731.0/1966080.0, -529.0/36864.0, -21909721.0/491520.0,
+        29.0/43008.0, 118117627.0/860160.0, -1.0/96768.0, -173051131.0/645120.0,
+        0.0, 20850049.0/69120.0, 0.0, -6009839.0/40320.0,
+        -5445.0/524288.0, -237685649.0/5945425920.0, 287101.0/5898240.0, 239868169.0/495452160.0,
+        -197789.0/6635520.0, -56684033.0/17694720.0, 571.0/110592.0, 460090573.0/30965760.0,
+        -79.0/276480.0, -50621831.0/1105920.0, 1.0/207360.0, 173051131.0/1935360.0,
+        0.0, -20850049.0/207360.0, 0.0, 6009839.0/120960.0,
+        847.0/524288.0, 230716049.0/29727129600.0, -1573861.0/206438400.0, -711524123.0/7431782400.0,
+        25177.0/5160960.0, 56629249.0/88473600.0, -289.0/307200.0, -21908441.0/7372800.0,
+        41.0/645120.0, 212611639.0/23224320.0, -1.0/806400.0, -173051131.0/9676800.0,
+        0.0, 20850049.0/1036800.0, 0.0, -6009839.0/604800.0,
+        -63.0/524288.0, -20653459.0/29727129600.0, 117469.0/206438400.0, 21436091.0/2477260800.0,
+        -17281.0/46448640.0, -5145379.0/88473600.0, 209.0/2764800.0, 5974913.0/22118400.0,
+        -11.0/1935360.0, -1288555.0/1548288.0, 1.0/7257600.0, 15731921.0/9676800.0,
+        0.0, -1895459.0/1036800.0, 0.0, 546349.0/604800.0
+    };
+};
+
+template <>
+struct spline_coefficients<5,8>{
+    static const int nb_polys = 12;
+    static const int degree = 17;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -63.0/524288.0, 44342891.0/59454259200.0, 117469.0/206438400.0, -1698937.0/165150720.0,
+        -17281.0/46448640.0, 2389787.0/29491200.0, 209.0/2764800.0, -1113653.0/2457600.0,
+        -11.0/1935360.0, 187871.0/107520.0, 1.0/7257600.0, -14689223.0/3225600.0,
+        0.0, 1593481.0/207360.0, 0.0, -4594313.0/604800.0,
+        0.0, 1011991.0/302400.0,
+        847.0/524288.0, -494827801.0/59454259200.0, -1573861.0/206438400.0, 169021387.0/1486356480.0,
+        25177.0/5160960.0, -78893051.0/88473600.0, -289.0/307200.0, 110252927.0/22118400.0,
+        41.0/645120.0, -11159539.0/580608.0, -1.0/806400.0, 161581453.0/3225600.0,
+        0.0, -17528291.0/207360.0, 0.0, 50537443.0/604800.0,
+        0.0, -11131901.0/302400.0,
+        -5445.0/524288.0, 508767001.0/11890851840.0, 287101.0/5898240.0, -94798591.0/165150720.0,
+        -197789.0/6635520.0, 5263189.0/1179648.0, 571.0/110592.0, -257261267.0/10321920.0,
+        -79.0/276480.0, 4428389.0/46080.0, 1.0/207360.0, -161581453.0/645120.0,
+        0.0, 17528291.0/41472.0, 0.0, -50537443.0/120960.0,
+        0.0, 11131901.0/60480.0,
+        22869.0/524288.0, -542639257.0/3963617280.0, -553309.0/2752512.0, 19385651.0/11010048.0,
+        339749.0/3096576.0, -15811199.0/1179648.0, -529.0/36864.0, 110256767.0/1474560.0,
+        29.0/43008.0, -92996177.0/322560.0, -1.0/96768.0, 161581453.0/215040.0,
+        0.0, -17528291.0/13824.0, 0.0, 50537443.0/40320.0,
+        0.0, -11131901.0/20160.0,
+        -38115.0/262144.0, 665583001.0/1981808640.0, 12978949.0/20643840.0, -936347639.0/247726080.0,
+        -499349.0/2580480.0, 15835519.0/589824.0, 125.0/6144.0, -110258303.0/737280.0,
+        -277.0/322560.0, 278988547.0/483840.0, 1.0/80640.0, -161581453.0/107520.0,
+        0.0, 17528291.0/6912.0, 0.0, -50537443.0/20160.0,
+        0.0, 11131901.0/10080.0,
+        160083.0/262144.0, -2202379801.0/1415577600.0, -2306749.0/4915200.0, 4438231.0/786432.0,
+        120649.0/1105920.0, -554797277.0/14745600.0, -527.0/51200.0, 771814009.0/3686400.0,
+        19.0/46080.0, -18599237.0/23040.0, -1.0/172800.0, 161581453.0/76800.0,
+        0.0, -122698037.0/34560.0, 0.0, 50537443.0/14400.0,
+        0.0, -11131901.0/7200.0,
+        160083.0/262144.0, 2202379801.0/1415577600.0, -2306749.0/4915200.0, -4438231.0/786432.0,
+        120649.0/1105920.0, 554797277.0/14745600.0, -527.0/51200.0, -771814009.0/3686400.0,
+        19.0/46080.0, 18599237.0/23040.0, -1.0/172800.0, -161581453.0/76800.0,
+        0.0, 122698037.0/34560.0, 0.0, -50537443.0/14400.0,
+        0.0, 11131901.0/7200.0,
+        -38115.0/262144.0, -665583001.0/1981808640.0, 12978949.0/20643840.0, 936347639.0/247726080.0,
+        -499349.0/2580480.0, -15835519.0/589824.0, 125.0/6144.0, 110258303.0/737280.0,
+        -277.0/322560.0, -278988547.0/483840.0, 1.0/80640.0, 161581453.0/107520.0,
+        0.0, -17528291.0/6912.0, 0.0, 50537443.0/20160.0,
+        0.0, -11131901.0/10080.0,
+        22869.0/524288.0, 542639257.0/3963617280.0, -553309.0/2752512.0, -19385651.0/11010048.0,
+        339749.0/3096576.0, 15811199.0/1179648.0, -529.0/36864.0, -110256767.0/1474560.0,
+        29.0/43008.0, 92996177.0/322560.0, -1.0/96768.0, -161581453.0/215040.0,
+        0.0, 17528291.0/13824.0, 0.0, -50537443.0/40320.0,
+        0.0, 11131901.0/20160.0,
+        -5445.0/524288.0, -508767001.0/11890851840.0, 287101.0/5898240.0, 94798591.0/165150720.0,
+        -197789.0/6635520.0, -5263189.0/1179648.0, 571.0/110592.0, 257261267.0/10321920.0,
+        -79.0/276480.0, -4428389.0/46080.0, 1.0/207360.0, 161581453.0/645120.0,
+        0.0, -17528291.0/41472.0, 0.0, 50537443.0/120960.0,
+        0.0, -11131901.0/60480.0,
+        847.0/524288.0, 494827801.0/59454259200.0, -1573861.0/206438400.0, -169021387.0/1486356480.0,
+        25177.0/5160960.0, 78893051.0/88473600.0, -289.0/307200.0, -110252927.0/22118400.0,
+        41.0/645120.0, 11159539.0/580608.0, -1.0/806400.0, -161581453.0/3225600.0,
+        0.0, 17528291.0/207360.0, 0.0, -50537443.0/604800.0,
+        0.0, 11131901.0/302400.0,
+        -63.0/524288.0, -44342891.0/59454259200.0, 117469.0/206438400.0, 1698937.0/165150720.0,
+        -17281.0/46448640.0, -2389787.0/29491200.0, 209.0/2764800.0, 1113653.0/2457600.0,
+        -11.0/1935360.0, -187871.0/107520.0, 1.0/7257600.0, 14689223.0/3225600.0,
+        0.0, -1593481.0/207360.0, 0.0, 4594313.0/604800.0,
+        0.0, -1011991.0/302400.0
+    };
+};
+
+template <>
+struct spline_coefficients<5,9>{
+    static const int nb_polys = 12;
+    static const int degree = 19;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -63.0/524288.0, 125823121.0/158544691200.0, 117469.0/206438400.0, -31728239.0/2642411520.0,
+        -17281.0/46448640.0, 12805753.0/117964800.0, 209.0/2764800.0, -62817743.0/88473600.0,
+        -11.0/1935360.0, 67887961.0/20643840.0, 1.0/7257600.0, -92199143.0/8601600.0,
+        0.0, 4001933.0/165888.0, 0.0, -86555957.0/2419200.0,
+        0.0, 76274633.0/2419200.0, 0.0, -649321.0/51840.0,
+        847.0/524288.0, -1402870331.0/158544691200.0, -1573861.0/206438400.0, 630864329.0/4756340736.0,
+        25177.0/5160960.0, -422710169.0/353894400.0, -289.0/307200.0, 230333431.0/29491200.0,
+        41.0/645120.0, -6720908651.0/185794560.0, -1.0/806400.0, 1014190573.0/8601600.0,
+        0.0, -44021263.0/165888.0, 0.0, 952115527.0/2419200.0,
+        0.0, -839020963.0/2419200.0, 0.0, 7142531.0/51840.0,
+        -5445.0/524288.0, 1440041531.0/31708938240.0, 287101.0/5898240.0, -1766766041.0/2642411520.0,
+        -197789.0/6635520.0, 9398429.0/1572864.0, 571.0/110592.0, -4837055299.0/123863040.0,
+        -79.0/276480.0, 177801827.0/983040.0, 1.0/207360.0, -1014190573.0/1720320.0,
+        0.0, 220106315.0/165888.0, 0.0, -952115527.0/483840.0,
+        0.0, 839020963.0/483840.0, 0.0, -7142531.0/10368.0,
+        22869.0/524288.0, -1530367547.0/10569646080.0, -553309.0/2752512.0, 360168133.0/176160768.0,
+        339749.0/3096576.0, -84672389.0/4718592.0, -529.0/36864.0, 76779517.0/655360.0,
+        29.0/43008.0, -11201515613.0/20643840.0, -1.0/96768.0, 1014190573.0/573440.0,
+        0.0, -220106315.0/55296.0, 0.0, 952115527.0/161280.0,
+        0.0, -839020963.0/161280.0, 0.0, 7142531.0/3456.0,
+        -38115.0/262144.0, 1858217531.0/5284823040.0, 12978949.0/20643840.0, -17231459489.0/3963617280.0,
+        -499349.0/2580480.0, 84769669.0/2359296.0, 125.0/6144.0, -230340599.0/983040.0,
+        -277.0/322560.0, 33604547863.0/30965760.0, 1.0/80640.0, -1014190573.0/286720.0,
+        0.0, 220106315.0/27648.0, 0.0, -952115527.0/80640.0,
+        0.0, 839020963.0/80640.0, 0.0, -7142531.0/1728.0,
+        160083.0/262144.0, -5956342331.0/3774873600.0, -2306749.0/4915200.0, 405056197.0/62914560.0,
+        120649.0/1105920.0, -2969154863.0/58982400.0, -527.0/51200.0, 4837176131.0/14745600.0,
+        19.0/46080.0, -448060645.0/294912.0, -1.0/172800.0, 1014190573.0/204800.0,
+        0.0, -308148841.0/27648.0, 0.0, 952115527.0/57600.0,
+        0.0, -839020963.0/57600.0, 0.0, 49997717.0/8640.0,
+        160083.0/262144.0, 5956342331.0/3774873600.0, -2306749.0/4915200.0, -405056197.0/62914560.0,
+        120649.0/1105920.0, 2969154863.0/58982400.0, -527.0/51200.0, -4837176131.0/14745600.0,
+        19.0/46080.0, 448060645.0/294912.0, -1.0/172800.0, -1014190573.0/204800.0,
+        0.0, 308148841.0/27648.0, 0.0, -952115527.0/57600.0,
+        0.0, 839020963.0/57600.0, 0.0, -49997717.0/8640.0,
+        -38115.0/262144.0, -1858217531.0/5284823040.0, 12978949.0/20643840.0, 17231459489.0/3963617280.0,
+        -499349.0/2580480.0, -84769669.0/2359296.0, 125.0/6144.0, 230340599.0/983040.0,
+        -277.0/322560.0, -33604547863.0/30965760.0, 1.0/80640.0, 1014190573.0/286720.0,
+        0.0, -220106315.0/27648.0, 0.0, 952115527.0/80640.0,
+        0.0, -839020963.0/80640.0, 0.0, 7142531.0/1728.0,
+        22869.0/524288.0, 1530367547.0/10569646080.0, -553309.0/2752512.0, -360168133.0/176160768.0,
+        339749.0/3096576.0, 84672389.0/4718592.0, -529.0/36864.0, -76779517.0/655360.0,
+        29.0/43008.0, 11201515613.0/20643840.0, -1.0/96768.0, -1014190573.0/573440.0,
+        0.0, 220106315.0/55296.0, 0.0, -952115527.0/161280.0,
+        0.0, 839020963.0/161280.0, 0.0, -7142531.0/3456.0,
+        -5445.0/524288.0, -1440041531.0/31708938240.0, 287101.0/5898240.0, 1766766041.0/2642411520.0,
+        -197789.0/6635520.0, -9398429.0/1572864.0, 571.0/110592.0, 4837055299.0/123863040.0,
+        -79.0/276480.0, -177801827.0/983040.0, 1.0/207360.0, 1014190573.0/1720320.0,
+        0.0, -220106315.0/165888.0, 0.0, 952115527.0/483840.0,
+        0.0, -839020963.0/483840.0, 0.0, 7142531.0/10368.0,
+        847.0/524288.0, 1402870331.0/158544691200.0, -1573861.0/206438400.0, -630864329.0/4756340736.0,
+        25177.0/5160960.0, 422710169.0/353894400.0, -289.0/307200.0, -230333431.0/29491200.0,
+        41.0/645120.0, 6720908651.0/185794560.0, -1.0/806400.0, -1014190573.0/8601600.0,
+        0.0, 44021263.0/165888.0, 0.0, -952115527.0/2419200.0,
+        0.0, 839020963.0/2419200.0, 0.0, -7142531.0/51840.0,
+        -63.0/524288.0, -125823121.0/158544691200.0, 117469.0/206438400.0, 31728239.0/2642411520.0,
+        -17281.0/46448640.0, -12805753.0/117964800.0, 209.0/2764800.0, 62817743.0/88473600.0,
+        -11.0/1935360.0, -67887961.0/20643840.0, 1.0/7257600.0, 92199143.0/8601600.0,
+        0.0, -4001933.0/165888.0, 0.0, 86555957.0/2419200.0,
+        0.0, -76274633.0/2419200.0, 0.0, 649321.0/51840.0
+    };
+};
+
+template <>
+struct spline_coefficients<5,10>{
+    static const int nb_polys = 12;
+    static const int degree = 21;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -63.0/524288.0, 265934471.0/317089382400.0, 117469.0/206438400.0, -18245491.0/1321205760.0,
+        -17281.0/46448640.0, 931445603.0/6606028800.0, 209.0/2764800.0, -163511909.0/154828800.0,
+        -11.0/1935360.0, 47158705.0/8257536.0, 1.0/7257600.0, -96108373.0/4300800.0,
+        0.0, 208632721.0/3317760.0, 0.0, -9402481.0/75600.0,
+        0.0, 113645653.0/691200.0, 0.0, -23704967.0/181440.0,
+        0.0, 1587581.0/33600.0,
+        847.0/524288.0, -2962911181.0/317089382400.0, -1573861.0/206438400.0, 1812916601.0/11890851840.0,
+        25177.0/5160960.0, -30744442819.0/19818086400.0, -289.0/307200.0, 599546653.0/51609600.0,
+        41.0/645120.0, -23343559999.0/371589120.0, -1.0/806400.0, 1057192103.0/4300800.0,
+        0.0, -2294959931.0/3317760.0, 0.0, 103427291.0/75600.0,
+        0.0, -1250102183.0/691200.0, 0.0, 260754637.0/181440.0,
+        0.0, -17463391.0/33600.0,
+        -5445.0/524288.0, 3037253581.0/63417876480.0, 287101.0/5898240.0, -1014358453.0/1321205760.0,
+        -197789.0/6635520.0, 683482543.0/88080384.0, 571.0/110592.0, -1798653271.0/30965760.0,
+        -79.0/276480.0, 617554519.0/1966080.0, 1.0/207360.0, -1057192103.0/860160.0,
+        0.0, 2294959931.0/663552.0, 0.0, -103427291.0/15120.0,
+        0.0, 1250102183.0/138240.0, 0.0, -260754637.0/36288.0,
+        0.0, 17463391.0/6720.0,
+        22869.0/524288.0, -3217905613.0/21139292160.0, -553309.0/2752512.0, 206279153.0/88080384.0,
+        339749.0/3096576.0, -6156188455.0/264241152.0, -529.0/36864.0, 199851871.0/1146880.0,
+        29.0/43008.0, -38905935721.0/41287680.0, -1.0/96768.0, 1057192103.0/286720.0,
+        0.0, -2294959931.0/221184.0, 0.0, 103427291.0/5040.0,
+        0.0, -1250102183.0/46080.0, 0.0, 260754637.0/12096.0,
+        0.0, -17463391.0/2240.0,
+        -38115.0/262144.0, 3873605581.0/10569646080.0, 12978949.0/20643840.0, -9794508637.0/1981808640.0,
+        -499349.0/2580480.0, 6161636135.0/132120576.0, 125.0/6144.0, -599559197.0/1720320.0,
+        -277.0/322560.0, 116717809211.0/61931520.0, 1.0/80640.0, -1057192103.0/143360.0,
+        0.0, 2294959931.0/110592.0, 0.0, -103427291.0/2520.0,
+        0.0, 1250102183.0/23040.0, 0.0, -260754637.0/6048.0,
+        0.0, 17463391.0/1120.0,
+        160083.0/262144.0, -12069855181.0/7549747200.0, -2306749.0/4915200.0, 45744637.0/6291456.0,
+        120649.0/1105920.0, -30825912259.0/471859200.0, -527.0/51200.0, 1798683479.0/3686400.0,
+        19.0/46080.0, -7781187349.0/2949120.0, -1.0/172800.0, 1057192103.0/102400.0,
+        0.0, -16064719517.0/552960.0, 0.0, 103427291.0/1800.0,
+        0.0, -8750715281.0/115200.0, 0.0, 260754637.0/4320.0,
+        0.0, -17463391.0/800.0,
+        160083.0/262144.0, 12069855181.0/7549747200.0, -2306749.0/4915200.0, -45744637.0/6291456.0,
+        120649.0/1105920.0, 30825912259.0/471859200.0, -527.0/51200.0, -1798683479.0/3686400.0,
+        19.0/46080.0, 7781187349.0/2949120.0, -1.0/172800.0, -1057192103.0/102400.0,
+        0.0, 16064719517.0/552960.0, 0.0, -103427291.0/1800.0,
+        0.0, 8750715281.0/115200.0, 0.0, -260754637.0/4320.0,
+        0.0, 17463391.0/800.0,
+        -38115.0/262144.0, -3873605581.0/10569646080.0, 12978949.0/20643840.0, 9794508637.0/1981808640.0,
+        -499349.0/2580480.0, -6161636135.0/132120576.0, 125.0/6144.0, 599559197.0/1720320.0,
+        -277.0/322560.0, -116717809211.0/61931520.0, 1.0/80640.0, 1057192103.0/143360.0,
+        0.0, -2294959931.0/110592.0, 0.0, 103427291.0/2520.0,
+        0.0, -1250102183.0/23040.0, 0.0, 260754637.0/6048.0,
+        0.0, -17463391.0/1120.0,
+        22869.0/524288.0, 3217905613.0/21139292160.0, -553309.0/2752512.0, -206279153.0/88080384.0,
+        339749.0/3096576.0, 6156188455.0/264241152.0, -529.0/36864.0, -199851871.0/1146880.0,
+        29.0/43008.0, 38905935721.0/41287680.0, -1.0/96768.0, -1057192103.0/286720.0,
+        0.0, 2294959931.0/221184.0, 0.0, -103427291.0/5040.0,
+        0.0, 1250102183.0/46080.0, 0.0, -260754637.0/12096.0,
+        0.0, 17463391.0/2240.0,
+        -5445.0/524288.0, -3037253581.0/63417876480.0, 287101.0/5898240.0, 1014358453.0/1321205760.0,
+        -197789.0/6635520.0, -683482543.0/88080384.0, 571.0/110592.0, 1798653271.0/30965760.0,
+        -79.0/276480.0, -617554519.0/1966080.0, 1.0/207360.0, 1057192103.0/860160.0,
+        0.0, -2294959931.0/663552.0, 0.0, 103427291.0/15120.0,
+        0.0, -1250102183.0/138240.0, 0.0, 260754637.0/36288.0,
+        0.0, -17463391.0/6720.0,
+        847.0/524288.0, 2962911181.0/317089382400.0, -1573861.0/206438400.0, -1812916601.0/11890851840.0,
+        25177.0/5160960.0, 30744442819.0/19818086400.0, -289.0/307200.0, -599546653.0/51609600.0,
+        41.0/645120.0, 23343559999.0/371589120.0, -1.0/806400.0, -1057192103.0/4300800.0,
+        0.0, 2294959931.0/3317760.0, 0.0, -103427291.0/75600.0,
+        0.0, 1250102183.0/691200.0, 0.0, -260754637.0/181440.0,
+        0.0, 17463391.0/33600.0,
+        -63.0/524288.0, -265934471.0/317089382400.0, 117469.0/206438400.0, 18245491.0/1321205760.0,
+        -17281.0/46448640.0, -931445603.0/6606028800.0, 209.0/2764800.0, 163511909.0/154828800.0,
+        -11.0/1935360.0, -47158705.0/8257536.0, 1.0/7257600.0, 96108373.0/4300800.0,
+        0.0, -208632721.0/3317760.0, 0.0, 9402481.0/75600.0,
+        0.0, -113645653.0/691200.0, 0.0, 23704967.0/181440.0,
+        0.0, -1587581.0/33600.0
+    };
+};
+
+template <>
+struct spline_coefficients<6,0>{
+    static const int nb_polys = 14;
+    static const int degree = 1;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        1.0/2.0, -1.0,
+        1.0/2.0, 1.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0
+    };
+};
+
+template <>
+struct spline_coefficients<6,1>{
+    static const int nb_polys = 14;
+    static const int degree = 3;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        1.0/44352.0, -1.0/22176.0, -1.0/11088.0, 1.0/5544.0,
+        -1.0/2880.0, 67.0/110880.0, 1.0/720.0, -67.0/27720.0,
+        9.0/3520.0, -47.0/12320.0, -9.0/880.0, 47.0/3080.0,
+        -7.0/576.0, 31.0/2016.0, 7.0/144.0, -31.0/504.0,
+        25.0/576.0, -95.0/2016.0, -25.0/144.0, 95.0/504.0,
+        -9.0/64.0, 33.0/224.0, 9.0/16.0, -33.0/56.0,
+        17.0/28.0, -9.0/7.0, -3.0/7.0, 8.0/7.0,
+        17.0/28.0, 9.0/7.0, -3.0/7.0, -8.0/7.0,
+        -9.0/64.0, -33.0/224.0, 9.0/16.0, 33.0/56.0,
+        25.0/576.0, 95.0/2016.0, -25.0/144.0, -95.0/504.0,
+        -7.0/576.0, -31.0/2016.0, 7.0/144.0, 31.0/504.0,
+        9.0/3520.0, 47.0/12320.0, -9.0/880.0, -47.0/3080.0,
+        -1.0/2880.0, -67.0/110880.0, 1.0/720.0, 67.0/27720.0,
+        1.0/44352.0, 1.0/22176.0, -1.0/11088.0, -1.0/5544.0
+    };
+};
+
+template <>
+struct spline_coefficients<6,2>{
+    static const int nb_polys = 14;
+    static const int degree = 5;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        29.0/1064448.0, -41.0/532224.0, -17.0/133056.0, 29.0/66528.0,
+        5.0/66528.0, -17.0/33264.0,
+        -1013.0/2419200.0, 13613.0/13305600.0, 593.0/302400.0, -9593.0/1663200.0,
+        -173.0/151200.0, 5573.0/831600.0,
+        6057.0/1971200.0, -6273.0/985600.0, -3537.0/246400.0, 4393.0/123200.0,
+        1017.0/123200.0, -359.0/8800.0,
+        -401.0/27648.0, 2417.0/96768.0, 233.0/3456.0, -239.0/1728.0,
+        -65.0/1728.0, 929.0/6048.0,
+        4925.0/96768.0, -3505.0/48384.0, -2825.0/12096.0, 2365.0/6048.0,
+        725.0/6048.0, -175.0/432.0,
+        -549.0/3584.0, 351.0/1792.0, 297.0/448.0, -219.0/224.0,
+        -45.0/224.0, 87.0/112.0,
+        495217.0/806400.0, -545617.0/403200.0, -48817.0/100800.0, 84817.0/50400.0,
+        5617.0/50400.0, -27217.0/25200.0,
+        495217.0/806400.0, 545617.0/403200.0, -48817.0/100800.0, -84817.0/50400.0,
+        5617.0/50400.0, 27217.0/25200.0,
+        -549.0/3584.0, -351.0/1792.0, 297.0/448.0, 219.0/224.0,
+        -45.0/224.0, -87.0/112.0,
+        4925.0/96768.0, 3505.0/48384.0, -2825.0/12096.0, -2365.0/6048.0,
+        725.0/6048.0, 175.0/432.0,
+        -401.0/27648.0, -2417.0/96768.0, 233.0/3456.0, 239.0/1728.0,
+        -65.0/1728.0, -929.0/6048.0,
+        6057.0/1971200.0, 6273.0/985600.0, -3537.0/246400.0, -4393.0/123200.0,
+        1017.0/123200.0, 359.0/8800.0,
+        -1013.0/2419200.0, -13613.0/13305600.0, 593.0/302400.0, 9593.0/1663200.0,
+        -173.0/151200.0, -5573.0/831600.0,
+        29.0/1064448.0, 41.0/532224.0, -17.0/133056.0, -29.0/66528.0,
+        5.0/66528.0, 17.0/33264.0
+    };
+};
+
+template <>
+struct spline_coefficients<6,3>{
+    static const int nb_polys = 14;
+    static const int degree = 7;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        70331.0/2554675200.0, -11521.0/116121600.0, -27931.0/212889600.0, 74731.0/106444800.0,
+        1577.0/17740800.0, -1553.0/985600.0, -731.0/39916800.0, 28331.0/19958400.0,
+        -98233.0/232243200.0, 335081.0/255467520.0, 12979.0/6451200.0, -29773.0/3225600.0,
+        -6521.0/4838400.0, 546893.0/26611200.0, 197.0/725760.0, -52651.0/2851200.0,
+        1747.0/563200.0, -653.0/80640.0, -14493.0/985600.0, 41731.0/739200.0,
+        2379.0/246400.0, -716.0/5775.0, -23.0/12320.0, 15373.0/138600.0,
+        -60649.0/4147200.0, 227471.0/7257600.0, 7933.0/115200.0, -21641.0/100800.0,
+        -3749.0/86400.0, 69421.0/151200.0, 499.0/64800.0, -11549.0/28350.0,
+        67931.0/1327104.0, -2052689.0/23224320.0, -183517.0/774144.0, 1127089.0/1935360.0,
+        8639.0/64512.0, -62921.0/53760.0, -2717.0/145152.0, 370289.0/362880.0,
+        -440317.0/2867200.0, 966041.0/4300800.0, 478551.0/716800.0, -474041.0/358400.0,
+        -39351.0/179200.0, 193241.0/89600.0, 1117.0/44800.0, -17663.0/9600.0,
+        41281.0/67200.0, -44887.0/32256.0, -98099.0/201600.0, 432091.0/201600.0,
+        3041.0/25200.0, -147257.0/50400.0, -31.0/2520.0, 30941.0/12600.0,
+        41281.0/67200.0, 44887.0/32256.0, -98099.0/201600.0, -432091.0/201600.0,
+        3041.0/25200.0, 147257.0/50400.0, -31.0/2520.0, -30941.0/12600.0,
+        -440317.0/2867200.0, -966041.0/4300800.0, 478551.0/716800.0, 474041.0/358400.0,
+        -39351.0/179200.0, -193241.0/89600.0, 1117.0/44800.0, 17663.0/9600.0,
+        67931.0/1327104.0, 2052689.0/23224320.0, -183517.0/774144.0, -1127089.0/1935360.0,
+        8639.0/64512.0, 62921.0/53760.0, -2717.0/145152.0, -370289.0/362880.0,
+        -60649.0/4147200.0, -227471.0/7257600.0, 7933.0/115200.0, 21641.0/100800.0,
+        -3749.0/86400.0, -69421.0/151200.0, 499.0/64800.0, 11549.0/28350.0,
+        1747.0/563200.0, 653.0/80640.0, -14493.0/985600.0, -41731.0/739200.0,
+        2379.0/246400.0, 716.0/5775.0, -23.0/12320.0, -15373.0/138600.0,
+        -98233.0/232243200.0, -335081.0/255467520.0, 12979.0/6451200.0, 29773.0/3225600.0,
+        -6521.0/4838400.0, -546893.0/26611200.0, 197.0/725760.0, 52651.0/2851200.0,
+        70331.0/2554675200.0, 11521.0/116121600.0, -27931.0/212889600.0, -74731.0/106444800.0,
+        1577.0/17740800.0, 1553.0/985600.0, -731.0/39916800.0, -28331.0/19958400.0
+    };
+};
+
+template <>
+struct spline_coefficients<6,4>{
+    static const int nb_polys = 14;
+    static const int degree = 9;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        1688371.0/61312204800.0, -3590743.0/30656102400.0, -100637.0/766402560.0, 1894357.0/1916006400.0,
+        57199.0/638668800.0, -1052371.0/319334400.0, -4813.0/239500800.0, 143837.0/23950080.0,
+        61.0/34214400.0, -78457.0/17107200.0,
+        -336877.0/796262400.0, 47349427.0/30656102400.0, 701413.0/348364800.0, -24824869.0/1916006400.0,
+        -11257.0/8294400.0, 1957489.0/45619200.0, 6457.0/21772800.0, -9351049.0/119750400.0,
+        -547.0/21772800.0, 7139707.0/119750400.0,
+        195703.0/63078400.0, -2695219.0/283852800.0, -58011.0/3942400.0, 1398203.0/17740800.0,
+        19149.0/1971200.0, -254417.0/985600.0, -499.0/246400.0, 519643.0/1108800.0,
+        39.0/246400.0, -396659.0/1108800.0,
+        -2911583.0/199065600.0, 25407227.0/696729600.0, 171439.0/2488320.0, -12918923.0/43545600.0,
+        -90407.0/2073600.0, 6902219.0/7257600.0, 6419.0/777600.0, -935743.0/544320.0,
+        -431.0/777600.0, 3570011.0/2721600.0,
+        11413411.0/222953472.0, -56404699.0/557383680.0, -3304309.0/13934592.0, 5485553.0/6967296.0,
+        312007.0/2322432.0, -13935631.0/5806080.0, -17305.0/870912.0, 9361897.0/2177280.0,
+        1003.0/870912.0, -7140163.0/2177280.0,
+        -503237.0/3276800.0, 8521691.0/34406400.0, 38289.0/57344.0, -3637609.0/2150400.0,
+        -22539.0/102400.0, 223761.0/51200.0, 2357.0/89600.0, -208129.0/26880.0,
+        -123.0/89600.0, 793363.0/134400.0,
+        142667717.0/232243200.0, -165163361.0/116121600.0, -7063709.0/14515200.0, 19125437.0/7257600.0,
+        292517.0/2419200.0, -7104329.0/1209600.0, -11741.0/907200.0, 4684037.0/453600.0,
+        83.0/129600.0, -510023.0/64800.0,
+        142667717.0/232243200.0, 165163361.0/116121600.0, -7063709.0/14515200.0, -19125437.0/7257600.0,
+        292517.0/2419200.0, 7104329.0/1209600.0, -11741.0/907200.0, -4684037.0/453600.0,
+        83.0/129600.0, 510023.0/64800.0,
+        -503237.0/3276800.0, -8521691.0/34406400.0, 38289.0/57344.0, 3637609.0/2150400.0,
+        -22539.0/102400.0, -223761.0/51200.0, 2357.0/89600.0, 208129.0/26880.0,
+        -123.0/89600.0, -793363.0/134400.0,
+        11413411.0/222953472.0, 56404699.0/557383680.0, -3304309.0/13934592.0, -5485553.0/6967296.0,
+        312007.0/2322432.0, 13935631.0/5806080.0, -17305.0/870912.0, -9361897.0/2177280.0,
+        1003.0/870912.0, 7140163.0/2177280.0,
+        -2911583.0/199065600.0, -25407227.0/696729600.0, 171439.0/2488320.0, 12918923.0/43545600.0,
+        -90407.0/2073600.0, -6902219.0/7257600.0, 6419.0/777600.0, 935743.0/544320.0,
+        -431.0/777600.0, -3570011.0/2721600.0,
+        195703.0/63078400.0, 2695219.0/283852800.0, -58011.0/3942400.0, -1398203.0/17740800.0,
+        19149.0/1971200.0, 254417.0/985600.0, -499.0/246400.0, -519643.0/1108800.0,
+        39.0/246400.0, 396659.0/1108800.0,
+        -336877.0/796262400.0, -47349427.0/30656102400.0, 701413.0/348364800.0, 24824869.0/1916006400.0,
+        -11257.0/8294400.0, -1957489.0/45619200.0, 6457.0/21772800.0, 9351049.0/119750400.0,
+        -547.0/21772800.0, -7139707.0/119750400.0,
+        1688371.0/61312204800.0, 3590743.0/30656102400.0, -100637.0/766402560.0, -1894357.0/1916006400.0,
+        57199.0/638668800.0, 1052371.0/319334400.0, -4813.0/239500800.0, -143837.0/23950080.0,
+        61.0/34214400.0, 78457.0/17107200.0
+    };
+};
+
+template <>
+struct spline_coefficients<6,5>{
+    static const int nb_polys = 14;
+    static const int degree = 11;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        13507003.0/490497638400.0, -32524319.0/245248819200.0, -1073473.0/8174960640.0, 79611299.0/61312204800.0,
+        1372951.0/15328051200.0, -4916531.0/851558400.0, -77183.0/3832012800.0, 6099767.0/383201280.0,
+        19.0/10137600.0, -3340781.0/136857600.0, -1.0/13685760.0, 7235.0/456192.0,
+        -18865153.0/44590694400.0, 428174297.0/245248819200.0, 7481807.0/3715891200.0, -1041290213.0/61312204800.0,
+        -1891381.0/1393459200.0, 191917519.0/2554675200.0, 103517.0/348364800.0, -396511189.0/1916006400.0,
+        -509.0/19353600.0, 304012061.0/958003200.0, 41.0/43545600.0, -16459627.0/79833600.0,
+        14090639.0/4541644800.0, -218745211.0/20437401600.0, -16707283.0/1135411200.0, 526129679.0/5109350400.0,
+        1378843.0/141926400.0, -288309431.0/638668800.0, -71971.0/35481600.0, 198275807.0/159667200.0,
+        2923.0/17740800.0, -152006663.0/79833600.0, -23.0/4435200.0, 24689443.0/19958400.0,
+        -23292689.0/1592524800.0, 227947261.0/5573836800.0, 1828691.0/26542080.0, -536852761.0/1393459200.0,
+        -2169893.0/49766400.0, 96366827.0/58060800.0, 102829.0/12441600.0, -39661333.0/8709120.0,
+        -397.0/691200.0, 152007313.0/21772800.0, 1.0/62208.0, -1645963.0/362880.0,
+        91307341.0/1783627776.0, -100123297.0/891813888.0, -35246051.0/148635648.0, 224916589.0/222953472.0,
+        7488433.0/55738368.0, -21531467.0/5160960.0, -277145.0/13934592.0, 396684817.0/34836480.0,
+        307.0/258048.0, -304015769.0/17418240.0, -53.0/1741824.0, 16459631.0/1451520.0,
+        -253631503.0/1651507200.0, 662940647.0/2477260800.0, 11027243.0/16515072.0, -1294525867.0/619315200.0,
+        -11359931.0/51609600.0, 585221107.0/77414400.0, 339683.0/12902400.0, -79349471.0/3870720.0,
+        -9131.0/6451200.0, 304016611.0/9676800.0, 11.0/322560.0, -9875779.0/483840.0,
+        285335441.0/464486400.0, -84124771.0/58060800.0, -18836569.0/38707200.0, 91932653.0/29030400.0,
+        1755137.0/14515200.0, -3061991.0/302400.0, -46999.0/3628800.0, 24798979.0/907200.0,
+        19.0/28800.0, -1357219.0/32400.0, -1.0/64800.0, 5443.0/200.0,
+        285335441.0/464486400.0, 84124771.0/58060800.0, -18836569.0/38707200.0, -91932653.0/29030400.0,
+        1755137.0/14515200.0, 3061991.0/302400.0, -46999.0/3628800.0, -24798979.0/907200.0,
+        19.0/28800.0, 1357219.0/32400.0, -1.0/64800.0, -5443.0/200.0,
+        -253631503.0/1651507200.0, -662940647.0/2477260800.0, 11027243.0/16515072.0, 1294525867.0/619315200.0,
+        -11359931.0/51609600.0, -585221107.0/77414400.0, 339683.0/12902400.0, 79349471.0/3870720.0,
+        -9131.0/6451200.0, -304016611.0/9676800.0, 11.0/322560.0, 9875779.0/483840.0,
+        91307341.0/1783627776.0, 100123297.0/891813888.0, -35246051.0/148635648.0, -224916589.0/222953472.0,
+        7488433.0/55738368.0, 21531467.0/5160960.0, -277145.0/13934592.0, -396684817.0/34836480.0,
+        307.0/258048.0, 304015769.0/17418240.0, -53.0/1741824.0, -16459631.0/1451520.0,
+        -23292689.0/1592524800.0, -227947261.0/5573836800.0, 1828691.0/26542080.0, 536852761.0/1393459200.0,
+        -2169893.0/49766400.0, -96366827.0/58060800.0, 102829.0/12441600.0, 39661333.0/8709120.0,
+        -397.0/691200.0, -152007313.0/21772800.0, 1.0/62208.0, 1645963.0/362880.0,
+        14090639.0/4541644800.0, 218745211.0/20437401600.0, -16707283.0/1135411200.0, -526129679.0/5109350400.0,
+        1378843.0/141926400.0, 288309431.0/638668800.0, -71971.0/35481600.0, -198275807.0/159667200.0,
+        2923.0/17740800.0, 152006663.0/79833600.0, -23.0/4435200.0, -24689443.0/19958400.0,
+        -18865153.0/44590694400.0, -428174297.0/245248819200.0, 7481807.0/3715891200.0, 1041290213.0/61312204800.0,
+        -1891381.0/1393459200.0, -191917519.0/2554675200.0, 103517.0/348364800.0, 396511189.0/1916006400.0,
+        -509.0/19353600.0, -304012061.0/958003200.0, 41.0/43545600.0, 16459627.0/79833600.0,
+        13507003.0/490497638400.0, 32524319.0/245248819200.0, -1073473.0/8174960640.0, -79611299.0/61312204800.0,
+        1372951.0/15328051200.0, 4916531.0/851558400.0, -77183.0/3832012800.0, -6099767.0/383201280.0,
+        19.0/10137600.0, 3340781.0/136857600.0, -1.0/13685760.0, -7235.0/456192.0
+    };
+};
+
+template <>
+struct spline_coefficients<6,6>{
+    static const int nb_polys = 14;
+    static const int degree = 13;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        231.0/8388608.0, -287368621.0/1961990553600.0, -7156487.0/54499737600.0, 36360673.0/22295347200.0,
+        1997021.0/22295347200.0, -11268601.0/1238630400.0, -28067.0/1393459200.0, 669781.0/19906560.0,
+        871.0/464486400.0, -54063161.0/696729600.0, -13.0/174182400.0, 2930779.0/29030400.0,
+        1.0/958003200.0, -1006447.0/17740800.0,
+        -3549.0/8388608.0, 3778657273.0/1961990553600.0, 9975743.0/4954521600.0, -474995413.0/22295347200.0,
+        -30262111.0/22295347200.0, 439726799.0/3715891200.0, 414073.0/1393459200.0, -43537133.0/99532800.0,
+        -12221.0/464486400.0, 702821813.0/696729600.0, 167.0/174182400.0, -83820281.0/63866880.0,
+        -1.0/87091200.0, 13083811.0/17740800.0,
+        13013.0/4194304.0, -3853186273.0/326998425600.0, -133658267.0/9083289600.0, 478984193.0/3715891200.0,
+        4011181.0/412876800.0, -1320440477.0/1857945600.0, -52343.0/25804800.0, 43539233.0/16588800.0,
+        4253.0/25804800.0, -702822733.0/116121600.0, -17.0/3225600.0, 22860077.0/2903040.0,
+        1.0/17740800.0, -13083811.0/2956800.0,
+        -61347.0/4194304.0, 571488439.0/12740198400.0, 24382547.0/353894400.0, -764944397.0/1592524800.0,
+        -69436591.0/1592524800.0, 692864707.0/265420800.0, 822637.0/99532800.0, -670553561.0/69672960.0,
+        -19061.0/33177600.0, 1104437209.0/49766400.0, 203.0/12441600.0, -59871631.0/2073600.0,
+        -1.0/6220800.0, 13083811.0/806400.0,
+        429429.0/8388608.0, -4358194777.0/35672555520.0, -46994735.0/198180864.0, 5558120471.0/4459069440.0,
+        119814943.0/891813888.0, -540760637.0/82575360.0, -1108585.0/55738368.0, 479007679.0/19906560.0,
+        22109.0/18579456.0, -7731069607.0/139345920.0, -215.0/6967296.0, 419101421.0/5806080.0,
+        1.0/3483648.0, -13083811.0/322560.0,
+        -1288287.0/8388608.0, 5656788073.0/19818086400.0, 1102724303.0/1651507200.0, -6237892159.0/2477260800.0,
+        -181758911.0/825753600.0, 14662481167.0/1238630400.0, 1358737.0/51609600.0, -95808683.0/2211840.0,
+        -73063.0/51609600.0, 7731076343.0/77414400.0, 223.0/6451200.0, -1257304271.0/9676800.0,
+        -1.0/3225600.0, 13083811.0/179200.0,
+        1288287.0/2097152.0, -21889204273.0/14863564800.0, -200923403.0/412876800.0, 6943478483.0/1857945600.0,
+        224657551.0/1857945600.0, -4901793269.0/309657600.0, -1503973.0/116121600.0, 479064163.0/8294400.0,
+        25541.0/38707200.0, -7731079903.0/58060800.0, -227.0/14515200.0, 620891.0/3584.0,
+        1.0/7257600.0, -13083811.0/134400.0,
+        1288287.0/2097152.0, 21889204273.0/14863564800.0, -200923403.0/412876800.0, -6943478483.0/1857945600.0,
+        224657551.0/1857945600.0, 4901793269.0/309657600.0, -1503973.0/116121600.0, -479064163.0/8294400.0,
+        25541.0/38707200.0, 7731079903.0/58060800.0, -227.0/14515200.0, -620891.0/3584.0,
+        1.0/7257600.0, 13083811.0/134400.0,
+        -1288287.0/8388608.0, -5656788073.0/19818086400.0, 1102724303.0/1651507200.0, 6237892159.0/2477260800.0,
+        -181758911.0/825753600.0, -14662481167.0/1238630400.0, 1358737.0/51609600.0, 95808683.0/2211840.0,
+        -73063.0/51609600.0, -7731076343.0/77414400.0, 223.0/6451200.0, 1257304271.0/9676800.0,
+        -1.0/3225600.0, -13083811.0/179200.0,
+        429429.0/8388608.0, 4358194777.0/35672555520.0, -46994735.0/198180864.0, -5558120471.0/4459069440.0,
+        119814943.0/891813888.0, 540760637.0/82575360.0, -1108585.0/55738368.0, -479007679.0/19906560.0,
+        22109.0/18579456.0, 7731069607.0/139345920.0, -215.0/6967296.0, -419101421.0/5806080.0,
+        1.0/3483648.0, 13083811.0/322560.0,
+        -61347.0/4194304.0, -571488439.0/12740198400.0, 24382547.0/353894400.0, 764944397.0/1592524800.0,
+        -69436591.0/1592524800.0, -692864707.0/265420800.0, 822637.0/99532800.0, 670553561.0/69672960.0,
+        -19061.0/33177600.0, -1104437209.0/49766400.0, 203.0/12441600.0, 59871631.0/2073600.0,
+        -1.0/6220800.0, -13083811.0/806400.0,
+        13013.0/4194304.0, 3853186273.0/326998425600.0, -133658267.0/9083289600.0, -478984193.0/3715891200.0,
+        4011181.0/412876800.0, 1320440477.0/1857945600.0, -52343.0/25804800.0, -43539233.0/16588800.0,
+        4253.0/25804800.0, 702822733.0/116121600.0, -17.0/3225600.0, -22860077.0/2903040.0,
+        1.0/17740800.0, 13083811.0/2956800.0,
+        -3549.0/8388608.0, -3778657273.0/1961990553600.0, 9975743.0/4954521600.0, 474995413.0/22295347200.0,
+        -30262111.0/22295347200.0, -439726799.0/3715891200.0, 414073.0/1393459200.0, 43537133.0/99532800.0,
+        -12221.0/464486400.0, -702821813.0/696729600.0, 167.0/174182400.0, 83820281.0/63866880.0,
+        -1.0/87091200.0, -13083811.0/17740800.0,
+        231.0/8388608.0, 287368621.0/1961990553600.0, -7156487.0/54499737600.0, -36360673.0/22295347200.0,
+        1997021.0/22295347200.0, 11268601.0/1238630400.0, -28067.0/1393459200.0, -669781.0/19906560.0,
+        871.0/464486400.0, 54063161.0/696729600.0, -13.0/174182400.0, -2930779.0/29030400.0,
+        1.0/958003200.0, 1006447.0/17740800.0
+    };
+};
+
+template <>
+struct spline_coefficients<6,7>{
+    static const int nb_polys = 14;
+    static const int degree = 15;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        231.0/8388608.0, -624357373.0/3923981107200.0, -7156487.0/54499737600.0, 177019139.0/89181388800.0,
+        1997021.0/22295347200.0, -99188053.0/7431782400.0, -28067.0/1393459200.0, 3289723.0/53084160.0,
+        871.0/464486400.0, -88669519.0/464486400.0, -13.0/174182400.0, 43299563.0/116121600.0,
+        1.0/958003200.0, -80337811.0/191600640.0, 0.0, 4510921.0/21772800.0,
+        -3549.0/8388608.0, 8202376249.0/3923981107200.0, 9975743.0/4954521600.0, -2310475463.0/89181388800.0,
+        -30262111.0/22295347200.0, 1289947409.0/7431782400.0, 414073.0/1393459200.0, -213835643.0/265420800.0,
+        -12221.0/464486400.0, 1152704227.0/464486400.0, 167.0/174182400.0, -687981949.0/141926400.0,
+        -1.0/87091200.0, 1044391543.0/191600640.0, 0.0, -58641973.0/21772800.0,
+        13013.0/4194304.0, -8351434249.0/653996851200.0, -133658267.0/9083289600.0, 258492287.0/1651507200.0,
+        4011181.0/412876800.0, -3872362387.0/3715891200.0, -52343.0/25804800.0, 213841243.0/44236800.0,
+        4253.0/25804800.0, -3458114521.0/232243200.0, -17.0/3225600.0, 1688682973.0/58060800.0,
+        1.0/17740800.0, -1044391543.0/31933440.0, 0.0, 58641973.0/3628800.0,
+        -61347.0/4194304.0, 8645899849.0/178362777600.0, 24382547.0/353894400.0, -3704839291.0/6370099200.0,
+        -69436591.0/1592524800.0, 2030791117.0/530841600.0, 822637.0/99532800.0, -3293286803.0/185794560.0,
+        -19061.0/33177600.0, 1811394311.0/33177600.0, 203.0/12441600.0, -294849409.0/2764800.0,
+        -1.0/6220800.0, 1044391543.0/8709120.0, 0.0, -645061703.0/10886400.0,
+        429429.0/8388608.0, -9361451257.0/71345111040.0, -46994735.0/198180864.0, 5349582761.0/3567255552.0,
+        119814943.0/891813888.0, -14249123387.0/1486356480.0, -1108585.0/55738368.0, 2352456649.0/53084160.0,
+        22109.0/18579456.0, -12679766273.0/92897280.0, -215.0/6967296.0, 1238367521.0/4644864.0,
+        1.0/3483648.0, -1044391543.0/3483648.0, 0.0, 645061703.0/4354560.0,
+        -1288287.0/8388608.0, 11958637849.0/39636172800.0, 1102724303.0/1651507200.0, -1091370391.0/367001600.0,
+        -181758911.0/825753600.0, 42871258097.0/2477260800.0, 1358737.0/51609600.0, -470510389.0/5898240.0,
+        -73063.0/51609600.0, 38039312291.0/154828800.0, 223.0/6451200.0, -18575512847.0/38707200.0,
+        -1.0/3225600.0, 1044391543.0/1935360.0, 0.0, -645061703.0/2419200.0,
+        1288287.0/2097152.0, -44423470249.0/29727129600.0, -200923403.0/412876800.0, 32289345853.0/7431782400.0,
+        224657551.0/1857945600.0, -530334017.0/22937600.0, -1503973.0/116121600.0, 2352607273.0/22118400.0,
+        25541.0/38707200.0, -12679773137.0/38707200.0, -227.0/14515200.0, 6191837621.0/9676800.0,
+        1.0/7257600.0, -1044391543.0/1451520.0, 0.0, 645061703.0/1814400.0,
+        1288287.0/2097152.0, 44423470249.0/29727129600.0, -200923403.0/412876800.0, -32289345853.0/7431782400.0,
+        224657551.0/1857945600.0, 530334017.0/22937600.0, -1503973.0/116121600.0, -2352607273.0/22118400.0,
+        25541.0/38707200.0, 12679773137.0/38707200.0, -227.0/14515200.0, -6191837621.0/9676800.0,
+        1.0/7257600.0, 1044391543.0/1451520.0, 0.0, -645061703.0/1814400.0,
+        -1288287.0/8388608.0, -11958637849.0/39636172800.0, 1102724303.0/1651507200.0, 1091370391.0/367001600.0,
+        -181758911.0/825753600.0, -42871258097.0/2477260800.0, 1358737.0/51609600.0, 470510389.0/5898240.0,
+        -73063.0/51609600.0, -38039312291.0/154828800.0, 223.0/6451200.0, 18575512847.0/38707200.0,
+        -1.0/3225600.0, -1044391543.0/1935360.0, 0.0, 645061703.0/2419200.0,
+        429429.0/8388608.0, 9361451257.0/71345111040.0, -46994735.0/198180864.0, -5349582761.0/3567255552.0,
+        119814943.0/891813888.0, 14249123387.0/1486356480.0, -1108585.0/55738368.0, -2352456649.0/53084160.0,
+        22109.0/18579456.0, 12679766273.0/92897280.0, -215.0/6967296.0, -1238367521.0/4644864.0,
+        1.0/3483648.0, 1044391543.0/3483648.0, 0.0, -645061703.0/4354560.0,
+        -61347.0/4194304.0, -8645899849.0/178362777600.0, 24382547.0/353894400.0, 3704839291.0/6370099200.0,
+        -69436591.0/1592524800.0, -2030791117.0/530841600.0, 822637.0/99532800.0, 3293286803.0/185794560.0,
+        -19061.0/33177600.0, -1811394311.0/33177600.0, 203.0/12441600.0, 294849409.0/2764800.0,
+        -1.0/6220800.0, -1044391543.0/8709120.0, 0.0, 645061703.0/10886400.0,
+        13013.0/4194304.0, 8351434249.0/653996851200.0, -133658267.0/9083289600.0, -258492287.0/1651507200.0,
+        4011181.0/412876800.0, 3872362387.0/3715891200.0, -52343.0/25804800.0, -213841243.0/44236800.0,
+        4253.0/25804800.0, 3458114521.0/232243200.0, -17.0/3225600.0, -1688682973.0/58060800.0,
+        1.0/17740800.0, 1044391543.0/31933440.0, 0.0, -58641973.0/3628800.0,
+        -3549.0/8388608.0, -8202376249.0/3923981107200.0, 9975743.0/4954521600.0, 2310475463.0/89181388800.0,
+        -30262111.0/22295347200.0, -1289947409.0/7431782400.0, 414073.0/1393459200.0, 213835643.0/265420800.0,
+        -12221.0/464486400.0, -1152704227.0/464486400.0, 167.0/174182400.0, 687981949.0/141926400.0,
+        -1.0/87091200.0, -1044391543.0/191600640.0, 0.0, 58641973.0/21772800.0,
+        231.0/8388608.0, 624357373.0/3923981107200.0, -7156487.0/54499737600.0, -177019139.0/89181388800.0,
+        1997021.0/22295347200.0, 99188053.0/7431782400.0, -28067.0/1393459200.0, -3289723.0/53084160.0,
+        871.0/464486400.0, 88669519.0/464486400.0, -13.0/174182400.0, -43299563.0/116121600.0,
+        1.0/958003200.0, 80337811.0/191600640.0, 0.0, -4510921.0/21772800.0
+    };
+};
+
+template <>
+struct spline_coefficients<6,8>{
+    static const int nb_polys = 14;
+    static const int degree = 17;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        231.0/8388608.0, -383032417.0/2242274918400.0, -7156487.0/54499737600.0, 210436853.0/89181388800.0,
+        1997021.0/22295347200.0, -23029231.0/1238630400.0, -28067.0/1393459200.0, 3065317.0/29491200.0,
+        871.0/464486400.0, -13787989.0/34406400.0, -13.0/174182400.0, 40424743.0/38707200.0,
+        1.0/958003200.0, -422067761.0/239500800.0, 0.0, 7585727.0/4354560.0,
+        0.0, -5569619.0/7257600.0,
+        -3549.0/8388608.0, 5028410221.0/2242274918400.0, 9975743.0/4954521600.0, -548981149.0/17836277760.0,
+        -30262111.0/22295347200.0, 898391369.0/3715891200.0, 414073.0/1393459200.0, -119548579.0/88473600.0,
+        -12221.0/464486400.0, 1613195033.0/309657600.0, 167.0/174182400.0, -17342214779.0/1277337600.0,
+        -1.0/87091200.0, 5486880893.0/239500800.0, 0.0, -98614451.0/4354560.0,
+        0.0, 72405047.0/7257600.0,
+        13013.0/4194304.0, -5113586221.0/373712486400.0, -133658267.0/9083289600.0, 26293913.0/141557760.0,
+        4011181.0/412876800.0, -2696434187.0/1857945600.0, -52343.0/25804800.0, 358651337.0/44236800.0,
+        4253.0/25804800.0, -14518758977.0/464486400.0, -17.0/3225600.0, 4729694947.0/58060800.0,
+        1.0/17740800.0, -5486880893.0/39916800.0, 0.0, 98614451.0/725760.0,
+        0.0, -72405047.0/1209600.0,
+        -61347.0/4194304.0, 36972965947.0/713451110400.0, 24382547.0/353894400.0, -30712608139.0/44590694400.0,
+        -69436591.0/1592524800.0, 1413623317.0/265420800.0, 822637.0/99532800.0, -9205603751.0/309657600.0,
+        -19061.0/33177600.0, 2535022069.0/22118400.0, 203.0/12441600.0, -2477459261.0/8294400.0,
+        -1.0/6220800.0, 5486880893.0/10886400.0, 0.0, -1084758961.0/2177280.0,
+        0.0, 796455517.0/3628800.0,
+        429429.0/8388608.0, -5690738797.0/40768634880.0, -46994735.0/198180864.0, 4503806701.0/2548039680.0,
+        119814943.0/891813888.0, -367116889.0/27525120.0, -1108585.0/55738368.0, 48708243.0/655360.0,
+        22109.0/18579456.0, -1971684283.0/6881280.0, -215.0/6967296.0, 5780738281.0/7741440.0,
+        1.0/3483648.0, -5486880893.0/4354560.0, 0.0, 1084758961.0/870912.0,
+        0.0, -796455517.0/1451520.0,
+        -1288287.0/8388608.0, 7174845421.0/22649241600.0, 1102724303.0/1651507200.0, -11415244553.0/3303014400.0,
+        -181758911.0/825753600.0, 29798411977.0/1238630400.0, 1358737.0/51609600.0, -3945462979.0/29491200.0,
+        -73063.0/51609600.0, 159706453867.0/309657600.0, 223.0/6451200.0, -52026644561.0/38707200.0,
+        -1.0/3225600.0, 5486880893.0/2419200.0, 0.0, -1084758961.0/483840.0,
+        0.0, 796455517.0/806400.0,
+        1288287.0/2097152.0, -25726178221.0/16986931200.0, -200923403.0/412876800.0, 7413615791.0/1486356480.0,
+        224657551.0/1857945600.0, -9947103539.0/309657600.0, -1503973.0/116121600.0, 438390923.0/2457600.0,
+        25541.0/38707200.0, -17745163123.0/25804800.0, -227.0/14515200.0, 17342214859.0/9676800.0,
+        1.0/7257600.0, -5486880893.0/1814400.0, 0.0, 1084758961.0/362880.0,
+        0.0, -796455517.0/604800.0,
+        1288287.0/2097152.0, 25726178221.0/16986931200.0, -200923403.0/412876800.0, -7413615791.0/1486356480.0,
+        224657551.0/1857945600.0, 9947103539.0/309657600.0, -1503973.0/116121600.0, -438390923.0/2457600.0,
+        25541.0/38707200.0, 17745163123.0/25804800.0, -227.0/14515200.0, -17342214859.0/9676800.0,
+        1.0/7257600.0, 5486880893.0/1814400.0, 0.0, -1084758961.0/362880.0,
+        0.0, 796455517.0/604800.0,
+        -1288287.0/8388608.0, -7174845421.0/22649241600.0, 1102724303.0/1651507200.0, 11415244553.0/3303014400.0,
+        -181758911.0/825753600.0, -29798411977.0/1238630400.0, 1358737.0/51609600.0, 3945462979.0/29491200.0,
+        -73063.0/51609600.0, -159706453867.0/309657600.0, 223.0/6451200.0, 52026644561.0/38707200.0,
+        -1.0/3225600.0, -5486880893.0/2419200.0, 0.0, 1084758961.0/483840.0,
+        0.0, -796455517.0/806400.0,
+        429429.0/8388608.0, 5690738797.0/40768634880.0, -46994735.0/198180864.0, -4503806701.0/2548039680.0,
+        119814943.0/891813888.0, 367116889.0/27525120.0, -1108585.0/55738368.0, -48708243.0/655360.0,
+        22109.0/18579456.0, 1971684283.0/6881280.0, -215.0/6967296.0, -5780738281.0/7741440.0,
+        1.0/3483648.0, 5486880893.0/4354560.0, 0.0, -1084758961.0/870912.0,
+        0.0, 796455517.0/1451520.0,
+        -61347.0/4194304.0, -36972965947.0/713451110400.0, 24382547.0/353894400.0, 30712608139.0/44590694400.0,
+        -69436591.0/1592524800.0, -1413623317.0/265420800.0, 822637.0/99532800.0, 9205603751.0/309657600.0,
+        -19061.0/33177600.0, -2535022069.0/22118400.0, 203.0/12441600.0, 2477459261.0/8294400.0,
+        -1.0/6220800.0, -5486880893.0/10886400.0, 0.0, 1084758961.0/2177280.0,
+        0.0, -796455517.0/3628800.0,
+        13013.0/4194304.0, 5113586221.0/373712486400.0, -133658267.0/9083289600.0, -26293913.0/141557760.0,
+        4011181.0/412876800.0, 2696434187.0/1857945600.0, -52343.0/25804800.0, -358651337.0/44236800.0,
+        4253.0/25804800.0, 14518758977.0/464486400.0, -17.0/3225600.0, -4729694947.0/58060800.0,
+        1.0/17740800.0, 5486880893.0/39916800.0, 0.0, -98614451.0/725760.0,
+        0.0, 72405047.0/1209600.0,
+        -3549.0/8388608.0, -5028410221.0/2242274918400.0, 9975743.0/4954521600.0, 548981149.0/17836277760.0,
+        -30262111.0/22295347200.0, -898391369.0/3715891200.0, 414073.0/1393459200.0, 119548579.0/88473600.0,
+        -12221.0/464486400.0, -1613195033.0/309657600.0, 167.0/174182400.0, 17342214779.0/1277337600.0,
+        -1.0/87091200.0, -5486880893.0/239500800.0, 0.0, 98614451.0/4354560.0,
+        0.0, -72405047.0/7257600.0,
+        231.0/8388608.0, 383032417.0/2242274918400.0, -7156487.0/54499737600.0, -210436853.0/89181388800.0,
+        1997021.0/22295347200.0, 23029231.0/1238630400.0, -28067.0/1393459200.0, -3065317.0/29491200.0,
+        871.0/464486400.0, 13787989.0/34406400.0, -13.0/174182400.0, -40424743.0/38707200.0,
+        1.0/958003200.0, 422067761.0/239500800.0, 0.0, -7585727.0/4354560.0,
+        0.0, 5569619.0/7257600.0
+    };
+};
+
+template <>
+struct spline_coefficients<6,9>{
+    static const int nb_polys = 14;
+    static const int degree = 19;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        231.0/8388608.0, -713297917.0/3923981107200.0, -7156487.0/54499737600.0, 982445843.0/356725555200.0,
+        1997021.0/22295347200.0, -61691621.0/2477260800.0, -28067.0/1393459200.0, 3601751.0/22118400.0,
+        871.0/464486400.0, -38920669.0/51609600.0, -13.0/174182400.0, 190281599.0/77414400.0,
+        1.0/958003200.0, -5299530773.0/958003200.0, 0.0, 89313533.0/10886400.0,
+        0.0, -6558637.0/907200.0, 0.0, 5211053.0/1814400.0,
+        -3549.0/8388608.0, 9358603321.0/3923981107200.0, 9975743.0/4954521600.0, -12808702583.0/356725555200.0,
+        -30262111.0/22295347200.0, 343782277.0/1061683200.0, 414073.0/1393459200.0, -5202563.0/2457600.0,
+        -12221.0/464486400.0, 1517906251.0/154828800.0, 167.0/174182400.0, -16326161207.0/510935040.0,
+        -1.0/87091200.0, 68893900049.0/958003200.0, 0.0, -1161075929.0/10886400.0,
+        0.0, 85262281.0/907200.0, 0.0, -67743689.0/1814400.0,
+        13013.0/4194304.0, -9507661321.0/653996851200.0, -133658267.0/9083289600.0, 4290841021.0/19818086400.0,
+        4011181.0/412876800.0, -7221947977.0/3715891200.0, -52343.0/25804800.0, 140470601.0/11059200.0,
+        4253.0/25804800.0, -13661158099.0/232243200.0, -17.0/3225600.0, 4452589423.0/23224320.0,
+        1.0/17740800.0, -68893900049.0/159667200.0, 0.0, 1161075929.0/1814400.0,
+        0.0, -85262281.0/151200.0, 0.0, 67743689.0/302400.0,
+        -61347.0/4194304.0, 9802126921.0/178362777600.0, 24382547.0/353894400.0, -142970308189.0/178362777600.0,
+        -69436591.0/1592524800.0, 26497351649.0/3715891200.0, 822637.0/99532800.0, -133535813.0/2867200.0,
+        -19061.0/33177600.0, 2385281903.0/11059200.0, 203.0/12441600.0, -11661543733.0/16588800.0,
+        -1.0/6220800.0, 68893900049.0/43545600.0, 0.0, -12771835219.0/5443200.0,
+        0.0, 937885091.0/453600.0, 0.0, -745180579.0/907200.0,
+        429429.0/8388608.0, -10517678329.0/71345111040.0, -46994735.0/198180864.0, 146226463261.0/71345111040.0,
+        119814943.0/891813888.0, -2947881913.0/165150720.0, -1108585.0/55738368.0, 103015157.0/884736.0,
+        22109.0/18579456.0, -5565658451.0/10321920.0, -215.0/6967296.0, 27210268721.0/15482880.0,
+        1.0/3483648.0, -68893900049.0/17418240.0, 0.0, 12771835219.0/2177280.0,
+        0.0, -937885091.0/181440.0, 0.0, 745180579.0/362880.0,
+        -1288287.0/8388608.0, 13114864921.0/39636172800.0, 1102724303.0/1651507200.0, -52367603423.0/13212057600.0,
+        -181758911.0/825753600.0, 11388099941.0/353894400.0, 1358737.0/51609600.0, -1545251179.0/7372800.0,
+        -73063.0/51609600.0, 150272791649.0/154828800.0, 223.0/6451200.0, -244892418553.0/77414400.0,
+        -1.0/3225600.0, 68893900049.0/9676800.0, 0.0, -12771835219.0/1209600.0,
+        0.0, 937885091.0/100800.0, 0.0, -745180579.0/201600.0,
+        1288287.0/2097152.0, -45579697321.0/29727129600.0, -200923403.0/412876800.0, 168392191453.0/29727129600.0,
+        224657551.0/1857945600.0, -26600832289.0/619315200.0, -1503973.0/116121600.0, 515088337.0/1843200.0,
+        25541.0/38707200.0, -16696977641.0/12902400.0, -227.0/14515200.0, 16326161239.0/3870720.0,
+        1.0/7257600.0, -68893900049.0/7257600.0, 0.0, 12771835219.0/907200.0,
+        0.0, -937885091.0/75600.0, 0.0, 745180579.0/151200.0,
+        1288287.0/2097152.0, 45579697321.0/29727129600.0, -200923403.0/412876800.0, -168392191453.0/29727129600.0,
+        224657551.0/1857945600.0, 26600832289.0/619315200.0, -1503973.0/116121600.0, -515088337.0/1843200.0,
+        25541.0/38707200.0, 16696977641.0/12902400.0, -227.0/14515200.0, -16326161239.0/3870720.0,
+        1.0/7257600.0, 68893900049.0/7257600.0, 0.0, -12771835219.0/907200.0,
+        0.0, 937885091.0/75600.0, 0.0, -745180579.0/151200.0,
+        -1288287.0/8388608.0, -13114864921.0/39636172800.0, 1102724303.0/1651507200.0, 52367603423.0/13212057600.0,
+        -181758911.0/825753600.0, -11388099941.0/353894400.0, 1358737.0/51609600.0, 1545251179.0/7372800.0,
+        -73063.0/51609600.0, -150272791649.0/154828800.0, 223.0/6451200.0, 244892418553.0/77414400.0,
+        -1.0/3225600.0, -68893900049.0/9676800.0, 0.0, 12771835219.0/1209600.0,
+        0.0, -937885091.0/100800.0, 0.0, 745180579.0/201600.0,
+        429429.0/8388608.0, 10517678329.0/71345111040.0, -46994735.0/198180864.0, -146226463261.0/71345111040.0,
+        119814943.0/891813888.0, 2947881913.0/165150720.0, -1108585.0/55738368.0, -103015157.0/884736.0,
+        22109.0/18579456.0, 5565658451.0/10321920.0, -215.0/6967296.0, -27210268721.0/15482880.0,
+        1.0/3483648.0, 68893900049.0/17418240.0, 0.0, -12771835219.0/2177280.0,
+        0.0, 937885091.0/181440.0, 0.0, -745180579.0/362880.0,
+        -61347.0/4194304.0, -9802126921.0/178362777600.0, 24382547.0/353894400.0, 142970308189.0/178362777600.0,
+        -69436591.0/1592524800.0, -26497351649.0/3715891200.0, 822637.0/99532800.0, 133535813.0/2867200.0,
+        -19061.0/33177600.0, -2385281903.0/11059200.0, 203.0/12441600.0, 11661543733.0/16588800.0,
+        -1.0/6220800.0, -68893900049.0/43545600.0, 0.0, 12771835219.0/5443200.0,
+        0.0, -937885091.0/453600.0, 0.0, 745180579.0/907200.0,
+        13013.0/4194304.0, 9507661321.0/653996851200.0, -133658267.0/9083289600.0, -4290841021.0/19818086400.0,
+        4011181.0/412876800.0, 7221947977.0/3715891200.0, -52343.0/25804800.0, -140470601.0/11059200.0,
+        4253.0/25804800.0, 13661158099.0/232243200.0, -17.0/3225600.0, -4452589423.0/23224320.0,
+        1.0/17740800.0, 68893900049.0/159667200.0, 0.0, -1161075929.0/1814400.0,
+        0.0, 85262281.0/151200.0, 0.0, -67743689.0/302400.0,
+        -3549.0/8388608.0, -9358603321.0/3923981107200.0, 9975743.0/4954521600.0, 12808702583.0/356725555200.0,
+        -30262111.0/22295347200.0, -343782277.0/1061683200.0, 414073.0/1393459200.0, 5202563.0/2457600.0,
+        -12221.0/464486400.0, -1517906251.0/154828800.0, 167.0/174182400.0, 16326161207.0/510935040.0,
+        -1.0/87091200.0, -68893900049.0/958003200.0, 0.0, 1161075929.0/10886400.0,
+        0.0, -85262281.0/907200.0, 0.0, 67743689.0/1814400.0,
+        231.0/8388608.0, 713297917.0/3923981107200.0, -7156487.0/54499737600.0, -982445843.0/356725555200.0,
+        1997021.0/22295347200.0, 61691621.0/2477260800.0, -28067.0/1393459200.0, -3601751.0/22118400.0,
+        871.0/464486400.0, 38920669.0/51609600.0, -13.0/174182400.0, -190281599.0/77414400.0,
+        1.0/958003200.0, 5299530773.0/958003200.0, 0.0, -89313533.0/10886400.0,
+        0.0, 6558637.0/907200.0, 0.0, -5211053.0/1814400.0
+    };
+};
+
+template <>
+struct spline_coefficients<6,10>{
+    static const int nb_polys = 14;
+    static const int degree = 21;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        231.0/8388608.0, -16081891381.0/83711596953600.0, -7156487.0/54499737600.0, 3012977923.0/951268147200.0,
+        1997021.0/22295347200.0, -5127630769.0/158544691200.0, -28067.0/1393459200.0, 3599743697.0/14863564800.0,
+        871.0/464486400.0, -19464721847.0/14863564800.0, -13.0/174182400.0, 3173366627.0/619315200.0,
+        1.0/958003200.0, -442018767511.0/30656102400.0, 0.0, 709588229.0/24883200.0,
+        0.0, -625372373.0/16588800.0, 0.0, 186347471.0/6220800.0,
+        0.0, -47174681.0/4354560.0,
+        -3549.0/8388608.0, 210893503153.0/83711596953600.0, 9975743.0/4954521600.0, -39267130663.0/951268147200.0,
+        -30262111.0/22295347200.0, 200009774071.0/475634073600.0, 414073.0/1393459200.0, -46796872349.0/14863564800.0,
+        -12221.0/464486400.0, 253041399371.0/14863564800.0, 167.0/174182400.0, -272274856699.0/4087480320.0,
+        -1.0/87091200.0, 5746243977643.0/30656102400.0, 0.0, -9224646977.0/24883200.0,
+        0.0, 8129840849.0/16588800.0, 0.0, -2422517123.0/6220800.0,
+        0.0, 613270853.0/4354560.0,
+        13013.0/4194304.0, -214073407153.0/13951932825600.0, -133658267.0/9083289600.0, 118311955829.0/475634073600.0,
+        4011181.0/412876800.0, -600190612453.0/237817036800.0, -52343.0/25804800.0, 15599061983.0/825753600.0,
+        4253.0/25804800.0, -759124256993.0/7431782400.0, -17.0/3225600.0, 74256779123.0/185794560.0,
+        1.0/17740800.0, -5746243977643.0/5109350400.0, 0.0, 9224646977.0/4147200.0,
+        0.0, -8129840849.0/2764800.0, 0.0, 2422517123.0/1036800.0,
+        0.0, -613270853.0/725760.0,
+        -61347.0/4194304.0, 31479334279.0/543581798400.0, 24382547.0/353894400.0, -62495807147.0/67947724800.0,
+        -69436591.0/1592524800.0, 314539851323.0/33973862400.0, 822637.0/99532800.0, -514774311871.0/7431782400.0,
+        -19061.0/33177600.0, 397636547263.0/1061683200.0, 203.0/12441600.0, -194482040609.0/132710400.0,
+        -1.0/6220800.0, 5746243977643.0/1393459200.0, 0.0, -101471116747.0/12441600.0,
+        0.0, 89428249339.0/8294400.0, 0.0, -26647688353.0/3110400.0,
+        0.0, 6745979383.0/2177280.0,
+        429429.0/8388608.0, -235620436657.0/1522029035520.0, -46994735.0/198180864.0, 446153730221.0/190253629440.0,
+        119814943.0/891813888.0, -734642811871.0/31708938240.0, -1108585.0/55738368.0, 102956082419.0/594542592.0,
+        22109.0/18579456.0, -2783456025913.0/2972712960.0, -215.0/6967296.0, 50421269797.0/13762560.0,
+        1.0/3483648.0, -5746243977643.0/557383680.0, 0.0, 101471116747.0/4976640.0,
+        0.0, -89428249339.0/3317760.0, 0.0, 26647688353.0/1244160.0,
+        0.0, -6745979383.0/870912.0,
+        -1288287.0/8388608.0, 291027083953.0/845571686400.0, 1102724303.0/1651507200.0, -1425471966727.0/317089382400.0,
+        -181758911.0/825753600.0, 6619714134743.0/158544691200.0, 1358737.0/51609600.0, -57198416519.0/183500800.0,
+        -73063.0/51609600.0, 8350368508843.0/4954521600.0, 223.0/6451200.0, -4084122854069.0/619315200.0,
+        -1.0/3225600.0, 5746243977643.0/309657600.0, 0.0, -101471116747.0/2764800.0,
+        0.0, 89428249339.0/1843200.0, 0.0, -26647688353.0/691200.0,
+        0.0, 6745979383.0/483840.0,
+        1288287.0/2097152.0, -983610175153.0/634178764800.0, -200923403.0/412876800.0, 505262338733.0/79272345600.0,
+        224657551.0/1857945600.0, -2208401720221.0/39636172800.0, -1503973.0/116121600.0, 514788847039.0/1238630400.0,
+        25541.0/38707200.0, -2783456245561.0/1238630400.0, -227.0/14515200.0, 54454971391.0/6193152.0,
+        1.0/7257600.0, -5746243977643.0/232243200.0, 0.0, 101471116747.0/2073600.0,
+        0.0, -89428249339.0/1382400.0, 0.0, 26647688353.0/518400.0,
+        0.0, -6745979383.0/362880.0,
+        1288287.0/2097152.0, 983610175153.0/634178764800.0, -200923403.0/412876800.0, -505262338733.0/79272345600.0,
+        224657551.0/1857945600.0, 2208401720221.0/39636172800.0, -1503973.0/116121600.0, -514788847039.0/1238630400.0,
+        25541.0/38707200.0, 2783456245561.0/1238630400.0, -227.0/14515200.0, -54454971391.0/6193152.0,
+        1.0/7257600.0, 5746243977643.0/232243200.0, 0.0, -101471116747.0/2073600.0,
+        0.0, 89428249339.0/1382400.0, 0.0, -26647688353.0/518400.0,
+        0.0, 6745979383.0/362880.0,
+        -1288287.0/8388608.0, -291027083953.0/845571686400.0, 1102724303.0/1651507200.0, 1425471966727.0/317089382400.0,
+        -181758911.0/825753600.0, -6619714134743.0/158544691200.0, 1358737.0/51609600.0, 57198416519.0/183500800.0,
+        -73063.0/51609600.0, -8350368508843.0/4954521600.0, 223.0/6451200.0, 4084122854069.0/619315200.0,
+        -1.0/3225600.0, -5746243977643.0/309657600.0, 0.0, 101471116747.0/2764800.0,
+        0.0, -89428249339.0/1843200.0, 0.0, 26647688353.0/691200.0,
+        0.0, -6745979383.0/483840.0,
+        429429.0/8388608.0, 235620436657.0/1522029035520.0, -46994735.0/198180864.0, -446153730221.0/190253629440.0,
+        119814943.0/891813888.0, 734642811871.0/31708938240.0, -1108585.0/55738368.0, -102956082419.0/594542592.0,
+        22109.0/18579456.0, 2783456025913.0/2972712960.0, -215.0/6967296.0, -50421269797.0/13762560.0,
+        1.0/3483648.0, 5746243977643.0/557383680.0, 0.0, -101471116747.0/4976640.0,
+        0.0, 89428249339.0/3317760.0, 0.0, -26647688353.0/1244160.0,
+        0.0, 6745979383.0/870912.0,
+        -61347.0/4194304.0, -31479334279.0/543581798400.0, 24382547.0/353894400.0, 62495807147.0/67947724800.0,
+        -69436591.0/1592524800.0, -314539851323.0/33973862400.0, 822637.0/99532800.0, 514774311871.0/7431782400.0,
+        -19061.0/33177600.0, -397636547263.0/1061683200.0, 203.0/12441600.0, 194482040609.0/132710400.0,
+        -1.0/6220800.0, -5746243977643.0/1393459200.0, 0.0, 101471116747.0/12441600.0,
+        0.0, -89428249339.0/8294400.0, 0.0, 26647688353.0/3110400.0,
+        0.0, -6745979383.0/2177280.0,
+        13013.0/4194304.0, 214073407153.0/13951932825600.0, -133658267.0/9083289600.0, -118311955829.0/475634073600.0,
+        4011181.0/412876800.0, 600190612453.0/237817036800.0, -52343.0/25804800.0, -15599061983.0/825753600.0,
+        4253.0/25804800.0, 759124256993.0/7431782400.0, -17.0/3225600.0, -74256779123.0/185794560.0,
+        1.0/17740800.0, 5746243977643.0/5109350400.0, 0.0, -9224646977.0/4147200.0,
+        0.0, 8129840849.0/2764800.0, 0.0, -2422517123.0/1036800.0,
+        0.0, 613270853.0/725760.0,
+        -3549.0/8388608.0, -210893503153.0/83711596953600.0, 9975743.0/4954521600.0, 39267130663.0/951268147200.0,
+        -30262111.0/22295347200.0, -200009774071.0/475634073600.0, 414073.0/1393459200.0, 46796872349.0/14863564800.0,
+        -12221.0/464486400.0, -253041399371.0/14863564800.0, 167.0/174182400.0, 272274856699.0/4087480320.0,
+        -1.0/87091200.0, -5746243977643.0/30656102400.0, 0.0, 9224646977.0/24883200.0,
+        0.0, -8129840849.0/16588800.0, 0.0, 2422517123.0/6220800.0,
+        0.0, -613270853.0/4354560.0,
+        231.0/8388608.0, 16081891381.0/83711596953600.0, -7156487.0/54499737600.0, -3012977923.0/951268147200.0,
+        1997021.0/22295347200.0, 5127630769.0/158544691200.0, -28067.0/1393459200.0, -3599743697.0/14863564800.0,
+        871.0/464486400.0, 19464721847.0/14863564800.0, -13.0/174182400.0, -3173366627.0/619315200.0,
+        1.0/958003200.0, 442018767511.0/30656102400.0, 0.0, -709588229.0/24883200.0,
+        0.0, 625372373.0/16588800.0, 0.0, -186347471.0/6220800.0,
+        0.0, 47174681.0/4354560.0
+    };
+};
+
+template <>
+struct spline_coefficients<6,11>{
+    static const int nb_polys = 14;
+    static const int degree = 23;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        231.0/8388608.0, -3073186891.0/15220290355200.0, -7156487.0/54499737600.0, 13693184731.0/3805072588800.0,
+        1997021.0/22295347200.0, -12990716603.0/317089382400.0, -28067.0/1393459200.0, 82214994737.0/237817036800.0,
+        871.0/464486400.0, -63548539279.0/29727129600.0, -13.0/174182400.0, 24182377781.0/2477260800.0,
+        1.0/958003200.0, -2021439751049.0/61312204800.0, 0.0, 16227746797.0/199065600.0,
+        0.0, -4767758401.0/33177600.0, 0.0, 4262403539.0/24883200.0,
+        0.0, -5395565927.0/43545600.0, 0.0, 26051953.0/633600.0,
+        -3549.0/8388608.0, 443123555813.0/167423193907200.0, 9975743.0/4954521600.0, -178405072159.0/3805072588800.0,
+        -30262111.0/22295347200.0, 506702295677.0/951268147200.0, 414073.0/1393459200.0, -1068798200189.0/237817036800.0,
+        -12221.0/464486400.0, 826131041347.0/29727129600.0, 167.0/174182400.0, -10374240070097.0/81749606400.0,
+        -1.0/87091200.0, 26278716763637.0/61312204800.0, 0.0, -210960708361.0/199065600.0,
+        0.0, 61980859213.0/33177600.0, 0.0, -55411246007.0/24883200.0,
+        0.0, 70142357051.0/43545600.0, 0.0, -338675389.0/633600.0,
+        13013.0/4194304.0, -40862123983.0/2536715059200.0, -133658267.0/9083289600.0, 537257471837.0/1902536294400.0,
+        4011181.0/412876800.0, -1520429467511.0/475634073600.0, -52343.0/25804800.0, 356267739263.0/13212057600.0,
+        4253.0/25804800.0, -2478393241801.0/14863564800.0, -17.0/3225600.0, 2829338201401.0/3715891200.0,
+        1.0/17740800.0, -26278716763637.0/10218700800.0, 0.0, 210960708361.0/33177600.0,
+        0.0, -61980859213.0/5529600.0, 0.0, 55411246007.0/4147200.0,
+        0.0, -70142357051.0/7257600.0, 0.0, 338675389.0/105600.0,
+        -61347.0/4194304.0, 66006747059.0/1087163596800.0, 24382547.0/353894400.0, -283512092099.0/271790899200.0,
+        -69436591.0/1592524800.0, 796724020201.0/67947724800.0, 822637.0/99532800.0, -11756919658591.0/118908518400.0,
+        -19061.0/33177600.0, 1298206047191.0/2123366400.0, 203.0/12441600.0, -1482034296167.0/530841600.0,
+        -1.0/6220800.0, 26278716763637.0/2786918400.0, 0.0, -2320567791971.0/99532800.0,
+        0.0, 681789451343.0/16588800.0, 0.0, -609523706077.0/12441600.0,
+        0.0, 771565927561.0/21772800.0, 0.0, -338675389.0/28800.0,
+        429429.0/8388608.0, -492577422821.0/3044058071040.0, -46994735.0/198180864.0, 2019316965461.0/761014517760.0,
+        119814943.0/891813888.0, -1860455698037.0/63417876480.0, -1108585.0/55738368.0, 2351403452435.0/9512681472.0,
+        22109.0/18579456.0, -9087442720481.0/5945425920.0, -215.0/6967296.0, 128077037953.0/18350080.0,
+        1.0/3483648.0, -26278716763637.0/1114767360.0, 0.0, 2320567791971.0/39813120.0,
+        0.0, -681789451343.0/6635520.0, 0.0, 609523706077.0/4976640.0,
+        0.0, -771565927561.0/8709120.0, 0.0, 338675389.0/11520.0,
+        -1288287.0/8388608.0, 603390717413.0/1691143372800.0, 1102724303.0/1651507200.0, -6405994000639.0/1268357529600.0,
+        -181758911.0/825753600.0, 16759958938141.0/317089382400.0, 1358737.0/51609600.0, -1306344738599.0/2936012800.0,
+        -73063.0/51609600.0, 27262329023651.0/9909043200.0, 223.0/6451200.0, -31122720224627.0/2477260800.0,
+        -1.0/3225600.0, 26278716763637.0/619315200.0, 0.0, -2320567791971.0/22118400.0,
+        0.0, 681789451343.0/3686400.0, 0.0, -609523706077.0/2764800.0,
+        0.0, 771565927561.0/4838400.0, 0.0, -338675389.0/6400.0,
+        1288287.0/2097152.0, -1988556899813.0/1268357529600.0, -200923403.0/412876800.0, 2255751399509.0/317089382400.0,
+        224657551.0/1857945600.0, -5590313663327.0/79272345600.0, -1503973.0/116121600.0, 11757152221279.0/19818086400.0,
+        25541.0/38707200.0, -9087443159777.0/2477260800.0, -227.0/14515200.0, 10374240075217.0/619315200.0,
+        1.0/7257600.0, -26278716763637.0/464486400.0, 0.0, 2320567791971.0/16588800.0,
+        0.0, -681789451343.0/2764800.0, 0.0, 609523706077.0/2073600.0,
+        0.0, -771565927561.0/3628800.0, 0.0, 338675389.0/4800.0,
+        1288287.0/2097152.0, 1988556899813.0/1268357529600.0, -200923403.0/412876800.0, -2255751399509.0/317089382400.0,
+        224657551.0/1857945600.0, 5590313663327.0/79272345600.0, -1503973.0/116121600.0, -11757152221279.0/19818086400.0,
+        25541.0/38707200.0, 9087443159777.0/2477260800.0, -227.0/14515200.0, -10374240075217.0/619315200.0,
+        1.0/7257600.0, 26278716763637.0/464486400.0, 0.0, -2320567791971.0/16588800.0,
+        0.0, 681789451343.0/2764800.0, 0.0, -609523706077.0/2073600.0,
+        0.0, 771565927561.0/3628800.0, 0.0, -338675389.0/4800.0,
+        -1288287.0/8388608.0, -603390717413.0/1691143372800.0, 1102724303.0/1651507200.0, 6405994000639.0/1268357529600.0,
+        -181758911.0/825753600.0, -16759958938141.0/317089382400.0, 1358737.0/51609600.0, 1306344738599.0/2936012800.0,
+        -73063.0/51609600.0, -27262329023651.0/9909043200.0, 223.0/6451200.0, 31122720224627.0/2477260800.0,
+        -1.0/3225600.0, -26278716763637.0/619315200.0, 0.0, 2320567791971.0/22118400.0,
+        0.0, -681789451343.0/3686400.0, 0.0, 609523706077.0/2764800.0,
+        0.0, -771565927561.0/4838400.0, 0.0, 338675389.0/6400.0,
+        429429.0/8388608.0, 492577422821.0/3044058071040.0, -46994735.0/198180864.0, -2019316965461.0/761014517760.0,
+        119814943.0/891813888.0, 1860455698037.0/63417876480.0, -1108585.0/55738368.0, -2351403452435.0/9512681472.0,
+        22109.0/18579456.0, 9087442720481.0/5945425920.0, -215.0/6967296.0, -128077037953.0/18350080.0,
+        1.0/3483648.0, 26278716763637.0/1114767360.0, 0.0, -2320567791971.0/39813120.0,
+        0.0, 681789451343.0/6635520.0, 0.0, -609523706077.0/4976640.0,
+        0.0, 771565927561.0/8709120.0, 0.0, -338675389.0/11520.0,
+        -61347.0/4194304.0, -66006747059.0/1087163596800.0, 24382547.0/353894400.0, 283512092099.0/271790899200.0,
+        -69436591.0/1592524800.0, -796724020201.0/67947724800.0, 822637.0/99532800.0, 11756919658591.0/118908518400.0,
+        -19061.0/33177600.0, -1298206047191.0/2123366400.0, 203.0/12441600.0, 1482034296167.0/530841600.0,
+        -1.0/6220800.0, -26278716763637.0/2786918400.0, 0.0, 2320567791971.0/99532800.0,
+        0.0, -681789451343.0/16588800.0, 0.0, 609523706077.0/12441600.0,
+        0.0, -771565927561.0/21772800.0, 0.0, 338675389.0/28800.0,
+        13013.0/4194304.0, 40862123983.0/2536715059200.0, -133658267.0/9083289600.0, -537257471837.0/1902536294400.0,
+        4011181.0/412876800.0, 1520429467511.0/475634073600.0, -52343.0/25804800.0, -356267739263.0/13212057600.0,
+        4253.0/25804800.0, 2478393241801.0/14863564800.0, -17.0/3225600.0, -2829338201401.0/3715891200.0,
+        1.0/17740800.0, 26278716763637.0/10218700800.0, 0.0, -210960708361.0/33177600.0,
+        0.0, 61980859213.0/5529600.0, 0.0, -55411246007.0/4147200.0,
+        0.0, 70142357051.0/7257600.0, 0.0, -338675389.0/105600.0,
+        -3549.0/8388608.0, -443123555813.0/167423193907200.0, 9975743.0/4954521600.0, 178405072159.0/3805072588800.0,
+        -30262111.0/22295347200.0, -506702295677.0/951268147200.0, 414073.0/1393459200.0, 1068798200189.0/237817036800.0,
+        -12221.0/464486400.0, -826131041347.0/29727129600.0, 167.0/174182400.0, 10374240070097.0/81749606400.0,
+        -1.0/87091200.0, -26278716763637.0/61312204800.0, 0.0, 210960708361.0/199065600.0,
+        0.0, -61980859213.0/33177600.0, 0.0, 55411246007.0/24883200.0,
+        0.0, -70142357051.0/43545600.0, 0.0, 338675389.0/633600.0,
+        231.0/8388608.0, 3073186891.0/15220290355200.0, -7156487.0/54499737600.0, -13693184731.0/3805072588800.0,
+        1997021.0/22295347200.0, 12990716603.0/317089382400.0, -28067.0/1393459200.0, -82214994737.0/237817036800.0,
+        871.0/464486400.0, 63548539279.0/29727129600.0, -13.0/174182400.0, -24182377781.0/2477260800.0,
+        1.0/958003200.0, 2021439751049.0/61312204800.0, 0.0, -16227746797.0/199065600.0,
+        0.0, 4767758401.0/33177600.0, 0.0, -4262403539.0/24883200.0,
+        0.0, 5395565927.0/43545600.0, 0.0, -26051953.0/633600.0
+    };
+};
+
+template <>
+struct spline_coefficients<6,12>{
+    static const int nb_polys = 14;
+    static const int degree = 25;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        231.0/8388608.0, -141480803971.0/669692775628800.0, -7156487.0/54499737600.0, 84703387171.0/20927899238400.0,
+        1997021.0/22295347200.0, -3582445997.0/70464307200.0, -28067.0/1393459200.0, 9459824881.0/19818086400.0,
+        871.0/464486400.0, -790114448747.0/237817036800.0, -13.0/174182400.0, 21482060041.0/1238630400.0,
+        1.0/958003200.0, -8381461973629.0/122624409600.0, 0.0, 630870331.0/3110400.0,
+        0.0, -59317624249.0/132710400.0, 0.0, 8838966877.0/12441600.0,
+        0.0, -67136358757.0/87091200.0, 0.0, 48626227.0/95040.0,
+        0.0, -894368681.0/5702400.0,
+        -3549.0/8388608.0, 1853881773223.0/669692775628800.0, 9975743.0/4954521600.0, -1103309221831.0/20927899238400.0,
+        -30262111.0/22295347200.0, 1257567241267.0/1902536294400.0, 414073.0/1393459200.0, -40992665279.0/6606028800.0,
+        -12221.0/464486400.0, 10271488079471.0/237817036800.0, 167.0/174182400.0, -9215803758613.0/40874803200.0,
+        -1.0/87091200.0, 108959005657177.0/122624409600.0, 0.0, -8201314303.0/3110400.0,
+        0.0, 771129115237.0/132710400.0, 0.0, -114906569401.0/12441600.0,
+        0.0, 872772663841.0/87091200.0, 0.0, -632140951.0/95040.0,
+        0.0, 11626792853.0/5702400.0,
+        13013.0/4194304.0, -1879321005223.0/111615462604800.0, -133658267.0/9083289600.0, 3321160069973.0/10463949619200.0,
+        4011181.0/412876800.0, -3773346884761.0/951268147200.0, -52343.0/25804800.0, 368935241911.0/9909043200.0,
+        4253.0/25804800.0, -30814465180493.0/118908518400.0, -17.0/3225600.0, 2513401025309.0/1857945600.0,
+        1.0/17740800.0, -108959005657177.0/20437401600.0, 0.0, 8201314303.0/518400.0,
+        0.0, -771129115237.0/22118400.0, 0.0, 114906569401.0/2073600.0,
+        0.0, -872772663841.0/14515200.0, 0.0, 632140951.0/15840.0,
+        0.0, -11626792853.0/950400.0,
+        -61347.0/4194304.0, 275653781089.0/4348654387200.0, 24382547.0/353894400.0, -159196235329.0/135895449600.0,
+        -69436591.0/1592524800.0, 1977132204551.0/135895449600.0, 822637.0/99532800.0, -450923191861.0/3303014400.0,
+        -19061.0/33177600.0, 16140910839763.0/16986931200.0, 203.0/12441600.0, -1316543394307.0/265420800.0,
+        -1.0/6220800.0, 108959005657177.0/5573836800.0, 0.0, -90214457333.0/1555200.0,
+        0.0, 8482420267607.0/66355200.0, 0.0, -1263972263411.0/6220800.0,
+        0.0, 9600499302251.0/43545600.0, 0.0, -632140951.0/4320.0,
+        0.0, 11626792853.0/259200.0,
+        429429.0/8388608.0, -410339448251.0/2435246456832.0, -46994735.0/198180864.0, 1131739807687.0/380507258880.0,
+        119814943.0/891813888.0, -923234889151.0/25367150592.0, -1108585.0/55738368.0, 270555541843.0/792723456.0,
+        22109.0/18579456.0, -112986378999493.0/47563407360.0, -215.0/6967296.0, 1023978195629.0/82575360.0,
+        1.0/3483648.0, -108959005657177.0/2229534720.0, 0.0, 90214457333.0/622080.0,
+        0.0, -8482420267607.0/26542080.0, 0.0, 1263972263411.0/2488320.0,
+        0.0, -9600499302251.0/17418240.0, 0.0, 632140951.0/1728.0,
+        0.0, -11626792853.0/103680.0,
+        -1288287.0/8388608.0, 2494950419623.0/6764573491200.0, 1102724303.0/1651507200.0, -3569240975189.0/634178764800.0,
+        -181758911.0/825753600.0, 41577285323411.0/634178764800.0, 1358737.0/51609600.0, -4058354473949.0/6606028800.0,
+        -73063.0/51609600.0, 338959143896143.0/79272345600.0, 223.0/6451200.0, -27647411283007.0/1238630400.0,
+        -1.0/3225600.0, 108959005657177.0/1238630400.0, 0.0, -90214457333.0/345600.0,
+        0.0, 8482420267607.0/14745600.0, 0.0, -1263972263411.0/1382400.0,
+        0.0, 9600499302251.0/9676800.0, 0.0, -632140951.0/960.0,
+        0.0, 11626792853.0/57600.0,
+        1288287.0/2097152.0, -8035615149223.0/5073430118400.0, -200923403.0/412876800.0, 1249957024711.0/158544691200.0,
+        224657551.0/1857945600.0, -13866416475697.0/158544691200.0, -1503973.0/116121600.0, 1352788955807.0/1651507200.0,
+        25541.0/38707200.0, -112986382513861.0/19818086400.0, -227.0/14515200.0, 9215803761173.0/309657600.0,
+        1.0/7257600.0, -108959005657177.0/928972800.0, 0.0, 90214457333.0/259200.0,
+        0.0, -8482420267607.0/11059200.0, 0.0, 1263972263411.0/1036800.0,
+        0.0, -9600499302251.0/7257600.0, 0.0, 632140951.0/720.0,
+        0.0, -11626792853.0/43200.0,
+        1288287.0/2097152.0, 8035615149223.0/5073430118400.0, -200923403.0/412876800.0, -1249957024711.0/158544691200.0,
+        224657551.0/1857945600.0, 13866416475697.0/158544691200.0, -1503973.0/116121600.0, -1352788955807.0/1651507200.0,
+        25541.0/38707200.0, 112986382513861.0/19818086400.0, -227.0/14515200.0, -9215803761173.0/309657600.0,
+        1.0/7257600.0, 108959005657177.0/928972800.0, 0.0, -90214457333.0/259200.0,
+        0.0, 8482420267607.0/11059200.0, 0.0, -1263972263411.0/1036800.0,
+        0.0, 9600499302251.0/7257600.0, 0.0, -632140951.0/720.0,
+        0.0, 11626792853.0/43200.0,
+        -1288287.0/8388608.0, -2494950419623.0/6764573491200.0, 1102724303.0/1651507200.0, 3569240975189.0/634178764800.0,
+        -181758911.0/825753600.0, -41577285323411.0/634178764800.0, 1358737.0/51609600.0, 4058354473949.0/6606028800.0,
+        -73063.0/51609600.0, -338959143896143.0/79272345600.0, 223.0/6451200.0, 27647411283007.0/1238630400.0,
+        -1.0/3225600.0, -108959005657177.0/1238630400.0, 0.0, 90214457333.0/345600.0,
+        0.0, -8482420267607.0/14745600.0, 0.0, 1263972263411.0/1382400.0,
+        0.0, -9600499302251.0/9676800.0, 0.0, 632140951.0/960.0,
+        0.0, -11626792853.0/57600.0,
+        429429.0/8388608.0, 410339448251.0/2435246456832.0, -46994735.0/198180864.0, -1131739807687.0/380507258880.0,
+        119814943.0/891813888.0, 923234889151.0/25367150592.0, -1108585.0/55738368.0, -270555541843.0/792723456.0,
+        22109.0/18579456.0, 112986378999493.0/47563407360.0, -215.0/6967296.0, -1023978195629.0/82575360.0,
+        1.0/3483648.0, 108959005657177.0/2229534720.0, 0.0, -90214457333.0/622080.0,
+        0.0, 8482420267607.0/26542080.0, 0.0, -1263972263411.0/2488320.0,
+        0.0, 9600499302251.0/17418240.0, 0.0, -632140951.0/1728.0,
+        0.0, 11626792853.0/103680.0,
+        -61347.0/4194304.0, -275653781089.0/4348654387200.0, 24382547.0/353894400.0, 159196235329.0/135895449600.0,
+        -69436591.0/1592524800.0, -1977132204551.0/135895449600.0, 822637.0/99532800.0, 450923191861.0/3303014400.0,
+        -19061.0/33177600.0, -16140910839763.0/16986931200.0, 203.0/12441600.0, 1316543394307.0/265420800.0,
+        -1.0/6220800.0, -108959005657177.0/5573836800.0, 0.0, 90214457333.0/1555200.0,
+        0.0, -8482420267607.0/66355200.0, 0.0, 1263972263411.0/6220800.0,
+        0.0, -9600499302251.0/43545600.0, 0.0, 632140951.0/4320.0,
+        0.0, -11626792853.0/259200.0,
+        13013.0/4194304.0, 1879321005223.0/111615462604800.0, -133658267.0/9083289600.0, -3321160069973.0/10463949619200.0,
+        4011181.0/412876800.0, 3773346884761.0/951268147200.0, -52343.0/25804800.0, -368935241911.0/9909043200.0,
+        4253.0/25804800.0, 30814465180493.0/118908518400.0, -17.0/3225600.0, -2513401025309.0/1857945600.0,
+        1.0/17740800.0, 108959005657177.0/20437401600.0, 0.0, -8201314303.0/518400.0,
+        0.0, 771129115237.0/22118400.0, 0.0, -114906569401.0/2073600.0,
+        0.0, 872772663841.0/14515200.0, 0.0, -632140951.0/15840.0,
+        0.0, 11626792853.0/950400.0,
+        -3549.0/8388608.0, -1853881773223.0/669692775628800.0, 9975743.0/4954521600.0, 1103309221831.0/20927899238400.0,
+        -30262111.0/22295347200.0, -1257567241267.0/1902536294400.0, 414073.0/1393459200.0, 40992665279.0/6606028800.0,
+        -12221.0/464486400.0, -10271488079471.0/237817036800.0, 167.0/174182400.0, 9215803758613.0/40874803200.0,
+        -1.0/87091200.0, -108959005657177.0/122624409600.0, 0.0, 8201314303.0/3110400.0,
+        0.0, -771129115237.0/132710400.0, 0.0, 114906569401.0/12441600.0,
+        0.0, -872772663841.0/87091200.0, 0.0, 632140951.0/95040.0,
+        0.0, -11626792853.0/5702400.0,
+        231.0/8388608.0, 141480803971.0/669692775628800.0, -7156487.0/54499737600.0, -84703387171.0/20927899238400.0,
+        1997021.0/22295347200.0, 3582445997.0/70464307200.0, -28067.0/1393459200.0, -9459824881.0/19818086400.0,
+        871.0/464486400.0, 790114448747.0/237817036800.0, -13.0/174182400.0, -21482060041.0/1238630400.0,
+        1.0/958003200.0, 8381461973629.0/122624409600.0, 0.0, -630870331.0/3110400.0,
+        0.0, 59317624249.0/132710400.0, 0.0, -8838966877.0/12441600.0,
+        0.0, 67136358757.0/87091200.0, 0.0, -48626227.0/95040.0,
+        0.0, 894368681.0/5702400.0
+    };
+};
+
+template <>
+struct spline_coefficients<7,0>{
+    static const int nb_polys = 16;
+    static const int degree = 1;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        1.0/2.0, -1.0,
+        1.0/2.0, 1.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0
+    };
+};
+
+template <>
+struct spline_coefficients<7,1>{
+    static const int nb_polys = 16;
+    static const int degree = 3;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -1.0/192192.0, 1.0/96096.0, 1.0/48048.0, -1.0/24024.0,
+        1.0/11088.0, -23.0/144144.0, -1.0/2772.0, 23.0/36036.0,
+        -7.0/9360.0, 119.0/102960.0, 7.0/2340.0, -119.0/25740.0,
+        7.0/1760.0, -7.0/1320.0, -7.0/440.0, 7.0/330.0,
+        -49.0/3168.0, 7.0/396.0, 49.0/792.0, -7.0/99.0,
+        7.0/144.0, -7.0/144.0, -7.0/36.0, 7.0/36.0,
+        -7.0/48.0, 7.0/48.0, 7.0/12.0, -7.0/12.0,
+        39.0/64.0, -41.0/32.0, -7.0/16.0, 9.0/8.0,
+        39.0/64.0, 41.0/32.0, -7.0/16.0, -9.0/8.0,
+        -7.0/48.0, -7.0/48.0, 7.0/12.0, 7.0/12.0,
+        7.0/144.0, 7.0/144.0, -7.0/36.0, -7.0/36.0,
+        -49.0/3168.0, -7.0/396.0, 49.0/792.0, 7.0/99.0,
+        7.0/1760.0, 7.0/1320.0, -7.0/440.0, -7.0/330.0,
+        -7.0/9360.0, -119.0/102960.0, 7.0/2340.0, 119.0/25740.0,
+        1.0/11088.0, 23.0/144144.0, -1.0/2772.0, -23.0/36036.0,
+        -1.0/192192.0, -1.0/96096.0, 1.0/48048.0, 1.0/24024.0
+    };
+};
+
+template <>
+struct spline_coefficients<7,2>{
+    static const int nb_polys = 16;
+    static const int degree = 5;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -17.0/2690688.0, 1.0/56056.0, 5.0/168168.0, -17.0/168168.0,
+        -1.0/56056.0, 5.0/42042.0,
+        815.0/7451136.0, -13163.0/48432384.0, -479.0/931392.0, 9299.0/6054048.0,
+        13.0/42336.0, -5435.0/3027024.0,
+        -4067.0/4492800.0, 48167.0/24710400.0, 2387.0/561600.0, -33887.0/3088800.0,
+        -707.0/280800.0, 19607.0/1544400.0,
+        1351.0/281600.0, -1239.0/140800.0, -791.0/35200.0, 2597.0/52800.0,
+        21.0/1600.0, -1477.0/26400.0,
+        -5635.0/304128.0, 4333.0/152064.0, 3283.0/38016.0, -2989.0/19008.0,
+        -931.0/19008.0, 1645.0/9504.0,
+        791.0/13824.0, -511.0/6912.0, -455.0/1728.0, 343.0/864.0,
+        119.0/864.0, -175.0/432.0,
+        -245.0/1536.0, 49.0/256.0, 133.0/192.0, -91.0/96.0,
+        -7.0/32.0, 35.0/48.0,
+        3481819.0/5644800.0, -3790519.0/2822400.0, -350719.0/705600.0, 571219.0/352800.0,
+        42019.0/352800.0, -174319.0/176400.0,
+        3481819.0/5644800.0, 3790519.0/2822400.0, -350719.0/705600.0, -571219.0/352800.0,
+        42019.0/352800.0, 174319.0/176400.0,
+        -245.0/1536.0, -49.0/256.0, 133.0/192.0, 91.0/96.0,
+        -7.0/32.0, -35.0/48.0,
+        791.0/13824.0, 511.0/6912.0, -455.0/1728.0, -343.0/864.0,
+        119.0/864.0, 175.0/432.0,
+        -5635.0/304128.0, -4333.0/152064.0, 3283.0/38016.0, 2989.0/19008.0,
+        -931.0/19008.0, -1645.0/9504.0,
+        1351.0/281600.0, 1239.0/140800.0, -791.0/35200.0, -2597.0/52800.0,
+        21.0/1600.0, 1477.0/26400.0,
+        -4067.0/4492800.0, -48167.0/24710400.0, 2387.0/561600.0, 33887.0/3088800.0,
+        -707.0/280800.0, -19607.0/1544400.0,
+        815.0/7451136.0, 13163.0/48432384.0, -479.0/931392.0, -9299.0/6054048.0,
+        13.0/42336.0, 5435.0/3027024.0,
+        -17.0/2690688.0, -1.0/56056.0, 5.0/168168.0, 17.0/168168.0,
+        -1.0/56056.0, -5.0/42042.0
+    };
+};
+
+template <>
+struct spline_coefficients<7,3>{
+    static const int nb_polys = 16;
+    static const int degree = 7;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -495217.0/77491814400.0, 891217.0/38745907200.0, 4033.0/131788800.0, -526417.0/3228825600.0,
+        -34417.0/1614412800.0, 296017.0/807206400.0, 5617.0/1210809600.0, -200017.0/605404800.0,
+        123623.0/1117670400.0, -20298541.0/58118860800.0, -7039.0/13305600.0, 11942141.0/4843238400.0,
+        947.0/2587200.0, -2225647.0/403603200.0, -1373.0/17463600.0, 4502941.0/908107200.0,
+        -69067.0/75479040.0, 20690897.0/8302694400.0, 45793.0/10483200.0, -4032491.0/230630400.0,
+        -23503.0/7862400.0, 6702769.0/172972800.0, 3707.0/5896800.0, -901357.0/25945920.0,
+        275141.0/56770560.0, -4749581.0/425779200.0, -545449.0/23654400.0, 2748029.0/35481600.0,
+        91513.0/5913600.0, -1499117.0/8870400.0, -13897.0/4435200.0, 200569.0/1330560.0,
+        -6822763.0/364953600.0, 45441877.0/1277337600.0, 895721.0/10137600.0, -8594359.0/35481600.0,
+        -433163.0/7603200.0, 13650677.0/26611200.0, 60763.0/5702400.0, -9044677.0/19958400.0,
+        1671697.0/29030400.0, -5199269.0/58060800.0, -647597.0/2419200.0, 2827669.0/4838400.0,
+        10433.0/67200.0, -465623.0/403200.0, -10597.0/453600.0, 906869.0/907200.0,
+        -386993.0/2419200.0, 4209469.0/19353600.0, 4399.0/6300.0, -2033869.0/1612800.0,
+        -12143.0/50400.0, 799069.0/403200.0, 559.0/18900.0, -505069.0/302400.0,
+        22291709.0/36126720.0, -41443861.0/30105600.0, -3223861.0/6451200.0, 45662941.0/22579200.0,
+        1465619.0/11289600.0, -14683133.0/5644800.0, -40337.0/2822400.0, 121399.0/56448.0,
+        22291709.0/36126720.0, 41443861.0/30105600.0, -3223861.0/6451200.0, -45662941.0/22579200.0,
+        1465619.0/11289600.0, 14683133.0/5644800.0, -40337.0/2822400.0, -121399.0/56448.0,
+        -386993.0/2419200.0, -4209469.0/19353600.0, 4399.0/6300.0, 2033869.0/1612800.0,
+        -12143.0/50400.0, -799069.0/403200.0, 559.0/18900.0, 505069.0/302400.0,
+        1671697.0/29030400.0, 5199269.0/58060800.0, -647597.0/2419200.0, -2827669.0/4838400.0,
+        10433.0/67200.0, 465623.0/403200.0, -10597.0/453600.0, -906869.0/907200.0,
+        -6822763.0/364953600.0, -45441877.0/1277337600.0, 895721.0/10137600.0, 8594359.0/35481600.0,
+        -433163.0/7603200.0, -13650677.0/26611200.0, 60763.0/5702400.0, 9044677.0/19958400.0,
+        275141.0/56770560.0, 4749581.0/425779200.0, -545449.0/23654400.0, -2748029.0/35481600.0,
+        91513.0/5913600.0, 1499117.0/8870400.0, -13897.0/4435200.0, -200569.0/1330560.0,
+        -69067.0/75479040.0, -20690897.0/8302694400.0, 45793.0/10483200.0, 4032491.0/230630400.0,
+        -23503.0/7862400.0, -6702769.0/172972800.0, 3707.0/5896800.0, 901357.0/25945920.0,
+        123623.0/1117670400.0, 20298541.0/58118860800.0, -7039.0/13305600.0, -11942141.0/4843238400.0,
+        947.0/2587200.0, 2225647.0/403603200.0, -1373.0/17463600.0, -4502941.0/908107200.0,
+        -495217.0/77491814400.0, -891217.0/38745907200.0, 4033.0/131788800.0, 526417.0/3228825600.0,
+        -34417.0/1614412800.0, -296017.0/807206400.0, 5617.0/1210809600.0, 200017.0/605404800.0
+    };
+};
+
+template <>
+struct spline_coefficients<7,4>{
+    static const int nb_polys = 16;
+    static const int degree = 9;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -41281.0/6457651200.0, 2105161.0/77491814400.0, 593471.0/19372953600.0, -63563.0/276756480.0,
+        -451.0/20966400.0, 3683.0/4804800.0, 3.0/582400.0, -76861.0/55036800.0,
+        -31.0/60540480.0, 322727.0/302702400.0,
+        47485381.0/429185433600.0, -1148605537.0/2789705318400.0, -1291343.0/2438553600.0, 17262647.0/4981616640.0,
+        6737.0/18247680.0, -47788879.0/4151347200.0, -20851.0/239500800.0, 228310861.0/10897286400.0,
+        14149.0/1676505600.0, -13405813.0/838252800.0,
+        -66322591.0/72459878400.0, 1167442747.0/398529331200.0, 19800847.0/4528742400.0, -609788719.0/24908083200.0,
+        -324937.0/107827200.0, 47878021.0/593049600.0, 196207.0/283046400.0, -20760101.0/141523200.0,
+        -18271.0/283046400.0, 174279691.0/1556755200.0,
+        131051.0/27033600.0, -5556457.0/425779200.0, -148879.0/6451200.0, 11471591.0/106444800.0,
+        46087.0/2956800.0, -1037623.0/2956800.0, -1691.0/492800.0, 4230349.0/6652800.0,
+        661.0/2217600.0, -28817.0/59400.0,
+        -40944109.0/2189721600.0, 79056037.0/1916006400.0, 24199529.0/273715200.0, -63838693.0/191600640.0,
+        -5941.0/103680.0, 84524917.0/79833600.0, 17941.0/1555200.0, -10389073.0/5443200.0,
+        -7531.0/8553600.0, 3112349.0/2138400.0,
+        45857437.0/796262400.0, -284424443.0/2786918400.0, -93290203.0/348364800.0, 27331123.0/34836480.0,
+        9050347.0/58060800.0, -68384387.0/29030400.0, -544891.0/21772800.0, 45741959.0/10886400.0,
+        7247.0/4354560.0, -4979933.0/1555200.0,
+        -33024923.0/206438400.0, 73807151.0/309657600.0, 27032017.0/38707200.0, -1234483.0/774144.0,
+        -44539.0/184320.0, 611819.0/153600.0, 2819.0/89600.0, -8475923.0/1209600.0,
+        -4561.0/2419200.0, 6455647.0/1209600.0,
+        1003132367.0/1625702400.0, -2281544773.0/1625702400.0, -203125091.0/406425600.0, 71159861.0/29030400.0,
+        629683.0/4838400.0, -6258977.0/1209600.0, -54983.0/3628800.0, 114467333.0/12700800.0,
+        2731.0/3175200.0, -43576279.0/6350400.0,
+        1003132367.0/1625702400.0, 2281544773.0/1625702400.0, -203125091.0/406425600.0, -71159861.0/29030400.0,
+        629683.0/4838400.0, 6258977.0/1209600.0, -54983.0/3628800.0, -114467333.0/12700800.0,
+        2731.0/3175200.0, 43576279.0/6350400.0,
+        -33024923.0/206438400.0, -73807151.0/309657600.0, 27032017.0/38707200.0, 1234483.0/774144.0,
+        -44539.0/184320.0, -611819.0/153600.0, 2819.0/89600.0, 8475923.0/1209600.0,
+        -4561.0/2419200.0, -6455647.0/1209600.0,
+        45857437.0/796262400.0, 284424443.0/2786918400.0, -93290203.0/348364800.0, -27331123.0/34836480.0,
+        9050347.0/58060800.0, 68384387.0/29030400.0, -544891.0/21772800.0, -45741959.0/10886400.0,
+        7247.0/4354560.0, 4979933.0/1555200.0,
+        -40944109.0/2189721600.0, -79056037.0/1916006400.0, 24199529.0/273715200.0, 63838693.0/191600640.0,
+        -5941.0/103680.0, -84524917.0/79833600.0, 17941.0/1555200.0, 10389073.0/5443200.0,
+        -7531.0/8553600.0, -3112349.0/2138400.0,
+        131051.0/27033600.0, 5556457.0/425779200.0, -148879.0/6451200.0, -11471591.0/106444800.0,
+        46087.0/2956800.0, 1037623.0/2956800.0, -1691.0/492800.0, -4230349.0/6652800.0,
+        661.0/2217600.0, 28817.0/59400.0,
+        -66322591.0/72459878400.0, -1167442747.0/398529331200.0, 19800847.0/4528742400.0, 609788719.0/24908083200.0,
+        -324937.0/107827200.0, -47878021.0/593049600.0, 196207.0/283046400.0, 20760101.0/141523200.0,
+        -18271.0/283046400.0, -174279691.0/1556755200.0,
+        47485381.0/429185433600.0, 1148605537.0/2789705318400.0, -1291343.0/2438553600.0, -17262647.0/4981616640.0,
+        6737.0/18247680.0, 47788879.0/4151347200.0, -20851.0/239500800.0, -228310861.0/10897286400.0,
+        14149.0/1676505600.0, 13405813.0/838252800.0,
+        -41281.0/6457651200.0, -2105161.0/77491814400.0, 593471.0/19372953600.0, 63563.0/276756480.0,
+        -451.0/20966400.0, -3683.0/4804800.0, 3.0/582400.0, 76861.0/55036800.0,
+        -31.0/60540480.0, -322727.0/302702400.0
+    };
+};
+
+template <>
+struct spline_coefficients<8,0>{
+    static const int nb_polys = 18;
+    static const int degree = 1;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        1.0/2.0, -1.0,
+        1.0/2.0, 1.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0
+    };
+};
+
+template <>
+struct spline_coefficients<8,1>{
+    static const int nb_polys = 18;
+    static const int degree = 3;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        1.0/823680.0, -1.0/411840.0, -1.0/205920.0, 1.0/102960.0,
+        -3.0/128128.0, 11.0/262080.0, 3.0/32032.0, -11.0/65520.0,
+        1.0/4620.0, -31.0/90090.0, -1.0/1155.0, 62.0/45045.0,
+        -1.0/780.0, 23.0/12870.0, 1.0/195.0, -46.0/6435.0,
+        63.0/11440.0, -343.0/51480.0, -63.0/2860.0, 343.0/12870.0,
+        -49.0/2640.0, 7.0/360.0, 49.0/660.0, -7.0/90.0,
+        7.0/132.0, -49.0/990.0, -7.0/33.0, 98.0/495.0,
+        -3.0/20.0, 13.0/90.0, 3.0/5.0, -26.0/45.0,
+        11.0/18.0, -23.0/18.0, -4.0/9.0, 10.0/9.0,
+        11.0/18.0, 23.0/18.0, -4.0/9.0, -10.0/9.0,
+        -3.0/20.0, -13.0/90.0, 3.0/5.0, 26.0/45.0,
+        7.0/132.0, 49.0/990.0, -7.0/33.0, -98.0/495.0,
+        -49.0/2640.0, -7.0/360.0, 49.0/660.0, 7.0/90.0,
+        63.0/11440.0, 343.0/51480.0, -63.0/2860.0, -343.0/12870.0,
+        -1.0/780.0, -23.0/12870.0, 1.0/195.0, 46.0/6435.0,
+        1.0/4620.0, 31.0/90090.0, -1.0/1155.0, -62.0/45045.0,
+        -3.0/128128.0, -11.0/262080.0, 3.0/32032.0, 11.0/65520.0,
+        1.0/823680.0, 1.0/411840.0, -1.0/205920.0, -1.0/102960.0
+    };
+};
+
+template <>
+struct spline_coefficients<8,2>{
+    static const int nb_polys = 18;
+    static const int degree = 5;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        1.0/675840.0, -1.0/239616.0, -23.0/3294720.0, 1.0/42240.0,
+        7.0/1647360.0, -23.0/823680.0,
+        -2455.0/86102016.0, 5151.0/71751680.0, 1447.0/10762752.0, -32807.0/80720640.0,
+        -439.0/5381376.0, 3851.0/8072064.0,
+        613.0/2328480.0, -1769.0/3027024.0, -361.0/291060.0, 6241.0/1891890.0,
+        109.0/145530.0, -3637.0/945945.0,
+        -437.0/280800.0, 4637.0/1544400.0, 257.0/35100.0, -3257.0/193050.0,
+        -77.0/17550.0, 1877.0/96525.0,
+        469.0/70400.0, -5033.0/457600.0, -3577.0/114400.0, 2429.0/39600.0,
+        1057.0/57200.0, -17857.0/257400.0,
+        -8477.0/380160.0, 1183.0/38016.0, 4949.0/47520.0, -4067.0/23760.0,
+        -1421.0/23760.0, 2219.0/11880.0,
+        595.0/9504.0, -161.0/2160.0, -343.0/1188.0, 1183.0/2970.0,
+        91.0/594.0, -119.0/297.0,
+        -79.0/480.0, 3.0/16.0, 43.0/60.0, -83.0/90.0,
+        -7.0/30.0, 31.0/45.0,
+        13975051.0/22579200.0, -1674739.0/1254400.0, -477017.0/940800.0, 2215051.0/1411200.0,
+        176651.0/1411200.0, -647051.0/705600.0,
+        13975051.0/22579200.0, 1674739.0/1254400.0, -477017.0/940800.0, -2215051.0/1411200.0,
+        176651.0/1411200.0, 647051.0/705600.0,
+        -79.0/480.0, -3.0/16.0, 43.0/60.0, 83.0/90.0,
+        -7.0/30.0, -31.0/45.0,
+        595.0/9504.0, 161.0/2160.0, -343.0/1188.0, -1183.0/2970.0,
+        91.0/594.0, 119.0/297.0,
+        -8477.0/380160.0, -1183.0/38016.0, 4949.0/47520.0, 4067.0/23760.0,
+        -1421.0/23760.0, -2219.0/11880.0,
+        469.0/70400.0, 5033.0/457600.0, -3577.0/114400.0, -2429.0/39600.0,
+        1057.0/57200.0, 17857.0/257400.0,
+        -437.0/280800.0, -4637.0/1544400.0, 257.0/35100.0, 3257.0/193050.0,
+        -77.0/17550.0, -1877.0/96525.0,
+        613.0/2328480.0, 1769.0/3027024.0, -361.0/291060.0, -6241.0/1891890.0,
+        109.0/145530.0, 3637.0/945945.0,
+        -2455.0/86102016.0, -5151.0/71751680.0, 1447.0/10762752.0, 32807.0/80720640.0,
+        -439.0/5381376.0, -3851.0/8072064.0,
+        1.0/675840.0, 1.0/239616.0, -23.0/3294720.0, -1.0/42240.0,
+        7.0/1647360.0, 23.0/823680.0
+    };
+};
+
+template <>
+struct spline_coefficients<8,3>{
+    static const int nb_polys = 18;
+    static const int degree = 7;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        316529.0/211341312000.0, -6260119.0/1162377216000.0, -107263.0/14902272000.0, 3702319.0/96864768000.0,
+        1733.0/338688000.0, -2085319.0/24216192000.0, -42019.0/36324288000.0, 1409119.0/18162144000.0,
+        -165639.0/5740134400.0, 107412457.0/1162377216000.0, 596551.0/4305100800.0, -63334657.0/96864768000.0,
+        -105551.0/1076275200.0, 35519257.0/24216192000.0, 5917.0/269068800.0, -3423751.0/2594592000.0,
+        5954279.0/22353408000.0, -4033129.0/5381376000.0, -264431.0/206976000.0, 5811353.0/1100736000.0,
+        418279.0/465696000.0, -35620883.0/3027024000.0, -69479.0/349272000.0, 1142023.0/108108000.0,
+        -8316509.0/5283532800.0, 4120619.0/1076275200.0, 132709.0/17611776.0, -64862729.0/2421619200.0,
+        -192287.0/36691200.0, 7155893.0/121080960.0, 93917.0/82555200.0, -8002307.0/151351200.0,
+        2760867.0/410009600.0, -32961173.0/2372198400.0, -10133.0/315392.0, 1726879.0/17971200.0,
+        43213.0/1971200.0, -2059729.0/9884160.0, -29411.0/6406400.0, 6870101.0/37065600.0,
+        -41077453.0/1824768000.0, 82319287.0/2128896000.0, 16224653.0/152064000.0, -139314661.0/532224000.0,
+        -295717.0/4224000.0, 73066661.0/133056000.0, 387853.0/28512000.0, -16071287.0/33264000.0,
+        3659923.0/58060800.0, -6819017.0/76032000.0, -5213851.0/17740800.0, 11026651.0/19008000.0,
+        210323.0/1209600.0, -5359451.0/4752000.0, -275153.0/9979200.0, 383939.0/396000.0,
+        -4142217.0/25088000.0, 214780063.0/1016064000.0, 13603153.0/18816000.0, -102354463.0/84672000.0,
+        -1215953.0/4704000.0, 38850463.0/21168000.0, 39451.0/1176000.0, -24268063.0/15876000.0,
+        251652181.0/406425600.0, -8668351.0/6350400.0, -690955.0/1354752.0, 16330063.0/8467200.0,
+        1161169.0/8467200.0, -498091.0/211680.0, -101263.0/6350400.0, 434251.0/226800.0,
+        251652181.0/406425600.0, 8668351.0/6350400.0, -690955.0/1354752.0, -16330063.0/8467200.0,
+        1161169.0/8467200.0, 498091.0/211680.0, -101263.0/6350400.0, -434251.0/226800.0,
+        -4142217.0/25088000.0, -214780063.0/1016064000.0, 13603153.0/18816000.0, 102354463.0/84672000.0,
+        -1215953.0/4704000.0, -38850463.0/21168000.0, 39451.0/1176000.0, 24268063.0/15876000.0,
+        3659923.0/58060800.0, 6819017.0/76032000.0, -5213851.0/17740800.0, -11026651.0/19008000.0,
+        210323.0/1209600.0, 5359451.0/4752000.0, -275153.0/9979200.0, -383939.0/396000.0,
+        -41077453.0/1824768000.0, -82319287.0/2128896000.0, 16224653.0/152064000.0, 139314661.0/532224000.0,
+        -295717.0/4224000.0, -73066661.0/133056000.0, 387853.0/28512000.0, 16071287.0/33264000.0,
+        2760867.0/410009600.0, 32961173.0/2372198400.0, -10133.0/315392.0, -1726879.0/17971200.0,
+        43213.0/1971200.0, 2059729.0/9884160.0, -29411.0/6406400.0, -6870101.0/37065600.0,
+        -8316509.0/5283532800.0, -4120619.0/1076275200.0, 132709.0/17611776.0, 64862729.0/2421619200.0,
+        -192287.0/36691200.0, -7155893.0/121080960.0, 93917.0/82555200.0, 8002307.0/151351200.0,
+        5954279.0/22353408000.0, 4033129.0/5381376000.0, -264431.0/206976000.0, -5811353.0/1100736000.0,
+        418279.0/465696000.0, 35620883.0/3027024000.0, -69479.0/349272000.0, -1142023.0/108108000.0,
+        -165639.0/5740134400.0, -107412457.0/1162377216000.0, 596551.0/4305100800.0, 63334657.0/96864768000.0,
+        -105551.0/1076275200.0, -35519257.0/24216192000.0, 5917.0/269068800.0, 3423751.0/2594592000.0,
+        316529.0/211341312000.0, 6260119.0/1162377216000.0, -107263.0/14902272000.0, -3702319.0/96864768000.0,
+        1733.0/338688000.0, 2085319.0/24216192000.0, -42019.0/36324288000.0, -1409119.0/18162144000.0
+    };
+};
+
+template <>
+struct spline_coefficients<8,4>{
+    static const int nb_polys = 18;
+    static const int degree = 9;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        2026519.0/1352584396800.0, -236669249.0/37196070912000.0, -33506393.0/4649508864000.0, 1987319.0/36900864000.0,
+        40459.0/7827456000.0, -13942109.0/77491814400.0, -376489.0/290594304000.0, 47618393.0/145297152000.0,
+        3667.0/26417664000.0, -1101377.0/4402944000.0,
+        -143162353.0/4959476121600.0, 368643731.0/3381460992000.0, 43001929.0/309967257600.0, -38871167.0/42268262400.0,
+        -93031.0/939294720.0, 395396843.0/129153024000.0, 36637.0/1490227200.0, -809612473.0/145297152000.0,
+        -50257.0/19372953600.0, 617882417.0/145297152000.0,
+        28590127.0/107296358400.0, -279717241.0/317011968000.0, -42885761.0/33530112000.0, 1614069953.0/217945728000.0,
+        5067287.0/5588352000.0, -178174531.0/7264857600.0, -464813.0/2095632000.0, 46716689.0/1047816000.0,
+        47939.0/2095632000.0, -463422059.0/13621608000.0,
+        -199658443.0/126804787200.0, 3133597459.0/697426329600.0, 59781277.0/7925299200.0, -232995067.0/6227020800.0,
+        -6984559.0/1320883200.0, 892789927.0/7264857600.0, 48133.0/38102400.0, -607477873.0/2724321600.0,
+        -62227.0/495331200.0, 42130577.0/247665600.0,
+        397673929.0/59041382400.0, -391781147.0/24153292800.0, -118665181.0/3690086400.0, 2213577437.0/16605388800.0,
+        13591537.0/615014400.0, -398221787.0/922521600.0, -1167877.0/230630400.0, 810304069.0/1037836800.0,
+        15583.0/32947200.0, -617941241.0/1037836800.0,
+        -394427999.0/17517772800.0, 1246172369.0/27869184000.0, 584509759.0/5474304000.0, -624476957.0/1741824000.0,
+        -5845193.0/82944000.0, 721503719.0/638668800.0, 5076487.0/342144000.0, -2432485063.0/1197504000.0,
+        -422251.0/342144000.0, 264845533.0/171072000.0,
+        87849961.0/1393459200.0, -3900288587.0/38320128000.0, -281677853.0/958003200.0, 370572409.0/479001600.0,
+        507137.0/2903040.0, -913697903.0/399168000.0, -1780817.0/59875200.0, 608632961.0/149688000.0,
+        1687.0/777600.0, -42136729.0/13608000.0,
+        -178953773.0/1083801600.0, 1872748537.0/8128512000.0, 244906747.0/338688000.0, -109804973.0/72576000.0,
+        -14641429.0/56448000.0, 20660659.0/5644800.0, 760111.0/21168000.0, -203044159.0/31752000.0,
+        -49993.0/21168000.0, 154508033.0/31752000.0,
+        32211694289.0/52022476800.0, -36123612977.0/26011238400.0, -184278569.0/361267200.0, 3753419377.0/1625702400.0,
+        74529937.0/541900800.0, -46503843.0/10035200.0, -3455537.0/203212800.0, 812591729.0/101606400.0,
+        71707.0/67737600.0, -618047281.0/101606400.0,
+        32211694289.0/52022476800.0, 36123612977.0/26011238400.0, -184278569.0/361267200.0, -3753419377.0/1625702400.0,
+        74529937.0/541900800.0, 46503843.0/10035200.0, -3455537.0/203212800.0, -812591729.0/101606400.0,
+        71707.0/67737600.0, 618047281.0/101606400.0,
+        -178953773.0/1083801600.0, -1872748537.0/8128512000.0, 244906747.0/338688000.0, 109804973.0/72576000.0,
+        -14641429.0/56448000.0, -20660659.0/5644800.0, 760111.0/21168000.0, 203044159.0/31752000.0,
+        -49993.0/21168000.0, -154508033.0/31752000.0,
+        87849961.0/1393459200.0, 3900288587.0/38320128000.0, -281677853.0/958003200.0, -370572409.0/479001600.0,
+        507137.0/2903040.0, 913697903.0/399168000.0, -1780817.0/59875200.0, -608632961.0/149688000.0,
+        1687.0/777600.0, 42136729.0/13608000.0,
+        -394427999.0/17517772800.0, -1246172369.0/27869184000.0, 584509759.0/5474304000.0, 624476957.0/1741824000.0,
+        -5845193.0/82944000.0, -721503719.0/638668800.0, 5076487.0/342144000.0, 2432485063.0/1197504000.0,
+        -422251.0/342144000.0, -264845533.0/171072000.0,
+        397673929.0/59041382400.0, 391781147.0/24153292800.0, -118665181.0/3690086400.0, -2213577437.0/16605388800.0,
+        13591537.0/615014400.0, 398221787.0/922521600.0, -1167877.0/230630400.0, -810304069.0/1037836800.0,
+        15583.0/32947200.0, 617941241.0/1037836800.0,
+        -199658443.0/126804787200.0, -3133597459.0/697426329600.0, 59781277.0/7925299200.0, 232995067.0/6227020800.0,
+        -6984559.0/1320883200.0, -892789927.0/7264857600.0, 48133.0/38102400.0, 607477873.0/2724321600.0,
+        -62227.0/495331200.0, -42130577.0/247665600.0,
+        28590127.0/107296358400.0, 279717241.0/317011968000.0, -42885761.0/33530112000.0, -1614069953.0/217945728000.0,
+        5067287.0/5588352000.0, 178174531.0/7264857600.0, -464813.0/2095632000.0, -46716689.0/1047816000.0,
+        47939.0/2095632000.0, 463422059.0/13621608000.0,
+        -143162353.0/4959476121600.0, -368643731.0/3381460992000.0, 43001929.0/309967257600.0, 38871167.0/42268262400.0,
+        -93031.0/939294720.0, -395396843.0/129153024000.0, 36637.0/1490227200.0, 809612473.0/145297152000.0,
+        -50257.0/19372953600.0, -617882417.0/145297152000.0,
+        2026519.0/1352584396800.0, 236669249.0/37196070912000.0, -33506393.0/4649508864000.0, -1987319.0/36900864000.0,
+        40459.0/7827456000.0, 13942109.0/77491814400.0, -376489.0/290594304000.0, -47618393.0/145297152000.0,
+        3667.0/26417664000.0, 1101377.0/4402944000.0
+    };
+};
+
+template <>
+struct spline_coefficients<9,0>{
+    static const int nb_polys = 20;
+    static const int degree = 1;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        1.0/2.0, -1.0,
+        1.0/2.0, 1.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0
+    };
+};
+
+template <>
+struct spline_coefficients<9,1>{
+    static const int nb_polys = 20;
+    static const int degree = 3;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -1.0/3500640.0, 1.0/1750320.0, 1.0/875160.0, -1.0/437580.0,
+        1.0/164736.0, -7.0/636480.0, -1.0/41184.0, 7.0/159120.0,
+        -135.0/2178176.0, 549.0/5445440.0, 135.0/544544.0, -549.0/1361360.0,
+        1.0/2464.0, -47.0/80080.0, -1.0/616.0, 47.0/20020.0,
+        -1.0/520.0, 7.0/2860.0, 1.0/130.0, -7.0/715.0,
+        81.0/11440.0, -9.0/1144.0, -81.0/2860.0, 9.0/286.0,
+        -49.0/2288.0, 119.0/5720.0, 49.0/572.0, -119.0/1430.0,
+        5.0/88.0, -1.0/20.0, -5.0/22.0, 1.0/5.0,
+        -27.0/176.0, 63.0/440.0, 27.0/44.0, -63.0/110.0,
+        49.0/80.0, -51.0/40.0, -9.0/20.0, 11.0/10.0,
+        49.0/80.0, 51.0/40.0, -9.0/20.0, -11.0/10.0,
+        -27.0/176.0, -63.0/440.0, 27.0/44.0, 63.0/110.0,
+        5.0/88.0, 1.0/20.0, -5.0/22.0, -1.0/5.0,
+        -49.0/2288.0, -119.0/5720.0, 49.0/572.0, 119.0/1430.0,
+        81.0/11440.0, 9.0/1144.0, -81.0/2860.0, -9.0/286.0,
+        -1.0/520.0, -7.0/2860.0, 1.0/130.0, 7.0/715.0,
+        1.0/2464.0, 47.0/80080.0, -1.0/616.0, -47.0/20020.0,
+        -135.0/2178176.0, -549.0/5445440.0, 135.0/544544.0, 549.0/1361360.0,
+        1.0/164736.0, 7.0/636480.0, -1.0/41184.0, -7.0/159120.0,
+        -1.0/3500640.0, -1.0/1750320.0, 1.0/875160.0, 1.0/437580.0
+    };
+};
+
+template <>
+struct spline_coefficients<9,2>{
+    static const int nb_polys = 20;
+    static const int degree = 5;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -1.0/2864160.0, 31.0/31505760.0, 1.0/605880.0, -1.0/179010.0,
+        -1.0/984555.0, 1.0/151470.0,
+        1759.0/237219840.0, -38047.0/2016368640.0, -1039.0/29652480.0, 26959.0/252046080.0,
+        29.0/1347840.0, -15871.0/126023040.0,
+        -36909.0/487911424.0, 209871.0/1219778560.0, 21789.0/60988928.0, -148383.0/152472320.0,
+        -513.0/2345728.0, 17379.0/15247232.0,
+        4.0/8085.0, -3343.0/3363360.0, -151.0/64680.0, 589.0/105105.0,
+        23.0/16170.0, -1369.0/210210.0,
+        -73.0/31200.0, 703.0/171600.0, 43.0/3900.0, -493.0/21450.0,
+        -1.0/150.0, 283.0/10725.0,
+        7857.0/915200.0, -5913.0/457600.0, -4617.0/114400.0, 4113.0/57200.0,
+        1377.0/57200.0, -2313.0/28600.0,
+        -14161.0/549120.0, 9079.0/274560.0, 637.0/5280.0, -6223.0/34320.0,
+        -2401.0/34320.0, 259.0/1320.0,
+        71.0/1056.0, -197.0/2640.0, -41.0/132.0, 131.0/330.0,
+        1.0/6.0, -13.0/33.0,
+        -27.0/160.0, 81.0/440.0, 81.0/110.0, -9.0/10.0,
+        -27.0/110.0, 36.0/55.0,
+        126120419.0/203212800.0, -135010979.0/101606400.0, -13083299.0/25401600.0, 19433699.0/12700800.0,
+        1652579.0/12700800.0, -5462819.0/6350400.0,
+        126120419.0/203212800.0, 135010979.0/101606400.0, -13083299.0/25401600.0, -19433699.0/12700800.0,
+        1652579.0/12700800.0, 5462819.0/6350400.0,
+        -27.0/160.0, -81.0/440.0, 81.0/110.0, 9.0/10.0,
+        -27.0/110.0, -36.0/55.0,
+        71.0/1056.0, 197.0/2640.0, -41.0/132.0, -131.0/330.0,
+        1.0/6.0, 13.0/33.0,
+        -14161.0/549120.0, -9079.0/274560.0, 637.0/5280.0, 6223.0/34320.0,
+        -2401.0/34320.0, -259.0/1320.0,
+        7857.0/915200.0, 5913.0/457600.0, -4617.0/114400.0, -4113.0/57200.0,
+        1377.0/57200.0, 2313.0/28600.0,
+        -73.0/31200.0, -703.0/171600.0, 43.0/3900.0, 493.0/21450.0,
+        -1.0/150.0, -283.0/10725.0,
+        4.0/8085.0, 3343.0/3363360.0, -151.0/64680.0, -589.0/105105.0,
+        23.0/16170.0, 1369.0/210210.0,
+        -36909.0/487911424.0, -209871.0/1219778560.0, 21789.0/60988928.0, 148383.0/152472320.0,
+        -513.0/2345728.0, -17379.0/15247232.0,
+        1759.0/237219840.0, 38047.0/2016368640.0, -1039.0/29652480.0, -26959.0/252046080.0,
+        29.0/1347840.0, 15871.0/126023040.0,
+        -1.0/2864160.0, -31.0/31505760.0, 1.0/605880.0, 1.0/179010.0,
+        -1.0/984555.0, -1.0/151470.0
+    };
+};
+
+template <>
+struct spline_coefficients<9,3>{
+    static const int nb_polys = 20;
+    static const int degree = 7;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -13975051.0/39520825344000.0, 25107851.0/19760412672000.0, 16837153.0/9880206336000.0, -44590753.0/4940103168000.0,
+        -3038753.0/2470051584000.0, 25147553.0/1235025792000.0, 176651.0/617512896000.0, -1888217.0/102918816000.0,
+        1745687.0/232475443200.0, -635623.0/26138112000.0, -2102041.0/58118860800.0, 30407413.0/176432256000.0,
+        378221.0/14529715200.0, -17090963.0/44108064000.0, -7289.0/1210809600.0, 3845371.0/11027016000.0,
+        -280283.0/3659335680.0, 242748379.0/1097800704000.0, 224821.0/609889280.0, -12990389.0/8316672000.0,
+        -10069.0/38118080.0, 11418997.0/3267264000.0, 6931.0/114354240.0, -53864479.0/17153136000.0,
+        17911877.0/35765452800.0, -1478781739.0/1162377216000.0, -7175237.0/2980454400.0, 866263339.0/96864768000.0,
+        1276997.0/745113600.0, -68735677.0/3459456000.0, -217157.0/558835200.0, 323440939.0/18162144000.0,
+        -125090243.0/52835328000.0, 216330371.0/41513472000.0, 50014403.0/4402944000.0, -125771651.0/3459456000.0,
+        -8807363.0/1100736000.0, 69081731.0/864864000.0, 1469123.0/825552000.0, -46260611.0/648648000.0,
+        124580447.0/14350336000.0, -1050728683.0/64576512000.0, -148937181.0/3587584000.0, 603237163.0/5381376000.0,
+        25739421.0/896896000.0, -325089643.0/1345344000.0, -1382687.0/224224000.0, 216286123.0/1009008000.0,
+        -123571439.0/4744396800.0, 3396301903.0/83026944000.0, 48918959.0/395366400.0, -173215373.0/628992000.0,
+        -8135279.0/98841600.0, 990205903.0/1729728000.0, 1220399.0/74131200.0, -650812303.0/1297296000.0,
+        121110659.0/1788272640.0, -1994775649.0/22353408000.0, -47163779.0/149022720.0, 1066206049.0/1862784000.0,
+        7085699.0/37255680.0, -510193249.0/465696000.0, -876419.0/27941760.0, 326737249.0/349272000.0,
+        -112149539.0/662323200.0, 146260259.0/709632000.0, 41025059.0/55193600.0, -68845859.0/59136000.0,
+        -3769379.0/13798400.0, 25300259.0/14784000.0, 382499.0/10348800.0, -15623459.0/11088000.0,
+        1682339557.0/2709504000.0, -5510092789.0/4064256000.0, -1053269653.0/2032128000.0, 1883656807.0/1016064000.0,
+        72708893.0/508032000.0, -78210521.0/36288000.0, -2201911.0/127008000.0, 109653629.0/63504000.0,
+        1682339557.0/2709504000.0, 5510092789.0/4064256000.0, -1053269653.0/2032128000.0, -1883656807.0/1016064000.0,
+        72708893.0/508032000.0, 78210521.0/36288000.0, -2201911.0/127008000.0, -109653629.0/63504000.0,
+        -112149539.0/662323200.0, -146260259.0/709632000.0, 41025059.0/55193600.0, 68845859.0/59136000.0,
+        -3769379.0/13798400.0, -25300259.0/14784000.0, 382499.0/10348800.0, 15623459.0/11088000.0,
+        121110659.0/1788272640.0, 1994775649.0/22353408000.0, -47163779.0/149022720.0, -1066206049.0/1862784000.0,
+        7085699.0/37255680.0, 510193249.0/465696000.0, -876419.0/27941760.0, -326737249.0/349272000.0,
+        -123571439.0/4744396800.0, -3396301903.0/83026944000.0, 48918959.0/395366400.0, 173215373.0/628992000.0,
+        -8135279.0/98841600.0, -990205903.0/1729728000.0, 1220399.0/74131200.0, 650812303.0/1297296000.0,
+        124580447.0/14350336000.0, 1050728683.0/64576512000.0, -148937181.0/3587584000.0, -603237163.0/5381376000.0,
+        25739421.0/896896000.0, 325089643.0/1345344000.0, -1382687.0/224224000.0, -216286123.0/1009008000.0,
+        -125090243.0/52835328000.0, -216330371.0/41513472000.0, 50014403.0/4402944000.0, 125771651.0/3459456000.0,
+        -8807363.0/1100736000.0, -69081731.0/864864000.0, 1469123.0/825552000.0, 46260611.0/648648000.0,
+        17911877.0/35765452800.0, 1478781739.0/1162377216000.0, -7175237.0/2980454400.0, -866263339.0/96864768000.0,
+        1276997.0/745113600.0, 68735677.0/3459456000.0, -217157.0/558835200.0, -323440939.0/18162144000.0,
+        -280283.0/3659335680.0, -242748379.0/1097800704000.0, 224821.0/609889280.0, 12990389.0/8316672000.0,
+        -10069.0/38118080.0, -11418997.0/3267264000.0, 6931.0/114354240.0, 53864479.0/17153136000.0,
+        1745687.0/232475443200.0, 635623.0/26138112000.0, -2102041.0/58118860800.0, -30407413.0/176432256000.0,
+        378221.0/14529715200.0, 17090963.0/44108064000.0, -7289.0/1210809600.0, -3845371.0/11027016000.0,
+        -13975051.0/39520825344000.0, -25107851.0/19760412672000.0, 16837153.0/9880206336000.0, 44590753.0/4940103168000.0,
+        -3038753.0/2470051584000.0, -25147553.0/1235025792000.0, 176651.0/617512896000.0, 1888217.0/102918816000.0
+    };
+};
+
+template <>
+struct spline_coefficients<9,4>{
+    static const int nb_polys = 20;
+    static const int degree = 9;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        -22877471.0/64670441472000.0, 13351771.0/8892185702400.0, 151736903.0/88921857024000.0, -565575821.0/44460928512000.0,
+        -4608761.0/3705077376000.0, 12120937.0/285005952000.0, 51211.0/158789030400.0, -215240903.0/2778808032000.0,
+        -101263.0/2778808032000.0, 41064761.0/694702008000.0,
+        457232891.0/60866297856000.0, -32672132453.0/1138199769907200.0, -1515452761.0/41845579776000.0, 86269082329.0/355687428096000.0,
+        183529321.0/6974263296000.0, -47937991993.0/59281238016000.0, -17727481.0/2615348736000.0, 32720005657.0/22230464256000.0,
+        152557.0/201180672000.0, -24967737721.0/22230464256000.0,
+        -55215341.0/720607641600.0, 237794077.0/912457728000.0, 72034371.0/195164569600.0, -1926634613.0/878240563200.0,
+        -26051593.0/97582284800.0, 1777367667.0/243955712000.0, 2492873.0/36593356800.0, -330552667.0/24950016000.0,
+        -13093.0/1742540800.0, 2774247673.0/274450176000.0,
+        537553451.0/1072963584000.0, -149046389.0/99632332800.0, -323279947.0/134120448000.0, 992498513.0/79252992000.0,
+        604753.0/349272000.0, -3004006013.0/72648576000.0, -331967.0/762048000.0, 4091436409.0/54486432000.0,
+        28163.0/598752000.0, -390139199.0/6810804000.0,
+        -115507429.0/48771072000.0, 4258596827.0/697426329600.0, 56330411.0/4953312000.0, -1380605873.0/27243216000.0,
+        -53357839.0/6604416000.0, 6022665673.0/36324288000.0, 492103.0/247665600.0, -2046352901.0/6810804000.0,
+        -513661.0/2476656000.0, 3121232971.0/13621608000.0,
+        1993891379.0/229605376000.0, -156689887.0/8265793536.0, -596352951.0/14350336000.0, 910311173.0/5870592000.0,
+        207728049.0/7175168000.0, -1791764697.0/3587584000.0, -3187.0/465920.0, 3639721439.0/4036032000.0,
+        46479.0/68992000.0, -2774576947.0/4036032000.0,
+        -29664254831.0/1138655232000.0, 3418097369.0/72459878400.0, 8812522091.0/71165952000.0, -93566151659.0/249080832000.0,
+        -983342951.0/11860992000.0, 3749061971.0/3193344000.0, 80333411.0/4447872000.0, -2980237417.0/1415232000.0,
+        -7109471.0/4447872000.0, 3567551993.0/2223936000.0,
+        660704669.0/9754214400.0, -27059138917.0/268240896000.0, -1061740937.0/3353011200.0, 1271768557.0/1676505600.0,
+        213682789.0/1117670400.0, -6182990623.0/2794176000.0, -254609.0/7484400.0, 1025510719.0/261954000.0,
+        1111819.0/419126400.0, -3121831129.0/1047816000.0,
+        -99571.0/588000.0, 88843571.0/397393920.0, 205173531.0/275968000.0, -1792654337.0/1241856000.0,
+        -18919249.0/68992000.0, 58424577.0/17248000.0, 2057203.0/51744000.0, -456255511.0/77616000.0,
+        -12059.0/4312000.0, 173445649.0/38808000.0,
+        1453552677901.0/2341011456000.0, -46053822239.0/33443020800.0, -75846715669.0/146313216000.0, 160600345237.0/73156608000.0,
+        3501327517.0/24385536000.0, -51255790189.0/12192768000.0, -33967649.0/1828915200.0, 32872116421.0/4572288000.0,
+        1614379.0/1306368000.0, -24977055133.0/4572288000.0,
+        1453552677901.0/2341011456000.0, 46053822239.0/33443020800.0, -75846715669.0/146313216000.0, -160600345237.0/73156608000.0,
+        3501327517.0/24385536000.0, 51255790189.0/12192768000.0, -33967649.0/1828915200.0, -32872116421.0/4572288000.0,
+        1614379.0/1306368000.0, 24977055133.0/4572288000.0,
+        -99571.0/588000.0, -88843571.0/397393920.0, 205173531.0/275968000.0, 1792654337.0/1241856000.0,
+        -18919249.0/68992000.0, -58424577.0/17248000.0, 2057203.0/51744000.0, 456255511.0/77616000.0,
+        -12059.0/4312000.0, -173445649.0/38808000.0,
+        660704669.0/9754214400.0, 27059138917.0/268240896000.0, -1061740937.0/3353011200.0, -1271768557.0/1676505600.0,
+        213682789.0/1117670400.0, 6182990623.0/2794176000.0, -254609.0/7484400.0, -1025510719.0/261954000.0,
+        1111819.0/419126400.0, 3121831129.0/1047816000.0,
+        -29664254831.0/1138655232000.0, -3418097369.0/72459878400.0, 8812522091.0/71165952000.0, 93566151659.0/249080832000.0,
+        -983342951.0/11860992000.0, -3749061971.0/3193344000.0, 80333411.0/4447872000.0, 2980237417.0/1415232000.0,
+        -7109471.0/4447872000.0, -3567551993.0/2223936000.0,
+        1993891379.0/229605376000.0, 156689887.0/8265793536.0, -596352951.0/14350336000.0, -910311173.0/5870592000.0,
+        207728049.0/7175168000.0, 1791764697.0/3587584000.0, -3187.0/465920.0, -3639721439.0/4036032000.0,
+        46479.0/68992000.0, 2774576947.0/4036032000.0,
+        -115507429.0/48771072000.0, -4258596827.0/697426329600.0, 56330411.0/4953312000.0, 1380605873.0/27243216000.0,
+        -53357839.0/6604416000.0, -6022665673.0/36324288000.0, 492103.0/247665600.0, 2046352901.0/6810804000.0,
+        -513661.0/2476656000.0, -3121232971.0/13621608000.0,
+        537553451.0/1072963584000.0, 149046389.0/99632332800.0, -323279947.0/134120448000.0, -992498513.0/79252992000.0,
+        604753.0/349272000.0, 3004006013.0/72648576000.0, -331967.0/762048000.0, -4091436409.0/54486432000.0,
+        28163.0/598752000.0, 390139199.0/6810804000.0,
+        -55215341.0/720607641600.0, -237794077.0/912457728000.0, 72034371.0/195164569600.0, 1926634613.0/878240563200.0,
+        -26051593.0/97582284800.0, -1777367667.0/243955712000.0, 2492873.0/36593356800.0, 330552667.0/24950016000.0,
+        -13093.0/1742540800.0, -2774247673.0/274450176000.0,
+        457232891.0/60866297856000.0, 32672132453.0/1138199769907200.0, -1515452761.0/41845579776000.0, -86269082329.0/355687428096000.0,
+        183529321.0/6974263296000.0, 47937991993.0/59281238016000.0, -17727481.0/2615348736000.0, -32720005657.0/22230464256000.0,
+        152557.0/201180672000.0, 24967737721.0/22230464256000.0,
+        -22877471.0/64670441472000.0, -13351771.0/8892185702400.0, 151736903.0/88921857024000.0, 565575821.0/44460928512000.0,
+        -4608761.0/3705077376000.0, -12120937.0/285005952000.0, 51211.0/158789030400.0, 215240903.0/2778808032000.0,
+        -101263.0/2778808032000.0, -41064761.0/694702008000.0
+    };
+};
+
+template <>
+struct spline_coefficients<10,0>{
+    static const int nb_polys = 22;
+    static const int degree = 1;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        1.0/2.0, -1.0,
+        1.0/2.0, 1.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0,
+        0.0, 0.0
+    };
+};
+
+template <>
+struct spline_coefficients<10,1>{
+    static const int nb_polys = 22;
+    static const int degree = 3;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        1.0/14780480.0, -1.0/7390240.0, -1.0/3695120.0, 1.0/1847560.0,
+        -1.0/636480.0, 191.0/66512160.0, 1.0/159120.0, -191.0/16628040.0,
+        5.0/284544.0, -775.0/26604864.0, -5.0/71136.0, 775.0/6651216.0,
+        -25.0/198016.0, 205.0/1089088.0, 25.0/49504.0, -205.0/272272.0,
+        5.0/7616.0, -475.0/544544.0, -5.0/1904.0, 475.0/136136.0,
+        -11.0/4160.0, 71.0/22880.0, 11.0/1040.0, -71.0/5720.0,
+        9.0/1040.0, -51.0/5720.0, -9.0/260.0, 51.0/1430.0,
+        -5.0/208.0, 25.0/1144.0, 5.0/52.0, -25.0/286.0,
+        25.0/416.0, -115.0/2288.0, -25.0/104.0, 115.0/572.0,
+        -5.0/32.0, 25.0/176.0, 5.0/8.0, -25.0/44.0,
+        27.0/44.0, -14.0/11.0, -5.0/11.0, 12.0/11.0,
+        27.0/44.0, 14.0/11.0, -5.0/11.0, -12.0/11.0,
+        -5.0/32.0, -25.0/176.0, 5.0/8.0, 25.0/44.0,
+        25.0/416.0, 115.0/2288.0, -25.0/104.0, -115.0/572.0,
+        -5.0/208.0, -25.0/1144.0, 5.0/52.0, 25.0/286.0,
+        9.0/1040.0, 51.0/5720.0, -9.0/260.0, -51.0/1430.0,
+        -11.0/4160.0, -71.0/22880.0, 11.0/1040.0, 71.0/5720.0,
+        5.0/7616.0, 475.0/544544.0, -5.0/1904.0, -475.0/136136.0,
+        -25.0/198016.0, -205.0/1089088.0, 25.0/49504.0, 205.0/272272.0,
+        5.0/284544.0, 775.0/26604864.0, -5.0/71136.0, -775.0/6651216.0,
+        -1.0/636480.0, -191.0/66512160.0, 1.0/159120.0, 191.0/16628040.0,
+        1.0/14780480.0, 1.0/7390240.0, -1.0/3695120.0, -1.0/1847560.0
+    };
+};
+
+template <>
+struct spline_coefficients<10,2>{
+    static const int nb_polys = 22;
+    static const int degree = 5;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        49.0/591219200.0, -69.0/295609600.0, -29.0/73902400.0, 49.0/36951200.0,
+        9.0/36951200.0, -29.0/18475600.0,
+        -373.0/193881600.0, 118249.0/23944377600.0, 2869.0/315057600.0, -83869.0/2993047200.0,
+        -889.0/157528800.0, 4499.0/136047600.0,
+        19385.0/901435392.0, -29405.0/589400064.0, -11465.0/112679424.0, 270665.0/957775104.0,
+        3545.0/56339712.0, -159065.0/478887552.0,
+        -75325.0/487911424.0, 6015.0/18765824.0, 3425.0/4691456.0, -55235.0/30494464.0,
+        -13725.0/30494464.0, 32275.0/15247232.0,
+        11285.0/14074368.0, -134765.0/91483392.0, -6665.0/1759296.0, 94865.0/11435424.0,
+        2045.0/879648.0, -54965.0/5717712.0,
+        -1609.0/499200.0, 1093.0/211200.0, 73.0/4800.0, -9949.0/343200.0,
+        -289.0/31200.0, 5689.0/171600.0,
+        9621.0/915200.0, -513.0/35200.0, -5661.0/114400.0, 4629.0/57200.0,
+        1701.0/57200.0, -2589.0/28600.0,
+        -245.0/8448.0, 1895.0/54912.0, 1865.0/13728.0, -1295.0/6864.0,
+        -545.0/6864.0, 695.0/3432.0,
+        7825.0/109824.0, -4085.0/54912.0, -4525.0/13728.0, 2705.0/6864.0,
+        1225.0/6864.0, -1325.0/3432.0,
+        -485.0/2816.0, 255.0/1408.0, 265.0/352.0, -155.0/176.0,
+        -45.0/176.0, 5.0/8.0,
+        278087261.0/447068160.0, -295868381.0/223534080.0, -29151581.0/55883520.0, 41852381.0/27941760.0,
+        3749981.0/27941760.0, -11370461.0/13970880.0,
+        278087261.0/447068160.0, 295868381.0/223534080.0, -29151581.0/55883520.0, -41852381.0/27941760.0,
+        3749981.0/27941760.0, 11370461.0/13970880.0,
+        -485.0/2816.0, -255.0/1408.0, 265.0/352.0, 155.0/176.0,
+        -45.0/176.0, -5.0/8.0,
+        7825.0/109824.0, 4085.0/54912.0, -4525.0/13728.0, -2705.0/6864.0,
+        1225.0/6864.0, 1325.0/3432.0,
+        -245.0/8448.0, -1895.0/54912.0, 1865.0/13728.0, 1295.0/6864.0,
+        -545.0/6864.0, -695.0/3432.0,
+        9621.0/915200.0, 513.0/35200.0, -5661.0/114400.0, -4629.0/57200.0,
+        1701.0/57200.0, 2589.0/28600.0,
+        -1609.0/499200.0, -1093.0/211200.0, 73.0/4800.0, 9949.0/343200.0,
+        -289.0/31200.0, -5689.0/171600.0,
+        11285.0/14074368.0, 134765.0/91483392.0, -6665.0/1759296.0, -94865.0/11435424.0,
+        2045.0/879648.0, 54965.0/5717712.0,
+        -75325.0/487911424.0, -6015.0/18765824.0, 3425.0/4691456.0, 55235.0/30494464.0,
+        -13725.0/30494464.0, -32275.0/15247232.0,
+        19385.0/901435392.0, 29405.0/589400064.0, -11465.0/112679424.0, -270665.0/957775104.0,
+        3545.0/56339712.0, 159065.0/478887552.0,
+        -373.0/193881600.0, -118249.0/23944377600.0, 2869.0/315057600.0, 83869.0/2993047200.0,
+        -889.0/157528800.0, -4499.0/136047600.0,
+        49.0/591219200.0, 69.0/295609600.0, -29.0/73902400.0, -49.0/36951200.0,
+        9.0/36951200.0, 29.0/18475600.0
+    };
+};
+
+template <>
+struct spline_coefficients<10,3>{
+    static const int nb_polys = 22;
+    static const int degree = 7;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        126120419.0/1501791363072000.0, -226456739.0/750895681536000.0, -50762339.0/125149280256000.0, 134164259.0/62574640128000.0,
+        9273059.0/31287320064000.0, -75740579.0/15643660032000.0, -1652579.0/23465490048000.0, 51185699.0/11732745024000.0,
+        -14006411.0/7185604608000.0, 4783541621.0/750895681536000.0, 185961323.0/19760412672000.0, -652770971.0/14440301568000.0,
+        -33896683.0/4940103168000.0, 434339453.0/4266452736000.0, 39331.0/24216192000.0, -97750271.0/1066613184000.0,
+        2566087.0/117787557888.0, -192877105.0/3003582726144.0, -9286583.0/88340668416.0, 341289035.0/750895681536.0,
+        1687663.0/22085167104.0, -191441155.0/187723920384.0, -9031.0/501935616.0, 531225.0/579394816.0,
+        -49440535.0/316166602752.0, 65022317.0/158083301376.0, 1805885.0/2395201536.0, -38213477.0/13173608448.0,
+        -513505.0/940972032.0, 1938487.0/299400192.0, 37055.0/290594304.0, -14351957.0/2470051584.0,
+        39494603.0/48641015808.0, -595031135.0/316166602752.0, -15849803.0/4053417984.0, 347852255.0/26347216896.0,
+        407069.0/144764928.0, -192602975.0/6586804224.0, -493643.0/760015872.0, 129283295.0/4940103168.0,
+        -1379083201.0/422682624000.0, 15267496501.0/2324754432000.0, 552402241.0/35223552000.0, -8852463541.0/193729536000.0,
+        -98278081.0/8805888000.0, 4842115381.0/48432384000.0, 16710721.0/6604416000.0, -294222911.0/3302208000.0,
+        1373464861.0/129153024000.0, -3544135687.0/193729536000.0, -548336221.0/10762752000.0, 2027236807.0/16144128000.0,
+        95764381.0/2690688000.0, -1086107527.0/4036032000.0, -15749341.0/2018016000.0, 720747847.0/3027024000.0,
+        -272468921.0/9299017728.0, 197648855.0/4649508864.0, 9824011.0/70447104.0, -8484275.0/29804544.0,
+        -18170681.0/193729536.0, 5164645.0/8805888.0, 2788601.0/145297152.0, -37195415.0/72648576.0,
+        1335223105.0/18598035456.0, -822581153.0/9299017728.0, -520960705.0/1549836288.0, 436194593.0/774918144.0,
+        79255105.0/387459072.0, -205604513.0/193729536.0, -918755.0/26417664.0, 130810913.0/145297152.0,
+        -22480711.0/130056192.0, 144155555.0/715309056.0, 90644621.0/119218176.0, -67104035.0/59609088.0,
+        -8512781.0/29804544.0, 2174665.0/1354752.0, 892301.0/22353408.0, -1327945.0/1016064.0,
+        278216629.0/447068160.0, -200909323.0/149022720.0, -29345633.0/55883520.0, 40076629.0/22353408.0,
+        118231.0/798336.0, -55714543.0/27941760.0, -16171.0/873180.0, 10991207.0/6985440.0,
+        278216629.0/447068160.0, 200909323.0/149022720.0, -29345633.0/55883520.0, -40076629.0/22353408.0,
+        118231.0/798336.0, 55714543.0/27941760.0, -16171.0/873180.0, -10991207.0/6985440.0,
+        -22480711.0/130056192.0, -144155555.0/715309056.0, 90644621.0/119218176.0, 67104035.0/59609088.0,
+        -8512781.0/29804544.0, -2174665.0/1354752.0, 892301.0/22353408.0, 1327945.0/1016064.0,
+        1335223105.0/18598035456.0, 822581153.0/9299017728.0, -520960705.0/1549836288.0, -436194593.0/774918144.0,
+        79255105.0/387459072.0, 205604513.0/193729536.0, -918755.0/26417664.0, -130810913.0/145297152.0,
+        -272468921.0/9299017728.0, -197648855.0/4649508864.0, 9824011.0/70447104.0, 8484275.0/29804544.0,
+        -18170681.0/193729536.0, -5164645.0/8805888.0, 2788601.0/145297152.0, 37195415.0/72648576.0,
+        1373464861.0/129153024000.0, 3544135687.0/193729536000.0, -548336221.0/10762752000.0, -2027236807.0/16144128000.0,
+        95764381.0/2690688000.0, 1086107527.0/4036032000.0, -15749341.0/2018016000.0, -720747847.0/3027024000.0,
+        -1379083201.0/422682624000.0, -15267496501.0/2324754432000.0, 552402241.0/35223552000.0, 8852463541.0/193729536000.0,
+        -98278081.0/8805888000.0, -4842115381.0/48432384000.0, 16710721.0/6604416000.0, 294222911.0/3302208000.0,
+        39494603.0/48641015808.0, 595031135.0/316166602752.0, -15849803.0/4053417984.0, -347852255.0/26347216896.0,
+        407069.0/144764928.0, 192602975.0/6586804224.0, -493643.0/760015872.0, -129283295.0/4940103168.0,
+        -49440535.0/316166602752.0, -65022317.0/158083301376.0, 1805885.0/2395201536.0, 38213477.0/13173608448.0,
+        -513505.0/940972032.0, -1938487.0/299400192.0, 37055.0/290594304.0, 14351957.0/2470051584.0,
+        2566087.0/117787557888.0, 192877105.0/3003582726144.0, -9286583.0/88340668416.0, -341289035.0/750895681536.0,
+        1687663.0/22085167104.0, 191441155.0/187723920384.0, -9031.0/501935616.0, -531225.0/579394816.0,
+        -14006411.0/7185604608000.0, -4783541621.0/750895681536000.0, 185961323.0/19760412672000.0, 652770971.0/14440301568000.0,
+        -33896683.0/4940103168000.0, -434339453.0/4266452736000.0, 39331.0/24216192000.0, 97750271.0/1066613184000.0,
+        126120419.0/1501791363072000.0, 226456739.0/750895681536000.0, -50762339.0/125149280256000.0, -134164259.0/62574640128000.0,
+        9273059.0/31287320064000.0, 75740579.0/15643660032000.0, -1652579.0/23465490048000.0, -51185699.0/11732745024000.0
+    };
+};
+
+template <>
+struct spline_coefficients<10,4>{
+    static const int nb_polys = 22;
+    static const int degree = 9;
+    static constexpr double values[nb_polys*(degree+1)] = {
+        8.401664164381721e-08, -3.5645845735519455e-07, -117313237.0/288806031360000.0, 5673182861.0/1877239203840000.0,
+        348169.0/1160939520000.0, -1054355557.0/104291066880000.0, -6242567.0/78218300160000.0, 2160112081.0/117327450240000.0,
+        2201911.0/234654900480000.0, -33637859.0/2394437760000.0,
+        -1.950070866154688e-06, 7.5228649386614185e-06, 16760386789.0/1778437140480000.0, -6.364347865439142e-05,
+        -2057668699.0/296406190080000.0, 598188301699.0/2815858805760000.0, 204397009.0/111152321280000.0, -58328147287.0/150849578880000.0,
+        -23867719.0/111152321280000.0, 311524262719.0/1055947052160000.0,
+        2218034771.0/101768450015232.0, -65517554483.0/865031825129472.0, -95652797.0/908646875136.0, 34541758763.0/54064489070592.0,
+        81943427.0/1060088020992.0, -19158123683.0/9010748178432.0, -8088155.0/397533007872.0, 13067052443.0/3379030566912.0,
+        935603.0/397533007872.0, -9968948243.0/3379030566912.0,
+        -75368875.0/481777680384.0, 2449943081.0/5058665644032.0, 477402895.0/632333205504.0, -1286352385.0/316166602752.0,
+        -58161815.0/105388867584.0, 21527353.0/1596801024.0, 145865.0/1013354496.0, -484044593.0/19760412672.0,
+        -649255.0/39520825344.0, 4795181.0/256628736.0,
+        135463357.0/166769197056.0, -16773123427.0/7587998466048.0, -285669481.0/72961523712.0, 673362829.0/36480761856.0,
+        34566823.0/12160253952.0, -4803611887.0/79041650688.0, -3334885.0/4560095232.0, 3268075957.0/29640619008.0,
+        373027.0/4560095232.0, -356053741.0/4234374144.0,
+        -165550894199.0/50721914880000.0, 2143660885199.0/278970531840000.0, 7111015967.0/452874240000.0, -1108283023769.0/17435658240000.0,
+        -5957594939.0/528353280000.0, 54735293449.0/264176640000.0, 43248593.0/15240960000.0, -408654865709.0/1089728640000.0,
+        -60910079.0/198132480000.0, 311561305079.0/1089728640000.0,
+        36637728913.0/3444080640000.0, -329691060913.0/15498362880000.0, -32936171119.0/645765120000.0, 167794414373.0/968647680000.0,
+        3866573099.0/107627520000.0, -9956056337.0/17937920000.0, -116994893.0/13453440000.0, 8653594699.0/8648640000.0,
+        35997859.0/40360320000.0, -46160205953.0/60540480000.0,
+        -13081929271.0/446352850944.0, 10911635569.0/223176425472.0, 3893729419.0/27897053184.0, -5395131229.0/13948526592.0,
+        -8969743.0/94887936.0, 253450619.0/211341312.0, 36884275.0/1743565824.0, -1870835509.0/871782912.0,
+        -3421063.0/1743565824.0, 18499877.0/11321856.0,
+        32050772375.0/446352850944.0, -22235034403.0/223176425472.0, -721746965.0/2145927168.0, 10344589405.0/13948526592.0,
+        956479115.0/4649508864.0, -4960340887.0/2324754432.0, -66055685.0/1743565824.0, 468278887.0/124540416.0,
+        5417855.0/1743565824.0, -2493086731.0/871782912.0,
+        -659481737.0/3814981632.0, 1245588401.0/5722472448.0, 77715767.0/102187008.0, -494968171.0/357654528.0,
+        -34193767.0/119218176.0, 62676407.0/19869696.0, 642415.0/14902272.0, -121558751.0/22353408.0,
+        -142643.0/44706816.0, 92343961.0/22353408.0,
+        11446727136673.0/18393661440000.0, -88039529920711.0/64377815040000.0, -4226471956711.0/8047226880000.0, 8460495604711.0/4023613440000.0,
+        18120807701.0/121927680000.0, -2583851416711.0/670602240000.0, -10015300711.0/502951680000.0, 1642385836711.0/251475840000.0,
+        700804711.0/502951680000.0, -178100340673.0/35925120000.0,
+        11446727136673.0/18393661440000.0, 88039529920711.0/64377815040000.0, -4226471956711.0/8047226880000.0, -8460495604711.0/4023613440000.0,
+        18120807701.0/121927680000.0, 2583851416711.0/670602240000.0, -10015300711.0/502951680000.0, -1642385836711.0/251475840000.0,
+        700804711.0/502951680000.0, 178100340673.0/35925120000.0,
+        -659481737.0/3814981632.0, -1245588401.0/5722472448.0, 77715767.0/102187008.0, 494968171.0/357654528.0,
+        -34193767.0/119218176.0, -62676407.0/19869696.0, 642415.0/14902272.0, 121558751.0/22353408.0,
+        -142643.0/44706816.0, -92343961.0/22353408.0,
+        32050772375.0/446352850944.0, 22235034403.0/223176425472.0, -721746965.0/2145927168.0, -10344589405.0/13948526592.0,
+        956479115.0/4649508864.0, 4960340887.0/2324754432.0, -66055685.0/1743565824.0, -468278887.0/124540416.0,
+        5417855.0/1743565824.0, 2493086731.0/871782912.0,
+        -13081929271.0/446352850944.0, -10911635569.0/223176425472.0, 3893729419.0/27897053184.0, 5395131229.0/13948526592.0,
+        -8969743.0/94887936.0, -253450619.0/211341312.0, 36884275.0/1743565824.0, 1870835509.0/871782912.0,
+        -3421063.0/1743565824.0, -18499877.0/11321856.0,
+        36637728913.0/3444080640000.0, 329691060913.0/15498362880000.0, -32936171119.0/645765120000.0, -167794414373.0/968647680000.0,
+        3866573099.0/107627520000.0, 9956056337.0/17937920000.0, -116994893.0/13453440000.0, -8653594699.0/8648640000.0,
+        35997859.0/40360320000.0, 46160205953.0/60540480000.0,
+        -165550894199.0/50721914880000.0, -2143660885199.0/278970531840000.0, 7111015967.0/452874240000.0, 1108283023769.0/17435658240000.0,
+        -5957594939.0/528353280000.0, -54735293449.0/264176640000.0, 43248593.0/15240960000.0, 408654865709.0/1089728640000.0,
+        -60910079.0/198132480000.0, -311561305079.0/1089728640000.0,
+        135463357.0/166769197056.0, 16773123427.0/7587998466048.0, -285669481.0/72961523712.0, -673362829.0/36480761856.0,
+        34566823.0/12160253952.0, 4803611887.0/79041650688.0, -3334885.0/4560095232.0, -3268075957.0/29640619008.0,
+        373027.0/4560095232.0, 356053741.0/4234374144.0,
+        -75368875.0/481777680384.0, -2449943081.0/5058665644032.0, 477402895.0/632333205504.0, 1286352385.0/316166602752.0,
+        -58161815.0/105388867584.0, -21527353.0/1596801024.0, 145865.0/1013354496.0, 484044593.0/19760412672.0,
+        -649255.0/39520825344.0, -4795181.0/256628736.0,
+        2218034771.0/101768450015232.0, 65517554483.0/865031825129472.0, -95652797.0/908646875136.0, -34541758763.0/54064489070592.0,
+        81943427.0/1060088020992.0, 19158123683.0/9010748178432.0, -8088155.0/397533007872.0, -13067052443.0/3379030566912.0,
+        935603.0/397533007872.0, 9968948243.0/3379030566912.0,
+        -1.950070866154688e-06, -7.5228649386614185e-06, 16760386789.0/1778437140480000.0, 6.364347865439142e-05,
+        -2057668699.0/296406190080000.0, -598188301699.0/2815858805760000.0, 204397009.0/111152321280000.0, 58328147287.0/150849578880000.0,
+        -23867719.0/111152321280000.0, -311524262719.0/1055947052160000.0,
+        8.401664164381721e-08, 3.5645845735519455e-07, -117313237.0/288806031360000.0, -5673182861.0/1877239203840000.0,
+        348169.0/1160939520000.0, 1054355557.0/104291066880000.0, -6242567.0/78218300160000.0, -2160112081.0/117327450240000.0,
+        2201911.0/234654900480000.0, 33637859.0/2394437760000.0
+    };
+};
+
+#endif//SPLINE_COEFFICIENTS_HPP
+
@@ -0,0 +1,136 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2017 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+#include <cassert>
+#include "spline_coefficients.hpp"
+
+#ifndef SPLINE_TABLE_HPP
+
+#define SPLINE_TABLE_HPP
+
+/** \file spline_table.hpp
+ *  \brief Table driven evaluation of the beta polynomials.
+ *
+ *  Replaces the generated `beta_*` functions of `spline_n*.cpp` and
+ *  `Lagrange_polys.cpp` where many positions are interpolated at once.
+ *  The coefficients of each derivative are computed at compile time from
+ *  `spline_coefficients` (neighbours, smoothness) or `Lagrange_coefficients`
+ *  (neighbours), and all the betas are evaluated for a batch of positions
+ *  with Horner's scheme, one position per SIMD lane.
+ */
+
+template <int... indexes>
+struct spline_table_indexes{};
+
+template <int size, int... indexes>
+struct spline_table_make_indexes : spline_table_make_indexes<size-1, size-1, indexes...>{};
+
+template <int... indexes>
+struct spline_table_make_indexes<0, indexes...>{
+    typedef spline_table_indexes<indexes...> type;
+};
+
+constexpr double spline_table_falling_factorial(const int power, const int deriv){
+    return (deriv == 0 ? 1. : power*spline_table_falling_factorial(power-1, deriv-1));
+}
+
+// Degree of the deriv-th derivative of polynomials of degree in_degree
+constexpr int spline_table_degree(const int in_degree, const int deriv){
+    return (deriv < in_degree ? in_degree-deriv : 0);
+}
+
+// Coefficient index of the deriv-th derivative of the betas of coefficients
+template <class coefficients, int deriv>
+constexpr double spline_table_coefficient(const int index){
+    return (index%(spline_table_degree(coefficients::degree, deriv)+1) + deriv <= coefficients::degree ?
+            coefficients::values[(index/(spline_table_degree(coefficients::degree, deriv)+1))*(coefficients::degree+1)
+                                 + index%(spline_table_degree(coefficients::degree, deriv)+1) + deriv]
+                * spline_table_falling_factorial(index%(spline_table_degree(coefficients::degree, deriv)+1) + deriv, deriv)
+            : 0.);
+}
+
+/** Coefficients of the deriv-th derivative of the betas of coefficients,
+ *  with the same layout as coefficients::values.
+ */
+template <class coefficients, int deriv,
+          class indexes = typename spline_table_make_indexes<
+                coefficients::nb_polys*(spline_table_degree(coefficients::degree, deriv)+1)>::type>
+struct spline_table;
+
+template <class coefficients, int deriv, int... indexes>
+struct spline_table<coefficients, deriv, spline_table_indexes<indexes...>>{
+    static const int nb_polys = coefficients::nb_polys;
+    static const int degree = spline_table_degree(coefficients::degree, deriv);
+    static constexpr double values[sizeof...(indexes)] = {spline_table_coefficient<coefficients, deriv>(indexes)...};
+};
+
+template <class coefficients, int deriv, int... indexes>
+constexpr double spline_table<coefficients, deriv, spline_table_indexes<indexes...>>::values[sizeof...(indexes)];
+
+/** Evaluates the deriv-th derivative of all the betas at nb_x positions.
+ *
+ *  x[idx_x] is the position in the cell, in [0,1); the value of beta number
+ *  idx_poly is stored in beta[idx_poly*beta_stride + idx_x].
+ */
+template <class coefficients, int deriv, class real_number>
+inline void spline_table_evaluate(const real_number* __restrict__ x, const int nb_x,
+                                  real_number* __restrict__ beta, const int beta_stride){
+    typedef spline_table<coefficients, deriv> table;
+    for(int idx_poly = 0 ; idx_poly < table::nb_polys ; ++idx_poly){
+        const double* poly_coefs = &table::values[idx_poly*(table::degree+1)];
+        real_number* __restrict__ poly_beta = &beta[idx_poly*beta_stride];
+        #pragma omp simd
+        for(int idx_x = 0 ; idx_x < nb_x ; ++idx_x){
+            const real_number shifted_x = x[idx_x] - real_number(0.5);
+            real_number value = real_number(poly_coefs[table::degree]);
+            for(int idx_power = table::degree-1 ; idx_power >= 0 ; --idx_power){
+                value = value*shifted_x + real_number(poly_coefs[idx_power]);
+            }
+            poly_beta[idx_x] = value;
+        }
+    }
+}
+
+template <class coefficients, class real_number>
+inline void spline_table_evaluate(const int deriv, const real_number* __restrict__ x, const int nb_x,
+                                  real_number* __restrict__ beta, const int beta_stride){
+    switch(deriv){
+    case 0:
+        spline_table_evaluate<coefficients, 0>(x, nb_x, beta, beta_stride);
+        break;
+    case 1:
+        spline_table_evaluate<coefficients, 1>(x, nb_x, beta, beta_stride);
+        break;
+    case 2:
+        spline_table_evaluate<coefficients, 2>(x, nb_x, beta, beta_stride);
+        break;
+    default:
+        assert(0);
+    }
+}
+
+#endif//SPLINE_TABLE_HPP
+
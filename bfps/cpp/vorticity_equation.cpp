@@ -29,6 +29,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstring>
+#include <type_traits>
 #include "fftw_tools.hpp"
 #include "vorticity_equation.hpp"
 #include "scope_timer.hpp"
@@ -141,6 +142,8 @@ vorticity_equation<rnumber, be>::vorticity_equation(
     this->cvelocity = new field<rnumber, be, THREE>(
             nx, ny, nz, MPI_COMM_WORLD, FFTW_PLAN_RIGOR);
     this->u = this->cvelocity;
+    this->batched_transforms = false;
+    this->stacked_fields = nullptr;
 
     /* initialize kspace */
     this->kk = new kspace<be, SMOOTH>(
@@ -153,6 +156,15 @@ vorticity_equation<rnumber, be>::vorticity_equation(
     this->famplitude = 1.0;
     this->fk0  = 2.0;
     this->fk1 = 4.0;
+
+    this->use_integrating_factor_tables = true;
+    this->integrating_factors_dt = 0.0;
+    this->integrating_factors_nu = 0.0;
+
+    this->mixed_precision = false;
+    this->u_lowp = nullptr;
+    this->rvorticity_lowp = nullptr;
+    this->stacked_fields_lowp = nullptr;
 }
 
 template <class rnumber,
@@ -163,9 +175,105 @@ vorticity_equation<rnumber, be>::~vorticity_equation()
     delete this->kk;
     delete this->cvorticity;
     delete this->rvorticity;
+    delete this->stacked_fields;
     delete this->v[1];
     delete this->v[2];
     delete this->cvelocity;
+    delete this->u_lowp;
+    delete this->rvorticity_lowp;
+    delete this->stacked_fields_lowp;
+}
+
+/** \brief Toggle the mixed precision mode of `omega_nonlin`.
+ *
+ *  The single precision work fields are allocated (and their FFT plans
+ *  created) the first time the mode is switched on. For single precision
+ *  solvers the call has no effect.
+ */
+template <class rnumber,
+          field_backend be>
+void vorticity_equation<rnumber, be>::set_mixed_precision(
+        const bool use_mixed_precision)
+{
+    if (std::is_same<rnumber, float>::value)
+    {
+        if (use_mixed_precision && this->kk->layout->myrank == 0)
+            std::cerr << "vorticity_equation: mixed precision only applies "
+                         "to double precision solvers, ignored." << std::endl;
+        this->mixed_precision = false;
+        return;
+    }
+    this->mixed_precision = use_mixed_precision;
+    this->update_work_fields();
+}
+
+/** \brief Toggle the batched transforms mode.
+ *
+ *  In this mode pairs of vector fields go through a single FFT, with one
+ *  MPI transpose instead of two, but the stacked fields hold one more
+ *  vector field than the separate transforms need. The work fields of the
+ *  mode that is switched off are released.
+ */
+template <class rnumber,
+          field_backend be>
+void vorticity_equation<rnumber, be>::set_batched_transforms(
+        const bool use_batched_transforms)
+{
+    this->batched_transforms = use_batched_transforms;
+    this->update_work_fields();
+}
+
+/* allocate the work fields needed by the current modes; the real space
+ * vorticity and the stacked fields are never both kept */
+template <class rnumber,
+          field_backend be>
+void vorticity_equation<rnumber, be>::update_work_fields()
+{
+    TIMEZONE("vorticity_equation::update_work_fields");
+    const hsize_t *sizes = this->u->rlayout->sizes;
+    if (this->batched_transforms)
+    {
+        delete this->rvorticity;
+        this->rvorticity = nullptr;
+        if (this->stacked_fields == nullptr)
+            this->stacked_fields = new field_batch<rnumber, be, THREE>(
+                    this->cvorticity, 2);
+    }
+    else
+    {
+        delete this->stacked_fields;
+        this->stacked_fields = nullptr;
+        if (this->rvorticity == nullptr)
+            this->rvorticity = new field<rnumber, be, THREE>(
+                    sizes[2], sizes[1], sizes[0],
+                    this->u->comm,
+                    this->u->fftw_plan_rigor);
+    }
+    if (!this->mixed_precision)
+        return;
+    if (this->u_lowp == nullptr)
+        this->u_lowp = new field<float, be, THREE>(
+                sizes[2], sizes[1], sizes[0],
+                this->u->comm,
+                this->u->fftw_plan_rigor);
+    if (this->batched_transforms)
+    {
+        delete this->rvorticity_lowp;
+        this->rvorticity_lowp = nullptr;
+        if (this->stacked_fields_lowp == nullptr)
+            this->stacked_fields_lowp = new field_batch<float, be, THREE>(
+                    this->u_lowp, 2);
+    }
+    else
+    {
+        delete this->stacked_fields_lowp;
+        this->stacked_fields_lowp = nullptr;
+        if (this->rvorticity_lowp == nullptr)
+            this->rvorticity_lowp = new field<float, be, THREE>(
+                    sizes[2], sizes[1], sizes[0],
+                    this->u->comm,
+                    this->u->fftw_plan_rigor);
+    }
 }
 
 template <class rnumber,
@@ -253,13 +361,13 @@ void vorticity_equation<rnumber, be>::add_forcing(
         ptrdiff_t cindex;
         if (this->cvorticity->clayout->myrank == this->cvorticity->clayout->rank[0][this->fmode])
         {
-            cindex = ((this->fmode - this->cvorticity->clayout->starts[0]) * this->cvorticity->clayout->sizes[1])*this->cvorticity->clayout->sizes[2];
+            cindex = ((this->fmode - this->cvorticity->clayout->starts[0]) * this->cvorticity->clayout->subsizes[1])*this->cvorticity->clayout->subsizes[2];
             dst->cval(cindex,2, 0) -= this->famplitude*factor/2;
             //dst->get_cdata()[cindex*3+2][0] -= this->famplitude*factor/2;
         }
         if (this->cvorticity->clayout->myrank == this->cvorticity->clayout->rank[0][this->cvorticity->clayout->sizes[0] - this->fmode])
         {
-            cindex = ((this->cvorticity->clayout->sizes[0] - this->fmode - this->cvorticity->clayout->starts[0]) * this->cvorticity->clayout->sizes[1])*this->cvorticity->clayout->sizes[2];
+            cindex = ((this->cvorticity->clayout->sizes[0] - this->fmode - this->cvorticity->clayout->starts[0]) * this->cvorticity->clayout->subsizes[1])*this->cvorticity->clayout->subsizes[2];
             dst->cval(cindex, 2, 0) -= this->famplitude*factor/2;
             //dst->get_cdata()[cindex*3+2][0] -= this->famplitude*factor/2;
         }
@@ -287,72 +395,246 @@ void vorticity_equation<rnumber, be>::add_forcing(
     }
 }
 
+/* put the velocity computed from the Fourier space `vorticity`, as
+ * `compute_velocity` does, in slot 0 of `uw`, and `vorticity` itself in
+ * slot 1, in a single sweep; the values are converted to the precision of
+ * `uw` */
 template <class rnumber,
+          class rnumber2,
           field_backend be>
-void vorticity_equation<rnumber, be>::omega_nonlin(
-        int src)
+static void stack_velocity_and_vorticity(
+        kspace<be, SMOOTH> *kk,
+        field<rnumber, be, THREE> *vorticity,
+        field_batch<rnumber2, be, THREE> *uw)
 {
-    DEBUG_MSG("vorticity_equation::omega_nonlin(%d)\n", src);
-    assert(src >= 0 && src < 3);
-    this->compute_velocity(this->v[src]);
-    /* get fields from Fourier space to real space */
-    this->u->ift();
-    this->rvorticity->real_space_representation = false;
-    *this->rvorticity = this->v[src]->get_cdata();
-    this->rvorticity->ift();
-    /* compute cross product $u \times \omega$, and normalize */
-    this->u->RLOOP(
+    TIMEZONE("stack_velocity_and_vorticity");
+    assert(!vorticity->real_space_representation);
+    uw->real_space_representation = false;
+    kk->CLOOP_K2(
+                [&](ptrdiff_t cindex,
+                    ptrdiff_t xindex,
+                    ptrdiff_t yindex,
+                    ptrdiff_t zindex,
+                    double k2){
+        rnumber uu[3][2];
+        if (k2 <= kk->kM2 && k2 > 0)
+        {
+            uu[0][0] = -(kk->ky[yindex]*vorticity->cval(cindex,2,1) - kk->kz[zindex]*vorticity->cval(cindex,1,1)) / k2;
+            uu[0][1] =  (kk->ky[yindex]*vorticity->cval(cindex,2,0) - kk->kz[zindex]*vorticity->cval(cindex,1,0)) / k2;
+            uu[1][0] = -(kk->kz[zindex]*vorticity->cval(cindex,0,1) - kk->kx[xindex]*vorticity->cval(cindex,2,1)) / k2;
+            uu[1][1] =  (kk->kz[zindex]*vorticity->cval(cindex,0,0) - kk->kx[xindex]*vorticity->cval(cindex,2,0)) / k2;
+            uu[2][0] = -(kk->kx[xindex]*vorticity->cval(cindex,1,1) - kk->ky[yindex]*vorticity->cval(cindex,0,1)) / k2;
+            uu[2][1] =  (kk->kx[xindex]*vorticity->cval(cindex,1,0) - kk->ky[yindex]*vorticity->cval(cindex,0,0)) / k2;
+        }
+        else
+            std::fill_n(&uu[0][0], 6, 0.0);
+        for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
+        {
+            uw->cval(cindex, 0, cc, i) = rnumber2(uu[cc][i]);
+            uw->cval(cindex, 1, cc, i) = rnumber2(vorticity->cval(cindex, cc, i));
+        }
+    }
+    );
+    uw->symmetrize(0);
+}
+
+/* compute cross product $u \times \omega$ of the real space velocity and
+ * vorticity held in slots 0 and 1 of `uw`, and store it in `result`;
+ * normalization is done in Fourier space */
+template <class rnumber,
+          field_backend be>
+static void rspace_cross_product(
+        const field_batch<rnumber, be, THREE> *uw,
+        field<rnumber, be, THREE> *result)
+{
+    assert(uw->real_space_representation);
+    result->RLOOP(
+                [&](ptrdiff_t rindex,
+                    ptrdiff_t xindex,
+                    ptrdiff_t yindex,
+                    ptrdiff_t zindex){
+        for (int cc=0; cc<3; cc++)
+            result->rval(rindex,cc) = (
+                    uw->rval(rindex,0,(cc+1)%3)*uw->rval(rindex,1,(cc+2)%3) -
+                    uw->rval(rindex,0,(cc+2)%3)*uw->rval(rindex,1,(cc+1)%3));
+    }
+    );
+    result->real_space_representation = true;
+}
+
+/* compute cross product $u \times \omega$ in place in `u`, normalization
+ * is done in Fourier space */
+template <class rnumber,
+          field_backend be>
+static void rspace_cross_product(
+        field<rnumber, be, THREE> *u,
+        const field<rnumber, be, THREE> *vorticity)
+{
+    u->RLOOP(
                 [&](ptrdiff_t rindex,
                     ptrdiff_t xindex,
                     ptrdiff_t yindex,
                     ptrdiff_t zindex){
-        //ptrdiff_t tindex = 3*rindex;
         rnumber tmp[3];
         for (int cc=0; cc<3; cc++)
-            tmp[cc] = (this->u->rval(rindex,(cc+1)%3)*this->rvorticity->rval(rindex,(cc+2)%3) -
-                       this->u->rval(rindex,(cc+2)%3)*this->rvorticity->rval(rindex,(cc+1)%3));
-            //tmp[cc][0] = (this->u->get_rdata()[tindex+(cc+1)%3]*this->rvorticity->get_rdata()[tindex+(cc+2)%3] -
-            //              this->u->get_rdata()[tindex+(cc+2)%3]*this->rvorticity->get_rdata()[tindex+(cc+1)%3]);
+            tmp[cc] = (u->rval(rindex,(cc+1)%3)*vorticity->rval(rindex,(cc+2)%3) -
+                       u->rval(rindex,(cc+2)%3)*vorticity->rval(rindex,(cc+1)%3));
         for (int cc=0; cc<3; cc++)
-            this->u->rval(rindex,cc) = tmp[cc] / this->u->npoints;
-            //this->u->get_rdata()[(3*rindex)+cc] = tmp[cc][0] / this->u->npoints;
+            u->rval(rindex,cc) = tmp[cc];
     }
     );
-    /* go back to Fourier space */
-    //this->clean_up_real_space(this->ru, 3);
-    this->u->dft();
-    this->kk->template dealias<rnumber, THREE>(this->u->get_cdata());
-    /* $\imath k \times Fourier(u \times \omega)$ */
-    this->kk->CLOOP(
+}
+
+template <class rnumber,
+          field_backend be>
+void vorticity_equation<rnumber, be>::omega_nonlin(
+        int src)
+{
+    DEBUG_MSG("vorticity_equation::omega_nonlin(%d)\n", src);
+    TIMEZONE("vorticity_equation::omega_nonlin");
+    assert(src >= 0 && src < 3);
+    if (this->batched_transforms)
+    {
+        /* velocity and vorticity are put directly in the stacked fields,
+         * and brought to real space with a single transform */
+        if (this->mixed_precision)
+        {
+            /* same operations as below, in single precision */
+            stack_velocity_and_vorticity(this->kk, this->v[src], this->stacked_fields_lowp);
+            this->stacked_fields_lowp->ift();
+            rspace_cross_product(this->stacked_fields_lowp, this->u_lowp);
+            this->u_lowp->dft();
+            this->u->copy_converted_cdata(*this->u_lowp);
+        }
+        else
+        {
+            stack_velocity_and_vorticity(this->kk, this->v[src], this->stacked_fields);
+            this->stacked_fields->ift();
+            rspace_cross_product(this->stacked_fields, this->u);
+            /* go back to Fourier space */
+            this->u->dft();
+        }
+    }
+    else
+    {
+        this->compute_velocity(this->v[src]);
+        if (this->mixed_precision)
+        {
+            /* same operations as below, in single precision */
+            this->u_lowp->copy_converted_cdata(*this->u);
+            this->rvorticity_lowp->copy_converted_cdata(*this->v[src]);
+            this->u_lowp->ift();
+            this->rvorticity_lowp->ift();
+            rspace_cross_product(this->u_lowp, this->rvorticity_lowp);
+            this->u_lowp->dft();
+            this->u->copy_converted_cdata(*this->u_lowp);
+        }
+        else
+        {
+            /* get fields from Fourier space to real space */
+            this->u->ift();
+            this->rvorticity->real_space_representation = false;
+            *this->rvorticity = this->v[src]->get_cdata();
+            this->rvorticity->ift();
+            rspace_cross_product(this->u, this->rvorticity);
+            /* go back to Fourier space */
+            //this->clean_up_real_space(this->ru, 3);
+            this->u->dft();
+        }
+    }
+    /* single sweep for normalization and dealiasing,
+     * $\imath k \times Fourier(u \times \omega)$, linear forcing and
+     * divergence free projection */
+    const bool linear_forcing = (strcmp(this->forcing_type, "linear") == 0);
+    this->kk->CLOOP_K2(
                 [&](ptrdiff_t cindex,
                     ptrdiff_t xindex,
                     ptrdiff_t yindex,
-                    ptrdiff_t zindex){
+                    ptrdiff_t zindex,
+                    double k2){
+        const double factor = this->kk->get_dealias_factor(k2) / this->u->npoints;
+        rnumber uu[3][2];
+        for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
+            uu[cc][i] = this->u->cval(cindex, cc, i)*factor;
         rnumber tmp[3][2];
         {
-            tmp[0][0] = -(this->kk->ky[yindex]*this->u->cval(cindex,2,1) - this->kk->kz[zindex]*this->u->cval(cindex,1,1));
-            tmp[1][0] = -(this->kk->kz[zindex]*this->u->cval(cindex,0,1) - this->kk->kx[xindex]*this->u->cval(cindex,2,1));
-            tmp[2][0] = -(this->kk->kx[xindex]*this->u->cval(cindex,1,1) - this->kk->ky[yindex]*this->u->cval(cindex,0,1));
-            tmp[0][1] =  (this->kk->ky[yindex]*this->u->cval(cindex,2,0) - this->kk->kz[zindex]*this->u->cval(cindex,1,0));
-            tmp[1][1] =  (this->kk->kz[zindex]*this->u->cval(cindex,0,0) - this->kk->kx[xindex]*this->u->cval(cindex,2,0));
-            tmp[2][1] =  (this->kk->kx[xindex]*this->u->cval(cindex,1,0) - this->kk->ky[yindex]*this->u->cval(cindex,0,0));
+            tmp[0][0] = -(this->kk->ky[yindex]*uu[2][1] - this->kk->kz[zindex]*uu[1][1]);
+            tmp[1][0] = -(this->kk->kz[zindex]*uu[0][1] - this->kk->kx[xindex]*uu[2][1]);
+            tmp[2][0] = -(this->kk->kx[xindex]*uu[1][1] - this->kk->ky[yindex]*uu[0][1]);
+            tmp[0][1] =  (this->kk->ky[yindex]*uu[2][0] - this->kk->kz[zindex]*uu[1][0]);
+            tmp[1][1] =  (this->kk->kz[zindex]*uu[0][0] - this->kk->kx[xindex]*uu[2][0]);
+            tmp[2][1] =  (this->kk->kx[xindex]*uu[1][0] - this->kk->ky[yindex]*uu[0][0]);
+        }
+        if (linear_forcing)
+        {
+            double knorm = sqrt(k2);
+            if ((this->fk0 <= knorm) &&
+                    (this->fk1 >= knorm))
+                for (int c=0; c<3; c++)
+                    for (int i=0; i<2; i++)
+                        tmp[c][i] += this->famplitude*this->v[src]->cval(cindex,c,i);
+        }
+        if (k2 > 0)
+        {
+            rnumber tval[2];
+            for (int i=0; i<2; i++)
+                tval[i] = (this->kk->kx[xindex]*tmp[0][i] +
+                           this->kk->ky[yindex]*tmp[1][i] +
+                           this->kk->kz[zindex]*tmp[2][i]) / k2;
+            for (int i=0; i<2; i++)
+            {
+                tmp[0][i] -= tval[i]*this->kk->kx[xindex];
+                tmp[1][i] -= tval[i]*this->kk->ky[yindex];
+                tmp[2][i] -= tval[i]*this->kk->kz[zindex];
+            }
         }
-        //ptrdiff_t tindex = 3*cindex;
-        //{
-        //    tmp[0][0] = -(this->kk->ky[yindex]*this->u->get_cdata()[tindex+2][1] - this->kk->kz[zindex]*this->u->get_cdata()[tindex+1][1]);
-        //    tmp[1][0] = -(this->kk->kz[zindex]*this->u->get_cdata()[tindex+0][1] - this->kk->kx[xindex]*this->u->get_cdata()[tindex+2][1]);
-        //    tmp[2][0] = -(this->kk->kx[xindex]*this->u->get_cdata()[tindex+1][1] - this->kk->ky[yindex]*this->u->get_cdata()[tindex+0][1]);
-        //    tmp[0][1] =  (this->kk->ky[yindex]*this->u->get_cdata()[tindex+2][0] - this->kk->kz[zindex]*this->u->get_cdata()[tindex+1][0]);
-        //    tmp[1][1] =  (this->kk->kz[zindex]*this->u->get_cdata()[tindex+0][0] - this->kk->kx[xindex]*this->u->get_cdata()[tindex+2][0]);
-        //    tmp[2][1] =  (this->kk->kx[xindex]*this->u->get_cdata()[tindex+1][0] - this->kk->ky[yindex]*this->u->get_cdata()[tindex+0][0]);
-        //}
         for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
             this->u->cval(cindex, cc, i) = tmp[cc][i];
             //this->u->get_cdata()[3*cindex+cc][i] = tmp[cc][i];
     }
     );
-    this->add_forcing(this->u, this->v[src], 1.0);
-    this->kk->template force_divfree<rnumber>(this->u->get_cdata());
+    /* Kolmogorov forcing only touches a mode with k parallel to y, and it
+     * forces the z component, so the projection above does not affect it */
+    if (!linear_forcing)
+        this->add_forcing(this->u, this->v[src], 1.0);
+    if (this->kk->layout->myrank == this->kk->layout->rank[0][0])
+        std::fill_n((rnumber*)(this->u->get_cdata()), 6, 0.0);
+}
+
+/** \brief Tabulate the integrating factors for the current `dt` and `nu`.
+ *
+ *  The tables are indexed by the k2 shell of `kk`, and only rebuilt when
+ *  `dt` or `nu` differ from the values used for the existing tables.
+ */
+template <class rnumber,
+          field_backend be>
+void vorticity_equation<rnumber, be>::update_integrating_factors(double dt)
+{
+    if (!this->use_integrating_factor_tables || this->kk->nk2shells == 0)
+    {
+        for (int tt=0; tt<3; tt++)
+            this->integrating_factor[tt].clear();
+        return;
+    }
+    if (int(this->integrating_factor[0].size()) == this->kk->nk2shells &&
+        this->integrating_factors_dt == dt &&
+        this->integrating_factors_nu == this->nu)
+        return;
+    TIMEZONE("vorticity_equation::update_integrating_factors");
+    for (int tt=0; tt<3; tt++)
+        this->integrating_factor[tt].resize(this->kk->nk2shells);
+    /* same expressions as in the per mode code, so that the values are
+     * identical when k2 is a multiple of dk2 */
+    #pragma omp parallel for schedule(static)
+    for (int k2shell = 0; k2shell < this->kk->nk2shells; k2shell++)
+    {
+        const double k2 = k2shell*this->kk->dk2;
+        this->integrating_factor[0][k2shell] = exp(-this->nu * k2 * dt);
+        this->integrating_factor[1][k2shell] = exp(-this->nu * k2 * dt/2);
+        this->integrating_factor[2][k2shell] = exp( this->nu * k2 * dt/2);
+    }
+    this->integrating_factors_dt = dt;
+    this->integrating_factors_nu = this->nu;
 }
 
 template <class rnumber,
@@ -361,6 +643,11 @@ void vorticity_equation<rnumber, be>::step(double dt)
 {
     DEBUG_MSG("vorticity_equation::step\n");
     TIMEZONE("vorticity_equation::step");
+    this->update_integrating_factors(dt);
+    const bool tabulated = (this->integrating_factor[0].size() > 0);
+    const double *__restrict__ factor_dt = this->integrating_factor[0].data();
+    const double *__restrict__ factor_mhdt = this->integrating_factor[1].data();
+    const double *__restrict__ factor_phdt = this->integrating_factor[2].data();
     *this->v[1] = 0.0;
     this->omega_nonlin(0);
     this->kk->CLOOP_K2(
@@ -371,8 +658,9 @@ void vorticity_equation<rnumber, be>::step(double dt)
                     double k2){
         if (k2 <= this->kk->kM2)
         {
-            double factor0;
-            factor0 = exp(-this->nu * k2 * dt);
+            const double factor0 = (tabulated ?
+                    factor_dt[this->kk->get_k2shell(k2)] :
+                    exp(-this->nu * k2 * dt));
             for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
                 this->v[1]->cval(cindex,cc,i) = (
                         this->v[0]->cval(cindex,cc,i) +
@@ -394,8 +682,17 @@ void vorticity_equation<rnumber, be>::step(double dt)
         if (k2 <= this->kk->kM2)
         {
             double factor0, factor1;
-            factor0 = exp(-this->nu * k2 * dt/2);
-            factor1 = exp( this->nu * k2 * dt/2);
+            if (tabulated)
+            {
+                const int k2shell = this->kk->get_k2shell(k2);
+                factor0 = factor_mhdt[k2shell];
+                factor1 = factor_phdt[k2shell];
+            }
+            else
+            {
+                factor0 = exp(-this->nu * k2 * dt/2);
+                factor1 = exp( this->nu * k2 * dt/2);
+            }
             for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
                 this->v[2]->cval(cindex, cc, i) = (
                         3*this->v[0]->cval(cindex,cc,i)*factor0 +
@@ -418,8 +715,9 @@ void vorticity_equation<rnumber, be>::step(double dt)
                     double k2){
         if (k2 <= this->kk->kM2)
         {
-            double factor0;
-            factor0 = exp(-this->nu * k2 * dt * 0.5);
+            const double factor0 = (tabulated ?
+                    factor_mhdt[this->kk->get_k2shell(k2)] :
+                    exp(-this->nu * k2 * dt * 0.5));
             for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
                 this->v[3]->cval(cindex,cc,i) = (
                         this->v[0]->cval(cindex,cc,i)*factor0 +
@@ -438,29 +736,86 @@ void vorticity_equation<rnumber, be>::step(double dt)
     this->iteration++;
 }
 
+/* products of the components of the real space `velocity`, diagonal terms
+ * 11 22 33 and off-diagonal terms 12 23 31, brought to Fourier space either
+ * together in slots 0 and 1 of the stacked fields, or separately in v[1]
+ * and v[2]; read them with `get_velocity_products`. Normalization is left
+ * to the caller */
+template <class rnumber,
+          field_backend be>
+void vorticity_equation<rnumber, be>::transform_velocity_products(
+        field<rnumber, be, THREE> *velocity)
+{
+    assert(velocity->real_space_representation);
+    if (this->batched_transforms)
+    {
+        this->stacked_fields->real_space_representation = true;
+        velocity->RLOOP (
+                    [&](ptrdiff_t rindex,
+                        ptrdiff_t xindex,
+                        ptrdiff_t yindex,
+                        ptrdiff_t zindex){
+            for (int cc=0; cc<3; cc++)
+            {
+                this->stacked_fields->rval(rindex,0,cc) = velocity->rval(rindex,cc)*velocity->rval(rindex,cc);
+                this->stacked_fields->rval(rindex,1,cc) = velocity->rval(rindex,cc)*velocity->rval(rindex,(cc+1)%3);
+            }
+        }
+        );
+        this->stacked_fields->dft();
+    }
+    else
+    {
+        this->v[1]->real_space_representation = true;
+        this->v[2]->real_space_representation = true;
+        velocity->RLOOP (
+                    [&](ptrdiff_t rindex,
+                        ptrdiff_t xindex,
+                        ptrdiff_t yindex,
+                        ptrdiff_t zindex){
+            for (int cc=0; cc<3; cc++)
+            {
+                this->v[1]->rval(rindex,cc) = velocity->rval(rindex,cc)*velocity->rval(rindex,cc);
+                this->v[2]->rval(rindex,cc) = velocity->rval(rindex,cc)*velocity->rval(rindex,(cc+1)%3);
+            }
+        }
+        );
+        this->v[1]->dft();
+        this->v[2]->dft();
+    }
+}
+
+/* pressure mode $-k_i k_j \widehat{u_i u_j} / k^2$ from the transformed
+ * velocity products, times `factor` which includes the $1/k^2$ */
+template <class rnumber,
+          field_backend be>
+static inline void get_pressure_mode(
+        const kspace<be, SMOOTH> *kk,
+        const rnumber diag[3][2],
+        const rnumber offdiag[3][2],
+        const ptrdiff_t xindex,
+        const ptrdiff_t yindex,
+        const ptrdiff_t zindex,
+        const double factor,
+        rnumber pressure[2])
+{
+    for (int i=0; i<2; i++)
+        pressure[i] = factor*(
+            -(kk->kx[xindex]*kk->kx[xindex]*diag[0][i] +
+              kk->ky[yindex]*kk->ky[yindex]*diag[1][i] +
+              kk->kz[zindex]*kk->kz[zindex]*diag[2][i])
+            - 2*(kk->kx[xindex]*kk->ky[yindex]*offdiag[0][i] +
+                 kk->ky[yindex]*kk->kz[zindex]*offdiag[1][i] +
+                 kk->kz[zindex]*kk->kx[xindex]*offdiag[2][i]));
+}
+
 template <class rnumber,
           field_backend be>
 void vorticity_equation<rnumber, be>::compute_pressure(field<rnumber, be, ONE> *pressure)
 {
     TIMEZONE("vorticity_equation::compute_pressure");
     /* assume velocity is already in real space representation */
-
-    this->v[1]->real_space_representation = true;
-    /* diagonal terms 11 22 33 */
-    this->v[1]->RLOOP (
-                [&](ptrdiff_t rindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex){
-        //ptrdiff_t tindex = 3*rindex;
-        for (int cc=0; cc<3; cc++)
-            this->v[1]->rval(rindex,cc) = this->u->rval(rindex,cc)*this->u->rval(rindex,cc);
-            //this->v[1]->get_rdata()[tindex+cc] = this->u->get_rdata()[tindex+cc]*this->u->get_rdata()[tindex+cc];
-        }
-        );
-    //this->clean_up_real_space(this->rv[1], 3);
-    this->v[1]->dft();
-    this->kk->template dealias<rnumber, THREE>(this->v[1]->get_cdata());
+    this->transform_velocity_products(this->u);
     this->kk->CLOOP_K2(
                 [&](ptrdiff_t cindex,
                     ptrdiff_t xindex,
@@ -469,111 +824,112 @@ void vorticity_equation<rnumber, be>::compute_pressure(field<rnumber, be, ONE> *
                     double k2){
         if (k2 <= this->kk->kM2 && k2 > 0)
         {
-            ptrdiff_t tindex = 3*cindex;
-            for (int i=0; i<2; i++)
-            {
-                pressure->get_cdata()[cindex][i] = \
-                    -(this->kk->kx[xindex]*this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+0][i] +
-                      this->kk->ky[yindex]*this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+1][i] +
-                      this->kk->kz[zindex]*this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+2][i]);
-            }
+            rnumber diag[3][2], offdiag[3][2];
+            this->get_velocity_products(cindex, diag, offdiag);
+            get_pressure_mode(
+                    this->kk, diag, offdiag,
+                    xindex, yindex, zindex,
+                    this->kk->get_dealias_factor(k2) / (pressure->npoints*k2),
+                    (rnumber*)(pressure->get_cdata()+cindex));
         }
         else
             std::fill_n((rnumber*)(pressure->get_cdata()+cindex), 2, 0.0);
     }
     );
-    /* off-diagonal terms 12 23 31 */
-    this->v[1]->real_space_representation = true;
-    this->v[1]->RLOOP (
-                [&](ptrdiff_t rindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex){
-        //ptrdiff_t tindex = 3*rindex;
-        for (int cc=0; cc<3; cc++)
-            this->v[1]->rval(rindex,cc) = this->u->rval(rindex,cc)*this->u->rval(rindex,(cc+1)%3);
-            //this->v[1]->get_rdata()[tindex+cc] = this->u->get_rdata()[tindex+cc]*this->u->get_rdata()[tindex+(cc+1)%3];
-    }
-    );
-    //this->clean_up_real_space(this->rv[1], 3);
-    this->v[1]->dft();
-    this->kk->template dealias<rnumber, THREE>(this->v[1]->get_cdata());
+}
+
+/* linear terms of the acceleration, $-\nu k^2 \hat{u}$ plus the linear
+ * forcing if `linear_forcing`, from the Fourier space velocity; modes
+ * outside the kM2 sphere are set to 0.
+ * The forcing type is resolved by the caller, once per call. */
+template <class rnumber,
+          field_backend be>
+template <bool linear_forcing>
+void vorticity_equation<rnumber, be>::set_linear_acceleration_terms(
+        field<rnumber, be, THREE> *acceleration)
+{
+    acceleration->real_space_representation = false;
     this->kk->CLOOP_K2(
                 [&](ptrdiff_t cindex,
                     ptrdiff_t xindex,
                     ptrdiff_t yindex,
                     ptrdiff_t zindex,
                     double k2){
-        if (k2 <= this->kk->kM2 && k2 > 0)
+        if (k2 <= this->kk->kM2)
         {
-            ptrdiff_t tindex = 3*cindex;
-            for (int i=0; i<2; i++)
+            double factor = - this->nu*k2;
+            if (linear_forcing)
             {
-                pressure->get_cdata()[cindex][i] -= \
-                    2*(this->kk->kx[xindex]*this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+0][i] +
-                       this->kk->ky[yindex]*this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+1][i] +
-                       this->kk->kz[zindex]*this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+2][i]);
-                pressure->get_cdata()[cindex][i] /= pressure->npoints*k2;
+                double knorm = sqrt(k2);
+                if ((this->fk0 <= knorm) &&
+                        (this->fk1 >= knorm))
+                    factor += this->famplitude;
             }
+            for (int cc=0; cc<3; cc++)
+                for (int i=0; i<2; i++)
+                    acceleration->cval(cindex,cc,i) = factor*this->cvelocity->cval(cindex,cc,i);
         }
+        else
+            std::fill_n((rnumber*)(acceleration->get_cdata()+3*cindex), 6, 0.0);
     }
     );
 }
 
+template <class rnumber,
+          field_backend be>
+void vorticity_equation<rnumber, be>::compute_linear_acceleration_terms(
+        field<rnumber, be, THREE> *acceleration)
+{
+    if (strcmp(this->forcing_type, "linear") == 0)
+        this->template set_linear_acceleration_terms<true>(acceleration);
+    else
+        this->template set_linear_acceleration_terms<false>(acceleration);
+}
+
 
 /** \brief Compute Lagrangian acceleration.
  *
  *  Acceleration is put in `acceleration` in the Fourier space representation.
+ *  The velocity is computed once: the linear terms are taken from its Fourier
+ *  representation, then the pressure gradient from its real space
+ *  representation, which `cvelocity` holds on return. The pressure itself
+ *  is never stored, only the stacked fields, or v[1] and v[2], are used as
+ *  scratch space.
  */
 template <class rnumber,
           field_backend be>
 void vorticity_equation<rnumber, be>::compute_Lagrangian_acceleration(
         field<rnumber, be, THREE> *acceleration)
 {
-    field<rnumber, be, ONE> *pressure = new field<rnumber, be, ONE>(
-            this->cvelocity->rlayout->sizes[2],
-            this->cvelocity->rlayout->sizes[1],
-            this->cvelocity->rlayout->sizes[0],
-            this->cvelocity->rlayout->comm,
-            this->cvelocity->fftw_plan_rigor);
+    TIMEZONE("vorticity_equation::compute_Lagrangian_acceleration");
     this->compute_velocity(this->cvorticity);
+    this->compute_linear_acceleration_terms(acceleration);
     this->cvelocity->ift();
-    this->compute_pressure(pressure);
-    this->compute_velocity(this->cvorticity);
-    acceleration->real_space_representation = false;
-    *acceleration = 0.0;
+    this->transform_velocity_products(this->cvelocity);
+    /* subtract the pressure gradient, $-\imath k p$ */
     this->kk->CLOOP_K2(
                 [&](ptrdiff_t cindex,
                     ptrdiff_t xindex,
                     ptrdiff_t yindex,
                     ptrdiff_t zindex,
                     double k2){
-        if (k2 <= this->kk->kM2)
+        if (k2 <= this->kk->kM2 && k2 > 0)
         {
-            ptrdiff_t tindex = 3*cindex;
-            for (int cc=0; cc<3; cc++)
-                for (int i=0; i<2; i++)
-                    acceleration->get_cdata()[tindex+cc][i] = \
-                        - this->nu*k2*this->cvelocity->get_cdata()[tindex+cc][i];
-            if (strcmp(this->forcing_type, "linear") == 0)
-            {
-                double knorm = sqrt(k2);
-                if ((this->fk0 <= knorm) &&
-                        (this->fk1 >= knorm))
-                    for (int c=0; c<3; c++)
-                        for (int i=0; i<2; i++)
-                            acceleration->get_cdata()[tindex+c][i] += \
-                                this->famplitude*this->cvelocity->get_cdata()[tindex+c][i];
-            }
-            acceleration->get_cdata()[tindex+0][0] += this->kk->kx[xindex]*pressure->get_cdata()[cindex][1];
-            acceleration->get_cdata()[tindex+1][0] += this->kk->ky[yindex]*pressure->get_cdata()[cindex][1];
-            acceleration->get_cdata()[tindex+2][0] += this->kk->kz[zindex]*pressure->get_cdata()[cindex][1];
-            acceleration->get_cdata()[tindex+0][1] -= this->kk->kx[xindex]*pressure->get_cdata()[cindex][0];
-            acceleration->get_cdata()[tindex+1][1] -= this->kk->ky[yindex]*pressure->get_cdata()[cindex][0];
-            acceleration->get_cdata()[tindex+2][1] -= this->kk->kz[zindex]*pressure->get_cdata()[cindex][0];
+            rnumber diag[3][2], offdiag[3][2], pressure[2];
+            this->get_velocity_products(cindex, diag, offdiag);
+            get_pressure_mode(
+                    this->kk, diag, offdiag,
+                    xindex, yindex, zindex,
+                    this->kk->get_dealias_factor(k2) / (this->cvelocity->npoints*k2),
+                    pressure);
+            acceleration->cval(cindex,0,0) += this->kk->kx[xindex]*pressure[1];
+            acceleration->cval(cindex,1,0) += this->kk->ky[yindex]*pressure[1];
+            acceleration->cval(cindex,2,0) += this->kk->kz[zindex]*pressure[1];
+            acceleration->cval(cindex,0,1) -= this->kk->kx[xindex]*pressure[0];
+            acceleration->cval(cindex,1,1) -= this->kk->ky[yindex]*pressure[0];
+            acceleration->cval(cindex,2,1) -= this->kk->kz[zindex]*pressure[0];
         }
         });
-    delete pressure;
 }
 
 template <class rnumber,
@@ -581,95 +937,13 @@ template <class rnumber,
 void vorticity_equation<rnumber, be>::compute_Eulerian_acceleration(
         field<rnumber, be, THREE> *acceleration)
 {
+    TIMEZONE("vorticity_equation::compute_Eulerian_acceleration");
     this->compute_velocity(this->cvorticity);
-    acceleration->real_space_representation = false;
     /* put in linear terms */
-    this->kk->CLOOP_K2(
-                [&](ptrdiff_t cindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex,
-                    double k2){
-        if (k2 <= this->kk->kM2)
-        {
-            ptrdiff_t tindex = 3*cindex;
-            for (int cc=0; cc<3; cc++)
-                for (int i=0; i<2; i++)
-                    acceleration->get_cdata()[tindex+cc][i] = \
-                        - this->nu*k2*this->cvelocity->get_cdata()[tindex+cc][i];
-            if (strcmp(this->forcing_type, "linear") == 0)
-            {
-                double knorm = sqrt(k2);
-                if ((this->fk0 <= knorm) &&
-                        (this->fk1 >= knorm))
-                {
-                    for (int c=0; c<3; c++)
-                        for (int i=0; i<2; i++)
-                            acceleration->get_cdata()[tindex+c][i] += \
-                                this->famplitude*this->cvelocity->get_cdata()[tindex+c][i];
-                }
-            }
-        }
-    }
-    );
+    this->compute_linear_acceleration_terms(acceleration);
     this->cvelocity->ift();
     /* compute uu */
-    /* 11 22 33 */
-    this->v[1]->real_space_representation = true;
-    this->cvelocity->RLOOP (
-                [&](ptrdiff_t rindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex){
-        //ptrdiff_t tindex = 3*rindex;
-        for (int cc=0; cc<3; cc++)
-            this->v[1]->rval(rindex,cc) = \
-                this->cvelocity->rval(rindex,cc)*this->cvelocity->rval(rindex,cc) / this->cvelocity->npoints;
-            //this->v[1]->get_rdata()[tindex+cc] = this->cvelocity->get_rdata()[tindex+cc]*this->cvelocity->get_rdata()[tindex+cc] / this->cvelocity->npoints;
-    }
-    );
-    this->v[1]->dft();
-    this->kk->template dealias<rnumber, THREE>(this->v[1]->get_cdata());
-    this->kk->CLOOP_K2(
-                [&](ptrdiff_t cindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex,
-                    double k2){
-        if (k2 <= this->kk->kM2)
-        {
-            ptrdiff_t tindex = 3*cindex;
-            acceleration->get_cdata()[tindex+0][0] +=
-                    this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+0][1];
-            acceleration->get_cdata()[tindex+0][1] +=
-                   -this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+0][0];
-            acceleration->get_cdata()[tindex+1][0] +=
-                    this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+1][1];
-            acceleration->get_cdata()[tindex+1][1] +=
-                   -this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+1][0];
-            acceleration->get_cdata()[tindex+2][0] +=
-                    this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+2][1];
-            acceleration->get_cdata()[tindex+2][1] +=
-                   -this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+2][0];
-        }
-    }
-    );
-    /* 12 23 31 */
-    this->v[1]->real_space_representation = true;
-    this->cvelocity->RLOOP (
-                [&](ptrdiff_t rindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex){
-        //ptrdiff_t tindex = 3*rindex;
-        for (int cc=0; cc<3; cc++)
-            this->v[1]->rval(rindex,cc) = \
-                this->cvelocity->rval(rindex,cc)*this->cvelocity->rval(rindex,(cc+1)%3) / this->cvelocity->npoints;
-            //this->v[1]->get_rdata()[tindex+cc] = this->cvelocity->get_rdata()[tindex+cc]*this->cvelocity->get_rdata()[tindex+(cc+1)%3] / this->cvelocity->npoints;
-    }
-    );
-    this->v[1]->dft();
-    this->kk->template dealias<rnumber, THREE>(this->v[1]->get_cdata());
+    this->transform_velocity_products(this->cvelocity);
     this->kk->CLOOP_K2(
                 [&](ptrdiff_t cindex,
                     ptrdiff_t xindex,
@@ -679,24 +953,38 @@ void vorticity_equation<rnumber, be>::compute_Eulerian_acceleration(
         if (k2 <= this->kk->kM2)
         {
             ptrdiff_t tindex = 3*cindex;
+            const double factor = this->kk->get_dealias_factor(k2) / this->cvelocity->npoints;
+            rnumber diag[3][2], offdiag[3][2];
+            this->get_velocity_products(cindex, diag, offdiag);
+            for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
+            {
+                diag[cc][i] *= factor;
+                offdiag[cc][i] *= factor;
+            }
             acceleration->get_cdata()[tindex+0][0] +=
-                    (this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+0][1] +
-                     this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+2][1]);
+                    (this->kk->kx[xindex]*diag[0][1] +
+                     this->kk->ky[yindex]*offdiag[0][1] +
+                     this->kk->kz[zindex]*offdiag[2][1]);
             acceleration->get_cdata()[tindex+0][1] +=
-                  - (this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+0][0] +
-                     this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+2][0]);
+                  - (this->kk->kx[xindex]*diag[0][0] +
+                     this->kk->ky[yindex]*offdiag[0][0] +
+                     this->kk->kz[zindex]*offdiag[2][0]);
             acceleration->get_cdata()[tindex+1][0] +=
-                    (this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+1][1] +
-                     this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+0][1]);
+                    (this->kk->ky[yindex]*diag[1][1] +
+                     this->kk->kz[zindex]*offdiag[1][1] +
+                     this->kk->kx[xindex]*offdiag[0][1]);
             acceleration->get_cdata()[tindex+1][1] +=
-                  - (this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+1][0] +
-                     this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+0][0]);
+                  - (this->kk->ky[yindex]*diag[1][0] +
+                     this->kk->kz[zindex]*offdiag[1][0] +
+                     this->kk->kx[xindex]*offdiag[0][0]);
             acceleration->get_cdata()[tindex+2][0] +=
-                    (this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+2][1] +
-                     this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+1][1]);
+                    (this->kk->kz[zindex]*diag[2][1] +
+                     this->kk->kx[xindex]*offdiag[2][1] +
+                     this->kk->ky[yindex]*offdiag[1][1]);
             acceleration->get_cdata()[tindex+2][1] +=
-                  - (this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+2][0] +
-                     this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+1][0]);
+                  - (this->kk->kz[zindex]*diag[2][0] +
+                     this->kk->kx[xindex]*offdiag[2][0] +
+                     this->kk->ky[yindex]*offdiag[1][0]);
         }
     }
     );
@@ -715,5 +1003,7 @@ void vorticity_equation<rnumber, be>::compute_Eulerian_acceleration(
 /* finally, force generation of code for single precision                    */
 template class vorticity_equation<float, FFTW>;
 template class vorticity_equation<double, FFTW>;
+template class vorticity_equation<float, PENCIL>;
+template class vorticity_equation<double, PENCIL>;
 /*****************************************************************************/
 
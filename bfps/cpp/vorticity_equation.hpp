@@ -26,8 +26,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <iostream>
+#include <vector>
 
 #include "field.hpp"
+#include "field_batch.hpp"
 #include "field_descriptor.hpp"
 
 #ifndef VORTICITY_EQUATION
@@ -61,6 +63,14 @@ class vorticity_equation
         field<rnumber, be, THREE> *rvorticity;
         kspace<be, SMOOTH> *kk;
 
+        /* batched transforms mode: two vector fields transformed with a
+         * single MPI transpose, velocity and vorticity in omega_nonlin, and
+         * the products of velocity components in compute_pressure and the
+         * accelerations. The stacked fields replace rvorticity, so the mode
+         * costs one more vector field; see `set_batched_transforms`. */
+        bool batched_transforms;
+        field_batch<rnumber, be, THREE> *stacked_fields;
+
 
         /* short names for velocity, and 4 vorticity fields */
         field<rnumber, be, THREE> *u, *v[4];
@@ -72,6 +82,23 @@ class vorticity_equation
         double fk0, fk1;   // for band forcing
         char forcing_type[128];
 
+        /* integrating factors exp(-nu k2 dt), exp(-nu k2 dt/2) and
+         * exp(nu k2 dt/2), tabulated per k2 shell for the (dt, nu) pair used
+         * in the last call of step. They are empty if kk has no shell
+         * tables, or if use_integrating_factor_tables is false. */
+        bool use_integrating_factor_tables;
+        double integrating_factors_dt, integrating_factors_nu;
+        std::vector<double> integrating_factor[3];
+
+        /* mixed precision mode: the FFTs and the real space cross product of
+         * omega_nonlin are computed in single precision, in the work fields
+         * below, while the Fourier space state, the time stepping and
+         * the statistics stay in rnumber. Only available for double
+         * precision solvers, see `set_mixed_precision`. */
+        bool mixed_precision;
+        field<float, be, THREE> *u_lowp, *rvorticity_lowp;
+        field_batch<float, be, THREE> *stacked_fields_lowp;
+
         /* constructor, destructor */
         vorticity_equation(
                 const char *NAME,
@@ -87,6 +114,9 @@ class vorticity_equation
         /* solver essential methods */
         void omega_nonlin(int src);
         void step(double dt);
+        void update_integrating_factors(double dt);
+        void set_mixed_precision(const bool use_mixed_precision);
+        void set_batched_transforms(const bool use_batched_transforms);
         void impose_zero_modes(void);
         void add_forcing(field<rnumber, be, THREE> *dst,
                          field<rnumber, be, THREE> *src_vorticity,
@@ -127,10 +157,50 @@ class vorticity_equation
             }
         }
 
+        /* write the current checkpoint in the background, see `field::io_async` */
+        inline void write_checkpoint_async(async_file_writer &writer)
+        {
+            assert(!this->cvorticity->real_space_representation);
+            this->update_checkpoint();
+            this->cvorticity->io_async(
+                    this->get_current_fname(),
+                    "vorticity",
+                    this->iteration,
+                    writer);
+        }
+
         /* statistics and general postprocessing */
         void compute_pressure(field<rnumber, be, ONE> *pressure);
         void compute_Eulerian_acceleration(field<rnumber, be, THREE> *acceleration);
         void compute_Lagrangian_acceleration(field<rnumber, be, THREE> *acceleration);
+
+    private:
+        void update_work_fields(void);
+
+        /* helpers of the statistics, the stacked fields or v[1] and v[2]
+         * are the only scratch space they use */
+        void transform_velocity_products(field<rnumber, be, THREE> *velocity);
+        inline void get_velocity_products(
+                const ptrdiff_t cindex,
+                rnumber diag[3][2],
+                rnumber offdiag[3][2])
+        {
+            if (this->batched_transforms)
+                for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
+                {
+                    diag[cc][i] = this->stacked_fields->cval(cindex,0,cc,i);
+                    offdiag[cc][i] = this->stacked_fields->cval(cindex,1,cc,i);
+                }
+            else
+                for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
+                {
+                    diag[cc][i] = this->v[1]->cval(cindex,cc,i);
+                    offdiag[cc][i] = this->v[2]->cval(cindex,cc,i);
+                }
+        }
+        template <bool linear_forcing>
+        void set_linear_acceleration_terms(field<rnumber, be, THREE> *acceleration);
+        void compute_linear_acceleration_terms(field<rnumber, be, THREE> *acceleration);
 };
 
 #endif//VORTICITY_EQUATION
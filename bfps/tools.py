@@ -30,6 +30,49 @@ import numpy as np
 
 import h5py
 
+default_quantile_levels = np.array(
+        [1e-4, 1e-3, 1e-2, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999, 0.9999])
+
+def create_rspace_stats_extra_datasets(
+        group,
+        quantity,
+        histogram_bins,
+        value_shape,
+        quantile_levels = default_quantile_levels,
+        with_quantiles = True):
+    """Datasets for the actual histogram bin edges and the quantiles of
+    `quantity`, filled in by `field::compute_rspace_stats` (C++) next to the
+    "histograms" and "moments" datasets in `group`.
+    Bin edges have shape (time, histogram_bins + 1) + value_shape,
+    quantiles have shape (time, len(quantile_levels)) + value_shape, and
+    the levels are stored in their "levels" attribute.
+    """
+    value_shape = tuple(value_shape)
+    nvalues = int(np.prod(value_shape))
+    group.require_group('bin_edges')
+    if quantity not in group['bin_edges'].keys():
+        time_chunk = max(2**20 // (8*(histogram_bins+1)*nvalues), 1)
+        group['bin_edges'].create_dataset(
+                quantity,
+                (1, histogram_bins+1) + value_shape,
+                chunks = (time_chunk, histogram_bins+1) + value_shape,
+                maxshape = (None, histogram_bins+1) + value_shape,
+                dtype = np.float64)
+    if not with_quantiles:
+        return None
+    group.require_group('quantiles')
+    if quantity not in group['quantiles'].keys():
+        nlevels = len(quantile_levels)
+        time_chunk = max(2**20 // (8*nlevels*nvalues), 1)
+        dset = group['quantiles'].create_dataset(
+                quantity,
+                (1, nlevels) + value_shape,
+                chunks = (time_chunk, nlevels) + value_shape,
+                maxshape = (None, nlevels) + value_shape,
+                dtype = np.float64)
+        dset.attrs['levels'] = np.array(quantile_levels, dtype = np.float64)
+    return None
+
 def create_alloc_early_dataset(
         data_file,
         dset_name,
@@ -91,6 +91,16 @@ print('This is bfps version ' + VERSION)
 src_file_list = ['full_code/joint_acc_vel_stats',
                  'full_code/test',
                  'full_code/filter_test',
+                 'full_code/particles_interpolation_benchmark',
+                 'full_code/vorticity_equation_step_benchmark',
+                 'full_code/vorticity_equation_scaling_benchmark',
+                 'full_code/vorticity_equation_mixed_precision_test',
+                 'full_code/particles_redistribute_test',
+                 'full_code/field_io_benchmark',
+                 'full_code/shared_array_merge_benchmark',
+                 'full_code/particles_memory_test',
+                 'full_code/spline_table_test',
+                 'full_code/kspace_test',
                  'hdf5_tools',
                  'full_code/get_rfields',
                  'full_code/NSVE_field_stats',
@@ -102,6 +112,10 @@ src_file_list = ['full_code/joint_acc_vel_stats',
                  'field_binary_IO',
                  'vorticity_equation',
                  'field',
+                 'field_pool',
+                 'field_batch',
+                 'pencil_fft',
+                 'async_file_writer',
                  'kspace',
                  'field_layout',
                  'field_descriptor',
@@ -115,6 +129,7 @@ src_file_list = ['full_code/joint_acc_vel_stats',
                  'fluid_solver',
                  'fluid_solver_base',
                  'fftw_tools',
+                 'fftw_wisdom',
                  'spline_n1',
                  'spline_n2',
                  'spline_n3',
@@ -126,6 +141,7 @@ src_file_list = ['full_code/joint_acc_vel_stats',
                  'spline_n9',
                  'spline_n10',
                  'Lagrange_polys',
+                 'spline_coefficients',
                  'scope_timer',
                  'full_code/NSVEparticles']
 
@@ -135,8 +151,11 @@ particle_headers = [
         'cpp/particles/abstract_particles_output.hpp',
         'cpp/particles/abstract_particles_system.hpp',
         'cpp/particles/alltoall_exchanger.hpp',
+        'cpp/particles/particles_buffer_arena.hpp',
         'cpp/particles/particles_adams_bashforth.hpp',
         'cpp/particles/particles_field_computer.hpp',
+        'cpp/particles/particles_field_set.hpp',
+        'cpp/particles/particles_field_halo.hpp',
         'cpp/particles/particles_input_hdf5.hpp',
         'cpp/particles/particles_generic_interp.hpp',
         'cpp/particles/particles_output_hdf5.hpp',
@@ -158,7 +177,9 @@ header_list = (['cpp/base.hpp'] +
                ['cpp/bfps_timer.hpp'] +
                ['cpp/omputils.hpp'] +
                ['cpp/shared_array.hpp'] +
+               ['cpp/quantile_sketch.hpp'] +
                ['cpp/spline.hpp'] +
+               ['cpp/spline_table.hpp'] +
                ['cpp/' + fname + '.hpp'
                 for fname in src_file_list] +
                particle_headers +
@@ -181,16 +202,19 @@ class CompileLibCommand(distutils.cmd.Command):
     description = 'Compile bfps library.'
     user_options = [
             ('timing-output=', None, 'Toggle timing output.'),
+            ('trace-output=', None, 'Toggle Chrome trace output of the timed scopes.'),
             ('fftw-estimate=', None, 'Use FFTW ESTIMATE.'),
             ('disable-fftw-omp=', None, 'Turn Off FFTW OpenMP.'),
             ]
     def initialize_options(self):
         self.timing_output = 0
+        self.trace_output = 0
         self.fftw_estimate = 0
         self.disable_fftw_omp = 0
         return None
     def finalize_options(self):
         self.timing_output = (int(self.timing_output) == 1)
+        self.trace_output = (int(self.trace_output) == 1)
         self.fftw_estimate = (int(self.fftw_estimate) == 1)
         self.disable_fftw_omp = (int(self.disable_fftw_omp) == 1)
         return None
@@ -215,6 +239,8 @@ class CompileLibCommand(distutils.cmd.Command):
         eca += ['-fPIC']
         if self.timing_output:
             eca += ['-DUSE_TIMINGOUTPUT']
+        if self.trace_output:
+            eca += ['-DUSE_TRACEOUTPUT']
         if self.fftw_estimate:
             eca += ['-DUSE_FFTWESTIMATE']
         if self.disable_fftw_omp:
@@ -0,0 +1,62 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+# relevant for results of "bfps TEST field_io_benchmark"
+
+import sys
+import h5py
+
+from bfps import TEST
+
+def main():
+    for n in [512, 1024]:
+        c = TEST()
+        c.launch(
+                ['field_io_benchmark',
+                 '-n', '{0}'.format(n),
+                 '--np', '8',
+                 '--ntpp', '1',
+                 '--precision', 'single',
+                 '--niterations', '2',
+                 '--simname', 'io_benchmark_{0}'.format(n),
+                 '--wd', './'] +
+                 sys.argv[1:])
+        with h5py.File(c.get_data_file_name(), 'r') as data_file:
+            configuration = data_file['io_configuration'][...]
+            bandwidth = data_file['io_bandwidth'][...]
+        for cc, bb in zip(configuration, bandwidth):
+            print('{0}^3 {1:7} {2:11} {3:10} compression {4}: write {5:.3f} GB/s, read {6:.3f} GB/s'.format(
+                n,
+                'real' if cc[0] else 'complex',
+                'collective' if cc[1] else 'independent',
+                'chunked' if cc[2] else 'contiguous',
+                cc[3],
+                bb[0], bb[1]))
+    return None
+
+if __name__ == '__main__':
+    main()
+
@@ -0,0 +1,63 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+
+# relevant for results of "bfps TEST particles_interpolation_benchmark"
+
+import sys
+import h5py
+
+from bfps import TEST
+
+def main():
+    c = TEST()
+    c.launch(
+            ['particles_interpolation_benchmark',
+             '-n', '128',
+             '--np', '4',
+             '--ntpp', '1',
+             '--nparticles', '{0}'.format(10**6),
+             '--niterations', '4',
+             '--max_neighbours', '5',
+             '--simname', 'interpolation_benchmark',
+             '--wd', './'] +
+             sys.argv[1:])
+    with h5py.File(c.get_data_file_name(), 'r') as data_file:
+        rate = data_file['interpolation_rate'][...]
+        rate_cell_order = data_file['interpolation_rate_cell_order'][...]
+    print('neighbours  smoothness  interpolations/s  cell ordered  speedup')
+    for neighbours in range(rate.shape[0]):
+        for smoothness in range(rate.shape[1]):
+            print('{0:10d}  {1:10d}  {2:16.4e}  {3:12.4e}  {4:7.2f}'.format(
+                neighbours + 1, smoothness,
+                rate[neighbours, smoothness],
+                rate_cell_order[neighbours, smoothness],
+                rate_cell_order[neighbours, smoothness] / rate[neighbours, smoothness]))
+    return None
+
+if __name__ == '__main__':
+    main()
+
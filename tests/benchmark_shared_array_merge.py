@@ -0,0 +1,58 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+# relevant for results of "bfps TEST shared_array_merge_benchmark"
+# thread counts go from 1 to the number of threads per process, by default
+# up to 128; use e.g. "--ntpp 64" for smaller nodes.
+
+import sys
+import h5py
+
+from bfps import TEST
+
+def main():
+    c = TEST()
+    c.launch(
+            ['shared_array_merge_benchmark',
+             '-n', '512',
+             '--np', '1',
+             '--ntpp', '128',
+             '--niterations', '8',
+             '--histogram_bins', '256',
+             '--simname', 'shared_array_merge_benchmark',
+             '--wd', './'] +
+             sys.argv[1:])
+    with h5py.File(c.get_data_file_name(), 'r') as data_file:
+        configuration = data_file['merge_configuration'][...]
+        timing = data_file['merge_time'][...]
+    for cc, tt in zip(configuration, timing):
+        print('{0:3} threads, {1:8} values: fill {2:.2e} s, merge {3:.2e} s, mergeParallel {4:.2e} s, speedup {5:.2f}'.format(
+            cc[0], cc[1], tt[0], tt[1], tt[2], tt[1] / tt[2]))
+    return None
+
+if __name__ == '__main__':
+    main()
+
@@ -0,0 +1,63 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+# relevant for results of "bfps TEST vorticity_equation_scaling_benchmark"
+# FFTW slabs stop at nz processes, PENCIL decompositions keep going
+
+import sys
+import h5py
+
+from bfps import TEST
+
+def main():
+    nprocesses = [16, 64, 256, 1024]
+    step_time = {}
+    for nb_processes in nprocesses:
+        c = TEST()
+        c.launch(
+                ['vorticity_equation_scaling_benchmark',
+                 '-n', '256',
+                 '--np', '{0}'.format(nb_processes),
+                 '--ntpp', '1',
+                 '--precision', 'double',
+                 '--niterations', '8',
+                 '--simname', 'scaling_benchmark_{0}'.format(nb_processes),
+                 '--wd', './'] +
+                 sys.argv[1:])
+        with h5py.File(c.get_data_file_name(), 'r') as data_file:
+            step_time[nb_processes] = data_file['step_time'][...]
+    print('processes   FFTW slabs   PENCIL (s per step)')
+    for nb_processes in nprocesses:
+        slab_time = step_time[nb_processes][0]
+        print('{0:9d}   {1:>10}   {2:.4f}'.format(
+            nb_processes,
+            '{0:.4f}'.format(slab_time) if slab_time >= 0 else '-',
+            step_time[nb_processes][1]))
+    return None
+
+if __name__ == '__main__':
+    main()
+
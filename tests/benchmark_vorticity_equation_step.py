@@ -0,0 +1,55 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+
+# relevant for results of "bfps TEST vorticity_equation_step_benchmark"
+
+import sys
+import h5py
+
+from bfps import TEST
+
+def main():
+    c = TEST()
+    c.launch(
+            ['vorticity_equation_step_benchmark',
+             '-n', '512',
+             '--np', '8',
+             '--ntpp', '2',
+             '--precision', 'double',
+             '--niterations', '8',
+             '--simname', 'step_benchmark',
+             '--wd', './'] +
+             sys.argv[1:])
+    with h5py.File(c.get_data_file_name(), 'r') as data_file:
+        step_time = data_file['step_time'][...]
+    print('per mode integrating factors:  {0:.4f} s per step'.format(step_time[0]))
+    print('tabulated integrating factors: {0:.4f} s per step'.format(step_time[1]))
+    return None
+
+if __name__ == '__main__':
+    main()
+
@@ -0,0 +1,142 @@
+#! /usr/bin/env python
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+# Scaling of the ghost slice exchange of the buffered `interpolator`
+# (interpolator::read_rFFTW), from --min_ncpu to --max_ncpu processes.
+# nz is fixed so that every slab holds neighbours+1 slices at --max_ncpu,
+# and nx, ny are kept small, so that every process exchanges the same
+# amount of data whatever the number of processes: the exchange time
+# should not grow with the number of processes.
+# The exchange times are read from the trace files, so bfps must be
+# compiled with --trace-output=1; otherwise only the run times are shown.
+
+import os
+import glob
+import json
+import time
+
+from base import *
+
+parser.add_argument('--min_ncpu',
+        type = int, dest = 'min_ncpu', default = 4)
+parser.add_argument('--max_ncpu',
+        type = int, dest = 'max_ncpu', default = 512)
+
+def read_rFFTW_time(c):
+    """Mean time of one exchange on the slowest process, None without traces."""
+    trace_files = glob.glob(os.path.join(c.work_dir, c.simname + '_trace_*.json'))
+    if len(trace_files) == 0:
+        return None
+    max_time = 0.
+    for trace_file in trace_files:
+        events = [ee for ee in json.load(open(trace_file, 'r'))['traceEvents']
+                  if ee['name'] == 'interpolator::read_rFFTW']
+        if len(events) > 0:
+            max_time = max(max_time,
+                           sum(ee['dur'] for ee in events)*1e-6 / len(events))
+    return max_time
+
+def launch_interpolator(opt, nz):
+    c = bfps.NavierStokes(
+            name = 'test_interpolator_scaling',
+            work_dir = opt.work_dir,
+            fluid_precision = opt.precision,
+            use_fftw_wisdom = False,
+            frozen_fields = True)
+    c.pars_from_namespace(opt)
+    c.parameters['nx'] = opt.n
+    c.parameters['ny'] = opt.n
+    c.parameters['nz'] = nz
+    c.parameters['dkz'] = float(opt.n) / nz
+    c.parameters['niter_out'] = c.parameters['niter_todo']
+    c.fill_up_fluid_code()
+    c.add_interpolator(
+            name = 'spline',
+            neighbours = opt.neighbours,
+            smoothness = opt.smoothness,
+            class_name = 'interpolator')
+    c.add_particles(
+            integration_steps = 2,
+            interpolator = 'spline',
+            class_name = 'particles')
+    c.finalize_code()
+    c.write_src()
+    c.write_par()
+    c.set_host_info({'type' : 'pc'})
+    c.generate_vector_field(write_to_file = True,
+                            spectra_slope = 2.0,
+                            amplitude = 0.25)
+    c.generate_tracer_state(
+            species = 0,
+            write_to_file = False,
+            testing = True,
+            rseed = 3284)
+    t0 = time.time()
+    c.run(ncpu = opt.ncpu)
+    return c, time.time() - t0
+
+def interpolator_scaling(opt):
+    wd = opt.work_dir
+    nz = opt.max_ncpu*(opt.neighbours + 1)
+    results = []
+    c0 = None
+    ncpu = opt.min_ncpu
+    while ncpu <= opt.max_ncpu:
+        opt.ncpu = ncpu
+        opt.work_dir = wd + '/nz{0:0>5}_ncpu{1:0>4}'.format(nz, ncpu)
+        c, run_time = launch_interpolator(opt, nz)
+        state = c.get_particle_file()['tracers0/state'][...]
+        if c0 is None:
+            c0 = c
+            state0 = state
+        results.append((ncpu, run_time, read_rFFTW_time(c),
+                        np.max(np.abs(state - state0))))
+        ncpu *= 2
+    print('nx = ny = {0}, nz = {1}, neighbours = {2}'.format(opt.n, nz, opt.neighbours))
+    print(' ncpu  run time (s)  read_rFFTW (s)  max pos difference')
+    for ncpu, run_time, exchange_time, pos_diff in results:
+        print('{0:5d}  {1:12.3f}  {2:>14}  {3:18.3e}'.format(
+            ncpu, run_time,
+            'n/a' if exchange_time is None else '{0:.3e}'.format(exchange_time),
+            pos_diff))
+    return None
+
+if __name__ == '__main__':
+    opt = parser.parse_args(
+            ['-n', '32',
+             '--run',
+             '--neighbours', '1',
+             '--smoothness', '1',
+             '--nparticles', '10000',
+             '--niter_todo', '16',
+             '--niter_part', '1',
+             '--niter_stat', '1',
+             '--precision', 'single',
+             '--wd', 'data/interpolator_scaling'] +
+            sys.argv[1:])
+    interpolator_scaling(opt)
+
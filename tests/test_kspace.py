@@ -0,0 +1,60 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+# relevant for results of "bfps TEST kspace_test"
+
+import sys
+import h5py
+import numpy as np
+
+from bfps import TEST
+
+def main():
+    c = TEST()
+    # ny < nz: the largest |ky| is not bounded by ny/2 in the transposed layout
+    c.launch(
+            ['kspace_test',
+             '--nx', '32',
+             '--ny', '16',
+             '--nz', '48',
+             '--np', '2',
+             '--ntpp', '1',
+             '--simname', 'kspace_test',
+             '--wd', './'] +
+             sys.argv[1:])
+    with h5py.File(c.get_data_file_name(), 'r') as data_file:
+        nk2shells = data_file['kspace_test/nk2shells'][0]
+        errors = data_file['kspace_test/errors'][...]
+    print('nk2shells = {0}, modes outside the tables {1}, '
+          'wrong dealiasing factors {2}, wrong spectrum shells {3}'.format(
+              nk2shells, errors[0], errors[1], errors[2]))
+    assert(nk2shells > 0)
+    assert(np.all(errors == 0))
+    print('SUCCESS! kspace tables cover all the modes')
+    return None
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,57 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+
+# relevant for results of "bfps TEST vorticity_equation_mixed_precision_test"
+
+import sys
+import h5py
+
+from bfps import TEST
+
+def main():
+    c = TEST()
+    c.launch(
+            ['vorticity_equation_mixed_precision_test',
+             '-n', '64',
+             '--np', '4',
+             '--ntpp', '1',
+             '--precision', 'double',
+             '--niterations', '16',
+             '--simname', 'mixed_precision_test',
+             '--wd', './'] +
+             sys.argv[1:])
+    with h5py.File(c.get_data_file_name(), 'r') as data_file:
+        error_table = data_file['mixed_precision_error'][...]
+    print('dt          mixed precision error    time discretization error')
+    for dt, mixed_error, time_error in error_table:
+        print('{0:.2e}    {1:.3e}                {2:.3e}'.format(dt, mixed_error, time_error))
+    # single precision round off should not accumulate beyond a few digits
+    assert(error_table[:, 1].max() < 1e-4)
+    return None
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,60 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+
+# relevant for results of "bfps TEST particles_memory_test"
+
+import sys
+import h5py
+
+from bfps import TEST
+
+def main():
+    c = TEST()
+    c.launch(
+            ['particles_memory_test',
+             '-n', '64',
+             '--np', '8',
+             '--ntpp', '1',
+             '--nparticles', '{0}'.format(10**5),
+             '--niterations', '2000',
+             '--max_neighbours', '5',
+             '--simname', 'memory_test',
+             '--wd', './'] +
+             sys.argv[1:])
+    with h5py.File(c.get_data_file_name(), 'r') as data_file:
+        rss = data_file['rss_kB'][...]
+        rss_growth = data_file['rss_growth_kB'][...]
+    print('resident set size: first iteration {0} kB, last iteration {1} kB'.format(rss[0], rss[-1]))
+    print('largest growth after warm up: {0} kB'.format(rss_growth))
+    # buffers are reused, so memory must not grow with the number of iterations
+    assert(rss_growth < 4096)
+    print('SUCCESS! resident set size stays flat')
+    return None
+
+if __name__ == '__main__':
+    main()
+
@@ -0,0 +1,58 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+
+# relevant for results of "bfps TEST particles_redistribute_test"
+
+import sys
+import h5py
+
+from bfps import TEST
+
+def main():
+    c = TEST()
+    # 64 layers over 16 processes: 4 layers per slab, so that particles
+    # displaced by up to half the box go through several slabs
+    c.launch(
+            ['particles_redistribute_test',
+             '-n', '64',
+             '--np', '16',
+             '--ntpp', '1',
+             '--nparticles', '{0}'.format(10**5),
+             '--niterations', '8',
+             '--simname', 'redistribute_test',
+             '--wd', './'] +
+             sys.argv[1:])
+    with h5py.File(c.get_data_file_name(), 'r') as data_file:
+        errors = data_file['redistribute_errors'][...]
+    print('errors per iteration: {0}'.format(errors))
+    assert(errors.sum() == 0)
+    print('SUCCESS! particles were correctly redistributed')
+    return None
+
+if __name__ == '__main__':
+    main()
+
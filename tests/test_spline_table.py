@@ -0,0 +1,62 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+# relevant for results of "bfps TEST spline_table_test"
+
+import sys
+import h5py
+import numpy as np
+
+from bfps import TEST
+
+def main():
+    c = TEST()
+    c.launch(
+            ['spline_table_test',
+             '-n', '32',
+             '--np', '1',
+             '--ntpp', '1',
+             '--nparticles', '{0}'.format(10**5),
+             '--niterations', '8',
+             '--simname', 'spline_table_test',
+             '--wd', './'] +
+             sys.argv[1:])
+    with h5py.File(c.get_data_file_name(), 'r') as data_file:
+        kernel = data_file['spline_table_kernel'][...]
+        error = data_file['spline_table_error'][...]
+        rate = data_file['spline_table_rate'][...]
+    for kk, ee, rr in zip(kernel, error, rate):
+        print('neighbours {0:2}, {1:>13}: error {2:.1e} {3:.1e} {4:.1e}, speedup {5:.2f} {6:.2f} {7:.2f}'.format(
+            kk[0], 'Lagrange' if kk[1] < 0 else 'smoothness {0}'.format(kk[1]),
+            ee[0], ee[1], ee[2],
+            rr[0, 1] / rr[0, 0], rr[1, 1] / rr[1, 0], rr[2, 1] / rr[2, 0]))
+    # the generated functions round the large coefficients of the smoothest
+    # splines (in powers of x) to about 1e-9, the tables are exact to 1e-12
+    assert(np.max(error) < 1e-8)
+    print('SUCCESS! tables match the generated functions')
+    return None
+
+if __name__ == '__main__':
+    main()